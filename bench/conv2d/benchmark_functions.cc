@@ -37,6 +37,7 @@
 
 #include "sycldnn/conv2d/selector/direct_selector.h"
 #include "sycldnn/conv2d/selector/im2col_selector.h"
+#include "sycldnn/conv2d/selector/implicit_gemm_selector.h"
 #include "sycldnn/conv2d/selector/matmul_selector.h"
 #include "sycldnn/conv2d/selector/tiled_selector.h"
 #include "sycldnn/conv2d/selector/winograd_selector.h"
@@ -94,8 +95,13 @@
 
 BM_ALGO_WITH_SNNBACKEND(Direct)
 BM_ALGO_WITH_SNNBACKEND(Tiled)
+BM_ALGO_WITH_SNNBACKEND(TiledLocal)
+BM_ALGO_WITH_SNNBACKEND(ImplicitGemm)
 
 BM_WITH_ALGO(Im2col);
 BM_WITH_ALGO(Winograd);
 BM_WITH_ALGO(WinogradLarge);
+BM_WITH_ALGO(Winograd6x6);
+BM_WITH_ALGO(Winograd5x5);
+BM_WITH_ALGO(Winograd5x5Large);
 BM_WITH_ALGO(Matmul);
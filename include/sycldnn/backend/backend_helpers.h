@@ -69,6 +69,24 @@ struct supports_interleaved_matmul
     : std::integral_constant<bool,
                              std::is_same<Backend, SyclBLASBackend>::value> {};
 
+// Helper to check if the backend's matmul and batch_matmul accept alpha and a
+// matmul::Epilogue to apply in the output stage.
+template <typename Backend>
+struct supports_matmul_epilogue
+    : std::integral_constant<
+          bool,
+          std::is_same<Backend, SNNBackend>::value ||
+              std::is_same<Backend, SNNUSMBackend>::value> {};
+
+// Helper to check if the backend provides grouped_matmul, computing a group of
+// matmuls with shapes given in device memory in a single launch.
+template <typename Backend>
+struct supports_grouped_matmul
+    : std::integral_constant<
+          bool,
+          std::is_same<Backend, SNNBackend>::value ||
+              std::is_same<Backend, SNNUSMBackend>::value> {};
+
 }  // namespace backend
 }  // namespace sycldnn
 
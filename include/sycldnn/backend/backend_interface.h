@@ -116,6 +116,48 @@ struct InternalHandler {
       internal_pointer_type<T> const output, Index const n_batches,
       Index const m, Index const k, Index const n,
       sycldnn::BatchFormat const batch_type = sycldnn::BatchFormat::STRIDED);
+  /**
+   * Compute a batch of matrix multiplies with independent batch strides.
+   *
+   * Should perform the batched matrix multiply operation:
+   *   output[i] = alpha * lhs[i] * rhs[i] + beta * output[i]
+   * for 0 <= i < params.batches, where the matrices of each tensor are
+   * params.lhs_batch_stride, params.rhs_batch_stride and
+   * params.output_batch_stride elements apart. A stride of zero for lhs or
+   * rhs broadcasts a single matrix to every batch, and must not require the
+   * matrix to be copied. Each matrix is assumed to be contiguous in memory and
+   * in row-major format.
+   *
+   * BLAS libraries typically map this to a strided batched GEMM.
+   */
+  template <bool TransposeLHS, bool TransposeRHS, typename T>
+  cl::sycl::event strided_batch_matmul(
+      internal_pointer_type<const T> const lhs,
+      internal_pointer_type<const T> const rhs,
+      internal_pointer_type<T> const output,
+      matmul::MatmulParams const& params);
+  /**
+   * Compute a group of matrix multiplies with different shapes.
+   *
+   * The problems array holds params.n_problems descriptions, each giving the
+   * m, k and n of a problem and the offsets of its matrices in the lhs, rhs
+   * and output tensors. Should perform the grouped matrix multiply operation:
+   *   output[i] = alpha * lhs[i] * rhs[i] + beta * output[i]
+   * for 0 <= i < n_problems. Each matrix is assumed to be contiguous in memory
+   * and in row-major format. The `bool` template parameters determine whether
+   * or not to transpose the matrices.
+   *
+   * This is optional, and only provided by backends for which
+   * backend::supports_grouped_matmul is true. Other backends need one
+   * `matmul` call per problem, with the shapes known on the host.
+   */
+  template <bool TransposeLHS, bool TransposeRHS, typename T>
+  cl::sycl::event grouped_matmul(
+      internal_pointer_type<const T> const lhs,
+      internal_pointer_type<const T> const rhs,
+      internal_pointer_type<T> const output,
+      internal_pointer_type<matmul::GroupedMatmulProblem const> const problems,
+      matmul::GroupedMatmulParams const& params);
   /**
    * A wrapper around a call to reduce.
    *
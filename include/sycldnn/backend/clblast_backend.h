@@ -27,6 +27,7 @@
 #include "sycldnn/backend/device_mem_pointer.h"
 #include "sycldnn/backend/snn_reduce_provider.h"
 #include "sycldnn/helpers/macros.h"
+#include "sycldnn/matmul/params.h"
 
 #include "sycldnn/mem_object.h"
 
@@ -326,6 +327,82 @@ class CLBlastBackend final : public CommonBackend,
     });
     return ev;
   }
+
+  /**
+   * Compute a batch of matrix multiplies with independent batch strides.
+   *
+   * Should perform the batched matrix multiply operation:
+   *   output[i] = alpha * lhs[i] * rhs[i] + beta * output[i]
+   * for 0 <= i < params.batches, where the matrices of each tensor are
+   * separated by the batch strides in the params. A stride of zero for lhs or
+   * rhs uses the same matrix for every batch. Each matrix is assumed to be
+   * contiguous in memory and in row-major format. The `bool` template
+   * parameters determine whether or not to transpose the matrices.
+   *
+   * \param [in]     lhs    Pointer to a buffer containing the LHS matrices.
+   * \param [in]     rhs    Pointer to a buffer containing the RHS matrices.
+   * \param [in,out] output Pointer to a buffer containing the output
+   *                        matrices.
+   * \param [in]     params Sizes, scale factors and batch strides of the
+   *                        matmul.
+   *
+   * \return A SYCL event corresponding to the matmul kernel launch.
+   */
+  template <bool TransposeLHS, bool TransposeRHS, typename T>
+  cl::sycl::event strided_batch_matmul(
+      internal_pointer_type<const T> const lhs,
+      internal_pointer_type<const T> const rhs,
+      internal_pointer_type<T> const output,
+      sycldnn::matmul::MatmulParams const& params,
+      const std::vector<cl::sycl::event>& = {}) {
+    using namespace clblast;
+    auto const m = params.m;
+    auto const k = params.k;
+    auto const n = params.n;
+    auto const n_batches = params.batches;
+    auto lda = TransposeLHS ? m : k;
+    auto ldb = TransposeRHS ? k : n;
+    auto ldc = n;
+    size_t const a_stride = sycldnn::matmul::get_lhs_batch_stride(params);
+    size_t const b_stride = sycldnn::matmul::get_rhs_batch_stride(params);
+    size_t const o_stride = sycldnn::matmul::get_output_batch_stride(params);
+    auto transa = TransposeLHS ? Transpose::kYes : Transpose::kNo;
+    auto transb = TransposeRHS ? Transpose::kYes : Transpose::kNo;
+    auto a_buf = lhs.get_buffer();
+    auto b_buf = rhs.get_buffer();
+    auto o_buf = output.get_buffer();
+    auto a_offset = lhs.get_offset();
+    auto b_offset = rhs.get_offset();
+    auto o_offset = output.get_offset();
+    auto const alpha = static_cast<T>(params.alpha);
+    auto const beta = static_cast<T>(params.beta);
+
+    auto ev = queue_.submit([&](cl::sycl::codeplay::handler& cgh) {
+      using namespace cl::sycl::access;
+      auto a_acc = a_buf.template get_access<mode::read>(cgh);
+      auto b_acc = b_buf.template get_access<mode::read>(cgh);
+      auto o_acc = o_buf.template get_access<mode::read_write>(cgh);
+
+      cgh.interop_task([=](cl::sycl::codeplay::interop_handle const& han) {
+        auto a = han.get(a_acc);
+        auto b = han.get(b_acc);
+        auto o = han.get(o_acc);
+
+        cl_event e;
+        auto code = clblast::GemmStridedBatched(
+            clblast::Layout::kRowMajor, transa, transb, m, n, k, alpha, a,
+            a_offset, lda, a_stride, b, b_offset, ldb, b_stride, beta, o,
+            o_offset, ldc, o_stride, n_batches, &cl_queue_, &e);
+        if (code != clblast::StatusCode::kSuccess) {
+          std::string excep("Bad return code from CLBlast batch GEMM: ");
+          throw std::runtime_error(excep +
+                                   std::to_string(static_cast<int>(code)));
+        }
+        clWaitForEvents(1, &e);
+      });
+    });
+    return ev;
+  }
 };  // namespace backend
 
 }  // namespace backend
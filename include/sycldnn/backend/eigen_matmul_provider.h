@@ -25,6 +25,7 @@
 #include "sycldnn/backend/backend_traits.h"
 #include "sycldnn/backend/crtp_backend.h"
 #include "sycldnn/batch_format.h"
+#include "sycldnn/matmul/params.h"
 
 namespace sycldnn {
 namespace backend {
@@ -150,6 +151,77 @@ struct EigenMatmulProvider
     }
     return event;
   }
+
+  /**
+   * Compute a batch of matrix multiplies with independent batch strides.
+   *
+   * Perform the batched matrix multiply operation:
+   * \code
+   *   output[i] = alpha * lhs[i] * rhs[i] + beta * output[i]
+   * \endcode
+   * for 0 <= i < params.batches, where the matrices of each tensor are
+   * separated by the batch strides in the params. A stride of zero for lhs or
+   * rhs uses the same matrix for every batch. Each matrix is assumed to be
+   * contiguous in memory and in row-major format. The `bool` template
+   * parameters determine whether or not to transpose the matrices.
+   * As Eigen Tensor does not have a batch matrix multiply, each matrix
+   * multiply is computed separately.
+   *
+   * \param [in]     lhs    Pointer to a buffer containing the LHS matrices.
+   * \param [in]     rhs    Pointer to a buffer containing the RHS matrices.
+   * \param [in,out] output Pointer to a buffer containing the output
+   *                        matrices.
+   * \param [in]     params Sizes, scale factors and batch strides of the
+   *                        matmul.
+   * \return A SYCL event corresponding to the matmul kernel launch.
+   */
+  template <bool TransposeLHS, bool TransposeRHS, typename T>
+  cl::sycl::event strided_batch_matmul(
+      T const* const lhs, T const* const rhs, T* const output,
+      sycldnn::matmul::MatmulParams const& params,
+      const std::vector<cl::sycl::event>& = {}) {
+    using Index = sycldnn::matmul::MatmulParams::Index;
+    static constexpr auto lhs_dim = TransposeLHS ? 0 : 1;
+    static constexpr auto rhs_dim = TransposeRHS ? 1 : 0;
+    using ConstTensorType = Eigen::Tensor<T const, 2, Eigen::RowMajor, Index>;
+    using ConstTensor = Eigen::TensorMap<ConstTensorType>;
+    using TensorType = Eigen::Tensor<T, 2, Eigen::RowMajor, Index>;
+    using Tensor = Eigen::TensorMap<TensorType>;
+    using TensorShape = Eigen::DSizes<Index, 2>;
+    using ContractDims =
+        Eigen::IndexPairList<Eigen::type2indexpair<lhs_dim, rhs_dim>>;
+
+    auto eigen_device = this->underlying_backend().get_eigen_device();
+
+    Index const m = params.m;
+    Index const k = params.k;
+    Index const n = params.n;
+    TensorShape const lhs_shape{TransposeLHS ? k : m, TransposeLHS ? m : k};
+    TensorShape const rhs_shape{TransposeRHS ? n : k, TransposeRHS ? k : n};
+    TensorShape const out_shape{m, n};
+
+    Index const lhs_stride = sycldnn::matmul::get_lhs_batch_stride(params);
+    Index const rhs_stride = sycldnn::matmul::get_rhs_batch_stride(params);
+    Index const out_stride = sycldnn::matmul::get_output_batch_stride(params);
+    auto const alpha = static_cast<T>(params.alpha);
+    auto const beta = static_cast<T>(params.beta);
+
+    for (Index i = 0; i < params.batches; ++i) {
+      ConstTensor lhs_tensor{lhs + lhs_stride * i, lhs_shape};
+      ConstTensor rhs_tensor{rhs + rhs_stride * i, rhs_shape};
+      Tensor out_tensor{output + out_stride * i, out_shape};
+      if (beta == static_cast<T>(0)) {
+        out_tensor.device(eigen_device) =
+            alpha * lhs_tensor.contract(rhs_tensor, ContractDims{});
+      } else {
+        out_tensor.device(eigen_device) =
+            beta * out_tensor +
+            alpha * lhs_tensor.contract(rhs_tensor, ContractDims{});
+      }
+    }
+    // Eigen does not provide a way to access the SYCL event from kernels.
+    return cl::sycl::event{};
+  }
 };
 
 }  // namespace backend
@@ -19,6 +19,8 @@
 #include "sycldnn/backend/backend_traits.h"
 #include "sycldnn/internal/helpers/types.h"
 
+#include <vector>
+
 namespace sycldnn {
 namespace backend {
 namespace internal {
@@ -60,6 +62,79 @@ struct InternalBackend {
     return underlying_backend.get_mem_object(ptr, n_elems);
   }
 
+  /** The internal pointer type matches the forwarded pointer type. */
+  template <typename T>
+  using internal_pointer_type = pointer_type<T>;
+
+  /** \copydoc get_mem_object */
+  template <typename T>
+  auto get_mem_object_internal(internal_pointer_type<T> ptr, size_t n_elems)
+      -> decltype(std::declval<Backend>().get_mem_object_internal(ptr,
+                                                                  n_elems)) {
+    return underlying_backend.get_mem_object_internal(ptr, n_elems);
+  }
+
+  /**
+   * Allocate a temporary buffer using the underlying backend, such as the
+   * workspace used by the matmul launcher.
+   *
+   * \param [in] n_elems Number of elements to allocate.
+   * \return Pointer to the allocation.
+   */
+  template <typename T>
+  internal_pointer_type<T> allocate(size_t n_elems) {
+    return underlying_backend.template allocate<T>(n_elems);
+  }
+
+  /**
+   * Deallocate a temporary buffer returned from \ref allocate, once the given
+   * events have completed. Only provided by backends which pool their
+   * allocations, such as the SNNUSMBackend.
+   *
+   * \param [in] ptr    Pointer to deallocate.
+   * \param [in] events Events of the kernels which still use the allocation.
+   */
+  template <typename T>
+  void deallocate(internal_pointer_type<T> ptr,
+                  std::vector<cl::sycl::event> events) {
+    underlying_backend.template deallocate<T>(ptr, std::move(events));
+  }
+
+  /**
+   * Get the workspace arena of the underlying backend. Only provided by
+   * backends which own an arena, such as the SNNUSMBackend.
+   *
+   * \return The workspace arena used for operator scratch memory.
+   */
+  template <typename B = Backend>
+  auto get_workspace_arena()
+      -> decltype(std::declval<B&>().get_workspace_arena()) {
+    return underlying_backend.get_workspace_arena();
+  }
+
+  /**
+   * Pointers are already in the internal representation, so no conversion is
+   * needed.
+   *
+   * \param [in] ptr Pointer to convert.
+   * \return The provided pointer.
+   */
+  template <typename T>
+  internal_pointer_type<T> to_internal_pointer(pointer_type<T> ptr) {
+    return ptr;
+  }
+
+  /**
+   * Release an internal pointer, which is either an allocation returned from
+   * \ref allocate or a pointer returned from \ref to_internal_pointer.
+   *
+   * \param [in] ptr Pointer to release.
+   */
+  template <typename T>
+  void release_internal_pointer(internal_pointer_type<T> ptr) {
+    underlying_backend.release_internal_pointer(ptr);
+  }
+
   /**
    * \brief Get the underlying queue
    *
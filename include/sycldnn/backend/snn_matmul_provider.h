@@ -19,12 +19,15 @@
 /**
  * \file
  * Contains the implementation of \ref sycldnn::backend::SNNMatmulProvider,
- * which provides matmul and batch_matmul implementations using the internal
- * SYCL-DNN matmul kernels.
+ * which provides matmul, batch_matmul and grouped_matmul implementations using
+ * the internal SYCL-DNN matmul kernels.
  */
 
 #include "sycldnn/backend/backend_traits.h"
 #include "sycldnn/backend/internal_backend.h"
+#include "sycldnn/matmul/epilogue.h"
+#include "sycldnn/matmul/grouped_launch.h"
+#include "sycldnn/matmul/grouped_params.h"
 #include "sycldnn/matmul/launch.h"
 #include "sycldnn/matmul/params.h"
 
@@ -32,8 +35,8 @@ namespace sycldnn {
 namespace backend {
 
 /**
- * CRTP module to provide matmul and batch_matmul implementations using the
- * internal SYCL-DNN kernels.
+ * CRTP module to provide matmul, batch_matmul and grouped_matmul
+ * implementations using the internal SYCL-DNN kernels.
  */
 template <typename Backend>
 struct SNNMatmulProvider {
@@ -43,6 +46,24 @@ struct SNNMatmulProvider {
   using internal_pointer_type =
       typename BackendTraits<Backend>::template internal_pointer_type<T>;
 
+  /** The epilogue type accepted by the internal matmul launcher. */
+  template <typename T>
+  using internal_epilogue_type =
+      sycldnn::matmul::Epilogue<T, internal::InternalBackend<Backend>>;
+
+  /**
+   * Convert an epilogue to use the internal backend. The SNN backend uses the
+   * same pointer type internally and externally, so the bias is unchanged.
+   */
+  template <typename T>
+  static internal_epilogue_type<T> to_internal_epilogue(
+      sycldnn::matmul::Epilogue<T, Backend> const& epilogue) {
+    internal_epilogue_type<T> internal_epilogue;
+    internal_epilogue.bias = epilogue.bias;
+    internal_epilogue.activation = epilogue.activation;
+    return internal_epilogue;
+  }
+
  public:
   /**
    * A wrapper around a call to GEMM.
@@ -82,6 +103,53 @@ struct SNNMatmulProvider {
     return status.event;
   }
 
+  /**
+   * A wrapper around a call to GEMM, with a fused epilogue.
+   *
+   * Perform the matrix multiply operation:
+   * \code
+   *   output = epilogue(alpha * lhs * rhs + beta * output)
+   * \endcode
+   * where lhs is a [m x k] matrix, rhs is a [k x n] matrix and the epilogue
+   * adds a bias to each column of the output and applies an activation. The
+   * `bool` template parameters determine whether or not to transpose the
+   * matrices. The matrices provided here are assumed to be in row-major
+   * ordering.
+   *
+   * \param [in]     lhs      Pointer to a buffer containing the LHS matrix.
+   * \param [in]     rhs      Pointer to a buffer containing the RHS matrix.
+   * \param [in,out] output   Pointer to a buffer containing the output
+   *                          matrix.
+   * \param [in]     alpha    Scale multiplier for the matrix product.
+   * \param [in]     beta     Scale multiplier for the output matrix.
+   * \param [in]     m        Number of rows in the LHS matrix.
+   * \param [in]     k        Number of columns in the LHS matrix and rows in
+   *                          the RHS matrix.
+   * \param [in]     n        Number of columns in the RHS matrix.
+   * \param [in]     epilogue Operations to apply to the output values.
+   *
+   * \return A SYCL event corresponding to the matmul kernel launch.
+   */
+  template <bool TransposeLHS, bool TransposeRHS, typename T, typename Index>
+  cl::sycl::event matmul(
+      internal_pointer_type<const T> const lhs,
+      internal_pointer_type<const T> const rhs,
+      internal_pointer_type<T> const output, T const alpha, T const beta,
+      Index const m, Index const k, Index const n,
+      sycldnn::matmul::Epilogue<T, Backend> const& epilogue,
+      const std::vector<cl::sycl::event>& = {}) {
+    auto& underlying_backend = static_cast<Backend&>(*this);
+    internal::InternalBackend<Backend> internal_backend{underlying_backend};
+    sycldnn::matmul::MatmulParams params{1, m, k, n, beta};
+    params.alpha = alpha;
+    auto status = matmul::launch<T, TransposeLHS, TransposeRHS>(
+        lhs, rhs, output, params, internal_backend,
+        to_internal_epilogue(epilogue));
+    SNN_ASSERT(status.status == StatusCode::OK,
+               "Error launching matmul kernel.");
+    return status.event;
+  }
+
   /**
    * Compute a batch of matrix multiplies.
    *
@@ -129,6 +197,141 @@ struct SNNMatmulProvider {
                "Error launching matmul kernel.");
     return status.event;
   }
+
+  /**
+   * Compute a batch of matrix multiplies, with a fused epilogue.
+   *
+   * Perform the batched matrix multiply operation:
+   * \code
+   *   output[i] = epilogue(alpha * lhs[i] * rhs[i])
+   * \endcode
+   * for 0 <= i < batch, where lhs is a [batch x m x k] tensor, rhs is a
+   * [batch x k x n] tensor and the epilogue adds a bias to each column of the
+   * output and applies an activation. The same bias is used for every batch.
+   * Each matrix is assumed to be contiguous in memory and in row-major format.
+   * The `bool` template parameters determine whether or not to transpose the
+   * matrices.
+   *
+   * \param [in]     lhs        Pointer to a buffer containing the LHS matrix.
+   * \param [in]     rhs        Pointer to a buffer containing the RHS matrix.
+   * \param [in,out] output     Pointer to a buffer containing the output
+   *                            matrix.
+   * \param [in]     n_batches  Number of matrices in each tensor.
+   * \param [in]     m          Number of rows in the LHS matrix.
+   * \param [in]     k          Number of columns in the LHS matrix and rows in
+   *                            the RHS matrix.
+   * \param [in]     n          Number of columns in the RHS matrix.
+   * \param [in]     alpha      Scale multiplier for the matrix products.
+   * \param [in]     epilogue   Operations to apply to the output values.
+   * \param [in]     batch_type Format indicating how the batches are layed out.
+   *
+   * \return A SYCL event corresponding to the matmul kernel launch.
+   */
+  template <bool TransposeLHS, bool TransposeRHS, typename T, typename Index>
+  cl::sycl::event batch_matmul(
+      internal_pointer_type<const T> const lhs,
+      internal_pointer_type<const T> const rhs,
+      internal_pointer_type<T> const output, Index const n_batches,
+      Index const m, Index const k, Index const n, T const alpha,
+      sycldnn::matmul::Epilogue<T, Backend> const& epilogue,
+      sycldnn::BatchFormat const batch_type = sycldnn::BatchFormat::STRIDED,
+      const std::vector<cl::sycl::event>& = {}) {
+    if (batch_type != sycldnn::BatchFormat::STRIDED) {
+      throw std::runtime_error(
+          "SNN batch matmul only supports strided batch format.");
+    }
+    auto& underlying_backend = static_cast<Backend&>(*this);
+    internal::InternalBackend<Backend> internal_backend{underlying_backend};
+    sycldnn::matmul::MatmulParams params{n_batches, m, k, n, T{0}};
+    params.alpha = alpha;
+    auto status = matmul::launch<T, TransposeLHS, TransposeRHS>(
+        lhs, rhs, output, params, internal_backend,
+        to_internal_epilogue(epilogue));
+    SNN_ASSERT(status.status == StatusCode::OK,
+               "Error launching matmul kernel.");
+    return status.event;
+  }
+
+  /**
+   * Compute a batch of matrix multiplies with independent batch strides.
+   *
+   * Perform the batched matrix multiply operation:
+   * \code
+   *   output[i] = alpha * lhs[i] * rhs[i] + beta * output[i]
+   * \endcode
+   * for 0 <= i < params.batches, where the matrices of each tensor are
+   * separated by the batch strides in the params. A stride of zero for lhs or
+   * rhs uses the same matrix for every batch, without copying it. Each matrix
+   * is assumed to be contiguous in memory and in row-major format. The `bool`
+   * template parameters determine whether or not to transpose the matrices.
+   *
+   * \param [in]     lhs    Pointer to a buffer containing the LHS matrices.
+   * \param [in]     rhs    Pointer to a buffer containing the RHS matrices.
+   * \param [in,out] output Pointer to a buffer containing the output
+   *                        matrices.
+   * \param [in]     params Sizes, scale factors and batch strides of the
+   *                        matmul.
+   *
+   * \return A SYCL event corresponding to the matmul kernel launch.
+   */
+  template <bool TransposeLHS, bool TransposeRHS, typename T>
+  cl::sycl::event strided_batch_matmul(
+      internal_pointer_type<const T> const lhs,
+      internal_pointer_type<const T> const rhs,
+      internal_pointer_type<T> const output,
+      sycldnn::matmul::MatmulParams const& params,
+      const std::vector<cl::sycl::event>& = {}) {
+    auto& underlying_backend = static_cast<Backend&>(*this);
+    internal::InternalBackend<Backend> internal_backend{underlying_backend};
+    auto status = matmul::launch<T, TransposeLHS, TransposeRHS>(
+        lhs, rhs, output, params, internal_backend);
+    SNN_ASSERT(status.status == StatusCode::OK,
+               "Error launching matmul kernel.");
+    return status.event;
+  }
+
+  /**
+   * Compute a group of matrix multiplies with different shapes.
+   *
+   * Perform the grouped matrix multiply operation:
+   * \code
+   *   output[i] = alpha * lhs[i] * rhs[i] + beta * output[i]
+   * \endcode
+   * for 0 <= i < n_problems, where the shape of each problem and the offsets
+   * of its matrices in the lhs, rhs and output tensors are given by the
+   * problem descriptions in device memory. Each matrix is assumed to be
+   * contiguous in memory and in row-major format. The `bool` template
+   * parameters determine whether or not to transpose the matrices.
+   *
+   * All of the problems are computed in a single kernel launch.
+   *
+   * \param [in]     lhs      Pointer to a buffer containing the LHS matrices.
+   * \param [in]     rhs      Pointer to a buffer containing the RHS matrices.
+   * \param [in,out] output   Pointer to a buffer containing the output
+   *                          matrices.
+   * \param [in]     problems Pointer to a buffer containing the problem
+   *                          descriptions.
+   * \param [in]     params   Parameters shared by all of the problems.
+   *
+   * \return A SYCL event corresponding to the matmul kernel launch.
+   */
+  template <bool TransposeLHS, bool TransposeRHS, typename T>
+  cl::sycl::event grouped_matmul(
+      internal_pointer_type<const T> const lhs,
+      internal_pointer_type<const T> const rhs,
+      internal_pointer_type<T> const output,
+      internal_pointer_type<sycldnn::matmul::GroupedMatmulProblem const> const
+          problems,
+      sycldnn::matmul::GroupedMatmulParams const& params,
+      const std::vector<cl::sycl::event>& = {}) {
+    auto& underlying_backend = static_cast<Backend&>(*this);
+    internal::InternalBackend<Backend> internal_backend{underlying_backend};
+    auto status = matmul::launch_grouped<T, TransposeLHS, TransposeRHS>(
+        lhs, rhs, output, problems, params, internal_backend);
+    SNN_ASSERT(status.status == StatusCode::OK,
+               "Error launching grouped matmul kernel.");
+    return status.event;
+  }
 };
 
 }  // namespace backend
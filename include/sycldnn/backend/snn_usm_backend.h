@@ -20,9 +20,13 @@
 #include "sycldnn/backend/device_mem_pointer.h"
 #include "sycldnn/backend/snn_usm_matmul_provider.h"
 #include "sycldnn/backend/snn_usm_reduce_provider.h"
+#include "sycldnn/backend/usm_memory_pool.h"
+#include "sycldnn/backend/workspace_arena.h"
 
 #include <CL/sycl.hpp>
+#include <memory>
 #include <numeric>
+#include <vector>
 
 namespace sycldnn {
 namespace backend {
@@ -74,10 +78,22 @@ struct SNNUSMBackend final : public CommonBackend,
    * Construct an SNNUSMBackend with the given queue. All SYCL-DNN operations
    * launched with this backend will be submitted to this queue.
    *
-   * \param queue The SYCL queue to use with this backend.
+   * Device memory allocated through the backend is taken from a pool, and
+   * operator scratch memory from a workspace arena, which are both shared by
+   * all copies of the backend.
+   *
+   * \param queue              The SYCL queue to use with this backend.
+   * \param max_retained_bytes The maximum number of released bytes the
+   *                           memory pool caches for reuse.
    */
-  SNNUSMBackend(cl::sycl::queue queue)
-      : CommonBackend{queue}, queue_{std::move(queue)} {}
+  SNNUSMBackend(cl::sycl::queue queue,
+                size_t max_retained_bytes =
+                    USMMemoryPool::default_max_retained_bytes)
+      : CommonBackend{queue},
+        queue_{std::move(queue)},
+        memory_pool_{
+            std::make_shared<USMMemoryPool>(queue_, max_retained_bytes)},
+        workspace_arena_{std::make_shared<WorkspaceArena>(memory_pool_)} {}
 
   /**
    * Allocate a tensor to be used internally.
@@ -87,16 +103,83 @@ struct SNNUSMBackend final : public CommonBackend,
    * */
   template <typename T>
   internal_pointer_type<T> allocate(size_t n_elems) {
-    return cl::sycl::malloc_device<T>(n_elems, queue_);
+    return static_cast<T*>(memory_pool_->allocate(n_elems * sizeof(T)));
   }
 
   /**
-   * Deallocate an internal tensor.
+   * Deallocate an internal tensor. The memory may be reused immediately, so
+   * no kernels may still be using it.
    * \param ptr A pointer to the allocation to deallocate.
    */
   template <typename T>
   void deallocate(internal_pointer_type<T> ptr) {
-    cl::sycl::free(ptr, queue_);
+    memory_pool_->deallocate(ptr);
+  }
+
+  /**
+   * Deallocate an internal tensor once the given events have completed. This
+   * does not block, and the memory is not reused until the events complete.
+   * \param ptr    A pointer to the allocation to deallocate.
+   * \param events Events of the kernels which still use the allocation.
+   */
+  template <typename T>
+  void deallocate(internal_pointer_type<T> ptr,
+                  std::vector<cl::sycl::event> events) {
+    memory_pool_->deallocate(ptr, std::move(events));
+  }
+
+  /**
+   * Free the device memory cached by the backend's memory pool, waiting for
+   * any kernels still using it. The workspace arena block is first returned
+   * to the pool if no scratch memory is borrowed.
+   * \param target_bytes The number of cached bytes to keep.
+   * \return The number of bytes returned to the device.
+   */
+  size_t trim_memory_pool(size_t target_bytes = 0) {
+    workspace_arena_->release();
+    return memory_pool_->trim(target_bytes);
+  }
+
+  /**
+   * Get the counters of the backend's memory pool.
+   * \return The memory pool statistics.
+   */
+  USMMemoryPoolStats get_memory_pool_stats() const {
+    return memory_pool_->stats();
+  }
+
+  /**
+   * Set the maximum number of released bytes the backend's memory pool caches
+   * for reuse.
+   * \param max_bytes The maximum number of retained bytes.
+   */
+  void set_memory_pool_limit(size_t max_bytes) {
+    memory_pool_->set_max_retained_bytes(max_bytes);
+  }
+
+  /**
+   * Get the arena which operators launched with this backend borrow their
+   * scratch memory from.
+   * \return The backend's workspace arena.
+   */
+  WorkspaceArena& get_workspace_arena() { return *workspace_arena_; }
+
+  /**
+   * Grow the workspace arena so that it can hold at least n_bytes of scratch
+   * memory, for example the peak scratch memory recorded by an earlier run.
+   * \param n_bytes The number of scratch bytes to reserve.
+   */
+  void reserve_workspace(size_t n_bytes) {
+    workspace_arena_->reserve(n_bytes);
+  }
+
+  /**
+   * Get the counters of the workspace arena, including the peak scratch
+   * memory needed by each operator.
+   * \return The workspace arena statistics.
+   */
+  WorkspaceArenaStats get_workspace_stats() const {
+    return workspace_arena_->stats();
   }
 
   /**
@@ -160,6 +243,8 @@ struct SNNUSMBackend final : public CommonBackend,
 
  private:
   cl::sycl::queue queue_;
+  std::shared_ptr<USMMemoryPool> memory_pool_;
+  std::shared_ptr<WorkspaceArena> workspace_arena_;
 };
 
 }  // namespace backend
@@ -25,6 +25,7 @@
 #include "sycldnn/backend/common_backend.h"
 #include "sycldnn/batch_format.h"
 #include "sycldnn/helpers/macros.h"
+#include "sycldnn/matmul/params.h"
 #include "sycldnn/reduce/operators.h"
 
 #include "sycldnn/mem_object.h"
@@ -331,6 +332,55 @@ struct SyclBLASBackend final : public CommonBackend {
     return e;
   }
 
+  /**
+   * Compute a batch of matrix multiplies with independent batch strides.
+   *
+   * Should perform the batched matrix multiply operation:
+   *   output[i] = alpha * lhs[i] * rhs[i] + beta * output[i]
+   * for 0 <= i < params.batches, where the matrices of each tensor are
+   * separated by the batch strides in the params. A stride of zero for lhs or
+   * rhs uses the same matrix for every batch. Each matrix is assumed to be
+   * contiguous in memory and in row-major format. The `bool` template
+   * parameters determine whether or not to transpose the matrices.
+   *
+   * \param [in]     lhs    Pointer to a buffer containing the LHS matrices.
+   * \param [in]     rhs    Pointer to a buffer containing the RHS matrices.
+   * \param [in,out] output Pointer to a buffer containing the output
+   *                        matrices.
+   * \param [in]     params Sizes, scale factors and batch strides of the
+   *                        matmul.
+   *
+   * \return A SYCL event corresponding to the matmul kernel launch.
+   */
+  template <bool TransposeLHS, bool TransposeRHS, typename T>
+  cl::sycl::event strided_batch_matmul(
+      internal_pointer_type<const T> const lhs,
+      internal_pointer_type<const T> const rhs,
+      internal_pointer_type<T> const output,
+      sycldnn::matmul::MatmulParams const& params,
+      const std::vector<cl::sycl::event>& = {}) {
+    auto const m = params.m;
+    auto const k = params.k;
+    auto const n = params.n;
+    // We are flipping the lhs/rhs, so we need to flip m/n and the strides
+    auto trans_m = n;
+    auto trans_n = m;
+
+    auto ldc = trans_m;
+    auto lda = TransposeRHS ? k : trans_m;
+    auto ldb = TransposeLHS ? trans_n : k;
+    cl::sycl::event e =
+        blas::_gemm_strided_batched(
+            sb_handle_, TransposeRHS ? 't' : 'n', TransposeLHS ? 't' : 'n',
+            trans_m, trans_n, k, static_cast<T>(params.alpha), rhs, lda,
+            sycldnn::matmul::get_rhs_batch_stride(params), lhs, ldb,
+            sycldnn::matmul::get_lhs_batch_stride(params),
+            static_cast<T>(params.beta), output, ldc,
+            sycldnn::matmul::get_output_batch_stride(params), params.batches)
+            .back();
+    return e;
+  }
+
   /**
    * Compute a reduction.
    *
@@ -0,0 +1,348 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_BACKEND_USM_MEMORY_POOL_H_
+#define SYCLDNN_INCLUDE_BACKEND_USM_MEMORY_POOL_H_
+
+#include "sycldnn/helpers/macros.h"
+
+#include <CL/sycl.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * \file
+ * Contains the USMMemoryPool class, a caching allocator for USM device memory
+ * which reuses released allocations once the kernels using them complete.
+ */
+
+namespace sycldnn {
+namespace backend {
+
+/** Counters describing the state of a \ref USMMemoryPool. */
+struct USMMemoryPoolStats {
+  /** Number of bytes currently handed out by the pool. */
+  size_t bytes_in_use;
+  /** Number of bytes released to the pool and cached for reuse. */
+  size_t bytes_retained;
+  /** Largest number of device bytes held by the pool at any time. */
+  size_t peak_bytes;
+  /** Number of allocations which required a call to malloc_device. */
+  size_t device_allocations;
+  /** Number of allocations satisfied by reusing a cached block. */
+  size_t reused_allocations;
+  /** Number of blocks returned to the device with free. */
+  size_t device_frees;
+};
+
+/**
+ * A caching pool of USM device allocations bound to a single SYCL queue.
+ *
+ * Allocation sizes are rounded up to a bin size, and released blocks are kept
+ * in the bin so that later allocations of a similar size avoid calling into
+ * the driver. A released block can be given the events of the kernels which
+ * still use it, and it is only handed out again once those events complete.
+ *
+ * The number of bytes cached by the pool is capped. Blocks which do not fit
+ * under the cap are freed as soon as their events complete.
+ *
+ * The pool is safe to use from multiple threads.
+ */
+struct USMMemoryPool {
+  /** The default cap on the number of bytes cached by the pool. */
+  static constexpr size_t default_max_retained_bytes = size_t{256} << 20;
+
+  /**
+   * Construct a pool which allocates device memory for the given queue.
+   *
+   * \param queue              The queue to allocate memory for.
+   * \param max_retained_bytes The maximum number of released bytes to cache.
+   */
+  explicit USMMemoryPool(
+      cl::sycl::queue queue,
+      size_t max_retained_bytes = default_max_retained_bytes)
+      : queue_{std::move(queue)}, max_retained_bytes_{max_retained_bytes} {}
+
+  SNN_DISABLE_COPY(USMMemoryPool);
+  SNN_DISABLE_MOVE(USMMemoryPool);
+
+  /** Free all cached blocks, waiting for any kernels still using them. */
+  ~USMMemoryPool() { trim(0); }
+
+  /**
+   * Allocate device memory, reusing a cached block if one is available.
+   *
+   * \param n_bytes The number of bytes required.
+   * \return Pointer to the device memory, or nullptr if the device allocation
+   *         failed.
+   */
+  void* allocate(size_t n_bytes) {
+    size_t const size = bin_size(n_bytes);
+    std::lock_guard<std::mutex> lock{mutex_};
+    void* ptr = take_cached_block(size);
+    if (ptr) {
+      ++stats_.reused_allocations;
+    } else {
+      ptr = cl::sycl::malloc_device(size, queue_);
+      if (!ptr) {
+        // Give the memory held in completed cached blocks back to the device
+        // and try again.
+        release_completed_blocks(0);
+        ptr = cl::sycl::malloc_device(size, queue_);
+        if (!ptr) {
+          return nullptr;
+        }
+      }
+      ++stats_.device_allocations;
+    }
+    live_blocks_[ptr] = size;
+    stats_.bytes_in_use += size;
+    stats_.peak_bytes = std::max(stats_.peak_bytes,
+                                 stats_.bytes_in_use + stats_.bytes_retained);
+    return ptr;
+  }
+
+  /**
+   * Release device memory back to the pool.
+   *
+   * The block is not reused until all of the given events complete, so it is
+   * safe to release memory which is still used by kernels in flight.
+   * Pointers which were not allocated by the pool are freed once the events
+   * complete.
+   *
+   * \param ptr    Pointer returned from \ref allocate.
+   * \param events Events which must complete before the memory is reused.
+   */
+  void deallocate(void* ptr, std::vector<cl::sycl::event> events = {}) {
+    if (!ptr) {
+      return;
+    }
+    std::lock_guard<std::mutex> lock{mutex_};
+    auto live = live_blocks_.find(ptr);
+    if (live == live_blocks_.end()) {
+      free_after(ptr, std::move(events));
+      return;
+    }
+    size_t const size = live->second;
+    live_blocks_.erase(live);
+    stats_.bytes_in_use -= size;
+
+    if (size > max_retained_bytes_) {
+      free_after(ptr, std::move(events));
+      return;
+    }
+    if (stats_.bytes_retained + size > max_retained_bytes_) {
+      release_completed_blocks(max_retained_bytes_ - size);
+    }
+    if (stats_.bytes_retained + size > max_retained_bytes_) {
+      free_after(ptr, std::move(events));
+      return;
+    }
+    free_blocks_[size].push_back(CachedBlock{ptr, std::move(events)});
+    stats_.bytes_retained += size;
+  }
+
+  /**
+   * Free cached blocks until at most target_bytes remain cached.
+   *
+   * Blocks whose kernels have completed are freed first. If more memory needs
+   * to be freed, this waits for the kernels still using the cached blocks.
+   *
+   * \param target_bytes The number of cached bytes to keep.
+   * \return The number of bytes returned to the device.
+   */
+  size_t trim(size_t target_bytes = 0) {
+    std::lock_guard<std::mutex> lock{mutex_};
+    size_t const initial_bytes = stats_.bytes_retained;
+    release_completed_blocks(target_bytes);
+    for (auto bin = free_blocks_.rbegin();
+         bin != free_blocks_.rend() && stats_.bytes_retained > target_bytes;
+         ++bin) {
+      auto& blocks = bin->second;
+      while (!blocks.empty() && stats_.bytes_retained > target_bytes) {
+        for (auto& event : blocks.front().events) {
+          event.wait();
+        }
+        free_block(blocks.front().ptr, bin->first);
+        blocks.pop_front();
+      }
+    }
+    remove_empty_bins();
+    return initial_bytes - stats_.bytes_retained;
+  }
+
+  /**
+   * Get the current counters of the pool.
+   *
+   * \return The pool statistics.
+   */
+  USMMemoryPoolStats stats() const {
+    std::lock_guard<std::mutex> lock{mutex_};
+    return stats_;
+  }
+
+  /**
+   * Get the cap on the number of bytes cached by the pool.
+   *
+   * \return The maximum number of retained bytes.
+   */
+  size_t max_retained_bytes() const {
+    std::lock_guard<std::mutex> lock{mutex_};
+    return max_retained_bytes_;
+  }
+
+  /**
+   * Set the cap on the number of bytes cached by the pool, freeing any
+   * completed blocks above the new cap.
+   *
+   * \param max_bytes The maximum number of retained bytes.
+   */
+  void set_max_retained_bytes(size_t max_bytes) {
+    std::lock_guard<std::mutex> lock{mutex_};
+    max_retained_bytes_ = max_bytes;
+    release_completed_blocks(max_bytes);
+  }
+
+ private:
+  /** Smallest allocation made by the pool. */
+  static constexpr size_t min_bin_size = 512;
+  /**
+   * Allocations up to this size are rounded up to a power of two, while
+   * larger allocations are rounded up to a multiple of this size.
+   */
+  static constexpr size_t large_bin_granularity = size_t{1} << 20;
+
+  /** A released block, with the events which must complete before reuse. */
+  struct CachedBlock {
+    void* ptr;
+    std::vector<cl::sycl::event> events;
+  };
+
+  /** Get the size of the bin used for an allocation of n_bytes. */
+  static size_t bin_size(size_t n_bytes) {
+    if (n_bytes > large_bin_granularity) {
+      return (n_bytes + large_bin_granularity - 1) / large_bin_granularity *
+             large_bin_granularity;
+    }
+    size_t size = min_bin_size;
+    while (size < n_bytes) {
+      size *= 2;
+    }
+    return size;
+  }
+
+  /** Check whether all kernels using a cached block have completed. */
+  static bool is_complete(CachedBlock const& block) {
+    return std::all_of(
+        block.events.begin(), block.events.end(),
+        [](cl::sycl::event const& event) {
+          return event.get_info<
+                     cl::sycl::info::event::command_execution_status>() ==
+                 cl::sycl::info::event_command_status::complete;
+        });
+  }
+
+  /** Take the oldest completed block from the bin, or return nullptr. */
+  void* take_cached_block(size_t size) {
+    auto bin = free_blocks_.find(size);
+    if (bin == free_blocks_.end()) {
+      return nullptr;
+    }
+    auto& blocks = bin->second;
+    auto block = std::find_if(blocks.begin(), blocks.end(), is_complete);
+    if (block == blocks.end()) {
+      return nullptr;
+    }
+    void* ptr = block->ptr;
+    blocks.erase(block);
+    if (blocks.empty()) {
+      free_blocks_.erase(bin);
+    }
+    stats_.bytes_retained -= size;
+    return ptr;
+  }
+
+  /**
+   * Free completed cached blocks, largest first, until at most target_bytes
+   * remain cached.
+   */
+  void release_completed_blocks(size_t target_bytes) {
+    for (auto bin = free_blocks_.rbegin();
+         bin != free_blocks_.rend() && stats_.bytes_retained > target_bytes;
+         ++bin) {
+      auto& blocks = bin->second;
+      for (auto block = blocks.begin();
+           block != blocks.end() && stats_.bytes_retained > target_bytes;) {
+        if (is_complete(*block)) {
+          free_block(block->ptr, bin->first);
+          block = blocks.erase(block);
+        } else {
+          ++block;
+        }
+      }
+    }
+    remove_empty_bins();
+  }
+
+  /** Return a cached block to the device. */
+  void free_block(void* ptr, size_t size) {
+    cl::sycl::free(ptr, queue_);
+    stats_.bytes_retained -= size;
+    ++stats_.device_frees;
+  }
+
+  /** Free memory which is not cached, once the given events complete. */
+  void free_after(void* ptr, std::vector<cl::sycl::event> events) {
+    ++stats_.device_frees;
+    if (events.empty()) {
+      cl::sycl::free(ptr, queue_);
+      return;
+    }
+    auto queue = queue_;
+    queue_.submit([&](cl::sycl::handler& cgh) {
+      cgh.depends_on(events);
+      cgh.host_task([=]() { cl::sycl::free(ptr, queue); });
+    });
+  }
+
+  /** Remove any bins which no longer hold cached blocks. */
+  void remove_empty_bins() {
+    for (auto bin = free_blocks_.begin(); bin != free_blocks_.end();) {
+      if (bin->second.empty()) {
+        bin = free_blocks_.erase(bin);
+      } else {
+        ++bin;
+      }
+    }
+  }
+
+  cl::sycl::queue queue_;
+  size_t max_retained_bytes_;
+  std::map<size_t, std::deque<CachedBlock>> free_blocks_;
+  std::unordered_map<void*, size_t> live_blocks_;
+  USMMemoryPoolStats stats_{};
+  mutable std::mutex mutex_;
+};
+
+}  // namespace backend
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_INCLUDE_BACKEND_USM_MEMORY_POOL_H_
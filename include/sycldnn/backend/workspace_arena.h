@@ -0,0 +1,308 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_BACKEND_WORKSPACE_ARENA_H_
+#define SYCLDNN_INCLUDE_BACKEND_WORKSPACE_ARENA_H_
+
+#include "sycldnn/backend/usm_memory_pool.h"
+#include "sycldnn/helpers/macros.h"
+
+#include <CL/sycl.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * \file
+ * Contains the WorkspaceArena class, which hands out the scratch memory used
+ * by SYCL-DNN operators from a single device block owned by a backend.
+ */
+
+namespace sycldnn {
+namespace backend {
+
+/** Counters describing the state of a \ref WorkspaceArena. */
+struct WorkspaceArenaStats {
+  /** Size in bytes of the device block held by the arena. */
+  size_t capacity;
+  /** Largest number of scratch bytes borrowed at the same time. */
+  size_t high_water_bytes;
+  /** Number of scratch requests served from the arena block. */
+  size_t arena_borrows;
+  /** Number of scratch requests which did not fit and used the pool. */
+  size_t overflow_borrows;
+  /** Number of times the arena block was replaced by a larger one. */
+  size_t grows;
+  /** Largest single scratch request made by each operator. */
+  std::map<std::string, size_t> op_peak_bytes;
+};
+
+/**
+ * A region of scratch memory borrowed from a \ref WorkspaceArena.
+ *
+ * Kernels which use the region must depend on the lease's dependencies, as
+ * kernels of earlier operators may still be using the same memory.
+ */
+struct WorkspaceLease {
+  /** Pointer to the start of the region. */
+  void* ptr;
+  /** Size of the region in bytes. */
+  size_t n_bytes;
+  /** Events which must complete before the region is written. */
+  std::vector<cl::sycl::event> dependencies;
+  /** Whether the region was allocated from the pool instead of the arena. */
+  bool pooled;
+
+  /**
+   * Check whether the region was allocated.
+   *
+   * \return False if the device memory for the region could not be
+   *         allocated, in which case ptr is null.
+   */
+  bool valid() const { return ptr != nullptr; }
+};
+
+/**
+ * A scratch memory arena shared by all operators launched with a backend.
+ *
+ * Scratch requests made while other scratch regions are borrowed are carved
+ * out of one device block. When the last region is given back the whole block
+ * becomes free again, and the next requests reuse it once the kernels given
+ * with the returned regions complete. Rather than blocking the host, those
+ * kernel events are handed to later borrowers as dependencies.
+ *
+ * Requests which do not fit in the block are served by the memory pool, and
+ * the arena records the largest amount of scratch memory needed at once. The
+ * block is regrown to this high-water mark the next time the arena is idle,
+ * so that steady-state execution makes no device allocations.
+ *
+ * The arena is safe to use from multiple threads.
+ */
+struct WorkspaceArena {
+  /** Alignment in bytes of every region handed out by the arena. */
+  static constexpr size_t alignment = 256;
+
+  /**
+   * Construct an arena which takes its device memory from the given pool.
+   *
+   * \param pool The memory pool to allocate the arena block from.
+   */
+  explicit WorkspaceArena(std::shared_ptr<USMMemoryPool> pool)
+      : pool_{std::move(pool)} {}
+
+  SNN_DISABLE_COPY(WorkspaceArena);
+  SNN_DISABLE_MOVE(WorkspaceArena);
+
+  /** Return the arena block to the pool once its kernels complete. */
+  ~WorkspaceArena() {
+    if (block_) {
+      pool_->deallocate(block_, std::move(pending_events_));
+    }
+  }
+
+  /**
+   * Round a scratch size up to the alignment used by the arena.
+   *
+   * \param n_bytes The number of bytes required.
+   * \return The number of bytes taken from the arena for the request.
+   */
+  static size_t aligned_size(size_t n_bytes) {
+    return (n_bytes + alignment - 1) / alignment * alignment;
+  }
+
+  /**
+   * Borrow a region of scratch memory.
+   *
+   * \param n_bytes The number of bytes required.
+   * \param op_name Name of the operator making the request, used to record
+   *                the scratch memory needed by each operator.
+   * \return The borrowed region, which must be returned with \ref give_back.
+   *         The region is not valid if the device memory could not be
+   *         allocated.
+   */
+  WorkspaceLease borrow(size_t n_bytes, std::string const& op_name) {
+    size_t const size = aligned_size(n_bytes);
+    std::lock_guard<std::mutex> lock{mutex_};
+    auto& op_peak = stats_.op_peak_bytes[op_name];
+    op_peak = std::max(op_peak, size);
+
+    if (live_leases_ == 0) {
+      start_generation(size);
+    }
+    generation_bytes_ += size;
+    stats_.high_water_bytes =
+        std::max(stats_.high_water_bytes, generation_bytes_);
+
+    if (block_ && offset_ + size <= stats_.capacity) {
+      void* ptr = static_cast<char*>(block_) + offset_;
+      offset_ += size;
+      ++live_leases_;
+      ++stats_.arena_borrows;
+      return WorkspaceLease{ptr, size, pending_events_, false};
+    }
+    void* ptr = pool_->allocate(size);
+    if (ptr) {
+      ++stats_.overflow_borrows;
+    }
+    return WorkspaceLease{ptr, size, {}, true};
+  }
+
+  /**
+   * Give back a borrowed region of scratch memory.
+   *
+   * This does not block. The region is not reused until the given events
+   * complete.
+   *
+   * \param lease  The region returned from \ref borrow.
+   * \param events Events of the kernels which still use the region.
+   */
+  void give_back(WorkspaceLease const& lease,
+                 std::vector<cl::sycl::event> events) {
+    if (lease.pooled) {
+      pool_->deallocate(lease.ptr, std::move(events));
+      return;
+    }
+    std::lock_guard<std::mutex> lock{mutex_};
+    generation_events_.insert(generation_events_.end(), events.begin(),
+                              events.end());
+    --live_leases_;
+    if (live_leases_ == 0) {
+      pending_events_.insert(pending_events_.end(),
+                             generation_events_.begin(),
+                             generation_events_.end());
+      generation_events_.clear();
+    }
+  }
+
+  /**
+   * Ensure that the arena can hold at least n_bytes of scratch memory at
+   * once. The block is grown immediately if no scratch memory is borrowed,
+   * and otherwise the next time the arena is idle.
+   *
+   * \param n_bytes The number of scratch bytes to reserve.
+   */
+  void reserve(size_t n_bytes) {
+    std::lock_guard<std::mutex> lock{mutex_};
+    stats_.high_water_bytes =
+        std::max(stats_.high_water_bytes, aligned_size(n_bytes));
+    if (live_leases_ == 0) {
+      grow_to(stats_.high_water_bytes);
+    }
+  }
+
+  /**
+   * Return the arena block to the memory pool, so that the pool can free it.
+   *
+   * Nothing is released while scratch memory is borrowed. The high-water mark
+   * is reset, so the block is only regrown to the size of later requests.
+   *
+   * \return The number of bytes returned to the pool.
+   */
+  size_t release() {
+    std::lock_guard<std::mutex> lock{mutex_};
+    if (live_leases_ != 0 || !block_) {
+      return 0;
+    }
+    pool_->deallocate(block_, std::move(pending_events_));
+    pending_events_.clear();
+    block_ = nullptr;
+    size_t const released = stats_.capacity;
+    stats_.capacity = 0;
+    stats_.high_water_bytes = 0;
+    return released;
+  }
+
+  /**
+   * Get the current counters of the arena.
+   *
+   * \return The arena statistics.
+   */
+  WorkspaceArenaStats stats() const {
+    std::lock_guard<std::mutex> lock{mutex_};
+    return stats_;
+  }
+
+  /**
+   * Get the largest single scratch request made by an operator.
+   *
+   * \param op_name Name of the operator.
+   * \return The number of bytes, or zero if the operator has not borrowed any
+   *         scratch memory from the arena.
+   */
+  size_t op_peak_bytes(std::string const& op_name) const {
+    std::lock_guard<std::mutex> lock{mutex_};
+    auto peak = stats_.op_peak_bytes.find(op_name);
+    return peak == stats_.op_peak_bytes.end() ? 0 : peak->second;
+  }
+
+ private:
+  /**
+   * Prepare the idle arena for a new set of requests, growing the block if
+   * the high-water mark or the first request does not fit.
+   */
+  void start_generation(size_t first_size) {
+    offset_ = 0;
+    generation_bytes_ = 0;
+    pending_events_.erase(
+        std::remove_if(pending_events_.begin(), pending_events_.end(),
+                       is_complete),
+        pending_events_.end());
+    grow_to(std::max(stats_.high_water_bytes, first_size));
+  }
+
+  /** Replace the arena block with one of at least n_bytes. */
+  void grow_to(size_t n_bytes) {
+    if (n_bytes <= stats_.capacity) {
+      return;
+    }
+    if (block_) {
+      pool_->deallocate(block_, std::move(pending_events_));
+      pending_events_.clear();
+    }
+    block_ = pool_->allocate(n_bytes);
+    if (block_) {
+      stats_.capacity = n_bytes;
+      ++stats_.grows;
+    } else {
+      stats_.capacity = 0;
+    }
+  }
+
+  /** Check whether a kernel using the arena has completed. */
+  static bool is_complete(cl::sycl::event const& event) {
+    return event.get_info<cl::sycl::info::event::command_execution_status>() ==
+           cl::sycl::info::event_command_status::complete;
+  }
+
+  std::shared_ptr<USMMemoryPool> pool_;
+  void* block_ = nullptr;
+  size_t offset_ = 0;
+  size_t generation_bytes_ = 0;
+  size_t live_leases_ = 0;
+  std::vector<cl::sycl::event> pending_events_;
+  std::vector<cl::sycl::event> generation_events_;
+  WorkspaceArenaStats stats_{};
+  mutable std::mutex mutex_;
+};
+
+}  // namespace backend
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_INCLUDE_BACKEND_WORKSPACE_ARENA_H_
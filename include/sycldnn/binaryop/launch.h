@@ -96,6 +96,64 @@ SNNStatus launch(typename Backend::template pointer_type<T const> lhs,
                                              events);
 }
 
+/**
+ * Launch the binary operation kernel with a scalar rhs operand, computing
+ * out[i] = Op(lhs[i], rhs). The scalar is passed to the kernel as an argument.
+ *
+ * \tparam T         The data type of the input tensor.
+ * \tparam Op        The type of the BinaryOp.
+ * \tparam Backend   The type of the Backend.
+ *
+ * \param [in]  lhs      A pointer to the input tensor.
+ * \param [in]  rhs      The scalar rhs operand.
+ * \param [out] out      A pointer to the output tensor.
+ * \param [in]  size     The number of elements in the input and output.
+ * \param [in]  backend  The backend that provides access to the SYCL buffers
+ *                       corresponding to the input and output pointers.
+ * \return An \ref SNNStatus containing the SYCL event tied to the kernel
+ *         launches and a \ref StatusCode enum showing if the launch was OK or
+ *         whether it encountered some problem.
+ */
+template <typename T, typename Op, typename Backend,
+          typename = typename std::enable_if<
+              sycldnn::backend::is_buffer_backend_v<Backend>>::type>
+SNNStatus launch_scalar(typename Backend::template pointer_type<T const> lhs,
+                        T rhs, typename Backend::template pointer_type<T> out,
+                        int size, Backend& backend) {
+  return internal::sublaunch_scalar<T, Op, Backend>(lhs, rhs, out, size,
+                                                    backend, {});
+}
+
+/**
+ * Launch the binary operation kernel with a scalar rhs operand, computing
+ * out[i] = Op(lhs[i], rhs). The scalar is passed to the kernel as an argument.
+ *
+ * \tparam T         The data type of the input tensor.
+ * \tparam Op        The type of the BinaryOp.
+ * \tparam Backend   The type of the Backend.
+ *
+ * \param [in]  lhs      A pointer to the input tensor.
+ * \param [in]  rhs      The scalar rhs operand.
+ * \param [out] out      A pointer to the output tensor.
+ * \param [in]  size     The number of elements in the input and output.
+ * \param [in]  backend  The backend that provides access to the SYCL buffers
+ *                       corresponding to the input and output pointers.
+ * \param [in]  events    Events which should be completed before the operation.
+ * \return An \ref SNNStatus containing the SYCL event tied to the kernel
+ *         launches and a \ref StatusCode enum showing if the launch was OK or
+ *         whether it encountered some problem.
+ */
+template <typename T, typename Op, typename Backend,
+          typename = typename std::enable_if<
+              sycldnn::backend::is_usm_backend_v<Backend>>::type>
+SNNStatus launch_scalar(typename Backend::template pointer_type<T const> lhs,
+                        T rhs, typename Backend::template pointer_type<T> out,
+                        int size, Backend& backend,
+                        std::vector<cl::sycl::event> events = {}) {
+  return internal::sublaunch_scalar<T, Op, Backend>(lhs, rhs, out, size,
+                                                    backend, events);
+}
+
 }  // namespace binaryop
 }  // namespace sycldnn
 
@@ -203,8 +203,8 @@ SNNStatus batchNormalizationForwardTraining(
   ValueT* outVarPtr = nullptr;
 
   if (!resultSaveMean) {
-    outMeanPtr = sycl::malloc_device<ValueT>(c, handle.getQueue());
-    outVarPtr = sycl::malloc_device<ValueT>(c, handle.getQueue());
+    outMeanPtr = handle.getBackend().allocate<ValueT>(c);
+    outVarPtr = handle.getBackend().allocate<ValueT>(c);
   } else {
     outMeanPtr = static_cast<ValueT*>(resultSaveMean);
     outVarPtr = static_cast<ValueT*>(resultSaveInvVariance);
@@ -233,15 +233,8 @@ SNNStatus batchNormalizationForwardTraining(
                                                     copyVarEvent};
 
   if (!resultSaveMean) {
-    auto e = q.submit([&](sycl::handler& cgh) {
-      cgh.depends_on(batchnormEventVector);
-      cgh.host_task([=]() {
-        sycl::free(outMeanPtr, q);
-        sycl::free(outVarPtr, q);
-      });
-    });
-    batchnormEventVector.clear();
-    batchnormEventVector.push_back(e);
+    handle.getBackend().deallocate(outMeanPtr, batchnormEventVector);
+    handle.getBackend().deallocate(outVarPtr, batchnormEventVector);
   }
 
   return scParams.applyScaling(handle.getBackend(), batchnormEventVector);
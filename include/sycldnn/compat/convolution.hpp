@@ -629,9 +629,10 @@ sycldnn::StatusCode findConvolutionAlgorithm(
   perfResults->status.push_back(run_status);
   *returnedAlgoCount = 1;
 
-  sycl::free(x, handle.getQueue());
-  sycl::free(w, handle.getQueue());
-  sycl::free(y, handle.getQueue());
+  handle.getBackend().deallocate(x);
+  handle.getBackend().deallocate(w);
+  handle.getBackend().deallocate(workspace);
+  handle.getBackend().deallocate(y);
 
   return StatusCode::OK;
 }
@@ -260,21 +260,18 @@ class ScalingParams {
     if (isAlphaZero() && isBetaZero() && this->isBatchnormFwdTr) {
       scalingEvent.event = q.memset(this->y, 0, this->ySize * sizeof(ValueT));
     }
+    // The temporaries are returned to the backend's memory pool, which does
+    // not reuse them until the scaling kernels complete.
+    std::vector<cl::sycl::event> const scalingEvents{scalingEvent.event};
     if (!isAlphaZero() && !isAlphaOne()) {
-      scalingEvent.event = sycldnn::helpers::enqueue_free(
-          this->q, std::vector<cl::sycl::event>{scalingEvent.event},
-          this->devAlpha);
+      backend.deallocate(this->devAlpha, scalingEvents);
     }
     if (!isBetaZero()) {
       if (!isAlphaZero()) {
-        scalingEvent.event = sycldnn::helpers::enqueue_free(
-            this->q, std::vector<cl::sycl::event>{scalingEvent.event},
-            this->yTmp);
+        backend.deallocate(this->yTmp, scalingEvents);
       }
       if (!isBetaOne()) {
-        scalingEvent.event = sycldnn::helpers::enqueue_free(
-            this->q, std::vector<cl::sycl::event>{scalingEvent.event},
-            this->devBeta);
+        backend.deallocate(this->devBeta, scalingEvents);
       }
     }
     return scalingEvent;
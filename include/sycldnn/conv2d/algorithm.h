@@ -42,6 +42,25 @@ enum class Algorithm {
   WinogradLarge,
   /** Use a matmul for 1x1 NHWC convolutions. */
   Matmul,
+  /** Winograd implementation computing 6x6 output tiles of 3x3 filters. */
+  Winograd6x6,
+  /** Winograd implementation computing 2x2 output tiles of 5x5 filters. */
+  Winograd5x5,
+  /** Winograd implementation computing 4x4 output tiles of 5x5 filters. */
+  Winograd5x5Large,
+  /** Tiled approach which stages input and filter data in local memory. */
+  TiledLocal,
+  /**
+   * GEMM approach which computes the input patches on the fly, rather than
+   * materialising them in a workspace.
+   */
+  ImplicitGemm,
+  /**
+   * Number of algorithm tags, used to validate algorithm values read at
+   * runtime. This is not an algorithm, so new algorithms must be added before
+   * it.
+   */
+  NumAlgorithms,
 };
 }  // namespace conv2d
 }  // namespace sycldnn
@@ -0,0 +1,118 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_CONV2D_EPILOGUE_H_
+#define SYCLDNN_INCLUDE_CONV2D_EPILOGUE_H_
+
+/**
+ * \file
+ * Contains the \ref sycldnn::conv2d::Epilogue descriptor, which describes the
+ * pointwise operations to fuse into the output stage of a forward
+ * convolution.
+ */
+
+#include <optional>
+
+namespace sycldnn {
+namespace conv2d {
+
+/** The activation applied as the last operation of an epilogue. */
+enum class Activation {
+  /** Do not apply an activation. */
+  None,
+  /** Rectified linear unit, max(x, 0). */
+  Relu,
+  /** Hyperbolic tangent. */
+  Tanh,
+};
+
+/**
+ * The set of operations enabled in an epilogue.
+ *
+ * For an output value x in feature f, the epilogue computes
+ * \code
+ *   y = activation((x + bias[f]) * scale[f] + shift[f] + residual)
+ * \endcode
+ * where any operation which is not enabled is skipped.
+ */
+struct EpilogueParams {
+  /** Whether a per-feature bias is added. */
+  bool bias = false;
+  /** Whether the output is multiplied by a per-feature scale. */
+  bool scale = false;
+  /** Whether a per-feature shift is added. */
+  bool shift = false;
+  /** Whether a residual tensor with the same shape as the output is added. */
+  bool residual = false;
+  /** The activation applied to the result. */
+  Activation activation = Activation::None;
+};
+
+/**
+ * Check whether an epilogue leaves the convolution output unchanged.
+ *
+ * \param params The epilogue parameters to check.
+ * \return Whether no epilogue operations are enabled.
+ */
+inline bool is_identity(EpilogueParams const& params) {
+  return !params.bias && !params.scale && !params.shift && !params.residual &&
+         params.activation == Activation::None;
+}
+
+/**
+ * Descriptor for the operations to apply to the output of a forward
+ * convolution before it is written to memory.
+ *
+ * This covers the layers which typically follow a convolution: a bias add, a
+ * frozen batch norm folded into a scale and shift, a residual connection and
+ * an activation. Fusing them into the convolution means the output is only
+ * written once, rather than being read and written again by each layer.
+ */
+template <typename T, typename Backend>
+struct Epilogue {
+  /** The backend's pointer type for the epilogue tensors. */
+  using ConstPointer = typename Backend::template pointer_type<T const>;
+
+  /** Optional per-feature bias, containing one value per output feature. */
+  std::optional<ConstPointer> bias;
+  /** Optional per-feature scale, containing one value per output feature. */
+  std::optional<ConstPointer> scale;
+  /** Optional per-feature shift, containing one value per output feature. */
+  std::optional<ConstPointer> shift;
+  /** Optional residual tensor, with the same shape as the output. */
+  std::optional<ConstPointer> residual;
+  /** The activation applied after all other operations. */
+  Activation activation = Activation::None;
+
+  /**
+   * Get the set of operations enabled in this epilogue.
+   *
+   * \return The epilogue parameters to pass to the kernels.
+   */
+  EpilogueParams get_params() const {
+    EpilogueParams params;
+    params.bias = bias.has_value();
+    params.scale = scale.has_value();
+    params.shift = shift.has_value();
+    params.residual = residual.has_value();
+    params.activation = activation;
+    return params;
+  }
+};
+
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_INCLUDE_CONV2D_EPILOGUE_H_
@@ -0,0 +1,118 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_CONV2D_FOLD_BATCHNORM_H_
+#define SYCLDNN_INCLUDE_CONV2D_FOLD_BATCHNORM_H_
+
+/**
+ * \file
+ * Contains the \ref sycldnn::conv2d::fold_batchnorm() function, which folds a
+ * frozen batchnorm into the filter and bias of the preceding convolution.
+ */
+#include "sycldnn/data_format.h"
+#include "sycldnn/filter_format.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/conv2d/conv_type.h"
+#include "sycldnn/conv2d/params.h"
+#include "sycldnn/conv2d/sizes.h"
+
+#include "sycldnn/helpers/macros.h"
+
+#include "sycldnn/internal/conv2d/fold_batchnorm.h"
+
+#include <optional>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+namespace sycldnn {
+namespace conv2d {
+
+/**
+ * Fold a frozen batchnorm into the filter and bias of the convolution which
+ * precedes it, so that the batchnorm can be removed from an inference graph.
+ *
+ * For each output feature f this computes
+ * \code
+ *   s[f] = gamma[f] / sqrt(variance[f] + epsilon)
+ *   folded_filter[..., f] = filter[..., f] * s[f]
+ *   folded_bias[f] = (bias[f] - mean[f]) * s[f] + beta[f]
+ * \endcode
+ * where the bias is taken to be zero if the convolution has no bias. The
+ * folded tensors have the same shapes and layouts as the original filter and
+ * bias, and the folded filter can be used in place of the original filter.
+ *
+ * \param filter        A pointer to the convolution filter, in the filter
+ *                      format given in the params.
+ * \param bias          An optional pointer to the convolution bias, holding
+ *                      one value per output feature.
+ * \param gamma         A pointer to the batchnorm scale.
+ * \param beta          A pointer to the batchnorm offset.
+ * \param mean          A pointer to the batchnorm moving mean.
+ * \param variance      A pointer to the batchnorm moving variance.
+ * \param folded_filter A pointer to the memory to write the folded filter to.
+ * \param folded_bias   A pointer to the memory to write the folded bias to,
+ *                      holding one value per output feature.
+ * \param params        The parameters of the convolution to fold into.
+ * \param epsilon       The batchnorm epsilon.
+ * \param backend       The backend implementation, used to map between
+ *                      pointer representations.
+ * \param events        Events which should be completed before the operation.
+ * \return Returns an SNNStatus containing the SYCL event tied to the kernel
+ * launch and a StatusCode enum showing if the launch was OK or whether it
+ * encountered some problem.
+ */
+template <typename T, typename Backend>
+SNNStatus fold_batchnorm(
+    typename Backend::template pointer_type<T const> filter,
+    std::optional<typename Backend::template pointer_type<T const>> bias,
+    typename Backend::template pointer_type<T const> gamma,
+    typename Backend::template pointer_type<T const> beta,
+    typename Backend::template pointer_type<T const> mean,
+    typename Backend::template pointer_type<T const> variance,
+    typename Backend::template pointer_type<T> folded_filter,
+    typename Backend::template pointer_type<T> folded_bias,
+    Conv2DParams const& params, float epsilon, Backend& backend,
+    const std::vector<cl::sycl::event>& events = {}) {
+  SNN_VALIDATE_PARAM(params.features > 0,
+                     "The number of features must be positive.");
+  SNN_VALIDATE_PARAM(params.groups > 0,
+                     "The number of groups must be positive.");
+  SNN_VALIDATE_PARAM(epsilon >= 0.f, "Epsilon must be non-negative.");
+
+  auto conv_sizes = get_sizes<conv_type::Forward>(params);
+  size_t const features = params.features;
+  size_t inner_size = 1;
+  switch (params.filter_format) {
+    case FilterFormat::HWCF:
+      inner_size = 1;
+      break;
+    case FilterFormat::FHWC:
+    case FilterFormat::FCHW:
+      inner_size = conv_sizes.filter_size / features;
+      break;
+  }
+  internal::FoldSizes const sizes{conv_sizes.filter_size, features,
+                                  inner_size};
+  return internal::fold_batchnorm<T>(filter, bias, gamma, beta, mean,
+                                     variance, folded_filter, folded_bias,
+                                     epsilon, sizes, backend, events);
+}
+
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_INCLUDE_CONV2D_FOLD_BATCHNORM_H_
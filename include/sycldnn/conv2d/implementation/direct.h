@@ -17,10 +17,12 @@
 #define SYCLDNN_INCLUDE_CONV2D_DIRECT_H_
 
 #include "sycldnn/conv2d/conv_type.h"
+#include "sycldnn/conv2d/epilogue.h"
 #include "sycldnn/conv2d/params.h"
 #include "sycldnn/conv2d/sizes.h"
 
 #include "sycldnn/internal/conv2d/direct.h"
+#include "sycldnn/internal/conv2d/epilogue.h"
 
 namespace sycldnn {
 namespace conv2d {
@@ -28,7 +30,8 @@ namespace conv2d {
  * Launch the direct implementation of a 2D convolution.
  *
  * Will extract the SYCL buffers and SYCL queue from the backend and forward
- * these on to the precompiled kernels.
+ * these on to the precompiled kernels. The epilogue is applied in the kernel's
+ * output stage.
  *
  * Returns an SNNStatus containing the SYCL event tied to the kernel launch.
  */
@@ -38,16 +41,20 @@ inline SNNStatus launch_direct(
     typename Backend::template pointer_type<T const> filter,
     typename Backend::template pointer_type<T> output,
     Conv2DParams const& params, Backend& backend,
-    const std::vector<cl::sycl::event>& events) {
+    const std::vector<cl::sycl::event>& events,
+    Epilogue<T, Backend> const& epilogue = {}) {
   auto conv_sizes = get_sizes<ConvType>(params);
 
   auto inp_access = backend.get_mem_object(input, conv_sizes.input_size);
   auto fil_access = backend.get_mem_object(filter, conv_sizes.filter_size);
   auto out_access = backend.get_mem_object(output, conv_sizes.output_size);
+  auto epi_access =
+      internal::make_epilogue_mem(epilogue, backend, fil_access,
+                                  params.features, conv_sizes.output_size);
 
   cl::sycl::queue queue = backend.get_queue();
   return internal::launch_direct<T, ConvType>(
-      inp_access, fil_access, out_access, params, queue, events);
+      inp_access, fil_access, out_access, epi_access, params, queue, events);
 }
 }  // namespace conv2d
 }  // namespace sycldnn
@@ -0,0 +1,84 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_CONV2D_IMPLEMENTATION_EPILOGUE_H_
+#define SYCLDNN_INCLUDE_CONV2D_IMPLEMENTATION_EPILOGUE_H_
+
+#include "sycldnn/status.h"
+
+#include "sycldnn/conv2d/conv_type.h"
+#include "sycldnn/conv2d/epilogue.h"
+#include "sycldnn/conv2d/params.h"
+#include "sycldnn/conv2d/sizes.h"
+
+#include "sycldnn/internal/conv2d/epilogue.h"
+
+namespace sycldnn {
+namespace conv2d {
+/**
+ * Apply an epilogue in place to the output of a forward convolution.
+ *
+ * This is used by the algorithms which compute the convolution with the
+ * backend's matrix multiply, when the backend cannot apply the epilogue
+ * before the values are stored. The whole epilogue is applied in a single
+ * pass over the output.
+ *
+ * \param output   Pointer to the convolution output
+ * \param params   Convolution parameters
+ * \param backend  Backend to provide SYCL buffers from the pointers
+ * \param epilogue Epilogue to apply to the output
+ * \param events   Events to wait on before launching the kernel
+ * \return An SNNStatus containing the SYCL event tied to the kernel launch.
+ */
+template <typename T, typename Backend>
+inline SNNStatus launch_epilogue(
+    typename Backend::template pointer_type<T> output,
+    Conv2DParams const& params, Backend& backend,
+    Epilogue<T, Backend> const& epilogue,
+    const std::vector<cl::sycl::event>& events) {
+  auto conv_sizes = get_sizes<conv_type::Forward>(params);
+
+  auto out_access = backend.get_mem_object(output, conv_sizes.output_size);
+  auto placeholder = out_access.as_const();
+  auto epi_access =
+      internal::make_epilogue_mem(epilogue, backend, placeholder,
+                                  params.features, conv_sizes.output_size);
+
+  cl::sycl::queue queue = backend.get_queue();
+  return internal::launch_epilogue<T>(out_access, epi_access, params, queue,
+                                      events);
+}
+
+/**
+ * Apply the epilogue as a separate pass once a convolution which could not
+ * fuse it into its output stage has completed.
+ */
+template <typename T, typename Backend>
+SNNStatus apply_unfused_epilogue(
+    SNNStatus const& conv_status,
+    typename Backend::template pointer_type<T> output,
+    Conv2DParams const& params, Backend& backend,
+    Epilogue<T, Backend> const& epilogue) {
+  if (conv_status.status != StatusCode::OK ||
+      is_identity(epilogue.get_params())) {
+    return conv_status;
+  }
+  return launch_epilogue<T>(output, params, backend, epilogue,
+                            {conv_status.event});
+}
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_INCLUDE_CONV2D_IMPLEMENTATION_EPILOGUE_H_
@@ -44,6 +44,41 @@ inline SNNStatus launch_im2col(
                                               params, workspace_size, backend,
                                               events);
 }
+
+/**
+ * Pack the filter into the layout used by the im2col matrix multiply, so that
+ * it can be reused by launch_im2col_packed() across many convolutions.
+ *
+ * Returns an SNNStatus containing the SYCL event tied to the kernel launch.
+ */
+template <typename T, typename ConvType, typename Backend>
+inline SNNStatus pack_filter_im2col(
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T> packed,
+    Conv2DParams const& params, Backend& backend,
+    const std::vector<cl::sycl::event>& events) {
+  return internal::pack_filter_im2col<T, ConvType>(filter, packed, params,
+                                                   backend, events);
+}
+
+/**
+ * Launch the 2D convolution using im2col with a filter previously packed by
+ * pack_filter_im2col().
+ *
+ * Returns an SNNStatus containing the SYCL event tied to the kernel launch.
+ */
+template <typename T, typename ConvType, typename Backend>
+inline SNNStatus launch_im2col_packed(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T const> packed,
+    typename Backend::template pointer_type<T> output,
+    typename Backend::template pointer_type<T> workspace,
+    Conv2DParams const& params, size_t workspace_size, Backend& backend,
+    const std::vector<cl::sycl::event>& events) {
+  return internal::launch_im2col_packed<T, ConvType>(
+      input, packed, output, workspace, params, workspace_size, backend,
+      events);
+}
 }  // namespace conv2d
 }  // namespace sycldnn
 #endif  // SYCLDNN_INCLUDE_CONV2D_IM2COL_H_
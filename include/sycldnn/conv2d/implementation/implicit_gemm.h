@@ -0,0 +1,62 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_CONV2D_IMPLICIT_GEMM_H_
+#define SYCLDNN_INCLUDE_CONV2D_IMPLICIT_GEMM_H_
+
+#include "sycldnn/conv2d/conv_type.h"
+#include "sycldnn/conv2d/epilogue.h"
+#include "sycldnn/conv2d/params.h"
+#include "sycldnn/conv2d/sizes.h"
+
+#include "sycldnn/internal/conv2d/epilogue.h"
+#include "sycldnn/internal/conv2d/implicit_gemm.h"
+
+namespace sycldnn {
+namespace conv2d {
+/**
+ * Launch the implicit GEMM implementation of a 2D convolution.
+ *
+ * Unlike the im2col implementation, the input patches are never written to
+ * memory, so no workspace is required and the whole batch is computed in a
+ * single kernel launch. The epilogue is applied to each output block before
+ * it is stored.
+ *
+ * Returns an SNNStatus containing the SYCL event tied to the kernel launch.
+ */
+template <typename T, typename ConvType, typename Backend>
+inline SNNStatus launch_implicit_gemm(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T> output,
+    Conv2DParams const& params, Backend& backend,
+    const std::vector<cl::sycl::event>& events,
+    Epilogue<T, Backend> const& epilogue = {}) {
+  auto conv_sizes = get_sizes<ConvType>(params);
+
+  auto inp_access = backend.get_mem_object(input, conv_sizes.input_size);
+  auto fil_access = backend.get_mem_object(filter, conv_sizes.filter_size);
+  auto out_access = backend.get_mem_object(output, conv_sizes.output_size);
+  auto epi_access =
+      internal::make_epilogue_mem(epilogue, backend, fil_access,
+                                  params.features, conv_sizes.output_size);
+
+  cl::sycl::queue queue = backend.get_queue();
+  return internal::launch_implicit_gemm<T, ConvType>(
+      inp_access, fil_access, out_access, epi_access, params, queue, events);
+}
+}  // namespace conv2d
+}  // namespace sycldnn
+#endif  // SYCLDNN_INCLUDE_CONV2D_IMPLICIT_GEMM_H_
@@ -17,8 +17,20 @@
 #define SYCLDNN_INCLUDE_CONV2D_IMPLEMENTATION_MATMUL_H_
 
 #include "sycldnn/conv2d/conv_type.h"
+#include "sycldnn/conv2d/epilogue.h"
 #include "sycldnn/conv2d/params.h"
 
+#include "sycldnn/conv2d/implementation/epilogue.h"
+
+#include "sycldnn/backend/backend_helpers.h"
+#include "sycldnn/matmul/epilogue.h"
+
+#include "sycldnn/data_format.h"
+#include "sycldnn/status.h"
+
+#include <type_traits>
+#include <vector>
+
 namespace sycldnn {
 namespace conv2d {
 
@@ -35,11 +47,63 @@ struct MatmulLauncher<conv_type::Forward> {
       typename Backend::template pointer_type<T const> filter,
       typename Backend::template pointer_type<T> output,
       Conv2DParams const& params, Backend& backend,
-      const std::vector<cl::sycl::event>& events) {
+      const std::vector<cl::sycl::event>& events,
+      Epilogue<T, Backend> const& epilogue) {
+    if (params.input_format == DataFormat::NCHW) {
+      auto status =
+          launch_nchw<T>(input, filter, output, params, backend, events);
+      return apply_unfused_epilogue<T>(status, output, params, backend,
+                                       epilogue);
+    }
     auto conv_width = params.batch * params.in_rows * params.in_cols;
+    if constexpr (backend::supports_matmul_epilogue<Backend>::value) {
+      // Each column of the NHWC output is a feature, so a per-feature bias
+      // and activation can be applied by the matmul's output stage.
+      auto epilogue_params = epilogue.get_params();
+      if (!epilogue_params.scale && !epilogue_params.shift &&
+          !epilogue_params.residual) {
+        sycldnn::matmul::Epilogue<T, Backend> matmul_epilogue;
+        matmul_epilogue.bias = epilogue.bias;
+        matmul_epilogue.activation = epilogue.activation;
+        auto event = backend.template matmul<false, false>(
+            input, filter, output, T{1}, T{0}, conv_width, params.channels,
+            params.features, matmul_epilogue, events);
+        return {event, StatusCode::OK};
+      }
+    }
     auto event = backend.template matmul<false, false>(
         input, filter, output, T{0}, conv_width, params.channels,
         params.features, events);
+    return apply_unfused_epilogue<T>({event, StatusCode::OK}, output, params,
+                                     backend, epilogue);
+  }
+
+ private:
+  /**
+   * Compute a 1x1 convolution of an NCHW input with an FCHW filter. Each
+   * output image is the product of the (features x channels) filter with the
+   * (channels x rows*cols) input image, so no transposes are needed.
+   */
+  template <typename T, typename Backend>
+  static SNNStatus launch_nchw(
+      typename Backend::template pointer_type<T const> input,
+      typename Backend::template pointer_type<T const> filter,
+      typename Backend::template pointer_type<T> output,
+      Conv2DParams const& params, Backend& backend,
+      const std::vector<cl::sycl::event>& events) {
+    auto const image_size = params.in_rows * params.in_cols;
+    auto const in_stride = static_cast<size_t>(image_size * params.channels);
+    auto const out_stride = static_cast<size_t>(image_size * params.features);
+    // Each matmul depends on the previous one, so the last event covers the
+    // whole batch.
+    std::vector<cl::sycl::event> dependencies = events;
+    cl::sycl::event event;
+    for (int batch = 0; batch < params.batch; ++batch) {
+      event = backend.template matmul<false, false>(
+          filter, input + batch * in_stride, output + batch * out_stride, T{0},
+          params.features, params.channels, image_size, dependencies);
+      dependencies = {event};
+    }
     return {event, StatusCode::OK};
   }
 };
@@ -85,6 +149,10 @@ struct MatmulLauncher<conv_type::FilterBackprop> {
  * Will extract the SYCL buffers and SYCL queue from the backend and forward
  * these on to the precompiled kernels.
  *
+ * For a forward convolution the epilogue is applied by the backend's matmul
+ * when the backend supports it and the epilogue only contains a bias and an
+ * activation, otherwise it is applied in a separate pass.
+ *
  * Returns an SNNStatus containing the SYCL event tied to the kernel launch.
  */
 template <typename T, typename ConvType, typename Backend>
@@ -93,11 +161,12 @@ inline SNNStatus launch_matmul(
     typename Backend::template pointer_type<T const> filter,
     typename Backend::template pointer_type<T> output,
     Conv2DParams const& params, Backend& backend,
-    const std::vector<cl::sycl::event>& events) {
+    const std::vector<cl::sycl::event>& events,
+    Epilogue<T, Backend> const& epilogue = {}) {
   SNN_VALIDATE_PARAM(params.window_rows == 1,
-                     "Matmul can only be used for 1x1 NHWC convolutions.");
+                     "Matmul can only be used for 1x1 convolutions.");
   SNN_VALIDATE_PARAM(params.window_cols == 1,
-                     "Matmul can only be used for 1x1 NHWC convolutions.");
+                     "Matmul can only be used for 1x1 convolutions.");
   SNN_VALIDATE_PARAM(params.stride_rows == 1,
                      "Matmul can only be used with stride 1.");
   SNN_VALIDATE_PARAM(params.stride_cols == 1,
@@ -107,8 +176,14 @@ inline SNNStatus launch_matmul(
   SNN_VALIDATE_PARAM(params.pad_cols == 0,
                      "Matmul can only be used with zero padding.");
 
-  return internal::MatmulLauncher<ConvType>::template launch<T>(
-      input, filter, output, params, backend, events);
+  if constexpr (std::is_same<ConvType, conv_type::Forward>::value) {
+    return internal::MatmulLauncher<ConvType>::template launch<T>(
+        input, filter, output, params, backend, events, epilogue);
+  } else {
+    SNN_UNUSED_VAR(epilogue);
+    return internal::MatmulLauncher<ConvType>::template launch<T>(
+        input, filter, output, params, backend, events);
+  }
 }
 
 }  // namespace conv2d
@@ -17,9 +17,11 @@
 #define SYCLDNN_INCLUDE_CONV2D_TILED_H_
 
 #include "sycldnn/conv2d/conv_type.h"
+#include "sycldnn/conv2d/epilogue.h"
 #include "sycldnn/conv2d/params.h"
 #include "sycldnn/conv2d/sizes.h"
 
+#include "sycldnn/internal/conv2d/epilogue.h"
 #include "sycldnn/internal/conv2d/tiled.h"
 
 namespace sycldnn {
@@ -28,7 +30,8 @@ namespace conv2d {
  * Launch the direct implementation of a 2D convolution.
  *
  * Will extract the SYCL buffers and SYCL queue from the backend and forward
- * these on to the precompiled kernels.
+ * these on to the precompiled kernels. The epilogue is applied in the kernel's
+ * output stage.
  *
  * Returns an SNNStatus containing the SYCL event tied to the kernel launch.
  */
@@ -38,16 +41,88 @@ inline SNNStatus launch_tiled(
     typename Backend::template pointer_type<T const> filter,
     typename Backend::template pointer_type<T> output,
     Conv2DParams const& params, Backend& backend,
-    const std::vector<cl::sycl::event>& events) {
+    const std::vector<cl::sycl::event>& events,
+    Epilogue<T, Backend> const& epilogue = {}) {
   auto conv_sizes = get_sizes<ConvType>(params);
 
   auto inp_access = backend.get_mem_object(input, conv_sizes.input_size);
   auto fil_access = backend.get_mem_object(filter, conv_sizes.filter_size);
   auto out_access = backend.get_mem_object(output, conv_sizes.output_size);
+  auto epi_access =
+      internal::make_epilogue_mem(epilogue, backend, fil_access,
+                                  params.features, conv_sizes.output_size);
+
+  cl::sycl::queue queue = backend.get_queue();
+  return internal::launch_tiled<T, ConvType>(
+      inp_access, fil_access, out_access, epi_access, params, queue, events);
+}
+
+/**
+ * Launch the tiled implementation of a 2D convolution which stages the input
+ * and filter data used by each work-group in local memory.
+ *
+ * Will extract the SYCL buffers and SYCL queue from the backend and forward
+ * these on to the precompiled kernels. The epilogue is applied in the kernel's
+ * output stage.
+ *
+ * Returns an SNNStatus containing the SYCL event tied to the kernel launch.
+ */
+template <typename T, typename ConvType, typename Backend>
+inline SNNStatus launch_tiled_local(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T> output,
+    Conv2DParams const& params, Backend& backend,
+    const std::vector<cl::sycl::event>& events,
+    Epilogue<T, Backend> const& epilogue = {}) {
+  auto conv_sizes = get_sizes<ConvType>(params);
+
+  auto inp_access = backend.get_mem_object(input, conv_sizes.input_size);
+  auto fil_access = backend.get_mem_object(filter, conv_sizes.filter_size);
+  auto out_access = backend.get_mem_object(output, conv_sizes.output_size);
+  auto epi_access =
+      internal::make_epilogue_mem(epilogue, backend, fil_access,
+                                  params.features, conv_sizes.output_size);
+
+  cl::sycl::queue queue = backend.get_queue();
+  return internal::launch_tiled_local<T, ConvType>(
+      inp_access, fil_access, out_access, epi_access, params, queue, events);
+}
+
+/**
+ * Launch the tiled implementation of a 2D convolution filter backprop.
+ *
+ * When the filter gradient is too small to occupy the device, the reduction
+ * over the output rows is split across work-groups, with the partial filter
+ * gradients held in the workspace. Without a workspace the reduction is not
+ * split.
+ *
+ * Returns an SNNStatus containing the SYCL event tied to the final kernel
+ * launch.
+ */
+template <typename T, typename Backend>
+inline SNNStatus launch_tiled_filter_backprop(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T const> output_grad,
+    typename Backend::template pointer_type<T> filter_grad,
+    typename Backend::template pointer_type<T> workspace,
+    Conv2DParams const& params, size_t workspace_size, Backend& backend,
+    const std::vector<cl::sycl::event>& events) {
+  if (workspace_size == 0) {
+    return launch_tiled<T, conv_type::FilterBackprop>(
+        input, output_grad, filter_grad, params, backend, events);
+  }
+  auto conv_sizes = get_sizes<conv_type::FilterBackprop>(params);
+
+  auto inp_access = backend.get_mem_object(input, conv_sizes.input_size);
+  auto err_access = backend.get_mem_object(output_grad, conv_sizes.filter_size);
+  auto out_access = backend.get_mem_object(filter_grad, conv_sizes.output_size);
+  auto workspace_access = backend.get_mem_object(workspace, workspace_size);
 
   cl::sycl::queue queue = backend.get_queue();
-  return internal::launch_tiled<T, ConvType>(inp_access, fil_access, out_access,
-                                             params, queue, events);
+  return internal::launch_tiled_filter_backprop<T>(
+      inp_access, err_access, out_access, workspace_access, workspace_size,
+      params, queue, events);
 }
 }  // namespace conv2d
 }  // namespace sycldnn
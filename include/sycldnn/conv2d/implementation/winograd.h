@@ -16,6 +16,8 @@
 #ifndef SYCLDNN_INCLUDE_CONV2D_IMPLEMENTATION_WINOGRAD_H_
 #define SYCLDNN_INCLUDE_CONV2D_IMPLEMENTATION_WINOGRAD_H_
 
+#include "sycldnn/conv2d/algorithm.h"
+#include "sycldnn/conv2d/epilogue.h"
 #include "sycldnn/conv2d/params.h"
 
 #include "sycldnn/internal/conv2d/winograd/launch.h"
@@ -35,6 +37,7 @@ namespace conv2d {
  * \param params  Convolution parameters
  * \param backend Backend to use to allocate temporary buffers and compute
  *                matrix multiplies
+ * \param epilogue Epilogue to apply in the Winograd output transform
  * \return An SNNStatus containing the SYCL event tied to the kernel launch.
  */
 template <typename T, typename ConvType, typename Backend>
@@ -44,10 +47,11 @@ inline SNNStatus launch_winograd(
     typename Backend::template pointer_type<T> output,
     typename Backend::template pointer_type<T> workspace,
     Conv2DParams const& params, size_t workspace_size, Backend& backend,
-    const std::vector<cl::sycl::event>& events) {
+    const std::vector<cl::sycl::event>& events,
+    Epilogue<T, Backend> const& epilogue = {}) {
   return internal::winograd::launch<T, ConvType>(
       input, filter, output, workspace, params, workspace_size, backend,
-      events);
+      events, epilogue);
 }
 /**
  * Special launcher to use larger tile sizes for Winograd.
@@ -61,10 +65,155 @@ inline SNNStatus launch_winograd_large(
     typename Backend::template pointer_type<T> output,
     typename Backend::template pointer_type<T> workspace,
     Conv2DParams const& params, size_t workspace_size, Backend& backend,
-    const std::vector<cl::sycl::event>& events) {
+    const std::vector<cl::sycl::event>& events,
+    Epilogue<T, Backend> const& epilogue = {}) {
   return internal::winograd::launch_large<T, ConvType>(
       input, filter, output, workspace, params, workspace_size, backend,
-      events);
+      events, epilogue);
+}
+
+/**
+ * Transform a filter into the Winograd domain, so that it can be reused by
+ * launch_winograd_transformed_filter() across many convolutions.
+ *
+ * \param filter           Pointer to the filter buffer
+ * \param transformed      Pointer to the buffer to write the transformed
+ *                         filter to
+ * \param params           Convolution parameters
+ * \param backend          Backend to provide SYCL buffers from the pointers
+ * \param events           Events to wait on before launching the kernel
+ * \return An SNNStatus containing the SYCL event tied to the kernel launch.
+ */
+template <typename T, typename ConvType, typename Backend>
+inline SNNStatus transform_filter_winograd(
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T> transformed,
+    Conv2DParams const& params, Backend& backend,
+    const std::vector<cl::sycl::event>& events) {
+  return internal::winograd::transform_filter<T, ConvType>(
+      filter, transformed, params, backend, events);
+}
+
+/**
+ * Transform a filter for use with launch_winograd_large_transformed_filter().
+ *
+ * \copydoc transform_filter_winograd
+ */
+template <typename T, typename ConvType, typename Backend>
+inline SNNStatus transform_filter_winograd_large(
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T> transformed,
+    Conv2DParams const& params, Backend& backend,
+    const std::vector<cl::sycl::event>& events) {
+  return internal::winograd::transform_filter_large<T, ConvType>(
+      filter, transformed, params, backend, events);
+}
+
+/**
+ * Launch the 2D convolution using the Winograd implementation with a filter
+ * previously transformed by transform_filter_winograd().
+ *
+ * \param input       Pointer to the input buffer
+ * \param transformed Pointer to the transformed filter buffer
+ * \param output      Pointer to the output buffer
+ * \param workspace   Pointer to the workspace buffer
+ * \param params      Convolution parameters
+ * \param workspace_size Number of elements available in the workspace
+ * \param backend     Backend to use to compute matrix multiplies
+ * \param events      Events to wait on before launching the kernels
+ * \param epilogue    Epilogue to apply in the Winograd output transform
+ * \return An SNNStatus containing the SYCL event tied to the kernel launch.
+ */
+template <typename T, typename ConvType, typename Backend>
+inline SNNStatus launch_winograd_transformed_filter(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T const> transformed,
+    typename Backend::template pointer_type<T> output,
+    typename Backend::template pointer_type<T> workspace,
+    Conv2DParams const& params, size_t workspace_size, Backend& backend,
+    const std::vector<cl::sycl::event>& events,
+    Epilogue<T, Backend> const& epilogue = {}) {
+  return internal::winograd::launch_transformed_filter<T, ConvType>(
+      input, transformed, output, workspace, params, workspace_size, backend,
+      events, epilogue);
+}
+
+/**
+ * Launch the 2D convolution using larger Winograd tiles with a filter
+ * previously transformed by transform_filter_winograd_large().
+ *
+ * \copydoc launch_winograd_transformed_filter
+ */
+template <typename T, typename ConvType, typename Backend>
+inline SNNStatus launch_winograd_large_transformed_filter(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T const> transformed,
+    typename Backend::template pointer_type<T> output,
+    typename Backend::template pointer_type<T> workspace,
+    Conv2DParams const& params, size_t workspace_size, Backend& backend,
+    const std::vector<cl::sycl::event>& events,
+    Epilogue<T, Backend> const& epilogue = {}) {
+  return internal::winograd::launch_large_transformed_filter<T, ConvType>(
+      input, transformed, output, workspace, params, workspace_size, backend,
+      events, epilogue);
+}
+
+/**
+ * Launch the 2D convolution using one of the Winograd algorithms with a single
+ * fixed tile size, Algorithm::Winograd6x6, Algorithm::Winograd5x5 or
+ * Algorithm::Winograd5x5Large.
+ *
+ * \copydoc launch_winograd
+ */
+template <typename T, typename ConvType, Algorithm Algo, typename Backend>
+inline SNNStatus launch_winograd_fixed(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T> output,
+    typename Backend::template pointer_type<T> workspace,
+    Conv2DParams const& params, size_t workspace_size, Backend& backend,
+    const std::vector<cl::sycl::event>& events,
+    Epilogue<T, Backend> const& epilogue = {}) {
+  return internal::winograd::launch_fixed<T, ConvType, Algo>(
+      input, filter, output, workspace, params, workspace_size, backend,
+      events, epilogue);
+}
+
+/**
+ * Transform a filter for use with launch_winograd_fixed_transformed_filter().
+ *
+ * \copydoc transform_filter_winograd
+ */
+template <typename T, typename ConvType, Algorithm Algo, typename Backend>
+inline SNNStatus transform_filter_winograd_fixed(
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T> transformed,
+    Conv2DParams const& params, Backend& backend,
+    const std::vector<cl::sycl::event>& events) {
+  return internal::winograd::transform_filter_fixed<T, ConvType, Algo>(
+      filter, transformed, params, backend, events);
+}
+
+/**
+ * Launch the 2D convolution using one of the fixed tile size Winograd
+ * algorithms with a filter previously transformed by
+ * transform_filter_winograd_fixed().
+ *
+ * \copydoc launch_winograd_transformed_filter
+ */
+template <typename T, typename ConvType, Algorithm Algo, typename Backend>
+inline SNNStatus launch_winograd_fixed_transformed_filter(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T const> transformed,
+    typename Backend::template pointer_type<T> output,
+    typename Backend::template pointer_type<T> workspace,
+    Conv2DParams const& params, size_t workspace_size, Backend& backend,
+    const std::vector<cl::sycl::event>& events,
+    Epilogue<T, Backend> const& epilogue = {}) {
+  return internal::winograd::launch_fixed_transformed_filter<T, ConvType,
+                                                             Algo>(
+      input, transformed, output, workspace, params, workspace_size, backend,
+      events, epilogue);
 }
 
 }  // namespace conv2d
@@ -23,6 +23,7 @@
  */
 
 #include "sycldnn/backend/backend_helpers.h"
+#include "sycldnn/conv2d/epilogue.h"
 #include "sycldnn/conv2d/params.h"
 #include "sycldnn/conv2d/selector/selector.h"
 #include "sycldnn/internal/conv2d/launch.h"
@@ -52,6 +53,9 @@ namespace conv2d {
  *                  temporary memory is required.
  * \param workspace_size The number of elements available in the workspace
  *                       buffer.
+ * \param epilogue Optional operations to apply to the output of a forward
+ *                 convolution before it is written, fused into the
+ *                 convolution's output stage where the algorithm allows.
  * \return Returns an SNNStatus containing the SYCL event tied to the kernel
  * launches and a StatusCode enum showing if the launch was OK or whether it
  * encountered some problem.
@@ -65,10 +69,11 @@ SNNStatus launch(typename Backend::template pointer_type<T const> input,
                  Conv2DParams const& params, Selector& selector,
                  Backend& backend,
                  typename Backend::template pointer_type<T> workspace,
-                 size_t workspace_size) {
+                 size_t workspace_size,
+                 Epilogue<T, Backend> const& epilogue = {}) {
   return sublaunch<T, ConvType, Backend>(input, filter, output, params,
                                          selector, backend, workspace,
-                                         workspace_size, {});
+                                         workspace_size, {}, epilogue);
 }
 
 /**
@@ -96,6 +101,9 @@ SNNStatus launch(typename Backend::template pointer_type<T const> input,
  * \param events Optional vector of
  *               events which the convolution will wait on before launching the
  *               kernels, required for USM
+ * \param epilogue Optional operations to apply to the output of a forward
+ *                 convolution before it is written, fused into the
+ *                 convolution's output stage where the algorithm allows.
  * \return Returns an SNNStatus containing the SYCL
  * event tied to the kernel launches and a StatusCode enum showing if the launch
  * was OK or whether it encountered some problem.
@@ -111,10 +119,11 @@ SNNStatus launch(typename Backend::template pointer_type<T const> input,
                  Backend& backend,
                  typename Backend::template pointer_type<T> workspace,
                  size_t workspace_size,
-                 const std::vector<cl::sycl::event>& events = {}) {
+                 const std::vector<cl::sycl::event>& events = {},
+                 Epilogue<T, Backend> const& epilogue = {}) {
   return sublaunch<T, ConvType, Backend>(input, filter, output, params,
                                          selector, backend, workspace,
-                                         workspace_size, events);
+                                         workspace_size, events, epilogue);
 }
 
 }  // namespace conv2d
@@ -0,0 +1,368 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_CONV2D_SELECTOR_AUTOTUNE_SELECTOR_H_
+#define SYCLDNN_INCLUDE_CONV2D_SELECTOR_AUTOTUNE_SELECTOR_H_
+
+/**
+ * \file
+ * Contains the definition of the \ref sycldnn::conv2d::AutotuneSelector class.
+ * This concrete implementation of \ref sycldnn::conv2d::Selector benchmarks
+ * every supported convolution algorithm on the backend's device the first time
+ * it sees a set of convolution parameters, and remembers the fastest one. The
+ * choices can be persisted to a cache file so that later processes do not need
+ * to benchmark again.
+ */
+#include "sycldnn/conv2d/algorithm.h"
+#include "sycldnn/conv2d/conv_type.h"
+#include "sycldnn/conv2d/launch.h"
+#include "sycldnn/conv2d/params.h"
+#include "sycldnn/conv2d/sizes.h"
+#include "sycldnn/conv2d/workspace_size.h"
+
+#include "sycldnn/conv2d/selector/default_selector.h"
+#include "sycldnn/conv2d/selector/direct_selector.h"
+#include "sycldnn/conv2d/selector/im2col_selector.h"
+#include "sycldnn/conv2d/selector/implicit_gemm_selector.h"
+#include "sycldnn/conv2d/selector/matmul_selector.h"
+#include "sycldnn/conv2d/selector/selector.h"
+#include "sycldnn/conv2d/selector/tiled_selector.h"
+#include "sycldnn/conv2d/selector/winograd_selector.h"
+
+#include "sycldnn/helpers/macros.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+
+/** Get a short name for the convolution type, used in autotuning cache keys. */
+template <typename ConvType>
+inline char const* conv_type_name();
+
+/** \copydoc conv_type_name() */
+template <>
+inline char const* conv_type_name<conv_type::Forward>() {
+  return "Forward";
+}
+
+/** \copydoc conv_type_name() */
+template <>
+inline char const* conv_type_name<conv_type::InputBackprop>() {
+  return "InputBackprop";
+}
+
+/** \copydoc conv_type_name() */
+template <>
+inline char const* conv_type_name<conv_type::FilterBackprop>() {
+  return "FilterBackprop";
+}
+
+/**
+ * Serialise the convolution parameters into a string which uniquely identifies
+ * the convolution shape.
+ *
+ * \param params The convolution parameters.
+ * \return A comma separated list of all fields in the parameters.
+ */
+inline std::string params_to_key(Conv2DParams const& params) {
+  std::ostringstream key;
+  key << params.channels << ',' << params.features << ',' << params.batch
+      << ',' << params.in_rows << ',' << params.in_cols << ','
+      << params.window_rows << ',' << params.window_cols << ','
+      << params.stride_rows << ',' << params.stride_cols << ','
+      << params.out_rows << ',' << params.out_cols << ',' << params.pad_rows
+      << ',' << params.pad_cols << ',' << params.dilation_rows << ','
+      << params.dilation_cols << ',' << params.groups << ','
+      << static_cast<int>(params.input_format) << ','
+      << static_cast<int>(params.filter_format) << ','
+      << static_cast<int>(params.group_format);
+  return key.str();
+}
+
+}  // namespace internal
+
+/**
+ * A selector which benchmarks each supported algorithm on the device used by
+ * the provided backend, and selects the fastest.
+ *
+ * The first time a set of parameters is seen for a given convolution type,
+ * every algorithm which supports those parameters is launched a number of
+ * times on uninitialised data and timed. The fastest algorithm is stored in an
+ * in-memory cache, and appended to the cache file if one was provided. Entries
+ * in the cache file are keyed on the device name, driver version, convolution
+ * type and convolution parameters, so a single file can be shared between
+ * multiple devices.
+ *
+ * Autotuning allocates temporary buffers and synchronises with the device, so
+ * should be done before any latency sensitive work is submitted.
+ *
+ * \tparam Backend The backend used to allocate memory and launch the
+ *                 benchmarked convolutions.
+ * \tparam T       The data type used in the benchmarked convolutions.
+ */
+template <typename Backend, typename T = float>
+class AutotuneSelector final : public Selector {
+ public:
+  /**
+   * Construct an autotuning selector.
+   *
+   * \param backend    The backend to use to run the benchmarks. The backend
+   *                   must outlive the selector.
+   * \param cache_file Path of a file to load previous selections from, and
+   *                   store new selections to. If empty then selections are
+   *                   only cached in memory.
+   * \param n_runs     Number of timed runs of each algorithm, after an initial
+   *                   warm up run.
+   */
+  AutotuneSelector(Backend& backend, std::string cache_file = "",
+                   int n_runs = 3)
+      : backend_{backend},
+        cache_file_{std::move(cache_file)},
+        n_runs_{n_runs > 0 ? n_runs : 1},
+        fallback_{get_default_selector(backend.get_queue().get_device())},
+        cache_{} {
+    auto device = backend_.get_queue().get_device();
+    device_key_ = device.template get_info<cl::sycl::info::device::name>() +
+                  '|' +
+                  device.template get_info<
+                      cl::sycl::info::device::driver_version>();
+    candidates_.emplace_back(new DirectSelector{});
+    candidates_.emplace_back(new TiledSelector{});
+    candidates_.emplace_back(new TiledLocalSelector{});
+    candidates_.emplace_back(new Im2colSelector{});
+    candidates_.emplace_back(new ImplicitGemmSelector{});
+    candidates_.emplace_back(new WinogradSelector{});
+    candidates_.emplace_back(new WinogradLargeSelector{});
+    candidates_.emplace_back(new Winograd6x6Selector{});
+    candidates_.emplace_back(new Winograd5x5Selector{});
+    candidates_.emplace_back(new Winograd5x5LargeSelector{});
+    candidates_.emplace_back(new MatmulSelector{});
+    load_cache_file();
+  }
+
+  /** \copydoc Selector::select_forward */
+  Algorithm select_forward(Conv2DParams const& params) override {
+    return select_impl<conv_type::Forward>(params);
+  }
+
+  /** \copydoc Selector::select_input_backprop */
+  Algorithm select_input_backprop(Conv2DParams const& params) override {
+    return select_impl<conv_type::InputBackprop>(params);
+  }
+
+  /** \copydoc Selector::select_filter_backprop */
+  Algorithm select_filter_backprop(Conv2DParams const& params) override {
+    return select_impl<conv_type::FilterBackprop>(params);
+  }
+
+  /** \copydoc Selector::name */
+  char const* name() const override { return "AutotuneSelector"; }
+
+  /**
+   * Get the number of convolution configurations which have been benchmarked
+   * by this selector, excluding any loaded from the cache file.
+   * \return The number of benchmarked configurations.
+   */
+  size_t n_benchmarked() const { return n_benchmarked_; }
+
+ private:
+  /**
+   * Look up the selection in the cache, and benchmark the available
+   * algorithms if there is no cached entry.
+   */
+  template <typename ConvType>
+  Algorithm select_impl(Conv2DParams const& params) {
+    auto const key = make_key<ConvType>(params);
+    auto cached = cache_.find(key);
+    if (cached != cache_.end()) {
+      return cached->second;
+    }
+    auto const algo = benchmark<ConvType>(params);
+    cache_.emplace(key, algo);
+    append_to_cache_file(key, algo);
+    return algo;
+  }
+
+  /**
+   * Time every algorithm which supports the convolution parameters and return
+   * the fastest. Falls back to the default selector if no algorithm could be
+   * launched successfully.
+   */
+  template <typename ConvType>
+  Algorithm benchmark(Conv2DParams const& params) {
+    ++n_benchmarked_;
+    auto const sizes = get_sizes<ConvType>(params);
+    auto input = backend_.template allocate<T>(sizes.input_size);
+    auto filter = backend_.template allocate<T>(sizes.filter_size);
+    auto output = backend_.template allocate<T>(sizes.output_size);
+
+    Algorithm best_algo = Algorithm::NotSupported;
+    double best_time = std::numeric_limits<double>::max();
+    for (auto& candidate : candidates_) {
+      auto const algo = candidate->template select<ConvType>(params);
+      if (algo == Algorithm::NotSupported) {
+        continue;
+      }
+      auto const workspace_size =
+          query_workspace_size<ConvType>(params, *candidate).recommended_size;
+      // Zero sized allocations are not supported by all backends.
+      auto workspace = backend_.template allocate<T>(
+          std::max<size_t>(workspace_size, 1));
+      double const time = time_algorithm<ConvType>(
+          input, filter, output, workspace, workspace_size, params, *candidate);
+      backend_.template deallocate<T>(workspace);
+      if (time < best_time) {
+        best_time = time;
+        best_algo = algo;
+      }
+    }
+    backend_.template deallocate<T>(output);
+    backend_.template deallocate<T>(filter);
+    backend_.template deallocate<T>(input);
+
+    if (best_algo == Algorithm::NotSupported) {
+      best_algo = fallback_->template select<ConvType>(params);
+    }
+    return best_algo;
+  }
+
+  /**
+   * Launch a convolution using the given selector and return the mean time
+   * per run in milliseconds, or the maximum double value if the convolution
+   * could not be launched.
+   */
+  template <typename ConvType, typename Pointer>
+  double time_algorithm(Pointer input, Pointer filter, Pointer output,
+                        Pointer workspace, size_t workspace_size,
+                        Conv2DParams const& params, Selector& selector) {
+    auto launch_once = [&]() {
+      return sublaunch<T, ConvType, Backend>(input, filter, output, params,
+                                             selector, backend_, workspace,
+                                             workspace_size, {});
+    };
+    try {
+      // Warm up run to ensure that any kernels are compiled and cached before
+      // timing.
+      auto status = launch_once();
+      if (status.status != StatusCode::OK) {
+        return std::numeric_limits<double>::max();
+      }
+      status.event.wait_and_throw();
+
+      auto start = std::chrono::high_resolution_clock::now();
+      for (int i = 0; i < n_runs_; ++i) {
+        status = launch_once();
+        if (status.status != StatusCode::OK) {
+          return std::numeric_limits<double>::max();
+        }
+      }
+      status.event.wait_and_throw();
+      auto stop = std::chrono::high_resolution_clock::now();
+      return std::chrono::duration<double, std::milli>(stop - start).count() /
+             n_runs_;
+    } catch (cl::sycl::exception const&) {
+      return std::numeric_limits<double>::max();
+    } catch (std::exception const&) {
+      return std::numeric_limits<double>::max();
+    }
+  }
+
+  /** Construct the cache key for the convolution on this device. */
+  template <typename ConvType>
+  std::string make_key(Conv2DParams const& params) const {
+    return device_key_ + '|' + internal::conv_type_name<ConvType>() + '|' +
+           internal::params_to_key(params);
+  }
+
+  /**
+   * Load any cached selections from the cache file. Each line in the file has
+   * the form `<key> <algorithm>`, where the algorithm is stored as an integer
+   * after the final space in the line.
+   */
+  void load_cache_file() {
+    if (cache_file_.empty()) {
+      return;
+    }
+    std::ifstream file{cache_file_};
+    std::string line;
+    while (std::getline(file, line)) {
+      auto const split = line.find_last_of(' ');
+      if (split == std::string::npos) {
+        continue;
+      }
+      auto const key = line.substr(0, split);
+      // Only keep entries which were tuned on this device, including the
+      // separator so that one driver version cannot match a prefix of another.
+      auto const device_prefix = device_key_ + '|';
+      if (key.compare(0, device_prefix.size(), device_prefix) != 0) {
+        continue;
+      }
+      int algo_id;
+      if (!(std::istringstream{line.substr(split + 1)} >> algo_id)) {
+        continue;
+      }
+      // Skip entries from stale or corrupt cache files which do not name a
+      // known algorithm.
+      if (algo_id <= static_cast<int>(Algorithm::NotSupported) ||
+          algo_id >= static_cast<int>(Algorithm::NumAlgorithms)) {
+        continue;
+      }
+      cache_[key] = static_cast<Algorithm>(algo_id);
+    }
+  }
+
+  /** Append a new selection to the cache file, if one was provided. */
+  void append_to_cache_file(std::string const& key, Algorithm algo) {
+    if (cache_file_.empty()) {
+      return;
+    }
+    std::ofstream file{cache_file_, std::ios::app};
+    file << key << ' ' << static_cast<int>(algo) << '\n';
+  }
+
+  /** Backend used to allocate memory and run the benchmarks. */
+  Backend& backend_;
+  /** Path to the persistent cache file. */
+  std::string cache_file_;
+  /** Number of timed runs per algorithm. */
+  int n_runs_;
+  /** Selector used if none of the candidates could be launched. */
+  std::unique_ptr<Selector> fallback_;
+  /** Device name and driver version, used as a prefix for cache keys. */
+  std::string device_key_;
+  /** Selectors which each return a single algorithm where supported. */
+  std::vector<std::unique_ptr<Selector>> candidates_;
+  /** Map from cache key to the fastest algorithm. */
+  std::unordered_map<std::string, Algorithm> cache_;
+  /** Number of configurations benchmarked by this selector. */
+  size_t n_benchmarked_ = 0;
+};
+
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_INCLUDE_CONV2D_SELECTOR_AUTOTUNE_SELECTOR_H_
@@ -89,6 +89,8 @@ class ConstantSelector final : public Selector {
         return "Tiled";
       case Algorithm::Im2col:
         return "Im2col";
+      case Algorithm::ImplicitGemm:
+        return "ImplicitGemm";
       default:
         SNN_ASSERT(false, "Unsupported algorithm in ConstantSelector::name()");
         return nullptr;
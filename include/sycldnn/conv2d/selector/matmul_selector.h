@@ -46,7 +46,9 @@ class MatmulSelector final : public Selector {
     bool right_window = (params.window_rows == 1 && params.window_cols == 1);
     bool right_pad = (params.pad_rows == 0 && params.pad_cols == 0);
     bool right_format = (params.input_format == DataFormat::NHWC &&
-                         params.filter_format == FilterFormat::HWCF);
+                         params.filter_format == FilterFormat::HWCF) ||
+                        (params.input_format == DataFormat::NCHW &&
+                         params.filter_format == FilterFormat::FCHW);
 
     if (right_stride && right_window && right_pad && right_format) {
       return Algorithm::Matmul;
@@ -18,9 +18,10 @@
 
 /**
  * \file
- * Contains the definition of the \ref sycldnn::conv2d::TiledSelector class.
- * This concrete implementation of \ref sycldnn::conv2d::Selector will always
- * attempt to select the tiled convolution where supported.
+ * Contains the definitions of the \ref sycldnn::conv2d::TiledSelector and
+ * \ref sycldnn::conv2d::TiledLocalSelector classes. These concrete
+ * implementations of \ref sycldnn::conv2d::Selector will always attempt to
+ * select the corresponding tiled convolution where supported.
  */
 #include "sycldnn/conv2d/algorithm.h"
 #include "sycldnn/conv2d/params.h"
@@ -85,7 +86,80 @@ class TiledSelector final : public Selector {
   }
 
   /**
-   * The tiled implementation does not support filter backprop.
+   * Selects an appropriate convolution algorithm for the target platform, given
+   * a set of convolution parameters, for filter backprop convolutions.
+   *
+   * The tiled filter backprop kernel supports any window size and stride, but
+   * requires NHWC input and HWCF filter layouts.
+   * \param params The convolution parameters (i.e. the shapes of the tensors,
+   * and strides used by the convolution).
+   * \return Returns Algorithm::Tiled where tiled algorithms are supported,
+   * or Algorithm::NotSupported otherwise.
+   */
+  Algorithm select_filter_backprop(Conv2DParams const& params) override {
+    if (params.input_format != DataFormat::NHWC ||
+        params.filter_format != FilterFormat::HWCF) {
+      return Algorithm::NotSupported;
+    }
+    return Algorithm::Tiled;
+  }
+
+  /**
+   * Gets the name of the selector.
+   * \return Returns a character string containing the descriptive name of the
+   * selector.
+   */
+  char const* name() const override { return "TiledSelector"; }
+};
+
+/**
+ * A selector which will return the local memory tiled algorithm if
+ * supported.
+ */
+class TiledLocalSelector final : public Selector {
+ public:
+  /**
+   * Selects an appropriate convolution algorithm for the target platform, given
+   * a set of convolution parameters, for forward convolutions.
+   * \param params The convolution parameters (i.e. the shapes of the tensors,
+   * and strides used by the convolution).
+   * \return Returns Algorithm::TiledLocal where the local memory tiled
+   * algorithm is supported, or Algorithm::NotSupported otherwise.
+   */
+  Algorithm select_forward(Conv2DParams const& params) override {
+    if (!is_supported_window(params)) {
+      return Algorithm::NotSupported;
+    }
+    if (params.window_rows == 3 &&
+        (params.stride_rows == 1 || params.stride_rows == 2)) {
+      return Algorithm::TiledLocal;
+    }
+    if (params.window_rows == 5 && params.stride_rows == 1) {
+      return Algorithm::TiledLocal;
+    }
+    return Algorithm::NotSupported;
+  }
+
+  /**
+   * Selects an appropriate convolution algorithm for the target platform, given
+   * a set of convolution parameters, for input backprop convolutions.
+   * \param params The convolution parameters (i.e. the shapes of the tensors,
+   * and strides used by the convolution).
+   * \return Returns Algorithm::TiledLocal where the local memory tiled
+   * algorithm is supported, or Algorithm::NotSupported otherwise.
+   */
+  Algorithm select_input_backprop(Conv2DParams const& params) override {
+    if (!is_supported_window(params) || params.stride_rows != 1) {
+      return Algorithm::NotSupported;
+    }
+    if (params.window_rows == 3 || params.window_rows == 5) {
+      return Algorithm::TiledLocal;
+    }
+    return Algorithm::NotSupported;
+  }
+
+  /**
+   * The local memory tiled implementation does not support filter backprop.
    * \param params The convolution parameters (i.e. the shapes of the tensors,
    * and strides used by the convolution).
    * \return Returns Algorithm::NotSupported.
@@ -100,7 +174,15 @@ class TiledSelector final : public Selector {
    * \return Returns a character string containing the descriptive name of the
    * selector.
    */
-  char const* name() const override { return "TiledSelector"; }
+  char const* name() const override { return "TiledLocalSelector"; }
+
+ private:
+  /** Check for square, undilated windows with equal strides. */
+  static bool is_supported_window(Conv2DParams const& params) {
+    return params.window_rows == params.window_cols &&
+           params.stride_rows == params.stride_cols &&
+           params.dilation_rows == 1 && params.dilation_cols == 1;
+  }
 };
 }  // namespace conv2d
 }  // namespace sycldnn
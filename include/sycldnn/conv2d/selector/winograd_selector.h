@@ -42,7 +42,8 @@ class WinogradSelector final : public Selector {
    * supported, or Algorithm::NotSupported otherwise.
    */
   Algorithm select_forward(Conv2DParams const& params) override {
-    if (params.stride_rows != 1 && params.stride_cols != 1) {
+    if (params.stride_rows != 1 || params.stride_cols != 1 ||
+        params.dilation_rows != 1 || params.dilation_cols != 1) {
       return Algorithm::NotSupported;
     }
     if (params.window_rows == 1 && params.window_cols == 3) {
@@ -66,7 +67,8 @@ class WinogradSelector final : public Selector {
    * supported, or Algorithm::NotSupported otherwise.
    */
   Algorithm select_input_backprop(Conv2DParams const& params) override {
-    if (params.stride_rows != 1 && params.stride_cols != 1) {
+    if (params.stride_rows != 1 || params.stride_cols != 1 ||
+        params.dilation_rows != 1 || params.dilation_cols != 1) {
       return Algorithm::NotSupported;
     }
     if (params.window_rows == 1 && params.window_cols == 3) {
@@ -90,7 +92,8 @@ class WinogradSelector final : public Selector {
    * supported, or Algorithm::NotSupported otherwise.
    */
   Algorithm select_filter_backprop(Conv2DParams const& params) override {
-    if (params.stride_rows != 1 && params.stride_cols != 1) {
+    if (params.stride_rows != 1 || params.stride_cols != 1 ||
+        params.dilation_rows != 1 || params.dilation_cols != 1) {
       return Algorithm::NotSupported;
     }
     if (params.window_rows == 1 && params.window_cols == 3) {
@@ -126,7 +129,8 @@ class WinogradLargeSelector final : public Selector {
    * supported, or Algorithm::NotSupported otherwise.
    */
   Algorithm select_forward(Conv2DParams const& params) override {
-    if (params.stride_rows != 1 && params.stride_cols != 1) {
+    if (params.stride_rows != 1 || params.stride_cols != 1 ||
+        params.dilation_rows != 1 || params.dilation_cols != 1) {
       return Algorithm::NotSupported;
     }
     if (params.window_rows == 3 && params.window_cols == 3) {
@@ -145,7 +149,8 @@ class WinogradLargeSelector final : public Selector {
    * supported, or Algorithm::NotSupported otherwise.
    */
   Algorithm select_input_backprop(Conv2DParams const& params) override {
-    if (params.stride_rows != 1 && params.stride_cols != 1) {
+    if (params.stride_rows != 1 || params.stride_cols != 1 ||
+        params.dilation_rows != 1 || params.dilation_cols != 1) {
       return Algorithm::NotSupported;
     }
     if (params.window_rows == 3 && params.window_cols == 3) {
@@ -164,7 +169,8 @@ class WinogradLargeSelector final : public Selector {
    * supported, or Algorithm::NotSupported otherwise.
    */
   Algorithm select_filter_backprop(Conv2DParams const& params) override {
-    if (params.stride_rows != 1 && params.stride_cols != 1) {
+    if (params.stride_rows != 1 || params.stride_cols != 1 ||
+        params.dilation_rows != 1 || params.dilation_cols != 1) {
       return Algorithm::NotSupported;
     }
     if (params.window_rows == 3 && params.window_cols == 3) {
@@ -181,6 +187,171 @@ class WinogradLargeSelector final : public Selector {
   char const* name() const override { return "WinogradLargeSelector"; }
 };
 
+/**
+ * A selector which returns the Winograd6x6 algorithm if supported, which
+ * computes F(6x6, 3x3) Winograd tiles.
+ */
+class Winograd6x6Selector final : public Selector {
+ public:
+  /**
+   * Selects the Winograd6x6 algorithm when supported for the provided
+   * convolution parameters, otherwise NotSupported.
+   *
+   * \param params The convolution parameters (i.e. the shapes of the tensors,
+   * and strides used by the convolution).
+   * \return Returns Algorithm::Winograd6x6 when the Winograd algorithm is
+   * supported, or Algorithm::NotSupported otherwise.
+   */
+  Algorithm select_forward(Conv2DParams const& params) override {
+    if (params.stride_rows != 1 || params.stride_cols != 1 ||
+        params.dilation_rows != 1 || params.dilation_cols != 1) {
+      return Algorithm::NotSupported;
+    }
+    if (params.window_rows == 3 && params.window_cols == 3) {
+      return Algorithm::Winograd6x6;
+    }
+    return Algorithm::NotSupported;
+  }
+
+  /**
+   * Selects the Winograd6x6 algorithm when supported for the provided
+   * convolution parameters, otherwise NotSupported.
+   *
+   * \param params The convolution parameters (i.e. the shapes of the tensors,
+   * and strides used by the convolution).
+   * \return Returns Algorithm::Winograd6x6 when the Winograd algorithm is
+   * supported, or Algorithm::NotSupported otherwise.
+   */
+  Algorithm select_input_backprop(Conv2DParams const& params) override {
+    return select_forward(params);
+  }
+
+  /**
+   * The Winograd6x6 algorithm is not implemented for filter backprop.
+   * \return Returns Algorithm::NotSupported.
+   */
+  Algorithm select_filter_backprop(Conv2DParams const& /*params*/) override {
+    return Algorithm::NotSupported;
+  }
+
+  /**
+   * Gets the name of the selector.
+   * \return Returns a character string containing the descriptive name of the
+   * selector.
+   */
+  char const* name() const override { return "Winograd6x6Selector"; }
+};
+
+/**
+ * A selector which returns the Winograd5x5 algorithm if supported, which
+ * computes F(2x2, 5x5) Winograd tiles.
+ */
+class Winograd5x5Selector final : public Selector {
+ public:
+  /**
+   * Selects the Winograd5x5 algorithm when supported for the provided
+   * convolution parameters, otherwise NotSupported.
+   *
+   * \param params The convolution parameters (i.e. the shapes of the tensors,
+   * and strides used by the convolution).
+   * \return Returns Algorithm::Winograd5x5 when the Winograd algorithm is
+   * supported, or Algorithm::NotSupported otherwise.
+   */
+  Algorithm select_forward(Conv2DParams const& params) override {
+    if (params.stride_rows != 1 || params.stride_cols != 1 ||
+        params.dilation_rows != 1 || params.dilation_cols != 1) {
+      return Algorithm::NotSupported;
+    }
+    if (params.window_rows == 5 && params.window_cols == 5) {
+      return Algorithm::Winograd5x5;
+    }
+    return Algorithm::NotSupported;
+  }
+
+  /**
+   * Selects the Winograd5x5 algorithm when supported for the provided
+   * convolution parameters, otherwise NotSupported.
+   *
+   * \param params The convolution parameters (i.e. the shapes of the tensors,
+   * and strides used by the convolution).
+   * \return Returns Algorithm::Winograd5x5 when the Winograd algorithm is
+   * supported, or Algorithm::NotSupported otherwise.
+   */
+  Algorithm select_input_backprop(Conv2DParams const& params) override {
+    return select_forward(params);
+  }
+
+  /**
+   * The Winograd5x5 algorithm is not implemented for filter backprop.
+   * \return Returns Algorithm::NotSupported.
+   */
+  Algorithm select_filter_backprop(Conv2DParams const& /*params*/) override {
+    return Algorithm::NotSupported;
+  }
+
+  /**
+   * Gets the name of the selector.
+   * \return Returns a character string containing the descriptive name of the
+   * selector.
+   */
+  char const* name() const override { return "Winograd5x5Selector"; }
+};
+
+/**
+ * A selector which returns the Winograd5x5Large algorithm if supported, which
+ * computes F(4x4, 5x5) Winograd tiles.
+ */
+class Winograd5x5LargeSelector final : public Selector {
+ public:
+  /**
+   * Selects the Winograd5x5Large algorithm when supported for the provided
+   * convolution parameters, otherwise NotSupported.
+   *
+   * \param params The convolution parameters (i.e. the shapes of the tensors,
+   * and strides used by the convolution).
+   * \return Returns Algorithm::Winograd5x5Large when the Winograd algorithm is
+   * supported, or Algorithm::NotSupported otherwise.
+   */
+  Algorithm select_forward(Conv2DParams const& params) override {
+    if (params.stride_rows != 1 || params.stride_cols != 1 ||
+        params.dilation_rows != 1 || params.dilation_cols != 1) {
+      return Algorithm::NotSupported;
+    }
+    if (params.window_rows == 5 && params.window_cols == 5) {
+      return Algorithm::Winograd5x5Large;
+    }
+    return Algorithm::NotSupported;
+  }
+
+  /**
+   * Selects the Winograd5x5Large algorithm when supported for the provided
+   * convolution parameters, otherwise NotSupported.
+   *
+   * \param params The convolution parameters (i.e. the shapes of the tensors,
+   * and strides used by the convolution).
+   * \return Returns Algorithm::Winograd5x5Large when the Winograd algorithm is
+   * supported, or Algorithm::NotSupported otherwise.
+   */
+  Algorithm select_input_backprop(Conv2DParams const& params) override {
+    return select_forward(params);
+  }
+
+  /**
+   * The Winograd5x5Large algorithm is not implemented for filter backprop.
+   * \return Returns Algorithm::NotSupported.
+   */
+  Algorithm select_filter_backprop(Conv2DParams const& /*params*/) override {
+    return Algorithm::NotSupported;
+  }
+
+  /**
+   * Gets the name of the selector.
+   * \return Returns a character string containing the descriptive name of the
+   * selector.
+   */
+  char const* name() const override { return "Winograd5x5LargeSelector"; }
+};
+
 }  // namespace conv2d
 }  // namespace sycldnn
 
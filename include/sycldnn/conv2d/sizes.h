@@ -114,6 +114,10 @@ inline ConvSizes get_spatial_sizes<conv_type::FilterBackprop>(
  * \brief Compute the spatial sizes (channel and/or feature) of the tensors used
  * in a convolution for the specified parameters.
  *
+ * For grouped convolutions the filter only holds the channels in a single
+ * group, so is smaller than the filter of an ungrouped convolution by a factor
+ * of the number of groups.
+ *
  * \param params The convolution parameters, containing the tensor sizes and
  *               filter strides.
  * \return Returns a \ref sycldnn::conv2d::ConvSizes instance, containing the
@@ -128,7 +132,7 @@ inline ConvSizes get_channel_sizes<conv_type::Forward>(
     Conv2DParams const& params) {
   size_t inp_size = params.channels;
   size_t fil_size = params.channels * params.features / params.groups;
-  size_t out_size = params.features / params.groups;
+  size_t out_size = params.features;
   ConvSizes sizes{inp_size, fil_size, out_size};
   return sizes;
 }
@@ -138,7 +142,7 @@ template <>
 inline ConvSizes get_channel_sizes<conv_type::InputBackprop>(
     Conv2DParams const& params) {
   size_t inp_size = params.features;
-  size_t fil_size = params.channels * params.features;
+  size_t fil_size = params.channels * params.features / params.groups;
   size_t out_size = params.channels;
   ConvSizes sizes{inp_size, fil_size, out_size};
   return sizes;
@@ -150,7 +154,7 @@ inline ConvSizes get_channel_sizes<conv_type::FilterBackprop>(
     Conv2DParams const& params) {
   size_t inp_size = params.channels;
   size_t fil_size = params.features;
-  size_t out_size = params.channels * params.features;
+  size_t out_size = params.channels * params.features / params.groups;
   ConvSizes sizes{inp_size, fil_size, out_size};
   return sizes;
 }
@@ -173,7 +177,7 @@ inline ConvSizes get_sizes(Conv2DParams const& params) {
   size_t fil_size = batch_sizes.filter_size * spatial_sizes.filter_size *
                     channel_sizes.filter_size;
   size_t out_size = batch_sizes.output_size * spatial_sizes.output_size *
-                    channel_sizes.output_size * params.groups;
+                    channel_sizes.output_size;
   ConvSizes sizes{inp_size, fil_size, out_size};
   return sizes;
 }
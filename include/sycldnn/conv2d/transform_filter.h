@@ -0,0 +1,157 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_CONV2D_TRANSFORM_FILTER_H_
+#define SYCLDNN_INCLUDE_CONV2D_TRANSFORM_FILTER_H_
+
+/**
+ * \file
+ * Implements the \ref sycldnn::conv2d::transform_filter() and
+ * \ref sycldnn::conv2d::launch_transformed() functions, which allow a filter
+ * that does not change between convolutions (such as the weights used for
+ * inference) to be transformed once and then reused for every convolution.
+ */
+
+#include "sycldnn/backend/backend_helpers.h"
+#include "sycldnn/conv2d/params.h"
+#include "sycldnn/conv2d/selector/selector.h"
+#include "sycldnn/internal/conv2d/transform_filter.h"
+#include "sycldnn/status.h"
+
+namespace sycldnn {
+namespace conv2d {
+
+/**
+ * Transform a filter into the layout used internally by the algorithm chosen
+ * by the Selector.
+ *
+ * The transformed filter can then be passed to launch_transformed() any number
+ * of times, avoiding the cost of transforming the filter on each convolution.
+ * The same selector must be used for both calls. The number of elements
+ * required for the transformed filter is given by
+ * query_transformed_filter_size().
+ *
+ * Only forward and input backprop convolutions using the im2col or Winograd
+ * algorithms are currently supported, for anything else
+ * StatusCode::InvalidAlgorithm is returned. For im2col the filter is packed
+ * into the layout used by the matrix multiply, including for grouped
+ * convolutions.
+ *
+ * \param filter A pointer to the memory representing the tensor of filter
+ *               coefficients.
+ * \param transformed A pointer to the memory to write the transformed filter
+ *                    to.
+ * \param params The convolution parameters, which describe the tensor shapes
+ *               and convolution strides.
+ * \param selector An instance of \ref sycldnn::conv2d::Selector, used to guide
+ *                 the selection of the most appropriate convolution algorithm.
+ * \param backend The backend implementation, used to map between pointer
+ *                representations.
+ * \return Returns an SNNStatus containing the SYCL event tied to the kernel
+ * launch and a StatusCode enum showing if the launch was OK or whether it
+ * encountered some problem.
+ */
+template <typename T, typename ConvType, typename Backend,
+          typename = typename std::enable_if<
+              sycldnn::backend::is_buffer_backend_v<Backend>>::type>
+SNNStatus transform_filter(
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T> transformed,
+    Conv2DParams const& params, Selector& selector, Backend& backend) {
+  return sublaunch_transform_filter<T, ConvType, Backend>(
+      filter, transformed, params, selector, backend, {});
+}
+
+/**
+ * \copydoc transform_filter
+ *
+ * \param events Optional vector of events which the transform will wait on
+ *               before launching the kernel, required for USM
+ */
+template <typename T, typename ConvType, typename Backend,
+          typename = typename std::enable_if<
+              sycldnn::backend::is_usm_backend_v<Backend>>::type>
+SNNStatus transform_filter(
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T> transformed,
+    Conv2DParams const& params, Selector& selector, Backend& backend,
+    const std::vector<cl::sycl::event>& events = {}) {
+  return sublaunch_transform_filter<T, ConvType, Backend>(
+      filter, transformed, params, selector, backend, events);
+}
+
+/**
+ * Launch a 2D convolution using a filter previously transformed by
+ * transform_filter(), with the implementation chosen by the Selector.
+ *
+ * The workspace buffer does not need to hold the filter transform, so should be
+ * sized using query_transformed_filter_workspace_size().
+ *
+ * \param input A pointer to the memory representing the input tensor.
+ * \param transformed A pointer to the memory holding the transformed filter.
+ * \param output A pointer to the memory representing the output tensor.
+ * \param params The convolution parameters, which describe the tensor shapes
+ *               and convolution strides.
+ * \param selector The same selector used to transform the filter.
+ * \param backend The backend implementation, used to provide optimized matrix
+ *                multiplies and to map between pointer representations.
+ * \param workspace Pointer to a workspace buffer for use whenever temporary
+ *                  memory is required.
+ * \param workspace_size The number of elements available in the workspace
+ *                       buffer.
+ * \return Returns an SNNStatus containing the SYCL event tied to the kernel
+ * launches and a StatusCode enum showing if the launch was OK or whether it
+ * encountered some problem.
+ */
+template <typename T, typename ConvType, typename Backend,
+          typename = typename std::enable_if<
+              sycldnn::backend::is_buffer_backend_v<Backend>>::type>
+SNNStatus launch_transformed(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T const> transformed,
+    typename Backend::template pointer_type<T> output,
+    Conv2DParams const& params, Selector& selector, Backend& backend,
+    typename Backend::template pointer_type<T> workspace,
+    size_t workspace_size) {
+  return sublaunch_transformed<T, ConvType, Backend>(
+      input, transformed, output, params, selector, backend, workspace,
+      workspace_size, {});
+}
+
+/**
+ * \copydoc launch_transformed
+ *
+ * \param events Optional vector of events which the convolution will wait on
+ *               before launching the kernels, required for USM
+ */
+template <typename T, typename ConvType, typename Backend,
+          typename = typename std::enable_if<
+              sycldnn::backend::is_usm_backend_v<Backend>>::type>
+SNNStatus launch_transformed(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T const> transformed,
+    typename Backend::template pointer_type<T> output,
+    Conv2DParams const& params, Selector& selector, Backend& backend,
+    typename Backend::template pointer_type<T> workspace,
+    size_t workspace_size, const std::vector<cl::sycl::event>& events = {}) {
+  return sublaunch_transformed<T, ConvType, Backend>(
+      input, transformed, output, params, selector, backend, workspace,
+      workspace_size, events);
+}
+
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_INCLUDE_CONV2D_TRANSFORM_FILTER_H_
@@ -24,8 +24,13 @@
 #include "sycldnn/internal/conv2d/im2col/tile_info.h"
 #include "sycldnn/internal/conv2d/im2col/transform_sizes.h"
 
+#include "sycldnn/internal/conv2d/tiled/filter_backprop_splits.h"
+
 #include "sycldnn/internal/conv2d/winograd/kernel_params.h"
 #include "sycldnn/internal/conv2d/winograd/tile_info.h"
+#include "sycldnn/internal/conv2d/winograd/tile_sizes.h"
+
+#include <algorithm>
 
 namespace sycldnn {
 namespace conv2d {
@@ -38,20 +43,43 @@ namespace conv2d {
  * less memory usage. If a workspace smaller than the recommended size is used
  * then the work will be batched into a number of kernels, rather than run in
  * one.
+ *
+ * Where the recommended size is too large, the overlap size gives a smaller
+ * workspace which holds two minibatches. The launcher then alternates between
+ * the two halves of the workspace, so that the transforms for one minibatch
+ * can run while the previous minibatch is still being computed.
  */
 struct WorkspaceSize {
   /** Minimum number of elements that a workspace buffer must hold. */
   size_t required_size;
   /** Recommended number of elements that a workspace buffer should hold. */
   size_t recommended_size;
+  /**
+   * Number of elements that a workspace buffer should hold to overlap
+   * consecutive minibatches. This is never larger than the recommended size,
+   * and is equal to it for algorithms which do not overlap minibatches.
+   */
+  size_t overlap_size;
 };
 
 namespace internal {
 
+/** Get the number of elements in a Winograd filter transform using the tile
+ * sizes specified in the template parameters. */
+template <typename ConvType, int M, int N, int R, int S>
+size_t winograd_impl_filter_transform_size(Conv2DParams const& params) {
+  static constexpr int A = M + R - 1;
+  static constexpr int B = N + S - 1;
+  auto kernel_params = winograd::get_params<ConvType>(params);
+  return A * B * kernel_params.channels * kernel_params.features;
+}
+
 /** Get the workspace sizes for Winograd using the tile sizes specified in the
- * template parameters. */
+ * template parameters. If the filter has already been transformed then the
+ * workspace does not need to hold the filter transform. */
 template <typename ConvType, int M, int N, int R, int S>
-WorkspaceSize winograd_impl_workspace_size(Conv2DParams const& params) {
+WorkspaceSize winograd_impl_workspace_size(Conv2DParams const& params,
+                                           bool filter_transformed = false) {
   static constexpr int A = M + R - 1;
   static constexpr int B = N + S - 1;
   auto kernel_params = winograd::get_params<ConvType>(params);
@@ -63,37 +91,96 @@ WorkspaceSize winograd_impl_workspace_size(Conv2DParams const& params) {
   size_t inter_transform_size =
       A * B * tile_info.number * kernel_params.features;
   size_t filter_transform_size =
-      A * B * kernel_params.channels * kernel_params.features;
+      filter_transformed
+          ? 0
+          : winograd_impl_filter_transform_size<ConvType, M, N, R, S>(params);
   size_t required_size =
       input_transform_size + inter_transform_size + filter_transform_size;
   size_t recommended_size =
       params.batch * (input_transform_size + inter_transform_size) +
       filter_transform_size;
-  return {required_size, recommended_size};
+  // The filter backprop accumulates into a single output transform, so does
+  // not overlap minibatches.
+  size_t overlap_size =
+      std::is_same<ConvType, conv_type::FilterBackprop>::value
+          ? recommended_size
+          : std::min(recommended_size,
+                     2 * (input_transform_size + inter_transform_size) +
+                         filter_transform_size);
+  return {required_size, recommended_size, overlap_size};
 }
 
 /** Get the workspace sizes for Winograd using the smaller tile sizes. */
 template <typename ConvType>
-WorkspaceSize workspace_size_for_winograd(Conv2DParams const& params) {
+WorkspaceSize workspace_size_for_winograd(Conv2DParams const& params,
+                                          bool filter_transformed = false) {
   // The choice of tile sizes here should match that used in
   // src/conv2d/winoograd/launch.cc
   if (std::is_same<ConvType, conv_type::FilterBackprop>::value) {
-    return winograd_impl_workspace_size<ConvType, 3, 3, 2, 2>(params);
+    return winograd_impl_workspace_size<ConvType, 3, 3, 2, 2>(
+        params, filter_transformed);
   } else {
-    return winograd_impl_workspace_size<ConvType, 2, 2, 3, 3>(params);
+    return winograd_impl_workspace_size<ConvType, 2, 2, 3, 3>(
+        params, filter_transformed);
   }
 }
 
 /** Get the workspace sizes for Winograd using the larger tile sizes. */
 template <typename ConvType>
-WorkspaceSize workspace_size_for_winograd_large(Conv2DParams const& params) {
+WorkspaceSize workspace_size_for_winograd_large(
+    Conv2DParams const& params, bool filter_transformed = false) {
   // The choice of tile sizes here should match that used in
   // src/conv2d/winoograd/launch.cc
   if (std::is_same<ConvType, conv_type::FilterBackprop>::value) {
-    return winograd_impl_workspace_size<ConvType, 3, 3, 3, 3>(params);
+    return winograd_impl_workspace_size<ConvType, 3, 3, 3, 3>(
+        params, filter_transformed);
   } else {
-    return winograd_impl_workspace_size<ConvType, 4, 4, 3, 3>(params);
+    return winograd_impl_workspace_size<ConvType, 4, 4, 3, 3>(
+        params, filter_transformed);
+  }
+}
+
+/** Get the size of the Winograd filter transform using the smaller tile
+ * sizes. */
+template <typename ConvType>
+size_t filter_transform_size_for_winograd(Conv2DParams const& params) {
+  if (params.window_rows == 3 && params.window_cols == 1) {
+    return winograd_impl_filter_transform_size<ConvType, 2, 1, 3, 1>(params);
+  }
+  if (params.window_rows == 1 && params.window_cols == 3) {
+    return winograd_impl_filter_transform_size<ConvType, 1, 2, 1, 3>(params);
+  }
+  return winograd_impl_filter_transform_size<ConvType, 2, 2, 3, 3>(params);
+}
+
+/** Get the size of the Winograd filter transform using the larger tile
+ * sizes. */
+template <typename ConvType>
+size_t filter_transform_size_for_winograd_large(Conv2DParams const& params) {
+  return winograd_impl_filter_transform_size<ConvType, 4, 4, 3, 3>(params);
+}
+
+/** Get the workspace sizes for one of the Winograd algorithms with a single
+ * fixed tile size. These are not supported for filter backprop, so no
+ * workspace is required. */
+template <typename ConvType, Algorithm Algo>
+WorkspaceSize workspace_size_for_winograd_fixed(
+    Conv2DParams const& params, bool filter_transformed = false) {
+  using Tiles = winograd::FixedTileSizes<Algo>;
+  if (std::is_same<ConvType, conv_type::FilterBackprop>::value) {
+    return {0, 0};
   }
+  return winograd_impl_workspace_size<ConvType, Tiles::M, Tiles::N, Tiles::R,
+                                      Tiles::S>(params, filter_transformed);
+}
+
+/** Get the size of the Winograd filter transform for one of the Winograd
+ * algorithms with a single fixed tile size. */
+template <typename ConvType, Algorithm Algo>
+size_t filter_transform_size_for_winograd_fixed(Conv2DParams const& params) {
+  using Tiles = winograd::FixedTileSizes<Algo>;
+  return winograd_impl_filter_transform_size<ConvType, Tiles::M, Tiles::N,
+                                             Tiles::R, Tiles::S>(params);
 }
 
 /** Get the workspace sizes needed for the Im2col transform tensors. */
@@ -101,22 +188,46 @@ template <typename ConvType>
 WorkspaceSize workspace_size_for_im2col(Conv2DParams const& params) {
   auto const transform_sizes = im2col::get_transform_sizes<ConvType>(params);
 
-  size_t required_size;
-  size_t recommended_size;
   // im2col convolution needs a workspace buffer large enough to hold
   // the input transform and the filter transform tensors for one image.
-  required_size = transform_sizes.input_transform_size +
-                  transform_sizes.filter_transform_size;
-  recommended_size = (params.batch * transform_sizes.input_transform_size) +
-                     transform_sizes.filter_transform_size;
+  size_t size_per_image = transform_sizes.input_transform_size;
   if (params.groups > 1 &&
       params.group_format == sycldnn::BatchFormat::STRIDED) {
     // NHWC strided group convolution also requires memory in the
     // workspace buffer large enough to transpose the output result
-    required_size += transform_sizes.output_transform_size;
-    recommended_size += params.batch * transform_sizes.output_transform_size;
+    size_per_image += transform_sizes.output_transform_size;
+  }
+  size_t const filter_size = transform_sizes.filter_transform_size;
+  size_t const required_size = size_per_image + filter_size;
+  size_t const recommended_size = params.batch * size_per_image + filter_size;
+  size_t const overlap_size =
+      std::min(recommended_size, 2 * size_per_image + filter_size);
+  return {required_size, recommended_size, overlap_size};
+}
+
+/** Get the workspace sizes needed for im2col when using a filter packed by
+ * sycldnn::conv2d::transform_filter(), so no filter transform is needed. */
+template <typename ConvType>
+WorkspaceSize workspace_size_for_im2col_packed(Conv2DParams const& params) {
+  auto const transform_sizes = im2col::get_transform_sizes<ConvType>(params);
+  size_t const size_per_image = transform_sizes.input_transform_size +
+                                transform_sizes.output_transform_size;
+  size_t const recommended_size = params.batch * size_per_image;
+  return {size_per_image, recommended_size,
+          std::min(recommended_size, 2 * size_per_image)};
+}
+
+/** Get the workspace sizes needed for the tiled algorithm. Only the filter
+ * backprop uses a workspace, to hold the partial filter gradients when its
+ * reduction is split across work-groups. The kernel runs without splitting
+ * the reduction when no workspace is provided. */
+template <typename ConvType>
+WorkspaceSize workspace_size_for_tiled(Conv2DParams const& params) {
+  if (!std::is_same<ConvType, conv_type::FilterBackprop>::value) {
+    return {0, 0};
   }
-  return {required_size, recommended_size};
+  size_t const partials_size = tiled::filter_backprop_workspace_size(params);
+  return {0, partials_size, partials_size};
 }
 
 /** Get the WorkspaceSize for the specified convolution using the provided
@@ -131,18 +242,89 @@ WorkspaceSize query_workspace_size(Conv2DParams const& params,
     case Algorithm::WinogradLarge:
       return workspace_size_for_winograd_large<ConvType>(params);
       break;
+    case Algorithm::Winograd6x6:
+      return workspace_size_for_winograd_fixed<
+          ConvType, Algorithm::Winograd6x6>(params);
+    case Algorithm::Winograd5x5:
+      return workspace_size_for_winograd_fixed<
+          ConvType, Algorithm::Winograd5x5>(params);
+    case Algorithm::Winograd5x5Large:
+      return workspace_size_for_winograd_fixed<
+          ConvType, Algorithm::Winograd5x5Large>(params);
     case Algorithm::Im2col:
       return workspace_size_for_im2col<ConvType>(params);
       break;
-    case Algorithm::Direct:
     case Algorithm::Tiled:
+      return workspace_size_for_tiled<ConvType>(params);
+    case Algorithm::Direct:
+    case Algorithm::TiledLocal:
+    case Algorithm::ImplicitGemm:
     case Algorithm::Matmul:
     case Algorithm::NotSupported:
+    case Algorithm::NumAlgorithms:
       return {0, 0};
   }
   SNN_ASSERT(false, "Invalid algorithm passed to query_workspace_size.");
   return {0, 0};
 }
+/** Get the WorkspaceSize for the specified convolution using the provided
+ * Algorithm when the filter has already been transformed with
+ * sycldnn::conv2d::transform_filter(). */
+template <typename ConvType>
+WorkspaceSize query_transformed_filter_workspace_size(
+    Conv2DParams const& params, Algorithm algorithm) {
+  if (std::is_same<ConvType, conv_type::FilterBackprop>::value) {
+    return {0, 0};
+  }
+  switch (algorithm) {
+    case Algorithm::Im2col:
+      return workspace_size_for_im2col_packed<ConvType>(params);
+    case Algorithm::Winograd:
+      return workspace_size_for_winograd<ConvType>(params, true);
+    case Algorithm::WinogradLarge:
+      return workspace_size_for_winograd_large<ConvType>(params, true);
+    case Algorithm::Winograd6x6:
+      return workspace_size_for_winograd_fixed<
+          ConvType, Algorithm::Winograd6x6>(params, true);
+    case Algorithm::Winograd5x5:
+      return workspace_size_for_winograd_fixed<
+          ConvType, Algorithm::Winograd5x5>(params, true);
+    case Algorithm::Winograd5x5Large:
+      return workspace_size_for_winograd_fixed<
+          ConvType, Algorithm::Winograd5x5Large>(params, true);
+    default:
+      return {0, 0};
+  }
+}
+
+/** Get the number of elements required to hold the transformed filter for the
+ * specified convolution using the provided Algorithm. */
+template <typename ConvType>
+size_t query_transformed_filter_size(Conv2DParams const& params,
+                                     Algorithm algorithm) {
+  if (std::is_same<ConvType, conv_type::FilterBackprop>::value) {
+    return 0;
+  }
+  switch (algorithm) {
+    case Algorithm::Im2col:
+      return im2col::packed_filter_size<ConvType>(params);
+    case Algorithm::Winograd:
+      return filter_transform_size_for_winograd<ConvType>(params);
+    case Algorithm::WinogradLarge:
+      return filter_transform_size_for_winograd_large<ConvType>(params);
+    case Algorithm::Winograd6x6:
+      return filter_transform_size_for_winograd_fixed<
+          ConvType, Algorithm::Winograd6x6>(params);
+    case Algorithm::Winograd5x5:
+      return filter_transform_size_for_winograd_fixed<
+          ConvType, Algorithm::Winograd5x5>(params);
+    case Algorithm::Winograd5x5Large:
+      return filter_transform_size_for_winograd_fixed<
+          ConvType, Algorithm::Winograd5x5Large>(params);
+    default:
+      return 0;
+  }
+}
 }  // namespace internal
 
 /**
@@ -162,6 +344,42 @@ WorkspaceSize query_workspace_size(Conv2DParams const& params,
       params, selector.select<ConvType>(params));
 }
 
+/**
+ * Query the number of elements that a workspace buffer must hold in order to be
+ * used in sycldnn::conv2d::launch_transformed(), where the filter has already
+ * been transformed and so the workspace does not need to hold the filter
+ * transform.
+ *
+ * \param params Convolution parameters describing the computation.
+ * \param selector Selector to use to determine which algorithm to use.
+ *
+ * \return A WorkspaceSize struct containing the minimum required and
+ *         recommended number of elements that a workspace buffer should hold.
+ */
+template <typename ConvType>
+WorkspaceSize query_transformed_filter_workspace_size(
+    Conv2DParams const& params, Selector& selector) {
+  return internal::query_transformed_filter_workspace_size<ConvType>(
+      params, selector.select<ConvType>(params));
+}
+
+/**
+ * Query the number of elements that a buffer must hold to store the filter
+ * transformed by sycldnn::conv2d::transform_filter().
+ *
+ * \param params Convolution parameters describing the computation.
+ * \param selector Selector to use to determine which algorithm to use.
+ *
+ * \return The number of elements required for the transformed filter, or zero
+ *         if the selected algorithm does not support pre-transformed filters.
+ */
+template <typename ConvType>
+size_t query_transformed_filter_size(Conv2DParams const& params,
+                                     Selector& selector) {
+  return internal::query_transformed_filter_size<ConvType>(
+      params, selector.select<ConvType>(params));
+}
+
 }  // namespace conv2d
 }  // namespace sycldnn
 
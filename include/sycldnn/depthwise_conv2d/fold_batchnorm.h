@@ -0,0 +1,88 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_DEPTHWISE_CONV2D_FOLD_BATCHNORM_H_
+#define SYCLDNN_INCLUDE_DEPTHWISE_CONV2D_FOLD_BATCHNORM_H_
+
+/**
+ * \file
+ * Contains the \ref sycldnn::depthwise_conv2d::fold_batchnorm() function,
+ * which folds a frozen batchnorm into the filter and bias of the preceding
+ * depthwise convolution.
+ */
+#include "sycldnn/filter_format.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/conv2d/conv_type.h"
+
+#include "sycldnn/depthwise_conv2d/params.h"
+#include "sycldnn/depthwise_conv2d/sizes.h"
+
+#include "sycldnn/helpers/macros.h"
+
+#include "sycldnn/internal/conv2d/fold_batchnorm.h"
+
+#include <optional>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+namespace sycldnn {
+namespace depthwise_conv2d {
+
+/**
+ * Fold a frozen batchnorm into the filter and bias of the depthwise
+ * convolution which precedes it.
+ *
+ * The depthwise convolution has channels * channel_multiplier output
+ * features, so the batchnorm tensors and the bias must hold that many values.
+ *
+ * \copydetails sycldnn::conv2d::fold_batchnorm()
+ */
+template <typename T, typename Backend>
+SNNStatus fold_batchnorm(
+    typename Backend::template pointer_type<T const> filter,
+    std::optional<typename Backend::template pointer_type<T const>> bias,
+    typename Backend::template pointer_type<T const> gamma,
+    typename Backend::template pointer_type<T const> beta,
+    typename Backend::template pointer_type<T const> mean,
+    typename Backend::template pointer_type<T const> variance,
+    typename Backend::template pointer_type<T> folded_filter,
+    typename Backend::template pointer_type<T> folded_bias,
+    DepthwiseConv2DParams const& params, float epsilon, Backend& backend,
+    const std::vector<cl::sycl::event>& events = {}) {
+  SNN_VALIDATE_PARAM(params.channels > 0,
+                     "The number of channels must be positive.");
+  SNN_VALIDATE_PARAM(params.channel_multiplier > 0,
+                     "The channel multiplier must be positive.");
+  SNN_VALIDATE_PARAM(params.filter_format == sycldnn::FilterFormat::HWCF,
+                     "Only HWCF filter format is supported.");
+  SNN_VALIDATE_PARAM(epsilon >= 0.f, "Epsilon must be non-negative.");
+
+  // The HWCM depthwise filter has its output features, indexed by
+  // channel * channel_multiplier + multiplier, as the innermost dimension.
+  auto conv_sizes = get_sizes<conv2d::conv_type::Forward>(params);
+  size_t const features =
+      static_cast<size_t>(params.channels) * params.channel_multiplier;
+  conv2d::internal::FoldSizes const sizes{conv_sizes.filter_size, features, 1};
+  return conv2d::internal::fold_batchnorm<T>(
+      filter, bias, gamma, beta, mean, variance, folded_filter, folded_bias,
+      epsilon, sizes, backend, events);
+}
+
+}  // namespace depthwise_conv2d
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_INCLUDE_DEPTHWISE_CONV2D_FOLD_BATCHNORM_H_
@@ -16,6 +16,8 @@
 #ifndef INCLUDE_SYCLDNN_HELPERS_MEM_UTILS_H_
 #define INCLUDE_SYCLDNN_HELPERS_MEM_UTILS_H_
 
+#include "sycldnn/helpers/macros.h"
+
 #include <CL/sycl.hpp>
 #include <type_traits>
 
@@ -36,6 +36,7 @@
 
 #include "sycldnn/helpers/event_handling.h"
 #include "sycldnn/helpers/mem_utils.h"
+#include "sycldnn/internal/helpers/scratch_space.h"
 #include "sycldnn/internal/transpose/launch.h"
 
 namespace sycldnn {
@@ -120,7 +121,6 @@ inline SNNStatus launch_batchnorm(
     const float epsilon, const std::vector<int>& input_dims,
     const std::vector<int>& channel_dims, cl::sycl::queue& queue,
     const std::vector<cl::sycl::event>& events) {
-  constexpr bool is_usm = is_usm_obj_v<MemObj<T>, T>;
   std::vector<cl::sycl::event> dependencies;
 
   SNNStatus status = binaryop::internal::launch_binaryop<binaryop::Sub>(
@@ -131,12 +131,8 @@ inline SNNStatus launch_batchnorm(
     return status;
   }
 
-  auto sycl_epsilon =
-      sycldnn::helpers::alloc_and_assign<T, is_usm>(1, &epsilon, queue);
-  auto epsilon_mem = make_mem_object<T const>(sycl_epsilon, 1);
-  status = binaryop::internal::launch_binaryop<binaryop::Add>(
-      current_variance, epsilon_mem, workspace, channel_dims, {1}, queue,
-      events);
+  status = binaryop::internal::launch_binaryop_scalar<binaryop::Add>(
+      current_variance, static_cast<T>(epsilon), workspace, queue, events);
   if (sycldnn::StatusCode::OK != status.status) {
     return status;
   }
@@ -170,10 +166,6 @@ inline SNNStatus launch_batchnorm(
   status = binaryop::internal::launch_binaryop<binaryop::Add>(
       const_output, beta, output, input_dims, channel_dims, queue,
       {status.event});
-
-  status.event =
-      sycldnn::helpers::enqueue_free(queue, {status.event}, sycl_epsilon);
-
   return status;
 }
 
@@ -184,21 +176,20 @@ inline SNNStatus launch_batchnorm(
 template <typename T, template <typename> class MemObj,
           typename = std::enable_if<is_mem_obj_v<MemObj<T>, T>>>
 inline SNNStatus launch_running_mean_variance(
-    MemObj<T const>& input, MemObj<T const>& momentum,
-    MemObj<T const>& one_minus_momentum, MemObj<T>& output,
+    MemObj<T const>& input, T momentum, MemObj<T>& output,
     MemObj<T>& workspace, int size, cl::sycl::queue& queue,
     const std::vector<cl::sycl::event>& events) {
   auto const_output = output.as_const();
-  SNNStatus status = binaryop::internal::launch_binaryop<binaryop::Mul>(
-      const_output, one_minus_momentum, output, {size}, {1}, queue, events);
+  SNNStatus status = binaryop::internal::launch_binaryop_scalar<binaryop::Mul>(
+      const_output, static_cast<T>(1 - momentum), output, queue, events);
   if (sycldnn::StatusCode::OK != status.status) {
     return status;
   }
 
-  SNNStatus status2 = binaryop::internal::launch_binaryop<binaryop::Mul>(
-      input, momentum, workspace, {size}, {1}, queue, events);
-  if (sycldnn::StatusCode::OK != status.status) {
-    return status;
+  SNNStatus status2 = binaryop::internal::launch_binaryop_scalar<binaryop::Mul>(
+      input, momentum, workspace, queue, events);
+  if (sycldnn::StatusCode::OK != status2.status) {
+    return status2;
   }
 
   auto const_workspace = workspace.as_const();
@@ -231,21 +222,27 @@ SNNStatus launch_forward(MemObj<T const>& input, MemObj<T const>& beta,
   auto channel_dims = get_4d_channel_dims(params);
 
   SNNStatus status;
-  std::vector<cl::sycl::event> dependencies = events;
 
-  auto sycl_auxiliary_input =
-      sycldnn::helpers::alloc<T, is_usm>(n_items, queue);
+  using Scratch = sycldnn::internal::helpers::ScratchSpace<Backend, is_usm>;
+  Scratch scratch{Scratch::template bytes_for<T>(n_items) +
+                      Scratch::template bytes_for<T>(params.channels),
+                  backend, "batchnorm"};
+  if (!scratch.valid()) {
+    return StatusCode::AllocationProblem;
+  }
+  auto dependencies = scratch.dependencies(events);
+
+  auto sycl_auxiliary_input = scratch.template take<T>(n_items);
   auto auxiliary_input =
       make_mem_object(sycl_auxiliary_input, n_items);  // Reused-later
 
-  auto sycl_workspace =
-      sycldnn::helpers::alloc<T, is_usm>(params.channels, queue);
+  auto sycl_workspace = scratch.template take<T>(params.channels);
   auto workspace = make_mem_object(sycl_workspace, params.channels);
 
   // auxiliary_input = centered_input
   status = launch_batchnorm(input, beta, gamma, input_mean, input_variance,
                             output, auxiliary_input, workspace, params.epsilon,
-                            input_dims, channel_dims, queue, events);
+                            input_dims, channel_dims, queue, dependencies);
   if (sycldnn::StatusCode::OK != status.status) {
     return status;
   }
@@ -280,18 +277,10 @@ SNNStatus launch_forward(MemObj<T const>& input, MemObj<T const>& beta,
     return status;
   }
 
-  auto sycl_momentum =
-      sycldnn::helpers::alloc_and_assign<T, is_usm>(1, &params.momentum, queue);
-  auto momentum = make_mem_object<T const>(sycl_momentum, 1);
-  const T one_minus_momentum_val = 1 - params.momentum;
-  auto sycl_one_minus_momentum = sycldnn::helpers::alloc_and_assign<T, is_usm>(
-      1, &one_minus_momentum_val, queue);
-  auto one_minus_momentum =
-      make_mem_object<T const>(sycl_one_minus_momentum, 1);
-
-  status = launch_running_mean_variance(
-      input_mean, momentum, one_minus_momentum, running_mean, workspace,
-      params.channels, queue, {status.event});
+  auto const momentum = static_cast<T>(params.momentum);
+  status = launch_running_mean_variance(input_mean, momentum, running_mean,
+                                        workspace, params.channels, queue,
+                                        {status.event});
   if (sycldnn::StatusCode::OK != status.status) {
     return status;
   }
@@ -303,13 +292,11 @@ SNNStatus launch_forward(MemObj<T const>& input, MemObj<T const>& beta,
     return status;
   }
 
-  status = launch_running_mean_variance(
-      input_variance, momentum, one_minus_momentum, running_variance, workspace,
-      params.channels, queue, {status.event});
+  status = launch_running_mean_variance(input_variance, momentum,
+                                        running_variance, workspace,
+                                        params.channels, queue, {status.event});
 
-  status.event = sycldnn::helpers::enqueue_free(
-      queue, {status.event}, sycl_auxiliary_input, sycl_workspace,
-      sycl_momentum, sycl_one_minus_momentum);
+  scratch.set_events({status.event});
   return status;
 }
 
@@ -334,20 +321,26 @@ SNNStatus launch_forward(MemObj<T const>& input, MemObj<T const>& beta,
   auto input_dims = get_input_dims(params);
   auto channel_dims = get_4d_channel_dims(params);
 
-  auto sycl_centered_input = sycldnn::helpers::alloc<T, is_usm>(n_items, queue);
+  using Scratch = sycldnn::internal::helpers::ScratchSpace<Backend, is_usm>;
+  Scratch scratch{Scratch::template bytes_for<T>(n_items) +
+                      Scratch::template bytes_for<T>(params.channels),
+                  backend, "batchnorm"};
+  if (!scratch.valid()) {
+    return StatusCode::AllocationProblem;
+  }
+
+  auto sycl_centered_input = scratch.template take<T>(n_items);
   auto centered_input = make_mem_object(sycl_centered_input, n_items);
 
-  auto sycl_workspace =
-      sycldnn::helpers::alloc<T, is_usm>(params.channels, queue);
+  auto sycl_workspace = scratch.template take<T>(params.channels);
   auto workspace = make_mem_object(sycl_workspace, params.channels);
 
-  SNNStatus status =
-      launch_batchnorm(input, beta, gamma, running_mean, running_variance,
-                       output, centered_input, workspace, params.epsilon,
-                       input_dims, channel_dims, queue, events);
+  SNNStatus status = launch_batchnorm(
+      input, beta, gamma, running_mean, running_variance, output,
+      centered_input, workspace, params.epsilon, input_dims, channel_dims,
+      queue, scratch.dependencies(events));
 
-  status.event = sycldnn::helpers::enqueue_free(
-      queue, {status.event}, sycl_centered_input, sycl_workspace);
+  scratch.set_events({status.event});
 
   return status;
 }
@@ -373,20 +366,29 @@ SNNStatus launch_gradient(MemObj<T const>& input, MemObj<T const>& gradient,
   auto queue = backend.get_queue();
   const bool is_nchw = params.input_format == DataFormat::NCHW;
   SNNStatus status;
-  std::vector<cl::sycl::event> beta_grad_deps = events;
-  std::vector<cl::sycl::event> scaled_input_deps = events;
-  std::vector<cl::sycl::event> mean_input_deps = events;
 
-  auto sycl_tr_input = sycldnn::helpers::alloc<T, is_usm>(n_items, queue);
+  using Scratch = sycldnn::internal::helpers::ScratchSpace<Backend, is_usm>;
+  Scratch scratch{3 * Scratch::template bytes_for<T>(n_items) +
+                      3 * Scratch::template bytes_for<T>(params.channels),
+                  backend, "batchnorm"};
+  if (!scratch.valid()) {
+    return StatusCode::AllocationProblem;
+  }
+  auto const scratch_deps = scratch.dependencies(events);
+  std::vector<cl::sycl::event> beta_grad_deps = scratch_deps;
+  std::vector<cl::sycl::event> scaled_input_deps = scratch_deps;
+  std::vector<cl::sycl::event> mean_input_deps = scratch_deps;
+
+  auto sycl_tr_input = scratch.template take<T>(n_items);
   auto tr_input = make_mem_object(sycl_tr_input, n_items);
-  auto sycl_tr_gradient = sycldnn::helpers::alloc<T, is_usm>(n_items, queue);
+  auto sycl_tr_gradient = scratch.template take<T>(n_items);
   auto tr_gradient = make_mem_object(sycl_tr_gradient, n_items);
   // Transpose NCHW input and gradient to NHWC to reduce NHW dimensions in one
   // go.
   if (is_nchw) {
     auto input_dims = get_input_dims(params);
     status = transpose::internal::launch(gradient, tr_gradient, input_dims,
-                                         NCHW_TO_NHWC, queue, events);
+                                         NCHW_TO_NHWC, queue, scratch_deps);
     beta_grad_deps = {status.event};
     scaled_input_deps = {status.event};
     if (sycldnn::StatusCode::OK != status.status) {
@@ -394,7 +396,7 @@ SNNStatus launch_gradient(MemObj<T const>& input, MemObj<T const>& gradient,
     }
 
     status = transpose::internal::launch(input, tr_input, input_dims,
-                                         NCHW_TO_NHWC, queue, events);
+                                         NCHW_TO_NHWC, queue, scratch_deps);
     mean_input_deps = {status.event};
     if (sycldnn::StatusCode::OK != status.status) {
       return status;
@@ -412,17 +414,12 @@ SNNStatus launch_gradient(MemObj<T const>& input, MemObj<T const>& gradient,
     return status;
   }
 
-  auto sycl_mean_gradient =
-      sycldnn::helpers::alloc<T, is_usm>(params.channels, queue);
+  auto sycl_mean_gradient = scratch.template take<T>(params.channels);
   auto mean_gradient = make_mem_object(sycl_mean_gradient, params.channels);
-  T num_elts_val = get_non_channel_size(params);
-  auto sycl_num_elts =
-      sycldnn::helpers::alloc_and_assign<T, is_usm>(1, &num_elts_val, queue);
-  auto num_elts = make_mem_object<T const>(sycl_num_elts, 1);
+  auto const num_elts = static_cast<T>(get_non_channel_size(params));
   auto const_beta_grad = beta_grad.as_const();
-  status = binaryop::internal::launch_binaryop<binaryop::Div>(
-      const_beta_grad, num_elts, mean_gradient, {params.channels}, {1}, queue,
-      mean_gradient_deps);
+  status = binaryop::internal::launch_binaryop_scalar<binaryop::Div>(
+      const_beta_grad, num_elts, mean_gradient, queue, mean_gradient_deps);
   std::vector<cl::sycl::event> output_binaryop_deps = {status.event};
   if (sycldnn::StatusCode::OK != status.status) {
     return status;
@@ -439,8 +436,7 @@ SNNStatus launch_gradient(MemObj<T const>& input, MemObj<T const>& gradient,
 
   auto const_tr_input = tr_input.as_const();
   auto& nhwc_input = is_nchw ? const_tr_input : input;
-  auto sycl_mean_input =
-      sycldnn::helpers::alloc<T, is_usm>(params.channels, queue);
+  auto sycl_mean_input = scratch.template take<T>(params.channels);
   auto mean_input = make_mem_object(sycl_mean_input, params.channels);
   status = reduce::internal::launch<reduce::Mean>(
       nhwc_input, mean_input, 1, get_non_channel_size(params), params.channels,
@@ -450,7 +446,7 @@ SNNStatus launch_gradient(MemObj<T const>& input, MemObj<T const>& gradient,
     return status;
   }
 
-  auto sycl_centered_input = sycldnn::helpers::alloc<T, is_usm>(n_items, queue);
+  auto sycl_centered_input = scratch.template take<T>(n_items);
   auto centered_input = make_mem_object(sycl_centered_input, n_items);
   auto const_mean_input = mean_input.as_const();
   status = sycldnn::binaryop::internal::launch_binaryop<sycldnn::binaryop::Sub>(
@@ -480,13 +476,11 @@ SNNStatus launch_gradient(MemObj<T const>& input, MemObj<T const>& gradient,
     return status;
   }
 
-  auto sycl_workspace =
-      sycldnn::helpers::alloc<T, is_usm>(params.channels, queue);
+  auto sycl_workspace = scratch.template take<T>(params.channels);
   auto workspace = make_mem_object(sycl_workspace, params.channels);
   auto const_gamma_grad = gamma_grad.as_const();
-  status = binaryop::internal::launch_binaryop<binaryop::Div>(
-      const_gamma_grad, num_elts, workspace, {params.channels}, {1}, queue,
-      input_variance_deps);
+  status = binaryop::internal::launch_binaryop_scalar<binaryop::Div>(
+      const_gamma_grad, num_elts, workspace, queue, input_variance_deps);
   std::vector<cl::sycl::event> workspace_deps = {status.event};
   if (sycldnn::StatusCode::OK != status.status) {
     return status;
@@ -500,12 +494,9 @@ SNNStatus launch_gradient(MemObj<T const>& input, MemObj<T const>& gradient,
     return status;
   }
 
-  auto sycl_epsilon =
-      sycldnn::helpers::alloc_and_assign<T, is_usm>(1, &params.epsilon, queue);
-  auto epsilon = make_mem_object<T const>(sycl_epsilon, 1);
   auto const_input_variance = input_variance.as_const();
-  status = binaryop::internal::launch_binaryop<binaryop::Add>(
-      const_input_variance, epsilon, input_variance, {params.channels}, {1},
+  status = binaryop::internal::launch_binaryop_scalar<binaryop::Add>(
+      const_input_variance, static_cast<T>(params.epsilon), input_variance,
       queue, input_variance_deps);
   workspace_deps.push_back(status.event);
   if (sycldnn::StatusCode::OK != status.status) {
@@ -579,10 +570,10 @@ SNNStatus launch_gradient(MemObj<T const>& input, MemObj<T const>& gradient,
           const_gamma_grad, const_input_variance, gamma_grad, params.channels,
           queue, gamma_grad_deps);
 
-  status.event = sycldnn::helpers::enqueue_free(
-      queue, {status.event, gamma_grad_status.event}, sycl_tr_input,
-      sycl_tr_gradient, sycl_mean_input, sycl_centered_input, sycl_epsilon,
-      sycl_mean_gradient, sycl_num_elts, sycl_workspace);
+  std::vector<cl::sycl::event> const final_events{status.event,
+                                                  gamma_grad_status.event};
+  scratch.set_events(final_events);
+  status.event = sycldnn::helpers::multi_event_to_one(final_events, queue);
 
   return status;
 }
@@ -614,13 +605,21 @@ SNNStatus launch_gradient(MemObj<T const>& input, MemObj<T const>& gradient,
   SNNStatus status;
 
   // Transpose NCHW tensor to NHWC to reduce NHW dimensions in one go.
-  auto sycl_tr_reduce_workspace = sycldnn::helpers::alloc<T, is_usm>(
-      tr_reduce_size + params.channels, queue);
+  using Scratch = sycldnn::internal::helpers::ScratchSpace<Backend, is_usm>;
+  Scratch scratch{
+      Scratch::template bytes_for<T>(tr_reduce_size + params.channels),
+      backend, "batchnorm"};
+  if (!scratch.valid()) {
+    return StatusCode::AllocationProblem;
+  }
+  auto const scratch_deps = scratch.dependencies(events);
+  auto sycl_tr_reduce_workspace =
+      scratch.template take<T>(tr_reduce_size + params.channels);
   auto tr_reduce = make_mem_object(sycl_tr_reduce_workspace, tr_reduce_size);
   auto beta_grad_dependencies = std::vector<cl::sycl::event>{};
   if (is_nchw) {
     status = transpose::internal::launch(gradient, tr_reduce, input_dims,
-                                         NCHW_TO_NHWC, queue, events);
+                                         NCHW_TO_NHWC, queue, scratch_deps);
     beta_grad_dependencies.push_back(status.event);
     if (sycldnn::StatusCode::OK != status.status) {
       return status;
@@ -637,14 +636,12 @@ SNNStatus launch_gradient(MemObj<T const>& input, MemObj<T const>& gradient,
     return status;
   }
 
-  auto sycl_epsilon =
-      sycldnn::helpers::alloc_and_assign<T, is_usm>(1, &params.epsilon, queue);
-  auto epsilon = make_mem_object<T const>(sycl_epsilon, 1);
   auto workspace = make_mem_object(sycl_tr_reduce_workspace, params.channels,
                                    tr_reduce_size);
 
-  status = binaryop::internal::launch_binaryop<binaryop::Add>(
-      pop_variance, epsilon, workspace, channel_dims, {1}, queue, events);
+  status = binaryop::internal::launch_binaryop_scalar<binaryop::Add>(
+      pop_variance, static_cast<T>(params.epsilon), workspace, queue,
+      scratch_deps);
   auto dependencies = std::vector<cl::sycl::event>{status.event};
   if (sycldnn::StatusCode::OK != status.status) {
     return status;
@@ -721,9 +718,9 @@ SNNStatus launch_gradient(MemObj<T const>& input, MemObj<T const>& gradient,
     return status;
   }
 
+  scratch.set_events(launch_gradient_dependencies);
   status.event =
-      sycldnn::helpers::enqueue_free(queue, launch_gradient_dependencies,
-                                     sycl_epsilon, sycl_tr_reduce_workspace);
+      sycldnn::helpers::multi_event_to_one(launch_gradient_dependencies, queue);
   return status;
 }
 
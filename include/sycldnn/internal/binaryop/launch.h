@@ -72,6 +72,24 @@ launch_binaryop(MemObj<T const>& lhs, MemObj<T const>& rhs, MemObj<T>& out,
                 const std::vector<int>& out_dims, cl::sycl::queue& queue,
                 const std::vector<cl::sycl::event>& events);
 
+/**
+ * Launch a binary operation where the rhs operand is a single scalar, which is
+ * passed to the kernel as an argument so no device memory needs to be
+ * allocated or initialised for it.
+ *
+ * \param [in]  lhs    The lhs operand.
+ * \param [in]  rhs    The scalar rhs operand.
+ * \param [out] out    The output, of the same size as the lhs operand. May be
+ *                     the same memory as the lhs operand.
+ * \param [in]  queue  The SYCL queue to launch the kernel on.
+ * \param [in]  events Events which should be completed before the operation.
+ * \return The status of the launch, with the kernel event.
+ */
+template <typename Op, typename T, template <typename> class MemObj>
+SNN_EXPORT SNNStatus launch_binaryop_scalar(
+    MemObj<T const>& lhs, T rhs, MemObj<T>& out, cl::sycl::queue& queue,
+    const std::vector<cl::sycl::event>& events);
+
 template <typename T, typename Op, typename Backend>
 SNNStatus sublaunch(typename Backend::template pointer_type<T const> lhs,
                     typename Backend::template pointer_type<T const> rhs,
@@ -115,6 +133,19 @@ SNNStatus sublaunch(typename Backend::template pointer_type<T const> lhs,
                                        rhs_dims, out_dims, queue, events);
 }
 
+template <typename T, typename Op, typename Backend>
+SNNStatus sublaunch_scalar(
+    typename Backend::template pointer_type<T const> lhs, T rhs,
+    typename Backend::template pointer_type<T> out, int size, Backend& backend,
+    const std::vector<cl::sycl::event>& events) {
+  SNN_VALIDATE_PARAM(size > 0, "Operand size cannot be zero.");
+  auto lhs_mem = backend.get_mem_object(lhs, size);
+  auto out_mem = backend.get_mem_object(out, size);
+  auto queue = backend.get_queue();
+  return internal::launch_binaryop_scalar<Op>(lhs_mem, rhs, out_mem, queue,
+                                              events);
+}
+
 template <typename Op, typename T, template <typename> class MemObj>
 SNNStatus launch_binaryop(MemObj<T const>& lhs, MemObj<T const>& rhs,
                           MemObj<T>& out, const std::vector<int>& lhs_dims,
@@ -18,6 +18,8 @@
 
 #include "sycldnn/helpers/ratio.h"
 
+#include <algorithm>
+
 namespace sycldnn {
 namespace conv2d {
 namespace internal {
@@ -37,6 +39,12 @@ struct BatchInfo {
   size_t n_batches;
   /** Number of images in the last batch. */
   size_t last_batch_size;
+  /**
+   * Number of transform buffers to cycle through. With two buffers the
+   * transforms for one batch can run while the previous batch is still being
+   * computed.
+   */
+  size_t n_buffers = 1;
 };
 
 /**
@@ -78,6 +86,36 @@ inline BatchInfo get_batch_info(size_t buffer_size, size_t n_images,
   return BatchInfo{minibatch_size, n_batches, last_batch_size};
 }
 
+/**
+ * Get the number of batches needed to process a number of images given a
+ * workspace of fixed size, double buffering the workspace if it cannot hold
+ * all of the images at once.
+ *
+ * When double buffered, each of the two buffers holds `images_per_batch`
+ * images, so consecutive batches use separate regions of the workspace and
+ * need not wait for each other before running their transforms.
+ *
+ * \param buffer_size    Size of the workspace available for the buffers.
+ * \param n_images       The total number of images to process.
+ * \param size_per_image The size in the workspace required by an image.
+ * \return A BatchInfo struct containing info on how to process the images,
+ *         where `images_per_batch` is zero if the workspace cannot hold a
+ *         single image.
+ */
+inline BatchInfo get_pipelined_batch_info(size_t buffer_size, size_t n_images,
+                                          size_t size_per_image) {
+  size_t const images_per_buffer = buffer_size / size_per_image;
+  if (images_per_buffer == 0) {
+    return BatchInfo{0, 0, 0};
+  }
+  if (images_per_buffer >= n_images || images_per_buffer < 2) {
+    return get_batch_info(std::min(images_per_buffer, n_images), n_images);
+  }
+  BatchInfo batch_info = get_batch_info(images_per_buffer / 2, n_images);
+  batch_info.n_buffers = 2;
+  return batch_info;
+}
+
 }  // namespace internal
 }  // namespace conv2d
 }  // namespace sycldnn
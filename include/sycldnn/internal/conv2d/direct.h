@@ -18,6 +18,7 @@
 
 #include "sycldnn/conv2d/params.h"
 #include "sycldnn/helpers/macros.h"
+#include "sycldnn/internal/conv2d/epilogue.h"
 #include "sycldnn/mem_object.h"
 #include "sycldnn/status.h"
 
@@ -34,6 +35,7 @@ namespace internal {
 template <typename T, typename ConvType, template <typename> class MemObj>
 SNN_EXPORT SNNStatus launch_direct(MemObj<T const>& input,
                                    MemObj<T const>& filter, MemObj<T>& output,
+                                   EpilogueMem<T, MemObj>& epilogue,
                                    Conv2DParams const& params,
                                    cl::sycl::queue& queue,
                                    const std::vector<cl::sycl::event>& events);
@@ -0,0 +1,121 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_INTERNAL_CONV2D_EPILOGUE_H_
+#define SYCLDNN_INCLUDE_INTERNAL_CONV2D_EPILOGUE_H_
+
+#include "sycldnn/mem_object.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/conv2d/epilogue.h"
+#include "sycldnn/conv2d/params.h"
+
+#include <stddef.h>
+
+#include <CL/sycl.hpp>
+
+#include "sycldnn/export.h"
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+
+/**
+ * The memory objects used by a convolution epilogue, passed on to the
+ * compiled kernels.
+ *
+ * The kernels always require a full set of memory objects, so any tensor
+ * which is not enabled in the params is bound to a placeholder memory object
+ * which is never read.
+ */
+template <typename T, template <typename> class MemObj>
+struct EpilogueMem {
+  /** The per-feature bias. */
+  MemObj<T const> bias;
+  /** The per-feature scale. */
+  MemObj<T const> scale;
+  /** The per-feature shift. */
+  MemObj<T const> shift;
+  /** The residual tensor, with the same shape as the output. */
+  MemObj<T const> residual;
+  /** The operations enabled in the epilogue. */
+  EpilogueParams params;
+};
+
+/**
+ * Create an epilogue which leaves the convolution output unchanged.
+ *
+ * \param placeholder Memory object to bind to the unused epilogue tensors.
+ * \return An EpilogueMem with no operations enabled.
+ */
+template <typename T, template <typename> class MemObj>
+EpilogueMem<T, MemObj> make_identity_epilogue(
+    MemObj<T const> const& placeholder) {
+  return {placeholder, placeholder, placeholder, placeholder,
+          EpilogueParams{}};
+}
+
+/**
+ * Extract the memory objects for an epilogue from the backend.
+ *
+ * \param epilogue        The user provided epilogue descriptor.
+ * \param backend         Backend to provide memory objects from the pointers.
+ * \param placeholder     Memory object to bind to the unused epilogue tensors.
+ * \param n_features      Number of features in the convolution output.
+ * \param output_size     Number of elements written by the kernel.
+ * \param residual_offset Offset into the residual tensor of the first element
+ *                        written by the kernel, used when the output is
+ *                        computed in minibatches.
+ * \return The memory objects to pass to the kernels.
+ */
+template <typename T, typename Backend, template <typename> class MemObj>
+EpilogueMem<T, MemObj> make_epilogue_mem(Epilogue<T, Backend> const& epilogue,
+                                         Backend& backend,
+                                         MemObj<T const> const& placeholder,
+                                         size_t n_features, size_t output_size,
+                                         size_t residual_offset = 0) {
+  using ConstPointer = typename Epilogue<T, Backend>::ConstPointer;
+  auto get_mem = [&](std::optional<ConstPointer> const& ptr, size_t offset,
+                     size_t size) -> MemObj<T const> {
+    if (ptr) {
+      return backend.get_mem_object(*ptr + offset, size);
+    }
+    return placeholder;
+  };
+  return {get_mem(epilogue.bias, 0, n_features),
+          get_mem(epilogue.scale, 0, n_features),
+          get_mem(epilogue.shift, 0, n_features),
+          get_mem(epilogue.residual, residual_offset, output_size),
+          epilogue.get_params()};
+}
+
+/**
+ * The internal launcher for a standalone epilogue, which applies the
+ * epilogue in place to the output of a convolution whose output stage cannot
+ * apply it directly.
+ *
+ * Implemented in the compiled SYCL DNN library.
+ */
+template <typename T, template <typename> class MemObj>
+SNN_EXPORT SNNStatus launch_epilogue(
+    MemObj<T>& output, EpilogueMem<T, MemObj>& epilogue,
+    Conv2DParams const& params, cl::sycl::queue& queue,
+    const std::vector<cl::sycl::event>& events);
+
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_INCLUDE_INTERNAL_CONV2D_EPILOGUE_H_
@@ -0,0 +1,107 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_INTERNAL_CONV2D_FOLD_BATCHNORM_H_
+#define SYCLDNN_INCLUDE_INTERNAL_CONV2D_FOLD_BATCHNORM_H_
+
+#include "sycldnn/mem_object.h"
+#include "sycldnn/status.h"
+
+#include <stddef.h>
+#include <optional>
+
+#include <CL/sycl.hpp>
+
+#include "sycldnn/export.h"
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+
+/**
+ * The shape of a filter to fold a batchnorm into, described by the position
+ * of the output feature dimension in the flattened filter.
+ */
+struct FoldSizes {
+  /** Number of elements in the filter. */
+  size_t filter_size;
+  /** Number of output features, which is the size of the folded bias. */
+  size_t features;
+  /**
+   * Number of filter elements between consecutive features, 1 when the
+   * features are the innermost dimension of the filter.
+   */
+  size_t inner_size;
+};
+
+/**
+ * The internal launcher for folding a frozen batchnorm into the preceding
+ * convolution's filter and bias.
+ *
+ * If has_bias is false then the bias memory object is never read, and the
+ * convolution is treated as having a zero bias.
+ *
+ * Implemented in the compiled SYCL DNN library.
+ */
+template <typename T, template <typename> class MemObj>
+SNN_EXPORT SNNStatus launch_fold_batchnorm(
+    MemObj<T const>& filter, MemObj<T const>& bias, MemObj<T const>& gamma,
+    MemObj<T const>& beta, MemObj<T const>& mean, MemObj<T const>& variance,
+    MemObj<T>& folded_filter, MemObj<T>& folded_bias, bool has_bias,
+    float epsilon, FoldSizes const& sizes, cl::sycl::queue& queue,
+    const std::vector<cl::sycl::event>& events);
+
+/**
+ * Extract the memory objects from the backend and launch the batchnorm
+ * folding kernel.
+ */
+template <typename T, typename Backend>
+SNNStatus fold_batchnorm(
+    typename Backend::template pointer_type<T const> filter,
+    std::optional<typename Backend::template pointer_type<T const>> bias,
+    typename Backend::template pointer_type<T const> gamma,
+    typename Backend::template pointer_type<T const> beta,
+    typename Backend::template pointer_type<T const> mean,
+    typename Backend::template pointer_type<T const> variance,
+    typename Backend::template pointer_type<T> folded_filter,
+    typename Backend::template pointer_type<T> folded_bias, float epsilon,
+    FoldSizes const& sizes, Backend& backend,
+    const std::vector<cl::sycl::event>& events) {
+  auto fil_access = backend.get_mem_object(filter, sizes.filter_size);
+  auto gamma_access = backend.get_mem_object(gamma, sizes.features);
+  auto beta_access = backend.get_mem_object(beta, sizes.features);
+  auto mean_access = backend.get_mem_object(mean, sizes.features);
+  auto var_access = backend.get_mem_object(variance, sizes.features);
+  // The kernel always needs a bias memory object, so bind the mean when the
+  // convolution has no bias. It is not read in that case.
+  auto bias_access =
+      bias ? backend.get_mem_object(*bias, sizes.features) : mean_access;
+  auto out_fil_access =
+      backend.get_mem_object(folded_filter, sizes.filter_size);
+  auto out_bias_access = backend.get_mem_object(folded_bias, sizes.features);
+
+  cl::sycl::queue queue = backend.get_queue();
+  return launch_fold_batchnorm<T>(fil_access, bias_access, gamma_access,
+                                  beta_access, mean_access, var_access,
+                                  out_fil_access, out_bias_access,
+                                  bias.has_value(), epsilon, sizes, queue,
+                                  events);
+}
+
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_INCLUDE_INTERNAL_CONV2D_FOLD_BATCHNORM_H_
@@ -33,35 +33,32 @@
 #include "sycldnn/internal/conv2d/im2col/tile_info.h"
 #include "sycldnn/internal/conv2d/im2col/transform_sizes.h"
 #include "sycldnn/internal/conv2d/im2col/workspace_pointer_set.h"
+#include "sycldnn/internal/helpers/allocated_pointer.h"
+#include "sycldnn/internal/helpers/internal_pointer.h"
 #include "sycldnn/internal/transpose/launch.h"
 namespace sycldnn {
 namespace conv2d {
 namespace internal {
 namespace im2col {
 
-/** Launch the input transform and matmul to compute im2col. */
-template <typename T, typename ConvType, typename Backend,
-          typename std::enable_if<
-              !std::is_same<ConvType, conv_type::FilterBackprop>::value,
-              int>::type = 0>
-static SNNStatus launch_im2col_for_minibatch(
-    FullPointerSet<T, Backend, ConvType> const& pointers, size_t in_offset,
-    size_t out_offset, TileInfo const& tile_info, Conv2DParams const& params,
-    Backend& backend, const std::vector<cl::sycl::event>& events) {
+/**
+ * Launch the matrix multiplies to compute im2col for a minibatch, given the
+ * already transformed input and a filter in the layout expected by the
+ * matmul.
+ *
+ * For strided group convolutions the matmul result is written to the
+ * transform buffer after the input transform, and then transposed into the
+ * output.
+ */
+template <typename T, typename ConvType, typename Backend>
+static SNNStatus launch_im2col_matmul(
+    typename Backend::template internal_pointer_type<T const> filter,
+    typename Backend::template internal_pointer_type<T> transform,
+    typename Backend::template internal_pointer_type<T> output,
+    TileInfo const& tile_info, Conv2DParams const& params, Backend& backend,
+    const std::vector<cl::sycl::event>& dependencies) {
   using ConstPointer =
-      typename FullPointerSet<T, Backend, ConvType>::ConstPointer;
-
-  const auto filter_size =
-      std::is_same<ConvType, conv_type::InputBackprop>::value
-          ? 0
-          : filter_transform_size<ConvType>(params);
-  auto status = launch_input_transform(pointers, in_offset, filter_size,
-                                       tile_info, params, backend, events);
-  if (status.status != StatusCode::OK) {
-    return status;
-  }
-
-  std::vector<cl::sycl::event> dependencies{status.event};
+      typename Backend::template internal_pointer_type<T const>;
 
   int matmul_size;
   if (std::is_same<ConvType, conv_type::InputBackprop>::value) {
@@ -76,16 +73,27 @@ static SNNStatus launch_im2col_for_minibatch(
   cl::sycl::event event;
   if (params.groups == 1) {
     // Regular convolution, no filter/output transformations are needed.
-    if (params.filter_format == sycldnn::FilterFormat::FHWC) {
+    if (params.input_format == sycldnn::DataFormat::NCHW) {
+      // Each NCHW output image is the (features x tiles) product of the FCHW
+      // filter with the transpose of that image's tiles. The matmuls are
+      // chained so the last event covers the whole minibatch.
+      auto deps = dependencies;
+      for (int batch = 0; batch < params.batch; ++batch) {
+        auto const image = static_cast<size_t>(batch) * tile_info.number;
+        event = backend.template matmul<false, true>(
+            filter, ConstPointer{transform + image * tile_size},
+            output + image * matmul_size, static_cast<T>(0), matmul_size,
+            tile_size, tile_info.number, deps);
+        deps = {event};
+      }
+    } else if (params.filter_format == sycldnn::FilterFormat::FHWC) {
       event = backend.template matmul<false, true>(
-          ConstPointer{pointers.transform}, ConstPointer{pointers.filter},
-          pointers.output + out_offset, static_cast<T>(0), n_tiles, tile_size,
-          matmul_size, dependencies);
+          ConstPointer{transform}, filter, output, static_cast<T>(0), n_tiles,
+          tile_size, matmul_size, dependencies);
     } else {
       event = backend.template matmul<false, false>(
-          ConstPointer{pointers.transform}, ConstPointer{pointers.filter},
-          pointers.output + out_offset, static_cast<T>(0), n_tiles, tile_size,
-          matmul_size, dependencies);
+          ConstPointer{transform}, filter, output, static_cast<T>(0), n_tiles,
+          tile_size, matmul_size, dependencies);
     }
   } else {
     // Group convolution cases
@@ -94,27 +102,23 @@ static SNNStatus launch_im2col_for_minibatch(
 
       if (params.filter_format == sycldnn::FilterFormat::FHWC) {
         event = backend.template batch_matmul<false, true>(
-            ConstPointer{pointers.transform}, ConstPointer{pointers.filter},
-            pointers.transform + matmul_offset, params.groups, n_tiles,
-            tile_size, matmul_size, params.group_format, dependencies);
+            ConstPointer{transform}, filter, transform + matmul_offset,
+            params.groups, n_tiles, tile_size, matmul_size,
+            params.group_format, dependencies);
       } else {
         event = backend.template batch_matmul<false, false>(
-            ConstPointer{pointers.transform + filter_size},
-            ConstPointer{pointers.transform},
-            pointers.transform + filter_size + matmul_offset, params.groups,
-            n_tiles, tile_size, matmul_size, params.group_format, dependencies);
+            ConstPointer{transform}, filter, transform + matmul_offset,
+            params.groups, n_tiles, tile_size, matmul_size,
+            params.group_format, dependencies);
       }
 
       // Transpose needed at the end to reshape the output from GNHWC to NHWGC
       size_t const trans_size = params.groups * n_tiles * matmul_size;
 
       auto in_mem_obj =
-          backend
-              .get_mem_object(pointers.transform + filter_size + matmul_offset,
-                              trans_size)
+          backend.get_mem_object(transform + matmul_offset, trans_size)
               .as_const();
-      auto out_mem_obj =
-          backend.get_mem_object(pointers.output + out_offset, trans_size);
+      auto out_mem_obj = backend.get_mem_object(output, trans_size);
 
       const std::vector<int> GNHWC_TO_NHWGC = {1, 2, 0, 3};
       auto queue = backend.get_queue();
@@ -131,14 +135,82 @@ static SNNStatus launch_im2col_for_minibatch(
     } else {
       // Interleaved group format case. No filter/output transpose is needed.
       event = backend.template batch_matmul<false, false>(
-          ConstPointer{pointers.transform}, ConstPointer{pointers.filter},
-          pointers.output + out_offset, params.groups, n_tiles, tile_size,
-          matmul_size, params.group_format, dependencies);
+          ConstPointer{transform}, filter, output, params.groups, n_tiles,
+          tile_size, matmul_size, params.group_format, dependencies);
     }
   }
   return {event, StatusCode::OK};
 }
 
+/**
+ * Launch the input transform and matmul to compute im2col.
+ *
+ * The input transform is written `transform_offset` elements into the
+ * minibatch transform buffers, and waits on `events`. The matmul additionally
+ * waits on `previous_events`, so that the minibatches complete in order.
+ */
+template <typename T, typename ConvType, typename Backend,
+          typename std::enable_if<
+              !std::is_same<ConvType, conv_type::FilterBackprop>::value,
+              int>::type = 0>
+static SNNStatus launch_im2col_for_minibatch(
+    FullPointerSet<T, Backend, ConvType> const& pointers, size_t in_offset,
+    size_t out_offset, size_t transform_offset, TileInfo const& tile_info,
+    Conv2DParams const& params, Backend& backend,
+    const std::vector<cl::sycl::event>& events,
+    const std::vector<cl::sycl::event>& previous_events) {
+  using ConstPointer =
+      typename FullPointerSet<T, Backend, ConvType>::ConstPointer;
+
+  const auto filter_size =
+      std::is_same<ConvType, conv_type::InputBackprop>::value
+          ? 0
+          : filter_transform_size<ConvType>(params);
+  auto status = launch_input_transform(pointers, in_offset,
+                                       filter_size + transform_offset,
+                                       tile_info, params, backend, events);
+  if (status.status != StatusCode::OK) {
+    return status;
+  }
+
+  // Any transformed filter for the forward pass is stored at the start of the
+  // transform buffer, before the input transform.
+  auto const filter = filter_size > 0 ? ConstPointer{pointers.transform}
+                                      : ConstPointer{pointers.filter};
+  auto dependencies = previous_events;
+  dependencies.push_back(status.event);
+  return launch_im2col_matmul<T, ConvType>(
+      filter, pointers.transform + filter_size + transform_offset,
+      pointers.output + out_offset, tile_info, params, backend, dependencies);
+}
+
+/**
+ * Launch the input transform and matmul to compute im2col using a filter
+ * which has already been packed by pack_filter().
+ *
+ * \copydetails launch_im2col_for_minibatch()
+ */
+template <typename T, typename ConvType, typename Backend>
+static SNNStatus launch_im2col_packed_for_minibatch(
+    PackedFilterPointerSet<T, Backend> const& pointers, size_t in_offset,
+    size_t out_offset, size_t transform_offset, TileInfo const& tile_info,
+    Conv2DParams const& params, Backend& backend,
+    const std::vector<cl::sycl::event>& events,
+    const std::vector<cl::sycl::event>& previous_events) {
+  auto const transform = pointers.transform + transform_offset;
+  auto status = launch_input_transform<T, ConvType>(
+      pointers.input + in_offset, transform, tile_info, params, backend,
+      events);
+  if (status.status != StatusCode::OK) {
+    return status;
+  }
+  auto dependencies = previous_events;
+  dependencies.push_back(status.event);
+  return launch_im2col_matmul<T, ConvType>(
+      pointers.filter, transform, pointers.output + out_offset, tile_info,
+      params, backend, dependencies);
+}
+
 /**
  * Launch the input transform and matmul to compute im2col for the filter
  * backprop pass.
@@ -149,17 +221,23 @@ template <typename T, typename ConvType, typename Backend,
               int>::type = 0>
 static SNNStatus launch_im2col_for_minibatch(
     FullPointerSet<T, Backend, ConvType> const& pointers, size_t in_offset,
-    size_t out_offset, TileInfo const& tile_info, Conv2DParams const& params,
-    Backend& backend, const std::vector<cl::sycl::event>& events) {
+    size_t out_offset, size_t transform_offset, TileInfo const& tile_info,
+    Conv2DParams const& params, Backend& backend,
+    const std::vector<cl::sycl::event>& events,
+    const std::vector<cl::sycl::event>& previous_events) {
   using ConstPointer =
       typename FullPointerSet<T, Backend, ConvType>::ConstPointer;
-  auto status = launch_input_transform(pointers, in_offset, 0, tile_info,
-                                       params, backend, events);
+  auto status = launch_input_transform(pointers, in_offset, transform_offset,
+                                       tile_info, params, backend, events);
   if (status.status != StatusCode::OK) {
     return status;
   }
 
-  std::vector<cl::sycl::event> dependencies{status.event};
+  // Every minibatch accumulates into the same output, so the matmuls must run
+  // in order.
+  auto dependencies = previous_events;
+  dependencies.push_back(status.event);
+  auto const transform = ConstPointer{pointers.transform + transform_offset};
 
   const int n_tiles = tile_info.number;
   const int tile_size = params.batch * tile_info.size;
@@ -167,19 +245,38 @@ static SNNStatus launch_im2col_for_minibatch(
   cl::sycl::event matmul_event;
   if (in_offset == 0) {
     matmul_event = backend.template matmul<false, false>(
-        ConstPointer{pointers.transform}, pointers.filter + out_offset,
-        pointers.output, static_cast<T>(0), n_tiles, tile_size, params.features,
-        dependencies);
+        transform, pointers.filter + out_offset, pointers.output,
+        static_cast<T>(0), n_tiles, tile_size, params.features, dependencies);
   } else {
     matmul_event = backend.template matmul<false, false>(
-        ConstPointer{pointers.transform}, pointers.filter + out_offset,
-        pointers.output, static_cast<T>(1), n_tiles, tile_size, params.features,
-        dependencies);
+        transform, pointers.filter + out_offset, pointers.output,
+        static_cast<T>(1), n_tiles, tile_size, params.features, dependencies);
   }
   return {matmul_event, StatusCode::OK};
 }
 
-/** Loop over the minibatches to compute im2col. */
+/**
+ * Get the number of elements of temporary memory needed for each image in a
+ * minibatch, excluding any filter transform. This is the size of the input
+ * transform plus, for strided group convolutions, the matmul result which is
+ * transposed into the output.
+ */
+template <typename ConvType>
+size_t packed_size_per_image(TileInfo const& tile_info,
+                             Conv2DParams const& params) {
+  return params.groups * tile_info.number * tile_info.size +
+         output_transform_size<ConvType>(params);
+}
+
+/**
+ * Loop over the minibatches to compute im2col.
+ *
+ * If batch_info requests two buffers then alternate minibatches use alternate
+ * regions of the transform buffer, each holding packed_size_per_image() values
+ * per image. The input transform of one minibatch then only waits for the
+ * minibatch which last used its region, so it can overlap the matmul of the
+ * previous minibatch.
+ */
 template <typename T, typename ConvType, typename Backend>
 static SNNStatus launch_im2col_for_all_minibatches(
     FullPointerSet<T, Backend, ConvType> const& pointers,
@@ -194,27 +291,77 @@ static SNNStatus launch_im2col_for_all_minibatches(
 
   auto kernel_params = get_kernel_params<ConvType>(params);
   kernel_params.batch = batch_info.images_per_batch;
+  size_t const buffer_stride =
+      batch_info.images_per_batch *
+      packed_size_per_image<ConvType>(tile_info, params);
 
   cl::sycl::event dep_event = filter_status.event;
+  // Events which must complete before each buffer can be reused.
+  std::vector<std::vector<cl::sycl::event>> buffer_dependencies(
+      batch_info.n_buffers, std::vector<cl::sycl::event>{dep_event});
   for (size_t i = 0; i < batch_info.n_batches; ++i) {
     auto offset =
         calculate_offsets<ConvType>(i, batch_info.images_per_batch, params);
     if (i == batch_info.n_batches - 1) {
       kernel_params.batch = batch_info.last_batch_size;
     }
-    auto status =
-        launch_im2col_for_minibatch(pointers, offset.in, offset.out, tile_info,
-                                    kernel_params, backend, {dep_event});
-    // Each minibatch depends on previous for safe re-use of transform buffer
-    dep_event = status.event;
+    size_t const buffer = i % batch_info.n_buffers;
+    auto status = launch_im2col_for_minibatch(
+        pointers, offset.in, offset.out, buffer * buffer_stride, tile_info,
+        kernel_params, backend, buffer_dependencies[buffer], {dep_event});
     if (status.status != StatusCode::OK) {
       return status;
     }
+    dep_event = status.event;
+    buffer_dependencies[buffer] = std::vector<cl::sycl::event>{dep_event};
   }
 
   return SNNStatus{dep_event, StatusCode::OK};
 }
 
+/**
+ * Loop over the minibatches to compute im2col with a packed filter.
+ *
+ * \copydetails launch_im2col_for_all_minibatches()
+ */
+template <typename T, typename ConvType, typename Backend>
+static SNNStatus launch_im2col_packed_for_all_minibatches(
+    PackedFilterPointerSet<T, Backend> const& pointers,
+    TileInfo const& tile_info, BatchInfo const& batch_info,
+    Conv2DParams const& params, Backend& backend,
+    const std::vector<cl::sycl::event>& events) {
+  auto kernel_params = get_kernel_params<ConvType>(params);
+  kernel_params.batch = batch_info.images_per_batch;
+  size_t const buffer_stride =
+      batch_info.images_per_batch *
+      packed_size_per_image<ConvType>(tile_info, params);
+
+  cl::sycl::event last_event;
+  std::vector<cl::sycl::event> previous_events = events;
+  // Events which must complete before each buffer can be reused.
+  std::vector<std::vector<cl::sycl::event>> buffer_dependencies(
+      batch_info.n_buffers, events);
+  for (size_t i = 0; i < batch_info.n_batches; ++i) {
+    auto offset =
+        calculate_offsets<ConvType>(i, batch_info.images_per_batch, params);
+    if (i == batch_info.n_batches - 1) {
+      kernel_params.batch = batch_info.last_batch_size;
+    }
+    size_t const buffer = i % batch_info.n_buffers;
+    auto status = launch_im2col_packed_for_minibatch<T, ConvType>(
+        pointers, offset.in, offset.out, buffer * buffer_stride, tile_info,
+        kernel_params, backend, buffer_dependencies[buffer], previous_events);
+    if (status.status != StatusCode::OK) {
+      return status;
+    }
+    last_event = status.event;
+    previous_events = std::vector<cl::sycl::event>{last_event};
+    buffer_dependencies[buffer] = previous_events;
+  }
+
+  return SNNStatus{last_event, StatusCode::OK};
+}
+
 /**
  * Split the input tensor into minibatches to ensure that the temporary
  * transform buffer can be safely allocated and create SYCL buffers using the
@@ -234,13 +381,23 @@ SNNStatus allocate_and_launch_im2col(
       params.groups * tile_info.number * tile_info.size;
   im2col::AllocatedPointerSet<T, Backend, ConvType> all_pointers{
       pointers, size_per_image, params, backend};
+  if (!all_pointers.valid()) {
+    return StatusCode::AllocationProblem;
+  }
 
-  auto const batch_info = get_batch_info(all_pointers.allocated_transform_size,
-                                         params.batch, size_per_image);
+  // Any filter transform is stored at the start of the transform buffer,
+  // except for the input backprop which allocates a separate filter buffer.
+  size_t const filter_size =
+      std::is_same<ConvType, conv_type::InputBackprop>::value
+          ? 0
+          : filter_transform_size<ConvType>(params);
+  auto const batch_info = get_batch_info(
+      all_pointers.allocated_transform_size - filter_size, params.batch,
+      packed_size_per_image<ConvType>(tile_info, params));
 
   const auto launch_status = im2col::launch_im2col_for_all_minibatches(
       all_pointers.to_full_pointer_set(), tile_info, batch_info, params,
-      backend, events);
+      backend, all_pointers.dependencies(events));
   all_pointers.pass_event_to_ptrs(launch_status.event);
   return launch_status;
 }
@@ -267,30 +424,97 @@ SNNStatus launch_im2col_with_workspace(
   im2col::WorkspacePointerSet<T, Backend, ConvType> all_pointers{
       pointers, workspace, size_per_image, params, workspace_size, backend};
 
-  auto const batch_info =
-      get_batch_info(all_pointers.minibatch_size, params.batch);
+  auto const& batch_info = all_pointers.batch_info;
+  if (batch_info.images_per_batch == 0) {
+    return StatusCode::InsufficientWorkspace;
+  }
 
   return im2col::launch_im2col_for_all_minibatches(
       all_pointers.to_full_pointer_set(), tile_info, batch_info, params,
       backend, events);
 }
 
-}  // namespace im2col
+/**
+ * Allocate a temporary transform buffer and use im2col with a packed filter to
+ * compute the convolution for each minibatch.
+ */
+template <typename T, typename ConvType, typename Backend>
+SNNStatus allocate_and_launch_im2col_packed(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T> output,
+    Conv2DParams const& params, Backend& backend,
+    const std::vector<cl::sycl::event>& events) {
+  using AllocatedPointer =
+      ::sycldnn::internal::helpers::AllocatedPointer<T, Backend>;
+  InternalPointerSet<T, Backend> pointers{input, filter, output, backend};
+
+  auto const tile_info = im2col::get_tile_info<ConvType>(params);
+  size_t const size_per_image =
+      packed_size_per_image<ConvType>(tile_info, params);
+  auto const alloc_info =
+      get_alloc_info(backend.get_queue().get_device(), params.batch,
+                     size_per_image * sizeof(T));
+  size_t const transform_size = size_per_image * alloc_info.images_per_alloc;
+  AllocatedPointer transform{transform_size, backend, "conv2d_im2col"};
+  if (!transform.valid()) {
+    return StatusCode::AllocationProblem;
+  }
+
+  auto const batch_info =
+      get_batch_info(transform_size, params.batch, size_per_image);
+  PackedFilterPointerSet<T, Backend> all_pointers{
+      pointers.input.get(), pointers.filter.get(), transform.get(),
+      pointers.output.get()};
+  auto const launch_status =
+      launch_im2col_packed_for_all_minibatches<T, ConvType>(
+          all_pointers, tile_info, batch_info, params, backend,
+          transform.dependencies(events));
+  transform.set_event(launch_status.event);
+  return launch_status;
+}
 
 /**
- * The internal im2col convolution launcher.
- *
- * Use im2col to compute a convolution, by transforming the input data then
- * computing a matrix multiply with the filter to give the output.
+ * Use the provided workspace for the input transform, and use im2col with a
+ * packed filter to compute the convolution for each minibatch. The workspace
+ * does not need to hold a filter transform.
  */
 template <typename T, typename ConvType, typename Backend>
-SNNStatus launch_im2col(typename Backend::template pointer_type<T const> input,
-                        typename Backend::template pointer_type<T const> filter,
-                        typename Backend::template pointer_type<T> output,
-                        typename Backend::template pointer_type<T> workspace,
-                        Conv2DParams const& params, size_t workspace_size,
-                        Backend& backend,
-                        const std::vector<cl::sycl::event>& events) {
+SNNStatus launch_im2col_packed_with_workspace(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T> output,
+    typename Backend::template pointer_type<T> workspace,
+    Conv2DParams const& params, size_t workspace_size, Backend& backend,
+    const std::vector<cl::sycl::event>& events) {
+  using InternalPointer =
+      ::sycldnn::internal::helpers::InternalPointer<T, Backend>;
+  InternalPointerSet<T, Backend> pointers{input, filter, output, backend};
+  InternalPointer transform{workspace, backend};
+
+  auto const tile_info = im2col::get_tile_info<ConvType>(params);
+  auto const batch_info = get_pipelined_batch_info(
+      workspace_size, params.batch,
+      packed_size_per_image<ConvType>(tile_info, params));
+  if (batch_info.images_per_batch == 0) {
+    return StatusCode::InsufficientWorkspace;
+  }
+  PackedFilterPointerSet<T, Backend> all_pointers{
+      pointers.input.get(), pointers.filter.get(), transform.get(),
+      pointers.output.get()};
+  return launch_im2col_packed_for_all_minibatches<T, ConvType>(
+      all_pointers, tile_info, batch_info, params, backend, events);
+}
+
+/**
+ * Get the parameters to use in the im2col kernels.
+ *
+ * Depthwise convolutions with a feature multiplier of one can be treated as
+ * having an interleaved group format, which avoids the filter and output
+ * transposes.
+ */
+template <typename Backend>
+Conv2DParams get_launch_params(Conv2DParams const& params) {
   if (sycldnn::backend::supports_interleaved_matmul<Backend>::value &&
       (params.groups == params.channels) &&
       (params.groups == params.features) &&
@@ -303,26 +527,97 @@ SNNStatus launch_im2col(typename Backend::template pointer_type<T const> input,
      * interleaved batch_matmul can be used. This prevents us from having to do
      * a filter and output transpose.
      */
-
     Conv2DParams interleaved_params = params;
     interleaved_params.group_format = sycldnn::BatchFormat::INTERLEAVED;
-    if (workspace_size == 0) {
-      return im2col::allocate_and_launch_im2col<T, ConvType>(
-          input, filter, output, interleaved_params, backend, events);
-    } else {
-      return im2col::launch_im2col_with_workspace<T, ConvType>(
-          input, filter, output, workspace, interleaved_params, workspace_size,
-          backend, events);
-    }
+    return interleaved_params;
   }
+  return params;
+}
 
+}  // namespace im2col
+
+/**
+ * The internal im2col convolution launcher.
+ *
+ * Use im2col to compute a convolution, by transforming the input data then
+ * computing a matrix multiply with the filter to give the output.
+ */
+template <typename T, typename ConvType, typename Backend>
+SNNStatus launch_im2col(typename Backend::template pointer_type<T const> input,
+                        typename Backend::template pointer_type<T const> filter,
+                        typename Backend::template pointer_type<T> output,
+                        typename Backend::template pointer_type<T> workspace,
+                        Conv2DParams const& params, size_t workspace_size,
+                        Backend& backend,
+                        const std::vector<cl::sycl::event>& events) {
+  auto const launch_params = im2col::get_launch_params<Backend>(params);
   if (workspace_size == 0) {
     return im2col::allocate_and_launch_im2col<T, ConvType>(
-        input, filter, output, params, backend, events);
+        input, filter, output, launch_params, backend, events);
   } else {
     return im2col::launch_im2col_with_workspace<T, ConvType>(
-        input, filter, output, workspace, params, workspace_size, backend,
-        events);
+        input, filter, output, workspace, launch_params, workspace_size,
+        backend, events);
+  }
+}
+
+/**
+ * Pack a filter into the layout used by the im2col matrix multiply, so that it
+ * can be reused across many convolutions with launch_im2col_packed().
+ *
+ * For the input backprop the filter is mirrored, for strided group
+ * convolutions with an HWCF filter the groups are moved to the outermost
+ * dimension, and otherwise the filter is copied as is.
+ */
+template <typename T, typename ConvType, typename Backend>
+SNNStatus pack_filter_im2col(
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T> packed,
+    Conv2DParams const& params, Backend& backend,
+    const std::vector<cl::sycl::event>& events) {
+  using ConstInternalPointer =
+      ::sycldnn::internal::helpers::InternalPointer<T const, Backend>;
+  using InternalPointer =
+      ::sycldnn::internal::helpers::InternalPointer<T, Backend>;
+  auto const launch_params = im2col::get_launch_params<Backend>(params);
+  ConstInternalPointer filter_ptr{filter, backend};
+  InternalPointer packed_ptr{packed, backend};
+
+  if (im2col::filter_transform_size<ConvType>(launch_params) > 0) {
+    return im2col::launch_filter_transform<T, ConvType>(
+        filter_ptr.get(), packed_ptr.get(), launch_params, backend, events);
+  }
+  // No transform is needed, so the packed filter is a copy of the filter.
+  int const packed_size = im2col::packed_filter_size<ConvType>(launch_params);
+  auto in_mem_obj =
+      backend.get_mem_object_internal(filter_ptr.get(), packed_size);
+  auto out_mem_obj =
+      backend.get_mem_object_internal(packed_ptr.get(), packed_size);
+  auto queue = backend.get_queue();
+  return sycldnn::transpose::internal::launch(
+      in_mem_obj, out_mem_obj, {packed_size}, {0}, queue, events);
+}
+
+/**
+ * The internal im2col convolution launcher for a filter packed by
+ * pack_filter_im2col().
+ */
+template <typename T, typename ConvType, typename Backend>
+SNNStatus launch_im2col_packed(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T const> packed,
+    typename Backend::template pointer_type<T> output,
+    typename Backend::template pointer_type<T> workspace,
+    Conv2DParams const& params, size_t workspace_size, Backend& backend,
+    const std::vector<cl::sycl::event>& events) {
+  auto const launch_params = im2col::get_launch_params<Backend>(params);
+  if (workspace_size == 0) {
+    return im2col::allocate_and_launch_im2col_packed<T, ConvType>(
+        input, packed, output, launch_params, backend, events);
+  } else {
+    return im2col::launch_im2col_packed_with_workspace<T, ConvType>(
+        input, packed, output, workspace, launch_params, workspace_size,
+        backend, events);
   }
 }
 }  // namespace internal
@@ -51,13 +51,22 @@ struct AllocatedPointerSet {
                                                     backend)},
         input{set.input.get()},
         filter{set.filter.get()},
-        transform{sizeof(T) * allocated_transform_size, backend},
+        transform{allocated_transform_size, backend, "conv2d_im2col"},
         output{set.output.get()} {}
 
   FullPointerSet<T, Backend, ConvType> to_full_pointer_set() {
     return {input, filter, transform.get(), output};
   }
 
+  /** Check whether the temporary buffers were allocated. */
+  bool valid() const { return transform.valid(); }
+
+  /** Get the events which kernels using the temporary buffers depend on. */
+  std::vector<cl::sycl::event> dependencies(
+      std::vector<cl::sycl::event> events) const {
+    return transform.dependencies(std::move(events));
+  }
+
   /** Add events to pointer on which to wait for before releasing memory */
   inline void pass_event_to_ptrs(const cl::sycl::event& event) {
     transform.set_event(event);
@@ -102,8 +111,8 @@ struct AllocatedPointerSet {
  * Set of all pointers required for input backprop.
  *
  * Will allocate temporary buffers for the filter transform and the input
- * transform on construction, which will be automatically deallocated on
- * destruction.
+ * and output transforms on construction, which will be automatically
+ * deallocated on destruction.
  */
 template <typename T, typename Backend>
 struct AllocatedPointerSet<T, Backend, conv_type::InputBackprop> {
@@ -116,20 +125,30 @@ struct AllocatedPointerSet<T, Backend, conv_type::InputBackprop> {
   AllocatedPointerSet(InternalPointerSet<T, Backend> const& set,
                       size_t size_per_image, Conv2DParams const& params,
                       Backend& backend)
-      : allocated_transform_size{get_transform_size(size_per_image,
-                                                    params.batch, backend)},
+      : allocated_transform_size{get_transform_size(
+            size_per_image +
+                output_transform_size<conv_type::InputBackprop>(params),
+            params.batch, backend)},
         input{set.input.get()},
         original_filter{set.filter.get()},
-        filter{
-            sizeof(T) * filter_transform_size<conv_type::InputBackprop>(params),
-            backend},
-        transform{sizeof(T) * allocated_transform_size, backend},
+        filter{filter_transform_size<conv_type::InputBackprop>(params),
+               backend, "conv2d_im2col"},
+        transform{allocated_transform_size, backend, "conv2d_im2col"},
         output{set.output.get()} {}
 
   FullPointerSet<T, Backend, conv_type::InputBackprop> to_full_pointer_set() {
     return {input, original_filter, filter.get(), transform.get(), output};
   }
 
+  /** Check whether the temporary buffers were allocated. */
+  bool valid() const { return filter.valid() && transform.valid(); }
+
+  /** Get the events which kernels using the temporary buffers depend on. */
+  std::vector<cl::sycl::event> dependencies(
+      std::vector<cl::sycl::event> events) const {
+    return transform.dependencies(filter.dependencies(std::move(events)));
+  }
+
   /** Add events to pointer on which to wait for before releasing memory */
   inline void pass_event_to_ptrs(const cl::sycl::event& event) {
     filter.set_event(event);
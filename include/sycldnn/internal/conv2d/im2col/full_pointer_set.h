@@ -55,6 +55,23 @@ struct FullPointerSet<T, Backend, conv_type::InputBackprop> {
   Pointer output;
 };
 
+/**
+ * Set of all pointers required for im2col when the filter has already been
+ * packed into the layout used by the matrix multiply, so no filter transform
+ * is needed.
+ */
+template <typename T, typename Backend>
+struct PackedFilterPointerSet {
+  using ConstPointer =
+      typename Backend::template internal_pointer_type<T const>;
+  using Pointer = typename Backend::template internal_pointer_type<T>;
+
+  ConstPointer input;
+  ConstPointer filter;
+  Pointer transform;
+  Pointer output;
+};
+
 }  // namespace im2col
 }  // namespace internal
 }  // namespace conv2d
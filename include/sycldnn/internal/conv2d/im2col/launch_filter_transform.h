@@ -52,21 +52,19 @@ SNN_EXPORT SNNStatus launch_filter_transform(
     cl::sycl::queue& queue, const std::vector<cl::sycl::event>& events);
 
 /**
- * For forward and filter backprop the original filter is used,
- *  so just return.*/
+ * Transpose a grouped HWCF filter into the GHWCF layout used by the strided
+ * batched matrix multiply.
+ */
 template <typename T, typename ConvType, typename Backend,
           typename std::enable_if<
               !std::is_same<ConvType, conv_type::InputBackprop>::value,
               int>::type = 0>
 static SNNStatus launch_filter_transform(
-    FullPointerSet<T, Backend, ConvType> const& pointers,
+    typename Backend::template internal_pointer_type<T const> filter,
+    typename Backend::template internal_pointer_type<T> transform,
     Conv2DParams const& params, Backend& backend,
     const std::vector<cl::sycl::event>& events) {
   auto queue = backend.get_queue();
-  if (filter_transform_size<ConvType>(params) == 0)
-    return {sycldnn::helpers::multi_event_to_one(events, queue),
-            StatusCode::OK};
-
   SNN_VALIDATE_PARAM(
       params.group_format != sycldnn::BatchFormat::INTERLEAVED ||
           params.filter_format == sycldnn::FilterFormat::HWCF,
@@ -76,8 +74,8 @@ static SNNStatus launch_filter_transform(
   int const channels_per_group = params.channels / params.groups;
   int const total_size = params.window_rows * params.window_cols *
                          channels_per_group * params.features;
-  auto in_mem_obj = backend.get_mem_object(pointers.filter, total_size);
-  auto out_mem_obj = backend.get_mem_object(pointers.transform, total_size);
+  auto in_mem_obj = backend.get_mem_object(filter, total_size);
+  auto out_mem_obj = backend.get_mem_object(transform, total_size);
   const std::vector<int> HWCGF_TO_HWCFG = {3, 0, 1, 2, 4};
   return sycldnn::transpose::internal::launch(
       in_mem_obj, out_mem_obj,
@@ -87,32 +85,70 @@ static SNNStatus launch_filter_transform(
 }
 
 /**
- * For the input backprop the filter needs to be mirrored.
- *
- * The AllocatedPointerSet will already have a temporary filter transform
- * buffer for this mirrored filter, so fill this with the filter values.
+ * Mirror the filter for the input backprop, writing the mirrored filter to the
+ * transform buffer. Group convolutions also move the groups into the layout
+ * used by the batched matrix multiply.
  */
 template <
     typename T, typename ConvType, typename Backend,
     typename std::enable_if<
         std::is_same<ConvType, conv_type::InputBackprop>::value, int>::type = 0>
 static SNNStatus launch_filter_transform(
-    FullPointerSet<T, Backend, ConvType> const& pointers,
+    typename Backend::template internal_pointer_type<T const> filter,
+    typename Backend::template internal_pointer_type<T> transform,
     Conv2DParams const& params, Backend& backend,
     const std::vector<cl::sycl::event>& events) {
   size_t const filter_size = params.window_rows * params.window_cols *
-                             params.channels * params.features;
-  auto filter_access =
-      backend.get_mem_object_internal(pointers.original_filter, filter_size);
-
+                             params.channels * params.features / params.groups;
+  auto filter_access = backend.get_mem_object_internal(filter, filter_size);
   auto transform_access =
-      backend.get_mem_object_internal(pointers.filter, filter_size);
+      backend.get_mem_object_internal(transform, filter_size);
 
   cl::sycl::queue queue = backend.get_queue();
   return launch_filter_transform(filter_access, transform_access, params, queue,
                                  events);
 }
 
+/**
+ * For forward and filter backprop the original filter is used,
+ *  so just return.*/
+template <typename T, typename ConvType, typename Backend,
+          typename std::enable_if<
+              !std::is_same<ConvType, conv_type::InputBackprop>::value,
+              int>::type = 0>
+static SNNStatus launch_filter_transform(
+    FullPointerSet<T, Backend, ConvType> const& pointers,
+    Conv2DParams const& params, Backend& backend,
+    const std::vector<cl::sycl::event>& events) {
+  auto queue = backend.get_queue();
+  if (filter_transform_size<ConvType>(params) == 0)
+    return {sycldnn::helpers::multi_event_to_one(events, queue),
+            StatusCode::OK};
+
+  return launch_filter_transform<T, ConvType>(pointers.filter,
+                                              pointers.transform, params,
+                                              backend, events);
+}
+
+/**
+ * For the input backprop the filter needs to be mirrored.
+ *
+ * The AllocatedPointerSet will already have a temporary filter transform
+ * buffer for this mirrored filter, so fill this with the filter values.
+ */
+template <
+    typename T, typename ConvType, typename Backend,
+    typename std::enable_if<
+        std::is_same<ConvType, conv_type::InputBackprop>::value, int>::type = 0>
+static SNNStatus launch_filter_transform(
+    FullPointerSet<T, Backend, ConvType> const& pointers,
+    Conv2DParams const& params, Backend& backend,
+    const std::vector<cl::sycl::event>& events) {
+  return launch_filter_transform<T, ConvType>(pointers.original_filter,
+                                              pointers.filter, params, backend,
+                                              events);
+}
+
 }  // namespace im2col
 }  // namespace internal
 }  // namespace conv2d
@@ -55,32 +55,45 @@ SNN_EXPORT SNNStatus launch_input_transform(
 /** Extract the buffers from the backend and call the kernel launcher. */
 template <typename T, typename ConvType, typename Backend>
 static SNNStatus launch_input_transform(
-    FullPointerSet<T, Backend, ConvType> const& pointers, size_t in_offset,
-    size_t out_offset, TileInfo const& tile_info, Conv2DParams const& params,
-    Backend& backend, const std::vector<cl::sycl::event>& events) {
+    typename Backend::template internal_pointer_type<T const> input,
+    typename Backend::template internal_pointer_type<T> transform,
+    TileInfo const& tile_info, Conv2DParams const& params, Backend& backend,
+    const std::vector<cl::sycl::event>& events) {
   auto const conv_sizes = get_sizes<ConvType>(params);
   size_t const input_size = conv_sizes.input_size;
-  auto input_acc =
-      backend.get_mem_object_internal(pointers.input + in_offset, input_size);
+  auto input_acc = backend.get_mem_object_internal(input, input_size);
 
   int n_tiles;
   int tile_size;
+  size_t transform_size;
   if (std::is_same<ConvType, conv_type::FilterBackprop>::value) {
     n_tiles = tile_info.number;
     tile_size = params.batch * tile_info.size;
+    transform_size = n_tiles * tile_size;
   } else {
+    // Group convolutions write a set of tiles for each group.
     n_tiles = params.batch * tile_info.number;
     tile_size = tile_info.size;
+    transform_size = params.groups * n_tiles * tile_size;
   }
-  size_t const transform_size = n_tiles * tile_size;
-  auto transform_acc = backend.get_mem_object_internal(
-      pointers.transform + out_offset, transform_size);
+  auto transform_acc = backend.get_mem_object_internal(transform, transform_size);
 
   cl::sycl::queue queue = backend.get_queue();
   return launch_input_transform<T, ConvType>(input_acc, transform_acc, params,
                                              n_tiles, tile_size, queue, events);
 }
 
+/** Launch the input transform using the pointers in the FullPointerSet. */
+template <typename T, typename ConvType, typename Backend>
+static SNNStatus launch_input_transform(
+    FullPointerSet<T, Backend, ConvType> const& pointers, size_t in_offset,
+    size_t out_offset, TileInfo const& tile_info, Conv2DParams const& params,
+    Backend& backend, const std::vector<cl::sycl::event>& events) {
+  return launch_input_transform<T, ConvType>(
+      pointers.input + in_offset, pointers.transform + out_offset, tile_info,
+      params, backend, events);
+}
+
 }  // namespace im2col
 }  // namespace internal
 }  // namespace conv2d
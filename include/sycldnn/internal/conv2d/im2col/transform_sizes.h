@@ -57,6 +57,16 @@ size_t filter_transform_size<conv_type::InputBackprop>(
          params.features / params.groups;
 }
 
+/**
+ * Get the tensor size needed for a filter packed ahead of time into the layout
+ * used by the im2col matrix multiply.
+ */
+template <typename ConvType>
+size_t packed_filter_size(Conv2DParams const& params) {
+  return params.window_rows * params.window_cols * params.channels *
+         params.features / params.groups;
+}
+
 /** Get the tensor size needed for the output transform. */
 template <typename ConvType>
 size_t output_transform_size(Conv2DParams const& params) {
@@ -69,6 +79,23 @@ size_t output_transform_size(Conv2DParams const& params) {
   return params.out_rows * params.out_cols * params.features;
 }
 
+/**
+ * Get the tensor size needed for the output transform of the input backprop.
+ *
+ * The matrix multiply for a strided group convolution gives the input
+ * gradient for each group in turn, which has to be transposed back into the
+ * input layout.
+ */
+template <>
+inline size_t output_transform_size<conv_type::InputBackprop>(
+    Conv2DParams const& params) {
+  if (params.groups == 1 ||
+      params.group_format == sycldnn::BatchFormat::INTERLEAVED) {
+    return 0;
+  }
+  return params.in_rows * params.in_cols * params.channels;
+}
+
 /** Get the tensor size needed for the input transform. */
 template <typename ConvType>
 size_t input_transform_size(Conv2DParams const& params) {
@@ -19,6 +19,7 @@
 #include "sycldnn/conv2d/params.h"
 
 #include "sycldnn/internal/conv2d/alloc_info.h"
+#include "sycldnn/internal/conv2d/batch_info.h"
 
 #include "sycldnn/internal/conv2d/im2col/full_pointer_set.h"
 #include "sycldnn/internal/conv2d/im2col/transform_sizes.h"
@@ -47,8 +48,8 @@ struct WorkspacePointerSet {
                       typename Backend::template pointer_type<T> workspace,
                       size_t size_per_image, Conv2DParams const& params,
                       size_t workspace_size, Backend& backend)
-      : minibatch_size{get_minibatch_size(workspace_size, size_per_image,
-                                          params)},
+      : batch_info{get_workspace_batch_info(workspace_size, size_per_image,
+                                            params)},
         input{set.input.get()},
         filter{set.filter.get()},
         transform{workspace, backend},
@@ -58,19 +59,28 @@ struct WorkspacePointerSet {
     return {input, filter, transform.get(), output};
   }
 
-  size_t minibatch_size;
+  BatchInfo batch_info;
   ConstPointer input;
   ConstPointer filter;
   InternalPointer transform;
   Pointer output;
 
  private:
-  /** Get the size of minibatch to use for the given workspace size. */
-  static size_t get_minibatch_size(size_t workspace_size, size_t size_per_image,
-                                   Conv2DParams const& params) {
+  /**
+   * Get the minibatches to use for the given workspace size, where the
+   * workspace holds the filter transform followed by the minibatch transform
+   * buffers.
+   */
+  static BatchInfo get_workspace_batch_info(size_t workspace_size,
+                                            size_t size_per_image,
+                                            Conv2DParams const& params) {
     auto const transform_sizes = get_transform_sizes<ConvType>(params);
-    return (workspace_size - transform_sizes.filter_transform_size) /
-           (size_per_image + transform_sizes.output_transform_size);
+    if (workspace_size < transform_sizes.filter_transform_size) {
+      return BatchInfo{0, 0, 0};
+    }
+    return get_pipelined_batch_info(
+        workspace_size - transform_sizes.filter_transform_size, params.batch,
+        size_per_image + transform_sizes.output_transform_size);
   }
 };
 
@@ -96,10 +106,12 @@ struct WorkspacePointerSet<T, Backend, conv_type::InputBackprop> {
                       typename Backend::template pointer_type<T> workspace,
                       size_t size_per_image, Conv2DParams const& params,
                       size_t workspace_size, Backend& backend)
-      : minibatch_size{get_minibatch_size(
+      : batch_info{get_workspace_batch_info(
             workspace_size,
             filter_transform_size<conv_type::InputBackprop>(params),
-            size_per_image)},
+            size_per_image +
+                output_transform_size<conv_type::InputBackprop>(params),
+            params.batch)},
         input{set.input.get()},
         original_filter{set.filter.get()},
         filter{workspace, backend},
@@ -112,7 +124,7 @@ struct WorkspacePointerSet<T, Backend, conv_type::InputBackprop> {
     return {input, original_filter, filter.get(), transform.get(), output};
   }
 
-  size_t minibatch_size;
+  BatchInfo batch_info;
   ConstPointer input;
   ConstPointer original_filter;
   InternalPointer filter;
@@ -120,11 +132,20 @@ struct WorkspacePointerSet<T, Backend, conv_type::InputBackprop> {
   Pointer output;
 
  private:
-  /** Get the size of minibatch to use for the given workspace size. */
-  static size_t get_minibatch_size(size_t workspace_size, size_t filter_size,
-                                   size_t size_per_image) {
-    size_t transform_workspace_size = workspace_size - filter_size;
-    return transform_workspace_size / size_per_image;
+  /**
+   * Get the minibatches to use for the given workspace size, where the
+   * workspace holds the rotated filter followed by the minibatch transform
+   * buffers.
+   */
+  static BatchInfo get_workspace_batch_info(size_t workspace_size,
+                                            size_t filter_size,
+                                            size_t size_per_image,
+                                            size_t n_images) {
+    if (workspace_size < filter_size) {
+      return BatchInfo{0, 0, 0};
+    }
+    return get_pipelined_batch_info(workspace_size - filter_size, n_images,
+                                    size_per_image);
   }
 };
 
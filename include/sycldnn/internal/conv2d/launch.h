@@ -27,15 +27,21 @@
 
 #include "sycldnn/backend/backend_helpers.h"
 #include "sycldnn/conv2d/algorithm.h"
+#include "sycldnn/conv2d/epilogue.h"
 #include "sycldnn/conv2d/params.h"
 #include "sycldnn/conv2d/selector/selector.h"
+#include "sycldnn/helpers/macros.h"
 
 #include "sycldnn/conv2d/implementation/direct.h"
+#include "sycldnn/conv2d/implementation/epilogue.h"
 #include "sycldnn/conv2d/implementation/im2col.h"
+#include "sycldnn/conv2d/implementation/implicit_gemm.h"
 #include "sycldnn/conv2d/implementation/matmul.h"
 #include "sycldnn/conv2d/implementation/tiled.h"
 #include "sycldnn/conv2d/implementation/winograd.h"
 
+#include <type_traits>
+
 namespace sycldnn {
 namespace conv2d {
 
@@ -73,10 +79,10 @@ SNNStatus validate_params(Conv2DParams const& params) {
                      "Channels must be divisble by groups.");
   SNN_VALIDATE_PARAM(params.features % params.groups == 0,
                      "Features must be divisble by groups.");
-  SNN_VALIDATE_PARAM(params.dilation_rows == 1,
-                     "Currently SYCL-DNN only supports dilation 1.");
-  SNN_VALIDATE_PARAM(params.dilation_cols == 1,
-                     "Currently SYCL-DNN only supports dilation 1.");
+  SNN_VALIDATE_PARAM(params.dilation_rows > 0,
+                     "The dilation in the row direction must be positive.");
+  SNN_VALIDATE_PARAM(params.dilation_cols > 0,
+                     "The dilation in the column direction must be positive.");
 
   auto implies = [](bool x, bool y) { return !x || y; };
   SNN_VALIDATE_PARAM(implies(params.input_format == DataFormat::NHWC,
@@ -96,6 +102,72 @@ SNNStatus validate_params(Conv2DParams const& params) {
   return StatusCode::OK;
 }
 
+/**
+ * Check whether an algorithm can compute a convolution on NCHW tensors.
+ *
+ * The direct algorithm supports NCHW for every pass. When SYCL-DNN is built
+ * with NCHW support the tiled, im2col, matmul and Winograd algorithms also
+ * support NCHW forward convolutions without groups.
+ */
+template <typename ConvType>
+bool supports_nchw(Algorithm algo_tag, Conv2DParams const& params) {
+  if (algo_tag == Algorithm::Direct) {
+    return true;
+  }
+#ifdef SNN_ENABLE_NCHW
+  if (!std::is_same<ConvType, conv_type::Forward>::value ||
+      params.groups != 1) {
+    return false;
+  }
+  switch (algo_tag) {
+    case Algorithm::Tiled:
+    case Algorithm::Im2col:
+    case Algorithm::Matmul:
+    case Algorithm::Winograd:
+    case Algorithm::WinogradLarge:
+    case Algorithm::Winograd6x6:
+    case Algorithm::Winograd5x5:
+    case Algorithm::Winograd5x5Large:
+      return true;
+    default:
+      return false;
+  }
+#else
+  SNN_UNUSED_VAR(params);
+  return false;
+#endif  // SNN_ENABLE_NCHW
+}
+
+/**
+ * Check whether an algorithm can compute a group convolution.
+ *
+ * The direct and tiled algorithms support group convolutions with NHWC inputs
+ * and HWCF filters for every pass they provide. Im2col supports any forward
+ * group convolution and the input backprop with HWCF filters, but not the
+ * filter backprop as its minibatches accumulate into a single matrix
+ * multiply output.
+ */
+template <typename ConvType>
+bool supports_groups(Algorithm algo_tag, Conv2DParams const& params) {
+  if (params.groups == 1) {
+    return true;
+  }
+  if (params.input_format != DataFormat::NHWC) {
+    return false;
+  }
+  bool const hwcf = params.filter_format == FilterFormat::HWCF;
+  switch (algo_tag) {
+    case Algorithm::Direct:
+    case Algorithm::Tiled:
+      return hwcf;
+    case Algorithm::Im2col:
+      return std::is_same<ConvType, conv_type::Forward>::value ||
+             (std::is_same<ConvType, conv_type::InputBackprop>::value && hwcf);
+    default:
+      return false;
+  }
+}
+
 template <typename T, typename ConvType, typename Backend>
 SNNStatus select_and_launch(
     typename Backend::template pointer_type<T const> input,
@@ -103,27 +175,55 @@ SNNStatus select_and_launch(
     typename Backend::template pointer_type<T> output,
     Conv2DParams const& params, Algorithm& algo_tag, Backend& backend,
     typename Backend::template pointer_type<T> workspace,
-    size_t workspace_size) {
+    size_t workspace_size, Epilogue<T, Backend> const& epilogue) {
   switch (algo_tag) {
     case Algorithm::Direct:
       return launch_direct<T, ConvType>(input, filter, output, params, backend,
-                                        {});
+                                        {}, epilogue);
     case Algorithm::Tiled:
+      if constexpr (std::is_same<ConvType, conv_type::FilterBackprop>::value) {
+        return launch_tiled_filter_backprop<T>(input, filter, output,
+                                               workspace, params,
+                                               workspace_size, backend, {});
+      }
       return launch_tiled<T, ConvType>(input, filter, output, params, backend,
-                                       {});
-    case Algorithm::Im2col:
-      return launch_im2col<T, ConvType>(input, filter, output, workspace,
-                                        params, workspace_size, backend, {});
+                                       {}, epilogue);
+    case Algorithm::TiledLocal:
+      return launch_tiled_local<T, ConvType>(input, filter, output, params,
+                                             backend, {}, epilogue);
+    case Algorithm::ImplicitGemm:
+      return launch_implicit_gemm<T, ConvType>(input, filter, output, params,
+                                               backend, {}, epilogue);
+    case Algorithm::Im2col: {
+      auto status = launch_im2col<T, ConvType>(input, filter, output, workspace,
+                                               params, workspace_size, backend,
+                                               {});
+      return apply_unfused_epilogue<T>(status, output, params, backend,
+                                       epilogue);
+    }
     case Algorithm::Winograd:
       return launch_winograd<T, ConvType>(input, filter, output, workspace,
-                                          params, workspace_size, backend, {});
+                                          params, workspace_size, backend, {},
+                                          epilogue);
     case Algorithm::WinogradLarge:
-      return launch_winograd_large<T, ConvType>(input, filter, output,
-                                                workspace, params,
-                                                workspace_size, backend, {});
+      return launch_winograd_large<T, ConvType>(
+          input, filter, output, workspace, params, workspace_size, backend, {},
+          epilogue);
     case Algorithm::Matmul:
       return launch_matmul<T, ConvType>(input, filter, output, params, backend,
-                                        {});
+                                        {}, epilogue);
+    case Algorithm::Winograd6x6:
+      return launch_winograd_fixed<T, ConvType, Algorithm::Winograd6x6>(
+          input, filter, output, workspace, params, workspace_size, backend,
+          {}, epilogue);
+    case Algorithm::Winograd5x5:
+      return launch_winograd_fixed<T, ConvType, Algorithm::Winograd5x5>(
+          input, filter, output, workspace, params, workspace_size, backend,
+          {}, epilogue);
+    case Algorithm::Winograd5x5Large:
+      return launch_winograd_fixed<T, ConvType, Algorithm::Winograd5x5Large>(
+          input, filter, output, workspace, params, workspace_size, backend,
+          {}, epilogue);
     case Algorithm::NotSupported:
     default:
       return StatusCode::InvalidAlgorithm;
@@ -137,30 +237,57 @@ SNNStatus select_and_launch_usm(
     typename Backend::template pointer_type<T> output,
     Conv2DParams const& params, Algorithm& algo_tag, Backend& backend,
     typename Backend::template pointer_type<T> workspace, size_t workspace_size,
-    const std::vector<cl::sycl::event>& events) {
+    const std::vector<cl::sycl::event>& events,
+    Epilogue<T, Backend> const& epilogue) {
   // TODO Expand switch statement with more supported USM algos
   switch (algo_tag) {
     case Algorithm::Direct:
       return launch_direct<T, ConvType>(input, filter, output, params, backend,
-                                        events);
+                                        events, epilogue);
     case Algorithm::Matmul:
       return launch_matmul<T, ConvType>(input, filter, output, params, backend,
-                                        events);
-    case Algorithm::Im2col:
-      return launch_im2col<T, ConvType>(input, filter, output, workspace,
-                                        params, workspace_size, backend,
-                                        events);
+                                        events, epilogue);
+    case Algorithm::Im2col: {
+      auto status = launch_im2col<T, ConvType>(input, filter, output, workspace,
+                                               params, workspace_size, backend,
+                                               events);
+      return apply_unfused_epilogue<T>(status, output, params, backend,
+                                       epilogue);
+    }
     case Algorithm::Winograd:
       return launch_winograd<T, ConvType>(input, filter, output, workspace,
                                           params, workspace_size, backend,
-                                          events);
+                                          events, epilogue);
     case Algorithm::WinogradLarge:
       return launch_winograd_large<T, ConvType>(
           input, filter, output, workspace, params, workspace_size, backend,
-          events);
+          events, epilogue);
+    case Algorithm::Winograd6x6:
+      return launch_winograd_fixed<T, ConvType, Algorithm::Winograd6x6>(
+          input, filter, output, workspace, params, workspace_size, backend,
+          events, epilogue);
+    case Algorithm::Winograd5x5:
+      return launch_winograd_fixed<T, ConvType, Algorithm::Winograd5x5>(
+          input, filter, output, workspace, params, workspace_size, backend,
+          events, epilogue);
+    case Algorithm::Winograd5x5Large:
+      return launch_winograd_fixed<T, ConvType, Algorithm::Winograd5x5Large>(
+          input, filter, output, workspace, params, workspace_size, backend,
+          events, epilogue);
     case Algorithm::Tiled:
+      if constexpr (std::is_same<ConvType, conv_type::FilterBackprop>::value) {
+        return launch_tiled_filter_backprop<T>(input, filter, output,
+                                               workspace, params,
+                                               workspace_size, backend, events);
+      }
       return launch_tiled<T, ConvType>(input, filter, output, params, backend,
-                                       events);
+                                       events, epilogue);
+    case Algorithm::TiledLocal:
+      return launch_tiled_local<T, ConvType>(input, filter, output, params,
+                                             backend, events, epilogue);
+    case Algorithm::ImplicitGemm:
+      return launch_implicit_gemm<T, ConvType>(input, filter, output, params,
+                                               backend, events, epilogue);
     default:
       return StatusCode::InvalidAlgorithm;
   }
@@ -174,35 +301,45 @@ SNNStatus sublaunch(typename Backend::template pointer_type<T const> input,
                     Backend& backend,
                     typename Backend::template pointer_type<T> workspace,
                     size_t workspace_size,
-                    const std::vector<cl::sycl::event>& events) {
+                    const std::vector<cl::sycl::event>& events,
+                    Epilogue<T, Backend> const& epilogue = {}) {
   auto status = validate_params(params);
   if (status.status != StatusCode::OK) {
     return status;
   }
-  SNN_VALIDATE_PARAM(
-      (params.groups == 1 || std::is_same<ConvType, conv_type::Forward>::value),
-      "Grouped convolution is only supported for the forward pass.");
-  SNN_VALIDATE_PARAM((params.group_format != BatchFormat::INTERLEAVED) ||
+  SNN_VALIDATE_PARAM((is_identity(epilogue.get_params()) ||
+                      std::is_same<ConvType, conv_type::Forward>::value),
+                     "An epilogue is only supported for the forward pass.");
+
+  Algorithm algo_tag = selector.select<ConvType>(params);
+  SNN_VALIDATE_PARAM((algo_tag != Algorithm::Im2col) ||
+                         (params.group_format != BatchFormat::INTERLEAVED) ||
                          backend::supports_interleaved_matmul<Backend>::value,
                      "The chosen backend does not support interleaved batched "
                      "matmul, used in im2col algorithm.");
-
-  Algorithm algo_tag = selector.select<ConvType>(params);
   if (params.input_format == DataFormat::NCHW &&
-      algo_tag != Algorithm::Direct) {
+      !supports_nchw<ConvType>(algo_tag, params)) {
     return StatusCode::InvalidAlgorithm;
   }
-  if (params.groups > 1 && algo_tag != Algorithm::Im2col) {
+  if (!supports_groups<ConvType>(algo_tag, params)) {
+    return StatusCode::InvalidAlgorithm;
+  }
+  if ((params.dilation_rows != 1 || params.dilation_cols != 1) &&
+      (algo_tag == Algorithm::Winograd ||
+       algo_tag == Algorithm::WinogradLarge ||
+       algo_tag == Algorithm::Winograd6x6 ||
+       algo_tag == Algorithm::Winograd5x5 ||
+       algo_tag == Algorithm::Winograd5x5Large)) {
     return StatusCode::InvalidAlgorithm;
   }
   if constexpr (backend::is_usm_backend<Backend>::value) {
     return select_and_launch_usm<T, ConvType, Backend>(
         input, filter, output, params, algo_tag, backend, workspace,
-        workspace_size, events);
+        workspace_size, events, epilogue);
   } else {
-    return select_and_launch<T, ConvType, Backend>(input, filter, output,
-                                                   params, algo_tag, backend,
-                                                   workspace, workspace_size);
+    return select_and_launch<T, ConvType, Backend>(
+        input, filter, output, params, algo_tag, backend, workspace,
+        workspace_size, epilogue);
   }
 }
 
@@ -17,6 +17,7 @@
 #define SYCLDNN_INCLUDE_INTERNAL_CONV2D_TILED_H_
 
 #include "sycldnn/conv2d/params.h"
+#include "sycldnn/internal/conv2d/epilogue.h"
 #include "sycldnn/mem_object.h"
 #include "sycldnn/status.h"
 
@@ -33,9 +34,35 @@ namespace internal {
 template <typename T, typename ConvType, template <typename> class MemObj>
 SNN_EXPORT SNNStatus launch_tiled(MemObj<T const>& input,
                                   MemObj<T const>& filter, MemObj<T>& output,
+                                  EpilogueMem<T, MemObj>& epilogue,
                                   Conv2DParams const& params,
                                   cl::sycl::queue& queue,
                                   const std::vector<cl::sycl::event>& events);
+
+/**
+ * The internal tiled convolution launcher for the kernels which stage their
+ * input and filter data in local memory.
+ *
+ * Implemented in the compiled SYCL DNN library.
+ */
+template <typename T, typename ConvType, template <typename> class MemObj>
+SNN_EXPORT SNNStatus launch_tiled_local(
+    MemObj<T const>& input, MemObj<T const>& filter, MemObj<T>& output,
+    EpilogueMem<T, MemObj>& epilogue, Conv2DParams const& params,
+    cl::sycl::queue& queue, const std::vector<cl::sycl::event>& events);
+
+/**
+ * The internal tiled filter backprop launcher, which can split the filter
+ * gradient reduction across work-groups using the provided workspace.
+ *
+ * Implemented in the compiled SYCL DNN library.
+ */
+template <typename T, template <typename> class MemObj>
+SNN_EXPORT SNNStatus launch_tiled_filter_backprop(
+    MemObj<T const>& input, MemObj<T const>& output_grad,
+    MemObj<T>& filter_grad, MemObj<T>& workspace, size_t workspace_size,
+    Conv2DParams const& params, cl::sycl::queue& queue,
+    const std::vector<cl::sycl::event>& events);
 }  // namespace internal
 }  // namespace conv2d
 }  // namespace sycldnn
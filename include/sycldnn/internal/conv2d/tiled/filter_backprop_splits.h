@@ -0,0 +1,86 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_INTERNAL_CONV2D_TILED_FILTER_BACKPROP_SPLITS_H_
+#define SYCLDNN_INCLUDE_INTERNAL_CONV2D_TILED_FILTER_BACKPROP_SPLITS_H_
+
+#include "sycldnn/conv2d/params.h"
+
+#include "sycldnn/helpers/ratio.h"
+
+#include <stddef.h>
+#include <algorithm>
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+namespace tiled {
+
+/**
+ * Number of work-groups per compute unit that the tiled filter backprop aims
+ * to launch before it splits the reduction over the output rows.
+ */
+constexpr size_t filter_backprop_groups_per_unit = 4;
+
+/**
+ * Largest number of work-groups that the tiled filter backprop workspace is
+ * sized for. The workspace query does not know the device, so this bounds the
+ * number of partial filter gradients that any device will use.
+ */
+constexpr size_t filter_backprop_max_groups = 2048;
+
+/** Get the number of elements in the filter gradient of a convolution. */
+inline size_t filter_backprop_filter_size(Conv2DParams const& params) {
+  return static_cast<size_t>(params.window_rows) * params.window_cols *
+         (params.channels / params.groups) * params.features;
+}
+
+/**
+ * Get the number of chunks of output rows to split the filter backprop
+ * reduction into, so that at least target_groups work-groups are launched
+ * when the filter gradient has fewer than target_groups vectors.
+ */
+inline size_t filter_backprop_splits(Conv2DParams const& params,
+                                     size_t n_filter_vectors,
+                                     size_t target_groups) {
+  if (n_filter_vectors == 0 || n_filter_vectors >= target_groups) {
+    return 1;
+  }
+  return std::min(
+      helpers::round_ratio_up_above_zero(target_groups, n_filter_vectors),
+      static_cast<size_t>(params.out_rows));
+}
+
+/**
+ * Get the number of elements needed to hold the partial filter gradients of
+ * the tiled filter backprop, or zero if the reduction is never split.
+ *
+ * The workspace is sized for the widest vectors the kernel uses, as these
+ * give the fewest filter vectors and so the most splits.
+ */
+inline size_t filter_backprop_workspace_size(Conv2DParams const& params) {
+  size_t const filter_size = filter_backprop_filter_size(params);
+  size_t const min_filter_vectors = std::max<size_t>(1, filter_size / 4);
+  size_t const n_splits = filter_backprop_splits(params, min_filter_vectors,
+                                                 filter_backprop_max_groups);
+  return n_splits > 1 ? n_splits * filter_size : 0;
+}
+
+}  // namespace tiled
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_INCLUDE_INTERNAL_CONV2D_TILED_FILTER_BACKPROP_SPLITS_H_
@@ -0,0 +1,176 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_INTERNAL_CONV2D_TRANSFORM_FILTER_H_
+#define SYCLDNN_INCLUDE_INTERNAL_CONV2D_TRANSFORM_FILTER_H_
+
+/**
+ * \file
+ * Implements the \ref sycldnn::conv2d::sublaunch_transform_filter() and
+ * \ref sycldnn::conv2d::sublaunch_transformed() functions, which dispatch the
+ * kernels to transform a filter once ahead of time and to compute a
+ * convolution using that transformed filter.
+ */
+
+#include "sycldnn/status.h"
+
+#include "sycldnn/backend/backend_helpers.h"
+#include "sycldnn/conv2d/algorithm.h"
+#include "sycldnn/conv2d/conv_type.h"
+#include "sycldnn/conv2d/params.h"
+#include "sycldnn/conv2d/selector/selector.h"
+
+#include "sycldnn/conv2d/implementation/im2col.h"
+#include "sycldnn/conv2d/implementation/winograd.h"
+
+#include "sycldnn/internal/conv2d/launch.h"
+
+namespace sycldnn {
+namespace conv2d {
+
+/**
+ * Check that the parameters describe a convolution which supports a
+ * pre-transformed filter.
+ */
+template <typename ConvType, typename Backend>
+SNNStatus validate_transformed_filter_params(Conv2DParams const& params,
+                                             Algorithm algo_tag) {
+  auto status = validate_params(params);
+  if (status.status != StatusCode::OK) {
+    return status;
+  }
+  SNN_VALIDATE_PARAM(
+      (!std::is_same<ConvType, conv_type::FilterBackprop>::value),
+      "Pre-transformed filters are not supported for the filter backprop.");
+  SNN_VALIDATE_PARAM((params.groups == 1 ||
+                      std::is_same<ConvType, conv_type::Forward>::value ||
+                      params.filter_format == FilterFormat::HWCF),
+                     "Grouped input backprop is only supported for HWCF "
+                     "filters.");
+  SNN_VALIDATE_PARAM((params.group_format != BatchFormat::INTERLEAVED) ||
+                         backend::supports_interleaved_matmul<Backend>::value,
+                     "The chosen backend does not support interleaved batched "
+                     "matmul, used in im2col algorithm.");
+  SNN_VALIDATE_PARAM(params.input_format == DataFormat::NHWC,
+                     "Pre-transformed filters are only supported for NHWC.");
+  if (params.groups > 1 && algo_tag != Algorithm::Im2col) {
+    return StatusCode::InvalidAlgorithm;
+  }
+  if ((params.dilation_rows != 1 || params.dilation_cols != 1) &&
+      algo_tag != Algorithm::Im2col) {
+    return StatusCode::InvalidAlgorithm;
+  }
+  return StatusCode::OK;
+}
+
+template <typename T, typename ConvType, typename Backend>
+SNNStatus sublaunch_transform_filter(
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T> transformed,
+    Conv2DParams const& params, Selector& selector, Backend& backend,
+    const std::vector<cl::sycl::event>& events) {
+  if constexpr (std::is_same<ConvType, conv_type::FilterBackprop>::value) {
+    return StatusCode::InvalidAlgorithm;
+  } else {
+    Algorithm algo_tag = selector.select<ConvType>(params);
+    auto status =
+        validate_transformed_filter_params<ConvType, Backend>(params, algo_tag);
+    if (status.status != StatusCode::OK) {
+      return status;
+    }
+    switch (algo_tag) {
+      case Algorithm::Im2col:
+        return pack_filter_im2col<T, ConvType>(filter, transformed, params,
+                                               backend, events);
+      case Algorithm::Winograd:
+        return transform_filter_winograd<T, ConvType>(filter, transformed,
+                                                      params, backend, events);
+      case Algorithm::WinogradLarge:
+        return transform_filter_winograd_large<T, ConvType>(
+            filter, transformed, params, backend, events);
+      case Algorithm::Winograd6x6:
+        return transform_filter_winograd_fixed<T, ConvType,
+                                               Algorithm::Winograd6x6>(
+            filter, transformed, params, backend, events);
+      case Algorithm::Winograd5x5:
+        return transform_filter_winograd_fixed<T, ConvType,
+                                               Algorithm::Winograd5x5>(
+            filter, transformed, params, backend, events);
+      case Algorithm::Winograd5x5Large:
+        return transform_filter_winograd_fixed<T, ConvType,
+                                               Algorithm::Winograd5x5Large>(
+            filter, transformed, params, backend, events);
+      default:
+        return StatusCode::InvalidAlgorithm;
+    }
+  }
+}
+
+template <typename T, typename ConvType, typename Backend>
+SNNStatus sublaunch_transformed(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T const> transformed,
+    typename Backend::template pointer_type<T> output,
+    Conv2DParams const& params, Selector& selector, Backend& backend,
+    typename Backend::template pointer_type<T> workspace,
+    size_t workspace_size, const std::vector<cl::sycl::event>& events) {
+  if constexpr (std::is_same<ConvType, conv_type::FilterBackprop>::value) {
+    return StatusCode::InvalidAlgorithm;
+  } else {
+    Algorithm algo_tag = selector.select<ConvType>(params);
+    auto status =
+        validate_transformed_filter_params<ConvType, Backend>(params, algo_tag);
+    if (status.status != StatusCode::OK) {
+      return status;
+    }
+    switch (algo_tag) {
+      case Algorithm::Im2col:
+        return launch_im2col_packed<T, ConvType>(input, transformed, output,
+                                                 workspace, params,
+                                                 workspace_size, backend,
+                                                 events);
+      case Algorithm::Winograd:
+        return launch_winograd_transformed_filter<T, ConvType>(
+            input, transformed, output, workspace, params, workspace_size,
+            backend, events);
+      case Algorithm::WinogradLarge:
+        return launch_winograd_large_transformed_filter<T, ConvType>(
+            input, transformed, output, workspace, params, workspace_size,
+            backend, events);
+      case Algorithm::Winograd6x6:
+        return launch_winograd_fixed_transformed_filter<T, ConvType,
+                                                        Algorithm::Winograd6x6>(
+            input, transformed, output, workspace, params, workspace_size,
+            backend, events);
+      case Algorithm::Winograd5x5:
+        return launch_winograd_fixed_transformed_filter<T, ConvType,
+                                                        Algorithm::Winograd5x5>(
+            input, transformed, output, workspace, params, workspace_size,
+            backend, events);
+      case Algorithm::Winograd5x5Large:
+        return launch_winograd_fixed_transformed_filter<
+            T, ConvType, Algorithm::Winograd5x5Large>(
+            input, transformed, output, workspace, params, workspace_size,
+            backend, events);
+      default:
+        return StatusCode::InvalidAlgorithm;
+    }
+  }
+}
+
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_INCLUDE_INTERNAL_CONV2D_TRANSFORM_FILTER_H_
@@ -18,6 +18,9 @@
 
 #include "sycldnn/status.h"
 
+#include "sycldnn/helpers/macros.h"
+
+#include "sycldnn/conv2d/epilogue.h"
 #include "sycldnn/conv2d/params.h"
 
 #include "sycldnn/internal/conv2d/batch_info.h"
@@ -30,6 +33,7 @@
 #include "sycldnn/internal/conv2d/winograd/launch_output_transform.h"
 #include "sycldnn/internal/conv2d/winograd/pointer_set.h"
 #include "sycldnn/internal/conv2d/winograd/tile_info.h"
+#include "sycldnn/internal/conv2d/winograd/tile_sizes.h"
 
 #include <CL/sycl.hpp>
 
@@ -49,14 +53,26 @@ namespace internal {
 namespace winograd {
 
 /**
- * Launch the kernels to compute a convolution over all minibatches.
+ * Launch the kernels to compute a convolution over all minibatches, using a
+ * filter which has already been transformed into the Winograd domain.
  *
- * \param pointers   Full set of pointers for the convolution
+ * The input transform and intermediate tensors for a minibatch are stored
+ * contiguously. If batch_info requests two buffers then a second set of
+ * tensors follows the first, and alternate minibatches use alternate buffers.
+ * A minibatch then only waits for the minibatch which last used its buffer
+ * before transforming its input, so the input transform of one minibatch can
+ * overlap the matmul and output transform of the previous one. The output
+ * transforms are always run in order, so the event returned for the last one
+ * covers every minibatch.
+ *
+ * \param pointers   Set of pointers for the convolution, including the
+ *                   pre-transformed filter
  * \param params     Kernel parameters for the convolution
  * \param tile_info  Information about the number of Winograd tiles
  * \param batch_info Information about the minibatch size
  * \param backend    Backend to use for matrix multiplication
- * \param events    Vector of events to synchronize on before launching kernel
+ * \param events     Vector of events to synchronize on before launching kernel
+ * \param epilogue   Epilogue to apply to the convolution output
  * \return An SNNStatus object containing a SYCL event corresponding to the last
  * kernel launched.
  */
@@ -65,25 +81,27 @@ template <
     typename std::enable_if<
         !std::is_same<ConvType, conv_type::FilterBackprop>::value, int>::type =
         0>
-SNNStatus launch_with_transforms(FullPointerSet<T, Backend> const& pointers,
-                                 Conv2DParams const& params,
-                                 TileInfo const& tile_info,
-                                 BatchInfo const& batch_info, Backend& backend,
-                                 const std::vector<cl::sycl::event>& events) {
+SNNStatus launch_with_transformed_filter(
+    TransformedFilterPointerSet<T, Backend> const& pointers,
+    Conv2DParams const& params, TileInfo const& tile_info,
+    BatchInfo const& batch_info, Backend& backend,
+    const std::vector<cl::sycl::event>& events,
+    Epilogue<T, Backend> const& epilogue) {
   constexpr int A = M + R - 1;
   constexpr int B = N + S - 1;
   constexpr bool transpose_input = false;
   // Need to transpose for the input backprop, but not for the forward pass
   constexpr bool transpose_filter =
       std::is_same<ConvType, conv_type::InputBackprop>::value;
-  auto fil_status = launch_filter_transform<T, ConvType, M, N, R, S>(
-      pointers.filter, pointers.filter_transform, params, tile_info, backend,
-      events);
-  if (fil_status.status != StatusCode::OK) {
-    return fil_status;
-  }
 
-  cl::sycl::event last_event = fil_status.event;
+  size_t const buffer_stride = A * B * tile_info.number *
+                               batch_info.images_per_batch *
+                               (params.channels + params.features);
+
+  cl::sycl::event last_event;
+  // Events which must complete before each buffer can be reused.
+  std::vector<std::vector<cl::sycl::event>> buffer_dependencies(
+      batch_info.n_buffers, events);
   Conv2DParams kernel_params{params};
   kernel_params.batch = batch_info.images_per_batch;
   for (size_t i = 0; i < batch_info.n_batches; ++i) {
@@ -92,34 +110,78 @@ SNNStatus launch_with_transforms(FullPointerSet<T, Backend> const& pointers,
     if (i == batch_info.n_batches - 1) {
       kernel_params.batch = batch_info.last_batch_size;
     }
+    size_t const buffer = i % batch_info.n_buffers;
+    auto input_transform = pointers.input_transform + buffer * buffer_stride;
+    auto intermediate = pointers.intermediate + buffer * buffer_stride;
 
     auto inp_status = launch_input_transform<T, ConvType, M, N, R, S>(
-        pointers.input + offset.in, pointers.input_transform, kernel_params,
-        tile_info, backend, std::vector<cl::sycl::event>{last_event});
+        pointers.input + offset.in, input_transform, kernel_params, tile_info,
+        backend, buffer_dependencies[buffer]);
     if (inp_status.status != StatusCode::OK) {
       return inp_status;
     }
-    last_event = inp_status.event;
 
-    last_event =
+    auto matmul_event =
         backend.template batch_matmul<transpose_input, transpose_filter, T>(
-            pointers.input_transform, pointers.filter_transform,
-            pointers.intermediate, A * B,
+            input_transform, pointers.filter_transform, intermediate, A * B,
             tile_info.number * kernel_params.batch, kernel_params.channels,
             kernel_params.features, sycldnn::BatchFormat::STRIDED,
-            std::vector<cl::sycl::event>{last_event});
+            std::vector<cl::sycl::event>{inp_status.event});
 
+    std::vector<cl::sycl::event> out_dependencies{matmul_event};
+    if (i > 0) {
+      out_dependencies.push_back(last_event);
+    }
     auto out_status = launch_output_transform<T, ConvType, M, N, R, S>(
-        pointers.intermediate, pointers.output + offset.out, kernel_params,
-        tile_info, backend, std::vector<cl::sycl::event>{last_event});
+        intermediate, pointers.output + offset.out, kernel_params, tile_info,
+        backend, out_dependencies, epilogue, offset.out);
     if (out_status.status != StatusCode::OK) {
       return out_status;
     }
     last_event = out_status.event;
+    buffer_dependencies[buffer] = std::vector<cl::sycl::event>{last_event};
   }
   return SNNStatus{last_event, StatusCode::OK};
 }
 
+/**
+ * Launch the kernels to compute a convolution over all minibatches.
+ *
+ * \param pointers   Full set of pointers for the convolution
+ * \param params     Kernel parameters for the convolution
+ * \param tile_info  Information about the number of Winograd tiles
+ * \param batch_info Information about the minibatch size
+ * \param backend    Backend to use for matrix multiplication
+ * \param events    Vector of events to synchronize on before launching kernel
+ * \param epilogue   Epilogue to apply to the convolution output
+ * \return An SNNStatus object containing a SYCL event corresponding to the last
+ * kernel launched.
+ */
+template <
+    typename T, int M, int N, int R, int S, typename ConvType, typename Backend,
+    typename std::enable_if<
+        !std::is_same<ConvType, conv_type::FilterBackprop>::value, int>::type =
+        0>
+SNNStatus launch_with_transforms(FullPointerSet<T, Backend> const& pointers,
+                                 Conv2DParams const& params,
+                                 TileInfo const& tile_info,
+                                 BatchInfo const& batch_info, Backend& backend,
+                                 const std::vector<cl::sycl::event>& events,
+                                 Epilogue<T, Backend> const& epilogue) {
+  auto fil_status = launch_filter_transform<T, ConvType, M, N, R, S>(
+      pointers.filter, pointers.filter_transform, params, tile_info, backend,
+      events);
+  if (fil_status.status != StatusCode::OK) {
+    return fil_status;
+  }
+  auto transformed_pointers = TransformedFilterPointerSet<T, Backend>{
+      pointers.input, pointers.filter_transform, pointers.output,
+      pointers.input_transform, pointers.intermediate};
+  return launch_with_transformed_filter<T, M, N, R, S, ConvType>(
+      transformed_pointers, params, tile_info, batch_info, backend,
+      std::vector<cl::sycl::event>{fil_status.event}, epilogue);
+}
+
 /** \copydoc launch_with_transforms() */
 template <
     typename T, int M, int N, int R, int S, typename ConvType, typename Backend,
@@ -130,9 +192,11 @@ SNNStatus launch_with_transforms(FullPointerSet<T, Backend> pointers,
                                  Conv2DParams const& params,
                                  TileInfo const& tile_info,
                                  BatchInfo const& batch_info, Backend& backend,
-                                 const std::vector<cl::sycl::event>& events) {
+                                 const std::vector<cl::sycl::event>& events,
+                                 Epilogue<T, Backend> const& epilogue) {
   constexpr int A = M + R - 1;
   constexpr int B = N + S - 1;
+  SNN_UNUSED_VAR(epilogue);
   constexpr bool transpose_input = true;
   constexpr bool transpose_filter = false;
   // For the filter backprop, we need to switch the temporary filter
@@ -214,6 +278,7 @@ SNNStatus launch_with_transforms(FullPointerSet<T, Backend> pointers,
  * \param backend        User provided backend to handle allocations and matrix
  *                       multiplies
  * \param events    Vector of events to synchronize on before launching kernel
+ * \param epilogue       Epilogue to apply to the convolution output
  * \return An SNNStatus object containing a SYCL event corresponding to the last
  * kernel launched.
  */
@@ -225,7 +290,8 @@ SNNStatus split_workspace_and_launch_with_tiles(
     typename Backend::template pointer_type<T> output,
     typename Backend::template pointer_type<T> workspace,
     Conv2DParams const& params, size_t workspace_size, Backend& backend,
-    const std::vector<cl::sycl::event>& events) {
+    const std::vector<cl::sycl::event>& events,
+    Epilogue<T, Backend> const& epilogue) {
   using InternalPointer =
       ::sycldnn::internal::helpers::InternalPointer<T, Backend>;
   constexpr int A = M + R - 1;
@@ -240,12 +306,24 @@ SNNStatus split_workspace_and_launch_with_tiles(
       A * B * tile_info.number * kernel_params.channels;
   size_t const inter_transform_size =
       A * B * tile_info.number * kernel_params.features;
+  size_t const size_per_image = input_transform_size + inter_transform_size;
+  if (workspace_size < filter_transform_size + size_per_image) {
+    return StatusCode::InsufficientWorkspace;
+  }
   size_t const workspace_minus_filter = workspace_size - filter_transform_size;
 
-  size_t const minibatch_size = std::min<size_t>(
-      workspace_minus_filter / (input_transform_size + inter_transform_size),
-      params.batch);
-  size_t const mb_input_transform_size = input_transform_size * minibatch_size;
+  // The filter backprop accumulates every minibatch into the same output
+  // transform, so there is nothing to gain from double buffering.
+  auto const batch_info =
+      std::is_same<ConvType, conv_type::FilterBackprop>::value
+          ? get_batch_info(
+                std::min<size_t>(workspace_minus_filter / size_per_image,
+                                 params.batch),
+                params.batch)
+          : get_pipelined_batch_info(workspace_minus_filter, params.batch,
+                                     size_per_image);
+  size_t const mb_input_transform_size =
+      input_transform_size * batch_info.images_per_batch;
 
   InternalPointer filter_transform_ptr{workspace, backend};
   InternalPointer input_transform_ptr{workspace + filter_transform_size,
@@ -258,9 +336,9 @@ SNNStatus split_workspace_and_launch_with_tiles(
       input_pointers.output.get(), input_transform_ptr.get(),
       filter_transform_ptr.get(),  inter_transform_ptr.get()};
 
-  auto batch_info = get_batch_info(minibatch_size, params.batch);
   return launch_with_transforms<T, M, N, R, S, ConvType>(
-      all_pointers, kernel_params, tile_info, batch_info, backend, events);
+      all_pointers, kernel_params, tile_info, batch_info, backend, events,
+      epilogue);
 }
 
 /**
@@ -276,13 +354,14 @@ SNNStatus launch_with_tiles(
     typename Backend::template pointer_type<T> output,
     typename Backend::template pointer_type<T> workspace,
     Conv2DParams const& params, size_t workspace_size, Backend& backend,
-    const std::vector<cl::sycl::event>& events) {
+    const std::vector<cl::sycl::event>& events,
+    Epilogue<T, Backend> const& epilogue) {
   if (workspace_size == 0) return StatusCode::InsufficientWorkspace;
 
   return split_workspace_and_launch_with_tiles<T, ConvType, M, N, R, S,
                                                Backend>(
       input, filter, output, workspace, params, workspace_size, backend,
-      events);
+      events, epilogue);
 }
 
 /**
@@ -296,6 +375,7 @@ SNNStatus launch_with_tiles(
  * \param params  User provided convolution parameters
  * \param backend User provided backend to handle allocations and matrix
  *                multiplies
+ * \param epilogue Epilogue to apply to the convolution output
  * \return An SNNStatus object containing a SYCL event corresponding to the last
  * kernel launched.
  */
@@ -308,21 +388,22 @@ SNNStatus launch(typename Backend::template pointer_type<T const> input,
                  typename Backend::template pointer_type<T> output,
                  typename Backend::template pointer_type<T> workspace,
                  Conv2DParams const& params, size_t workspace_size,
-                 Backend& backend, const std::vector<cl::sycl::event>& events) {
+                 Backend& backend, const std::vector<cl::sycl::event>& events,
+                 Epilogue<T, Backend> const& epilogue) {
   if (params.window_rows == 3 && params.window_cols == 3) {
     return launch_with_tiles<T, ConvType, 2, 2, 3, 3>(
         input, filter, output, workspace, params, workspace_size, backend,
-        events);
+        events, epilogue);
   }
   if (params.window_rows == 3 && params.window_cols == 1) {
     return launch_with_tiles<T, ConvType, 2, 1, 3, 1>(
         input, filter, output, workspace, params, workspace_size, backend,
-        events);
+        events, epilogue);
   }
   if (params.window_rows == 1 && params.window_cols == 3) {
     return launch_with_tiles<T, ConvType, 1, 2, 1, 3>(
         input, filter, output, workspace, params, workspace_size, backend,
-        events);
+        events, epilogue);
   }
   return StatusCode::InvalidAlgorithm;
 }
@@ -337,21 +418,22 @@ SNNStatus launch(typename Backend::template pointer_type<T const> input,
                  typename Backend::template pointer_type<T> output,
                  typename Backend::template pointer_type<T> workspace,
                  Conv2DParams const& params, size_t workspace_size,
-                 Backend& backend, const std::vector<cl::sycl::event>& events) {
+                 Backend& backend, const std::vector<cl::sycl::event>& events,
+                 Epilogue<T, Backend> const& epilogue) {
   if (params.window_rows == 3 && params.window_cols == 3) {
     return launch_with_tiles<T, ConvType, 3, 3, 2, 2>(
         input, filter, output, workspace, params, workspace_size, backend,
-        events);
+        events, epilogue);
   }
   if (params.window_rows == 3 && params.window_cols == 1) {
     return launch_with_tiles<T, ConvType, 3, 1, 2, 1>(
         input, filter, output, workspace, params, workspace_size, backend,
-        events);
+        events, epilogue);
   }
   if (params.window_rows == 1 && params.window_cols == 3) {
     return launch_with_tiles<T, ConvType, 1, 3, 1, 2>(
         input, filter, output, workspace, params, workspace_size, backend,
-        events);
+        events, epilogue);
   }
   return StatusCode::InvalidAlgorithm;
 }
@@ -367,11 +449,12 @@ SNNStatus launch_large(typename Backend::template pointer_type<T const> input,
                        typename Backend::template pointer_type<T> workspace,
                        Conv2DParams const& params, size_t workspace_size,
                        Backend& backend,
-                       const std::vector<cl::sycl::event>& events) {
+                       const std::vector<cl::sycl::event>& events,
+                       Epilogue<T, Backend> const& epilogue) {
   if (params.window_rows == 3 && params.window_cols == 3) {
     return launch_with_tiles<T, ConvType, 4, 4, 3, 3>(
         input, filter, output, workspace, params, workspace_size, backend,
-        events);
+        events, epilogue);
   }
   return StatusCode::InvalidAlgorithm;
 }
@@ -387,11 +470,311 @@ SNNStatus launch_large(typename Backend::template pointer_type<T const> input,
                        typename Backend::template pointer_type<T> workspace,
                        Conv2DParams const& params, size_t workspace_size,
                        Backend& backend,
-                       const std::vector<cl::sycl::event>& events) {
+                       const std::vector<cl::sycl::event>& events,
+                       Epilogue<T, Backend> const& epilogue) {
   if (params.window_rows == 3 && params.window_cols == 3) {
     return launch_with_tiles<T, ConvType, 3, 3, 3, 3>(
         input, filter, output, workspace, params, workspace_size, backend,
-        events);
+        events, epilogue);
+  }
+  return StatusCode::InvalidAlgorithm;
+}
+
+/**
+ * Launch the Winograd filter transform kernel on a user provided filter,
+ * writing the transformed filter to a user provided buffer so that it can be
+ * reused across many convolutions with launch_transformed_filter().
+ *
+ * \param filter           User provided filter pointer
+ * \param filter_transform User provided buffer to write the transformed filter
+ *                         to, which must hold at least
+ *                         filter_transform_size<ConvType, M, N, R, S>()
+ *                         elements
+ * \param params           User provided convolution parameters
+ * \param backend          User provided backend
+ * \param events           Vector of events to synchronize on before launching
+ *                         the kernel
+ * \return An SNNStatus object containing a SYCL event corresponding to the
+ * filter transform kernel.
+ */
+template <typename T, typename ConvType, int M, int N, int R, int S,
+          typename Backend>
+SNNStatus transform_filter_with_tiles(
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T> filter_transform,
+    Conv2DParams const& params, Backend& backend,
+    const std::vector<cl::sycl::event>& events) {
+  using ConstInternalPointer =
+      ::sycldnn::internal::helpers::InternalPointer<T const, Backend>;
+  using InternalPointer =
+      ::sycldnn::internal::helpers::InternalPointer<T, Backend>;
+  auto kernel_params = get_params<ConvType>(params);
+  auto const tile_info = get_tile_info<ConvType, M, N, R, S>(kernel_params);
+  ConstInternalPointer filter_ptr{filter, backend};
+  InternalPointer transform_ptr{filter_transform, backend};
+  return launch_filter_transform<T, ConvType, M, N, R, S>(
+      filter_ptr.get(), transform_ptr.get(), kernel_params, tile_info, backend,
+      events);
+}
+
+/**
+ * Split the user provided workspace into the input and intermediate transform
+ * buffers and launch a convolution using a filter which was transformed by
+ * transform_filter_with_tiles().
+ *
+ * Unlike launch_with_tiles() the workspace does not need to hold the filter
+ * transform.
+ *
+ * \param input            User provided input pointer
+ * \param filter_transform User provided pre-transformed filter pointer
+ * \param output           User provided output pointer
+ * \param workspace        Pointer to user provided workspace buffer
+ * \param params           User provided convolution parameters
+ * \param workspace_size   Number of elements available in the workspace buffer
+ * \param backend          User provided backend to handle allocations and
+ *                         matrix multiplies
+ * \param events           Vector of events to synchronize on before launching
+ *                         kernel
+ * \param epilogue         Epilogue to apply to the convolution output
+ * \return An SNNStatus object containing a SYCL event corresponding to the last
+ * kernel launched.
+ */
+template <typename T, typename ConvType, int M, int N, int R, int S,
+          typename Backend>
+SNNStatus launch_with_tiles_transformed_filter(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T const> filter_transform,
+    typename Backend::template pointer_type<T> output,
+    typename Backend::template pointer_type<T> workspace,
+    Conv2DParams const& params, size_t workspace_size, Backend& backend,
+    const std::vector<cl::sycl::event>& events,
+    Epilogue<T, Backend> const& epilogue) {
+  using InternalPointer =
+      ::sycldnn::internal::helpers::InternalPointer<T, Backend>;
+  constexpr int A = M + R - 1;
+  constexpr int B = N + S - 1;
+  auto kernel_params = get_params<ConvType>(params);
+  auto const tile_info = get_tile_info<ConvType, M, N, R, S>(kernel_params);
+
+  size_t const input_transform_size =
+      A * B * tile_info.number * kernel_params.channels;
+  size_t const inter_transform_size =
+      A * B * tile_info.number * kernel_params.features;
+  size_t const size_per_image = input_transform_size + inter_transform_size;
+  auto const batch_info =
+      get_pipelined_batch_info(workspace_size, params.batch, size_per_image);
+  if (batch_info.images_per_batch == 0) {
+    return StatusCode::InsufficientWorkspace;
+  }
+  size_t const mb_input_transform_size =
+      input_transform_size * batch_info.images_per_batch;
+
+  InternalPointerSet<T, Backend> input_pointers{input, filter_transform, output,
+                                                backend};
+  InternalPointer input_transform_ptr{workspace, backend};
+  InternalPointer inter_transform_ptr{workspace + mb_input_transform_size,
+                                      backend};
+
+  auto all_pointers = TransformedFilterPointerSet<T, Backend>{
+      input_pointers.input.get(), input_pointers.filter.get(),
+      input_pointers.output.get(), input_transform_ptr.get(),
+      inter_transform_ptr.get()};
+
+  return launch_with_transformed_filter<T, M, N, R, S, ConvType>(
+      all_pointers, kernel_params, tile_info, batch_info, backend, events,
+      epilogue);
+}
+
+/**
+ * Transform a filter for use in the Winograd convolution selected by
+ * launch(). Match up the runtime parameters to the available Winograd tile
+ * sizes and launch the filter transform with transform_filter_with_tiles().
+ *
+ * Only forward and input backprop convolutions are supported, as the filter
+ * backprop's "filter" changes with every call.
+ */
+template <typename T, typename ConvType, typename Backend,
+          typename std::enable_if<
+              !std::is_same<ConvType, conv_type::FilterBackprop>::value,
+              int>::type = 0>
+SNNStatus transform_filter(
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T> filter_transform,
+    Conv2DParams const& params, Backend& backend,
+    const std::vector<cl::sycl::event>& events) {
+  if (params.window_rows == 3 && params.window_cols == 3) {
+    return transform_filter_with_tiles<T, ConvType, 2, 2, 3, 3>(
+        filter, filter_transform, params, backend, events);
+  }
+  if (params.window_rows == 3 && params.window_cols == 1) {
+    return transform_filter_with_tiles<T, ConvType, 2, 1, 3, 1>(
+        filter, filter_transform, params, backend, events);
+  }
+  if (params.window_rows == 1 && params.window_cols == 3) {
+    return transform_filter_with_tiles<T, ConvType, 1, 2, 1, 3>(
+        filter, filter_transform, params, backend, events);
+  }
+  return StatusCode::InvalidAlgorithm;
+}
+
+/**
+ * Transform a filter for use in the Winograd convolution selected by
+ * launch_large().
+ *
+ * \copydetails transform_filter()
+ */
+template <typename T, typename ConvType, typename Backend,
+          typename std::enable_if<
+              !std::is_same<ConvType, conv_type::FilterBackprop>::value,
+              int>::type = 0>
+SNNStatus transform_filter_large(
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T> filter_transform,
+    Conv2DParams const& params, Backend& backend,
+    const std::vector<cl::sycl::event>& events) {
+  if (params.window_rows == 3 && params.window_cols == 3) {
+    return transform_filter_with_tiles<T, ConvType, 4, 4, 3, 3>(
+        filter, filter_transform, params, backend, events);
+  }
+  return StatusCode::InvalidAlgorithm;
+}
+
+/**
+ * Launch a Winograd convolution using a filter transformed by
+ * transform_filter(), skipping the filter transform kernel.
+ */
+template <typename T, typename ConvType, typename Backend,
+          typename std::enable_if<
+              !std::is_same<ConvType, conv_type::FilterBackprop>::value,
+              int>::type = 0>
+SNNStatus launch_transformed_filter(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T const> filter_transform,
+    typename Backend::template pointer_type<T> output,
+    typename Backend::template pointer_type<T> workspace,
+    Conv2DParams const& params, size_t workspace_size, Backend& backend,
+    const std::vector<cl::sycl::event>& events,
+    Epilogue<T, Backend> const& epilogue) {
+  if (params.window_rows == 3 && params.window_cols == 3) {
+    return launch_with_tiles_transformed_filter<T, ConvType, 2, 2, 3, 3>(
+        input, filter_transform, output, workspace, params, workspace_size,
+        backend, events, epilogue);
+  }
+  if (params.window_rows == 3 && params.window_cols == 1) {
+    return launch_with_tiles_transformed_filter<T, ConvType, 2, 1, 3, 1>(
+        input, filter_transform, output, workspace, params, workspace_size,
+        backend, events, epilogue);
+  }
+  if (params.window_rows == 1 && params.window_cols == 3) {
+    return launch_with_tiles_transformed_filter<T, ConvType, 1, 2, 1, 3>(
+        input, filter_transform, output, workspace, params, workspace_size,
+        backend, events, epilogue);
+  }
+  return StatusCode::InvalidAlgorithm;
+}
+
+/**
+ * Launch a Winograd convolution with larger tiles using a filter transformed
+ * by transform_filter_large(), skipping the filter transform kernel.
+ */
+template <typename T, typename ConvType, typename Backend,
+          typename std::enable_if<
+              !std::is_same<ConvType, conv_type::FilterBackprop>::value,
+              int>::type = 0>
+SNNStatus launch_large_transformed_filter(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T const> filter_transform,
+    typename Backend::template pointer_type<T> output,
+    typename Backend::template pointer_type<T> workspace,
+    Conv2DParams const& params, size_t workspace_size, Backend& backend,
+    const std::vector<cl::sycl::event>& events,
+    Epilogue<T, Backend> const& epilogue) {
+  if (params.window_rows == 3 && params.window_cols == 3) {
+    return launch_with_tiles_transformed_filter<T, ConvType, 4, 4, 3, 3>(
+        input, filter_transform, output, workspace, params, workspace_size,
+        backend, events, epilogue);
+  }
+  return StatusCode::InvalidAlgorithm;
+}
+
+/**
+ * Launch a Winograd convolution using one of the algorithms with a single
+ * fixed tile size, given by FixedTileSizes<Algo>. Only forward and input
+ * backprop convolutions with a window matching the tile's filter size are
+ * supported.
+ *
+ * \copydetails launch()
+ */
+template <typename T, typename ConvType, Algorithm Algo, typename Backend>
+SNNStatus launch_fixed(typename Backend::template pointer_type<T const> input,
+                       typename Backend::template pointer_type<T const> filter,
+                       typename Backend::template pointer_type<T> output,
+                       typename Backend::template pointer_type<T> workspace,
+                       Conv2DParams const& params, size_t workspace_size,
+                       Backend& backend,
+                       const std::vector<cl::sycl::event>& events,
+                       Epilogue<T, Backend> const& epilogue) {
+  using Tiles = FixedTileSizes<Algo>;
+  if constexpr (std::is_same<ConvType, conv_type::FilterBackprop>::value) {
+    return StatusCode::InvalidAlgorithm;
+  } else {
+    if (params.window_rows == Tiles::R && params.window_cols == Tiles::S) {
+      return launch_with_tiles<T, ConvType, Tiles::M, Tiles::N, Tiles::R,
+                               Tiles::S>(input, filter, output, workspace,
+                                         params, workspace_size, backend,
+                                         events, epilogue);
+    }
+    return StatusCode::InvalidAlgorithm;
+  }
+}
+
+/**
+ * Transform a filter for use in the Winograd convolution selected by
+ * launch_fixed().
+ *
+ * \copydetails transform_filter()
+ */
+template <typename T, typename ConvType, Algorithm Algo, typename Backend,
+          typename std::enable_if<
+              !std::is_same<ConvType, conv_type::FilterBackprop>::value,
+              int>::type = 0>
+SNNStatus transform_filter_fixed(
+    typename Backend::template pointer_type<T const> filter,
+    typename Backend::template pointer_type<T> filter_transform,
+    Conv2DParams const& params, Backend& backend,
+    const std::vector<cl::sycl::event>& events) {
+  using Tiles = FixedTileSizes<Algo>;
+  if (params.window_rows == Tiles::R && params.window_cols == Tiles::S) {
+    return transform_filter_with_tiles<T, ConvType, Tiles::M, Tiles::N,
+                                       Tiles::R, Tiles::S>(
+        filter, filter_transform, params, backend, events);
+  }
+  return StatusCode::InvalidAlgorithm;
+}
+
+/**
+ * Launch a Winograd convolution with a single fixed tile size using a filter
+ * transformed by transform_filter_fixed(), skipping the filter transform
+ * kernel.
+ */
+template <typename T, typename ConvType, Algorithm Algo, typename Backend,
+          typename std::enable_if<
+              !std::is_same<ConvType, conv_type::FilterBackprop>::value,
+              int>::type = 0>
+SNNStatus launch_fixed_transformed_filter(
+    typename Backend::template pointer_type<T const> input,
+    typename Backend::template pointer_type<T const> filter_transform,
+    typename Backend::template pointer_type<T> output,
+    typename Backend::template pointer_type<T> workspace,
+    Conv2DParams const& params, size_t workspace_size, Backend& backend,
+    const std::vector<cl::sycl::event>& events,
+    Epilogue<T, Backend> const& epilogue) {
+  using Tiles = FixedTileSizes<Algo>;
+  if (params.window_rows == Tiles::R && params.window_cols == Tiles::S) {
+    return launch_with_tiles_transformed_filter<T, ConvType, Tiles::M,
+                                                Tiles::N, Tiles::R, Tiles::S>(
+        input, filter_transform, output, workspace, params, workspace_size,
+        backend, events, epilogue);
   }
   return StatusCode::InvalidAlgorithm;
 }
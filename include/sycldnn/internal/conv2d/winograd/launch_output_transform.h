@@ -21,7 +21,10 @@
 #include "sycldnn/status.h"
 
 #include "sycldnn/conv2d/conv_type.h"
+#include "sycldnn/conv2d/epilogue.h"
 #include "sycldnn/conv2d/params.h"
+
+#include "sycldnn/internal/conv2d/epilogue.h"
 #include "sycldnn/internal/conv2d/winograd/tile_info.h"
 
 #include <stddef.h>
@@ -50,6 +53,8 @@ namespace winograd {
  *
  * \param intermediate Intermediate tensor
  * \param output       Output temporary transform tensor
+ * \param epilogue     Epilogue to apply to the output values, only used in
+ *                     forward convolutions
  * \param params       Kernel parameters for the convolution
  * \param tile_info    Winograd tile information
  * \param queue        SYCL queue to enqueue the kernels to
@@ -61,19 +66,24 @@ template <typename T, typename ConvType, int M, int N, int R, int S,
           bool Accumulate, template <typename> class MemObj>
 SNN_EXPORT SNNStatus launch_output_transform(
     MemObj<T const>& intermediate, MemObj<T>& output,
-    Conv2DParams const& params, TileInfo const& tile_info,
-    cl::sycl::queue& queue, const std::vector<cl::sycl::event>& events);
+    EpilogueMem<T, MemObj>& epilogue, Conv2DParams const& params,
+    TileInfo const& tile_info, cl::sycl::queue& queue,
+    const std::vector<cl::sycl::event>& events);
 
 /**
  * Extract the buffers from the backend and launch the Winograd output transform
  * kernel.
  *
- * \param inter     Intermediate tensor
- * \param output    Output temporary transform tensor
- * \param params    Kernel parameters for the convolution
- * \param tile_info Winograd tile information
- * \param backend   Backend to provide SYCL buffers from the pointers
- * \param events    Vector of events to synchronize on before launching kernel
+ * \param inter           Intermediate tensor
+ * \param output          Output temporary transform tensor
+ * \param params          Kernel parameters for the convolution
+ * \param tile_info       Winograd tile information
+ * \param backend         Backend to provide SYCL buffers from the pointers
+ * \param events          Vector of events to synchronize on before launching
+ *                        kernel
+ * \param epilogue        Epilogue to apply to the output values
+ * \param residual_offset Offset into the epilogue's residual tensor of the
+ *                        first output value written by this kernel
  * \return An SNNStatus event containing an event corresponding to the last
  * kernel launched.
  */
@@ -83,7 +93,8 @@ SNNStatus launch_output_transform(
     typename Backend::template internal_pointer_type<T const> inter,
     typename Backend::template internal_pointer_type<T> output,
     Conv2DParams const& params, TileInfo const& tile_info, Backend& backend,
-    const std::vector<cl::sycl::event>& events) {
+    const std::vector<cl::sycl::event>& events,
+    Epilogue<T, Backend> const& epilogue = {}, size_t residual_offset = 0) {
   constexpr int A = M + R - 1;
   constexpr int B = N + S - 1;
 
@@ -95,9 +106,13 @@ SNNStatus launch_output_transform(
       params.batch * params.out_rows * params.out_cols * params.features;
   auto output_acc = backend.get_mem_object_internal(output, output_size);
 
+  auto epi_access = make_epilogue_mem(epilogue, backend, inter_acc,
+                                      params.features, output_size,
+                                      residual_offset);
+
   cl::sycl::queue queue = backend.get_queue();
   return launch_output_transform<T, ConvType, M, N, R, S, false>(
-      inter_acc, output_acc, params, tile_info, queue, events);
+      inter_acc, output_acc, epi_access, params, tile_info, queue, events);
 }
 
 /**
@@ -128,10 +143,11 @@ SNNStatus launch_output_transform_filter_backprop(
 
   size_t const output_size = M * N * params.channels * params.features;
   auto output_acc = backend.get_mem_object_internal(output, output_size);
+  auto epi_access = make_identity_epilogue(inter_acc);
 
   cl::sycl::queue queue = backend.get_queue();
   return launch_output_transform<T, ConvType, M, N, R, S, Accumulate>(
-      inter_acc, output_acc, params, tile_info, queue, events);
+      inter_acc, output_acc, epi_access, params, tile_info, queue, events);
 }
 
 }  // namespace winograd
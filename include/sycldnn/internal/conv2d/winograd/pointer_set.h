@@ -27,7 +27,8 @@
 
 /**
  * \file
- * Contains the sycldnn::conv2d::internal::winograd::FullPointerSet to wrap the
+ * Contains the sycldnn::conv2d::internal::winograd::FullPointerSet and
+ * sycldnn::conv2d::internal::winograd::TransformedFilterPointerSet to wrap the
  * pointers required for a Winograd convolution.
  */
 
@@ -65,6 +66,32 @@ struct FullPointerSet {
   Pointer intermediate;
 };
 
+/**
+ * Struct containing the pointers required for a Winograd convolution where the
+ * filter has already been transformed into the Winograd domain.
+ */
+template <typename T, typename Backend>
+struct TransformedFilterPointerSet {
+  /** User provided internal pointer type. */
+  using Pointer = typename Backend::template internal_pointer_type<T>;
+  /** User provided internal const pointer type. */
+  using ConstPointer =
+      typename Backend::template internal_pointer_type<T const>;
+
+  TransformedFilterPointerSet() = delete;
+
+  /** The user provided input pointer. */
+  ConstPointer input;
+  /** The user provided pre-transformed filter pointer. */
+  ConstPointer filter_transform;
+  /** The user provided output pointer. */
+  Pointer output;
+  /** The temporary input transform pointer. */
+  Pointer input_transform;
+  /** The temporary output transform pointer. */
+  Pointer intermediate;
+};
+
 }  // namespace winograd
 }  // namespace internal
 }  // namespace conv2d
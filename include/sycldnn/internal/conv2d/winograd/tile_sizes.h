@@ -0,0 +1,80 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_INTERNAL_CONV2D_WINOGRAD_TILE_SIZES_H_
+#define SYCLDNN_INCLUDE_INTERNAL_CONV2D_WINOGRAD_TILE_SIZES_H_
+
+#include "sycldnn/conv2d/algorithm.h"
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+namespace winograd {
+
+/**
+ * Winograd tile sizes used by the algorithms which only support a single
+ * filter size, for forward and input backprop convolutions.
+ *
+ * Each specialisation provides the output tile sizes M x N and the filter
+ * sizes R x S for the algorithm.
+ */
+template <Algorithm Algo>
+struct FixedTileSizes;
+
+/** Tile sizes for Algorithm::Winograd6x6, computing F(6x6, 3x3). */
+template <>
+struct FixedTileSizes<Algorithm::Winograd6x6> {
+  /** Number of output rows computed per tile. */
+  static constexpr int M = 6;
+  /** Number of output columns computed per tile. */
+  static constexpr int N = 6;
+  /** Number of filter rows. */
+  static constexpr int R = 3;
+  /** Number of filter columns. */
+  static constexpr int S = 3;
+};
+
+/** Tile sizes for Algorithm::Winograd5x5, computing F(2x2, 5x5). */
+template <>
+struct FixedTileSizes<Algorithm::Winograd5x5> {
+  /** Number of output rows computed per tile. */
+  static constexpr int M = 2;
+  /** Number of output columns computed per tile. */
+  static constexpr int N = 2;
+  /** Number of filter rows. */
+  static constexpr int R = 5;
+  /** Number of filter columns. */
+  static constexpr int S = 5;
+};
+
+/** Tile sizes for Algorithm::Winograd5x5Large, computing F(4x4, 5x5). */
+template <>
+struct FixedTileSizes<Algorithm::Winograd5x5Large> {
+  /** Number of output rows computed per tile. */
+  static constexpr int M = 4;
+  /** Number of output columns computed per tile. */
+  static constexpr int N = 4;
+  /** Number of filter rows. */
+  static constexpr int R = 5;
+  /** Number of filter columns. */
+  static constexpr int S = 5;
+};
+
+}  // namespace winograd
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_INCLUDE_INTERNAL_CONV2D_WINOGRAD_TILE_SIZES_H_
@@ -16,21 +16,25 @@
 #ifndef SYCLDNN_INCLUDE_INTERNAL_HELPERS_ALLOCATED_POINTER_H_
 #define SYCLDNN_INCLUDE_INTERNAL_HELPERS_ALLOCATED_POINTER_H_
 
+#include "sycldnn/backend/backend_helpers.h"
+#include "sycldnn/backend/workspace_arena.h"
 #include "sycldnn/helpers/macros.h"
 
+#include <CL/sycl.hpp>
+
+#include <vector>
+
 namespace sycldnn {
 namespace internal {
 namespace helpers {
 
-template <typename T>
-void enqueue_free(T* pointer, cl::sycl::queue& q, cl::sycl::event event) {
-  q.submit([=](cl::sycl::handler& cgh) {
-    cgh.depends_on(event);
-    cgh.host_task([=]() { cl::sycl::free(pointer, q); });
-  });
-}
-
-/** Helper pointer type to automatically allocate and deallocate a pointer. */
+/**
+ * Helper pointer type to automatically allocate and deallocate a pointer.
+ *
+ * Backends which own a workspace arena, such as the SNNUSMBackend, provide the
+ * memory from the arena. Kernels using the pointer must then depend on the
+ * events returned from \ref dependencies.
+ */
 template <typename T, typename Backend>
 struct AllocatedPointer {
   using Pointer = typename Backend::template internal_pointer_type<T>;
@@ -38,11 +42,15 @@ struct AllocatedPointer {
   /**
    * Allocate a SYCL buffer using the provided backend.
    *
-   * \param alloc_size Number of bytes to allocate
+   * \param alloc_size Number of elements to allocate
    * \param backend    Backend to use to allocate the buffer
+   * \param op_name    Name of the operator using the memory, recorded by the
+   *                   backend's workspace arena
    */
-  AllocatedPointer(size_t alloc_size, Backend& backend)
-      : pointer{backend.template allocate<T>(alloc_size)}, backend{backend} {}
+  AllocatedPointer(size_t alloc_size, Backend& backend,
+                   char const* op_name = "internal")
+      : pointer{allocate_pointer(alloc_size, backend, op_name)},
+        backend{backend} {}
 
   SNN_DISABLE_COPY(AllocatedPointer);
   SNN_DISABLE_MOVE(AllocatedPointer);
@@ -52,18 +60,60 @@ struct AllocatedPointer {
     if constexpr (!sycldnn::backend::is_usm_backend_v<Backend>) {
       backend.release_internal_pointer(pointer);
     } else {
-      auto q = backend.get_queue();
-      enqueue_free(pointer, q, event_);
+      // The arena only reuses the memory once the kernels using it have
+      // completed.
+      backend.get_workspace_arena().give_back(lease_, {event_});
     }
   }
 
   /** Get the underlying pointer type. */
   Pointer get() const { return pointer; }
 
+  /**
+   * Check whether the memory was allocated.
+   *
+   * \return False if the backend's workspace arena could not allocate the
+   *         device memory, in which case the pointer must not be used.
+   */
+  bool valid() const {
+    if constexpr (!sycldnn::backend::is_usm_backend_v<Backend>) {
+      return true;
+    } else {
+      return lease_.valid();
+    }
+  }
+
+  /**
+   * Get the events which kernels using the pointer must depend on.
+   *
+   * \param events The events the kernels already depend on.
+   * \return The given events, along with any events of earlier kernels which
+   *         used the same memory.
+   */
+  std::vector<cl::sycl::event> dependencies(
+      std::vector<cl::sycl::event> events) const {
+    events.insert(events.end(), lease_.dependencies.begin(),
+                  lease_.dependencies.end());
+    return events;
+  }
+
   /** Add events to pointer on which to wait for before releasing memory */
   inline void set_event(const cl::sycl::event& event) { event_ = event; }
 
  private:
+  Pointer allocate_pointer(size_t alloc_size, Backend& backend,
+                           char const* op_name) {
+    if constexpr (!sycldnn::backend::is_usm_backend_v<Backend>) {
+      SNN_UNUSED_VAR(op_name);
+      return backend.template allocate<T>(alloc_size);
+    } else {
+      lease_ = backend.get_workspace_arena().borrow(alloc_size * sizeof(T),
+                                                    op_name);
+      return static_cast<Pointer>(lease_.ptr);
+    }
+  }
+
+  sycldnn::backend::WorkspaceLease lease_{};
   Pointer pointer;
   cl::sycl::event event_;
   Backend& backend;
@@ -0,0 +1,149 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_INTERNAL_HELPERS_SCRATCH_SPACE_H_
+#define SYCLDNN_INCLUDE_INTERNAL_HELPERS_SCRATCH_SPACE_H_
+
+#include "sycldnn/backend/workspace_arena.h"
+#include "sycldnn/helpers/macros.h"
+
+#include <CL/sycl.hpp>
+
+#include <vector>
+
+namespace sycldnn {
+namespace internal {
+namespace helpers {
+
+/**
+ * Scratch memory for the temporaries of a single operator launch.
+ *
+ * For USM the temporaries are carved out of one region borrowed from the
+ * backend's workspace arena, which is given back on destruction. Kernels using
+ * the temporaries must depend on the events returned from \ref dependencies.
+ *
+ * For buffers each temporary is a separate SYCL buffer, whose dependencies are
+ * tracked by the SYCL runtime.
+ */
+template <typename Backend, bool IsUSM>
+struct ScratchSpace {
+  /**
+   * Get the number of scratch bytes used by a temporary.
+   *
+   * \param n_elems Number of elements in the temporary.
+   * \return The number of bytes to request for the temporary.
+   */
+  template <typename T>
+  static size_t bytes_for(size_t n_elems) {
+    return sycldnn::backend::WorkspaceArena::aligned_size(n_elems * sizeof(T));
+  }
+
+  /**
+   * Borrow scratch memory from the backend.
+   *
+   * \param n_bytes Total number of bytes of all temporaries, as computed with
+   *                \ref bytes_for.
+   * \param backend Backend providing the workspace arena.
+   * \param op_name Name of the operator, recorded by the workspace arena.
+   */
+  ScratchSpace(size_t n_bytes, Backend& backend, char const* op_name)
+      : backend_{backend} {
+    if constexpr (IsUSM) {
+      lease_ = backend.get_workspace_arena().borrow(n_bytes, op_name);
+    } else {
+      SNN_UNUSED_VAR(n_bytes);
+      SNN_UNUSED_VAR(op_name);
+    }
+  }
+
+  SNN_DISABLE_COPY(ScratchSpace);
+  SNN_DISABLE_MOVE(ScratchSpace);
+
+  /** Give the scratch memory back once the kernels using it complete. */
+  ~ScratchSpace() {
+    if constexpr (IsUSM) {
+      backend_.get_workspace_arena().give_back(lease_, std::move(events_));
+    }
+  }
+
+  /**
+   * Check whether the scratch memory was allocated.
+   *
+   * \return False if the device memory could not be allocated, in which case
+   *         the launcher must not use any temporaries.
+   */
+  bool valid() const {
+    if constexpr (IsUSM) {
+      return lease_.valid();
+    } else {
+      return true;
+    }
+  }
+
+  /**
+   * Take a temporary from the scratch memory.
+   *
+   * \param n_elems Number of elements in the temporary.
+   * \return A USM pointer or SYCL buffer holding n_elems elements.
+   */
+  template <typename T>
+  auto take(size_t n_elems) {
+    if constexpr (IsUSM) {
+      SNN_ASSERT(offset_ + bytes_for<T>(n_elems) <= lease_.n_bytes,
+                 "Scratch space is too small for the requested temporary");
+      T* ptr = reinterpret_cast<T*>(static_cast<char*>(lease_.ptr) + offset_);
+      offset_ += bytes_for<T>(n_elems);
+      return ptr;
+    } else {
+      return cl::sycl::buffer<T, 1>(cl::sycl::range<1>(n_elems));
+    }
+  }
+
+  /**
+   * Get the events which kernels using the temporaries must depend on.
+   *
+   * \param events The events the kernels already depend on.
+   * \return The given events, along with any events of earlier kernels which
+   *         used the same memory.
+   */
+  std::vector<cl::sycl::event> dependencies(
+      std::vector<cl::sycl::event> events) const {
+    events.insert(events.end(), lease_.dependencies.begin(),
+                  lease_.dependencies.end());
+    return events;
+  }
+
+  /**
+   * Set the events of the kernels using the temporaries, which must complete
+   * before the scratch memory is reused.
+   *
+   * \param events Events of the last kernels using the temporaries.
+   */
+  void set_events(std::vector<cl::sycl::event> events) {
+    events_ = std::move(events);
+  }
+
+ private:
+  Backend& backend_;
+  sycldnn::backend::WorkspaceLease lease_{};
+  size_t offset_ = 0;
+  std::vector<cl::sycl::event> events_;
+};
+
+}  // namespace helpers
+}  // namespace internal
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_INCLUDE_INTERNAL_HELPERS_SCRATCH_SPACE_H_
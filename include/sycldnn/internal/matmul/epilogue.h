@@ -0,0 +1,82 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_INTERNAL_MATMUL_EPILOGUE_H_
+#define SYCLDNN_INCLUDE_INTERNAL_MATMUL_EPILOGUE_H_
+
+#include "sycldnn/mem_object.h"
+
+#include "sycldnn/matmul/epilogue.h"
+
+#include <stddef.h>
+
+namespace sycldnn {
+namespace matmul {
+namespace internal {
+
+/**
+ * The memory objects used by a matmul epilogue, passed on to the compiled
+ * kernels.
+ *
+ * The kernels always require a bias memory object, so if the bias is not
+ * enabled in the params it is bound to a placeholder memory object which is
+ * never read.
+ */
+template <typename T, template <typename> class MemObj>
+struct EpilogueMem {
+  /** The per-column bias. */
+  MemObj<T const> bias;
+  /** The operations enabled in the epilogue. */
+  EpilogueParams params;
+};
+
+/**
+ * Create an epilogue which leaves the matmul output unchanged.
+ *
+ * \param placeholder Memory object to bind to the unused bias.
+ * \return An EpilogueMem with no operations enabled.
+ */
+template <typename T, template <typename> class MemObj>
+EpilogueMem<T, MemObj> make_identity_epilogue(
+    MemObj<T const> const& placeholder) {
+  return {placeholder, EpilogueParams{}};
+}
+
+/**
+ * Extract the memory objects for an epilogue from the backend.
+ *
+ * \param epilogue    The user provided epilogue descriptor.
+ * \param backend     Backend to provide memory objects from the pointers.
+ * \param placeholder Memory object to bind to the unused bias.
+ * \param n_cols      Number of columns in the matmul output.
+ * \return The memory objects to pass to the kernels.
+ */
+template <typename T, typename Backend, template <typename> class MemObj>
+EpilogueMem<T, MemObj> make_epilogue_mem(Epilogue<T, Backend> const& epilogue,
+                                         Backend& backend,
+                                         MemObj<T const> const& placeholder,
+                                         size_t n_cols) {
+  if (epilogue.bias) {
+    return {backend.get_mem_object(*epilogue.bias, n_cols),
+            epilogue.get_params()};
+  }
+  return {placeholder, epilogue.get_params()};
+}
+
+}  // namespace internal
+}  // namespace matmul
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_INCLUDE_INTERNAL_MATMUL_EPILOGUE_H_
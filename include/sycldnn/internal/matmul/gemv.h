@@ -0,0 +1,57 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_INTERNAL_MATMUL_GEMV_H_
+#define SYCLDNN_INCLUDE_INTERNAL_MATMUL_GEMV_H_
+
+#include "sycldnn/matmul/params.h"
+
+namespace sycldnn {
+namespace matmul {
+namespace internal {
+
+/**
+ * Whether a matmul is a matrix-vector product, computed by the GEMV kernels
+ * rather than the register tiled kernels. This covers fully connected layers
+ * and convolutions over a single pixel with a batch size of one.
+ */
+inline bool is_gemv(MatmulParams const& params) {
+  return params.m == 1 || params.n == 1;
+}
+
+/**
+ * Whether the shared dimension of the matrix operand of a GEMV is contiguous
+ * in memory. The GEMV kernel for these matrices reduces over the shared
+ * dimension within a work-group, so does not benefit from split-K.
+ *
+ * A matrix with a single row is always contiguous. Returns false for matmuls
+ * which are not matrix-vector products.
+ */
+template <bool TransposeLHS, bool TransposeRHS>
+bool is_gemv_contiguous_acc(MatmulParams const& params) {
+  if (params.m == 1) {
+    return TransposeRHS || params.n == 1;
+  }
+  if (params.n == 1) {
+    return !TransposeLHS;
+  }
+  return false;
+}
+
+}  // namespace internal
+}  // namespace matmul
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_INCLUDE_INTERNAL_MATMUL_GEMV_H_
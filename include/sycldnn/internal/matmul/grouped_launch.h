@@ -0,0 +1,108 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_INTERNAL_MATMUL_GROUPED_LAUNCH_H_
+#define SYCLDNN_INCLUDE_INTERNAL_MATMUL_GROUPED_LAUNCH_H_
+
+#include <CL/sycl.hpp>
+
+#include "sycldnn/mem_object.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/matmul/grouped_params.h"
+
+#include "sycldnn/export.h"
+
+namespace sycldnn {
+namespace matmul {
+namespace internal {
+
+/**
+ * The internal grouped matrix multiply launcher.
+ *
+ * Implemented in the compiled SYCL DNN library.
+ */
+template <typename T, bool TransposeLHS, bool TransposeRHS,
+          template <typename> class MemObj>
+SNN_EXPORT SNNStatus launch_grouped(
+    MemObj<T const>& lhs, MemObj<T const>& rhs, MemObj<T>& output,
+    MemObj<GroupedMatmulProblem const>& problems,
+    GroupedMatmulParams const& params, cl::sycl::queue& queue,
+    const std::vector<cl::sycl::event>& events);
+
+/** Check that the grouped matmul parameters are valid. */
+SNNStatus inline validate_params(GroupedMatmulParams const& params) {
+  SNN_VALIDATE_PARAM(params.n_problems > 0,
+                     "The number of problems must be positive.");
+  SNN_VALIDATE_PARAM(params.lhs_size > 0,
+                     "The size of the lhs tensor must be positive.");
+  SNN_VALIDATE_PARAM(params.rhs_size > 0,
+                     "The size of the rhs tensor must be positive.");
+  SNN_VALIDATE_PARAM(params.output_size > 0,
+                     "The size of the output tensor must be positive.");
+  return StatusCode::OK;
+}
+
+/**
+ * Launch a grouped matrix multiplication.
+ *
+ * Will compute:
+ *   output[i] = alpha * op(lhs[i]) * op(rhs[i]) + beta * output[i]
+ * where i ranges over the problems, each problem has its own shape and
+ * offsets given in the problems array, and op(X) is either X or X^T if
+ * TransposeX is true.
+ *
+ * \param lhs A pointer to the memory containing the left hand matrices.
+ * \param rhs A pointer to the memory containing the right hand matrices.
+ * \param output A pointer to the memory containing the output matrices.
+ * \param problems A pointer to the memory containing the problem shapes.
+ * \param params The parameters shared by all problems.
+ * \param backend The backend implementation, used to map between pointer
+ *                representations.
+ * \param events Events which should be completed before the operation.
+ * \return Returns an SNNStatus containing the SYCL event tied to the kernel
+ *         launch and a StatusCode enum showing if the launch was OK or
+ *         whether it encountered some problem.
+ */
+template <typename T, bool TransposeLHS, bool TransposeRHS, typename Backend>
+SNNStatus sublaunch_grouped(
+    typename Backend::template pointer_type<T const> lhs,
+    typename Backend::template pointer_type<T const> rhs,
+    typename Backend::template pointer_type<T> output,
+    typename Backend::template pointer_type<GroupedMatmulProblem const>
+        problems,
+    GroupedMatmulParams const& params, Backend& backend,
+    const std::vector<cl::sycl::event>& events = {}) {
+  auto validation_status = validate_params(params);
+  if (validation_status.status != StatusCode::OK) {
+    return validation_status;
+  }
+
+  auto lhs_acc = backend.get_mem_object(lhs, params.lhs_size);
+  auto rhs_acc = backend.get_mem_object(rhs, params.rhs_size);
+  auto out_acc = backend.get_mem_object(output, params.output_size);
+  auto problems_acc = backend.get_mem_object(problems, params.n_problems);
+
+  auto sycl_queue = backend.get_queue();
+
+  return internal::launch_grouped<T, TransposeLHS, TransposeRHS>(
+      lhs_acc, rhs_acc, out_acc, problems_acc, params, sycl_queue, events);
+}
+
+}  // namespace internal
+}  // namespace matmul
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_INCLUDE_INTERNAL_MATMUL_GROUPED_LAUNCH_H_
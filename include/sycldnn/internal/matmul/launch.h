@@ -21,32 +21,138 @@
 #include "sycldnn/mem_object.h"
 #include "sycldnn/status.h"
 
+#include "sycldnn/matmul/epilogue.h"
 #include "sycldnn/matmul/params.h"
 
+#include "sycldnn/backend/backend_helpers.h"
+
+#include "sycldnn/internal/helpers/internal_pointer.h"
+#include "sycldnn/internal/matmul/epilogue.h"
+#include "sycldnn/internal/matmul/gemv.h"
+#include "sycldnn/internal/matmul/split_k.h"
+
 #include "sycldnn/export.h"
 
+#include <algorithm>
+
 namespace sycldnn {
 namespace matmul {
 namespace internal {
 
 /**
- * The internal matrix multiply launcher.
+ * The internal matrix multiply launcher, which applies the epilogue to the
+ * output values before they are stored.
  *
  * Implemented in the compiled SYCL DNN library.
  */
 template <typename T, bool TransposeLHS, bool TransposeRHS,
           template <typename> class MemObj>
 SNN_EXPORT SNNStatus launch(MemObj<T const>& lhs, MemObj<T const>& rhs,
-                            MemObj<T>& output, MatmulParams const& params,
+                            MemObj<T>& output,
+                            EpilogueMem<T, MemObj>& epilogue,
+                            MatmulParams const& params,
                             cl::sycl::queue& queue,
                             const std::vector<cl::sycl::event>& events);
 
+/**
+ * The internal split-K matrix multiply launcher, which computes the partial
+ * products over n_splits partitions of the shared dimension into the
+ * workspace, then sums them into the output and applies the epilogue.
+ *
+ * The workspace must hold n_splits * batches * m * n elements.
+ *
+ * Implemented in the compiled SYCL DNN library.
+ */
+template <typename T, bool TransposeLHS, bool TransposeRHS,
+          template <typename> class MemObj>
+SNN_EXPORT SNNStatus launch_split_k(MemObj<T const>& lhs,
+                                    MemObj<T const>& rhs, MemObj<T>& output,
+                                    MemObj<T>& workspace,
+                                    EpilogueMem<T, MemObj>& epilogue,
+                                    MatmulParams const& params, int n_splits,
+                                    cl::sycl::queue& queue,
+                                    const std::vector<cl::sycl::event>& events);
+
+/** Check that the matmul parameters are valid. */
+SNNStatus inline validate_params(MatmulParams const& params) {
+  SNN_VALIDATE_PARAM(params.batches > 0,
+                     "The number of batches must be positive.");
+  SNN_VALIDATE_PARAM(params.m > 0, "The value of m must be positive.");
+  SNN_VALIDATE_PARAM(params.k > 0, "The value of k must  be positive.");
+  SNN_VALIDATE_PARAM(params.n > 0, "The value of n must be positive.");
+  SNN_VALIDATE_PARAM(params.lhs_batch_stride == packed_batch_stride ||
+                         params.lhs_batch_stride >= 0,
+                     "The left hand batch stride must not be negative.");
+  SNN_VALIDATE_PARAM(params.rhs_batch_stride == packed_batch_stride ||
+                         params.rhs_batch_stride >= 0,
+                     "The right hand batch stride must not be negative.");
+  SNN_VALIDATE_PARAM(params.output_batch_stride == packed_batch_stride ||
+                         params.output_batch_stride >= params.m * params.n,
+                     "The output matrices must not overlap.");
+  return StatusCode::OK;
+}
+
+/** Get the number of elements spanned by the left hand matrices. */
+inline size_t get_lhs_extent(MatmulParams const& params) {
+  return get_batch_extent(params.batches, get_lhs_batch_stride(params),
+                          params.m * params.k);
+}
+
+/** Get the number of elements spanned by the right hand matrices. */
+inline size_t get_rhs_extent(MatmulParams const& params) {
+  return get_batch_extent(params.batches, get_rhs_batch_stride(params),
+                          params.k * params.n);
+}
+
+/** Get the number of elements spanned by the output matrices. */
+inline size_t get_output_extent(MatmulParams const& params) {
+  return get_batch_extent(params.batches, get_output_batch_stride(params),
+                          params.m * params.n);
+}
+
+/**
+ * Launch a batched matrix multiplication with the shared dimension split into
+ * n_splits partitions, using the given internal pointer as the workspace.
+ */
+template <typename T, bool TransposeLHS, bool TransposeRHS, typename Backend>
+SNNStatus launch_split_k_with_workspace(
+    typename Backend::template pointer_type<T const> lhs,
+    typename Backend::template pointer_type<T const> rhs,
+    typename Backend::template pointer_type<T> output,
+    typename Backend::template internal_pointer_type<T> workspace,
+    MatmulParams const& params, int n_splits, Backend& backend,
+    const std::vector<cl::sycl::event>& events,
+    Epilogue<T, Backend> const& epilogue) {
+  size_t lhs_size = get_lhs_extent(params);
+  size_t rhs_size = get_rhs_extent(params);
+  size_t out_size = get_output_extent(params);
+  size_t partial_size = params.batches * params.m * params.n;
+
+  auto lhs_acc = backend.get_mem_object(lhs, lhs_size);
+  auto rhs_acc = backend.get_mem_object(rhs, rhs_size);
+  auto out_acc = backend.get_mem_object(output, out_size);
+  auto workspace_acc =
+      backend.get_mem_object_internal(workspace, n_splits * partial_size);
+  auto epilogue_mem = make_epilogue_mem(epilogue, backend, rhs_acc, params.n);
+
+  auto sycl_queue = backend.get_queue();
+
+  return internal::launch_split_k<T, TransposeLHS, TransposeRHS>(
+      lhs_acc, rhs_acc, out_acc, workspace_acc, epilogue_mem, params, n_splits,
+      sycl_queue, events);
+}
+
 /**
  * Launch a batched matrix multiplication.
  *
- * Will compute: output[i] = beta * output[i] + op(lhs[i]) * op(rhs[i])
- * where i ranges over the number of batches and op(X) is either X or X^T if
- * TransposeX is true.
+ * Will compute:
+ *   output[i] = epilogue(alpha * op(lhs[i]) * op(rhs[i]) + beta * output[i])
+ * where i ranges over the number of batches, op(X) is either X or X^T if
+ * TransposeX is true, and the epilogue adds the per-column bias and applies
+ * the activation.
+ *
+ * Without a workspace the shared dimension is never split, so no temporary
+ * memory is allocated.
  *
  * \param lhs A pointer to the memory representing the left hand matrix.
  * \param rhs A pointer to the memory representing the right hand matrix.
@@ -54,6 +160,8 @@ SNN_EXPORT SNNStatus launch(MemObj<T const>& lhs, MemObj<T const>& rhs,
  * \param params The parameters of the matrix multiplication operation.
  * \param backend The backend implementation, used to map between pointer
  *                representations.
+ * \param events Events which should be completed before the operation.
+ * \param epilogue Optional operations to apply to the output values.
  * \return Returns an SNNStatus containing the SYCL event tied to the kernel
  *         launches and a StatusCode enum showing if the launch was OK or
  *         whether it encountered some problem.
@@ -63,25 +171,100 @@ SNNStatus sublaunch(typename Backend::template pointer_type<T const> lhs,
                     typename Backend::template pointer_type<T const> rhs,
                     typename Backend::template pointer_type<T> output,
                     MatmulParams const& params, Backend& backend,
-                    const std::vector<cl::sycl::event>& events = {}) {
-  SNN_VALIDATE_PARAM(params.batches > 0,
-                     "The number of batches must be positive.");
-  SNN_VALIDATE_PARAM(params.m > 0, "The value of m must be positive.");
-  SNN_VALIDATE_PARAM(params.k > 0, "The value of k must  be positive.");
-  SNN_VALIDATE_PARAM(params.n > 0, "The value of n must be positive.");
+                    const std::vector<cl::sycl::event>& events = {},
+                    Epilogue<T, Backend> const& epilogue = {}) {
+  auto validation_status = validate_params(params);
+  if (validation_status.status != StatusCode::OK) {
+    return validation_status;
+  }
+
+  size_t lhs_size = get_lhs_extent(params);
+  size_t rhs_size = get_rhs_extent(params);
+  size_t out_size = get_output_extent(params);
 
-  size_t lhs_size = params.batches * params.m * params.k;
-  size_t rhs_size = params.batches * params.k * params.n;
-  size_t out_size = params.batches * params.m * params.n;
+  auto sycl_queue = backend.get_queue();
 
   auto lhs_acc = backend.get_mem_object(lhs, lhs_size);
   auto rhs_acc = backend.get_mem_object(rhs, rhs_size);
   auto out_acc = backend.get_mem_object(output, out_size);
+  auto epilogue_mem = make_epilogue_mem(epilogue, backend, rhs_acc, params.n);
+
+  return internal::launch<T, TransposeLHS, TransposeRHS>(
+      lhs_acc, rhs_acc, out_acc, epilogue_mem, params, sycl_queue, events);
+}
+
+/**
+ * Launch a batched matrix multiplication, using the provided workspace for
+ * the partial products if the matmul is split along the shared dimension.
+ *
+ * If the workspace is too small for the number of partitions chosen for the
+ * device, then fewer partitions are used. If the workspace size is zero, then
+ * the shared dimension is not split.
+ *
+ * \param lhs A pointer to the memory representing the left hand matrix.
+ * \param rhs A pointer to the memory representing the right hand matrix.
+ * \param output A pointer to the memory representing the output tensor.
+ * \param params The parameters of the matrix multiplication operation.
+ * \param backend The backend implementation, used to map between pointer
+ *                representations.
+ * \param workspace A pointer to the workspace buffer.
+ * \param workspace_size The number of elements available in the workspace.
+ * \param events Events which should be completed before the operation.
+ * \param epilogue Optional operations to apply to the output values.
+ * \return Returns an SNNStatus containing the SYCL event tied to the kernel
+ *         launches and a StatusCode enum showing if the launch was OK or
+ *         whether it encountered some problem.
+ */
+template <typename T, bool TransposeLHS, bool TransposeRHS, typename Backend>
+SNNStatus sublaunch(typename Backend::template pointer_type<T const> lhs,
+                    typename Backend::template pointer_type<T const> rhs,
+                    typename Backend::template pointer_type<T> output,
+                    MatmulParams const& params, Backend& backend,
+                    typename Backend::template pointer_type<T> workspace,
+                    size_t workspace_size,
+                    const std::vector<cl::sycl::event>& events = {},
+                    Epilogue<T, Backend> const& epilogue = {}) {
+  if (workspace_size == 0) {
+    return sublaunch<T, TransposeLHS, TransposeRHS>(lhs, rhs, output, params,
+                                                    backend, events, epilogue);
+  }
+  auto validation_status = validate_params(params);
+  if (validation_status.status != StatusCode::OK) {
+    return validation_status;
+  }
+
+  size_t lhs_size = get_lhs_extent(params);
+  size_t rhs_size = get_rhs_extent(params);
+  size_t out_size = get_output_extent(params);
+  size_t partial_size = params.batches * params.m * params.n;
 
   auto sycl_queue = backend.get_queue();
 
+  // The GEMV kernels for contiguous matrices already spread the shared
+  // dimension across a work-group.
+  size_t const max_splits =
+      is_gemv_contiguous_acc<TransposeLHS, TransposeRHS>(params)
+          ? 1
+          : workspace_size / partial_size;
+  int const n_splits = static_cast<int>(std::min(
+      static_cast<size_t>(
+          get_split_k_partitions(params, sycl_queue.get_device())),
+      max_splits));
+  if (n_splits > 1) {
+    ::sycldnn::internal::helpers::InternalPointer<T, Backend> workspace_ptr{
+        workspace, backend};
+    return launch_split_k_with_workspace<T, TransposeLHS, TransposeRHS>(
+        lhs, rhs, output, workspace_ptr.get(), params, n_splits, backend,
+        events, epilogue);
+  }
+
+  auto lhs_acc = backend.get_mem_object(lhs, lhs_size);
+  auto rhs_acc = backend.get_mem_object(rhs, rhs_size);
+  auto out_acc = backend.get_mem_object(output, out_size);
+  auto epilogue_mem = make_epilogue_mem(epilogue, backend, rhs_acc, params.n);
+
   return internal::launch<T, TransposeLHS, TransposeRHS>(
-      lhs_acc, rhs_acc, out_acc, params, sycl_queue, events);
+      lhs_acc, rhs_acc, out_acc, epilogue_mem, params, sycl_queue, events);
 }
 
 }  // namespace internal
@@ -0,0 +1,86 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_INTERNAL_MATMUL_SPLIT_K_H_
+#define SYCLDNN_INCLUDE_INTERNAL_MATMUL_SPLIT_K_H_
+
+#include <CL/sycl.hpp>
+
+#include "sycldnn/helpers/ratio.h"
+#include "sycldnn/matmul/params.h"
+
+#include <algorithm>
+#include <cstddef>
+
+namespace sycldnn {
+namespace matmul {
+namespace internal {
+
+/** Minimum number of elements of the shared dimension in each partition. */
+static constexpr int split_k_min_size = 256;
+
+/** Maximum number of partitions of the shared dimension. */
+static constexpr int split_k_max_partitions = 16;
+
+/**
+ * Number of output values needed for each compute unit on the device before
+ * a matmul can occupy the device without splitting the shared dimension.
+ */
+static constexpr size_t split_k_outputs_per_compute_unit = 1024;
+
+/**
+ * Get the largest number of partitions that the shared dimension of a matmul
+ * can be split into. Returns 1 if the shared dimension is too small to split.
+ */
+inline int max_split_k_partitions(MatmulParams const& params) {
+  return std::max(
+      1, std::min(params.k / split_k_min_size, split_k_max_partitions));
+}
+
+/**
+ * Get the number of partitions to split the shared dimension of a matmul into
+ * on the given device.
+ *
+ * Each work item of the matmul kernels computes a tile of the output over the
+ * whole shared dimension, so matmuls with a small output and a large shared
+ * dimension, such as fully connected layers with a small batch, leave most of
+ * the device idle. Splitting the shared dimension gives enough work items to
+ * occupy the device, at the cost of a reduction over the partial products.
+ */
+inline int get_split_k_partitions(MatmulParams const& params,
+                                  cl::sycl::device const& device) {
+  int const max_partitions = max_split_k_partitions(params);
+  if (max_partitions < 2) {
+    return 1;
+  }
+  size_t const output_size = static_cast<size_t>(params.batches) *
+                             static_cast<size_t>(params.m) *
+                             static_cast<size_t>(params.n);
+  size_t const compute_units =
+      device.get_info<cl::sycl::info::device::max_compute_units>();
+  size_t const target_size = compute_units * split_k_outputs_per_compute_unit;
+  if (output_size >= target_size) {
+    return 1;
+  }
+  size_t const partitions = helpers::round_ratio_up(target_size, output_size);
+  return static_cast<int>(
+      std::min(partitions, static_cast<size_t>(max_partitions)));
+}
+
+}  // namespace internal
+}  // namespace matmul
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_INCLUDE_INTERNAL_MATMUL_SPLIT_K_H_
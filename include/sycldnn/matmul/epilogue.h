@@ -0,0 +1,96 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_MATMUL_EPILOGUE_H_
+#define SYCLDNN_INCLUDE_MATMUL_EPILOGUE_H_
+
+/**
+ * \file
+ * Contains the \ref sycldnn::matmul::Epilogue descriptor, which describes the
+ * pointwise operations to fuse into the output stage of a matrix multiply.
+ */
+
+#include "sycldnn/conv2d/epilogue.h"
+
+#include <optional>
+
+namespace sycldnn {
+namespace matmul {
+
+/** The activation applied as the last operation of an epilogue. */
+using Activation = conv2d::Activation;
+
+/**
+ * The set of operations enabled in a matmul epilogue.
+ *
+ * For an output value x in column j, the epilogue computes
+ * \code
+ *   y = activation(x + bias[j])
+ * \endcode
+ * where any operation which is not enabled is skipped.
+ */
+struct EpilogueParams {
+  /** Whether a per-column bias is added. */
+  bool bias = false;
+  /** The activation applied to the result. */
+  Activation activation = Activation::None;
+};
+
+/**
+ * Check whether an epilogue leaves the matmul output unchanged.
+ *
+ * \param params The epilogue parameters to check.
+ * \return Whether no epilogue operations are enabled.
+ */
+inline bool is_identity(EpilogueParams const& params) {
+  return !params.bias && params.activation == Activation::None;
+}
+
+/**
+ * Descriptor for the operations to apply to the output of a matrix multiply
+ * before it is written to memory.
+ *
+ * This covers the layers which typically follow a fully connected layer, or a
+ * convolution computed as a matrix multiply: a bias add over the columns of
+ * the output and an activation. The bias is shared by every batch and every
+ * row of the output.
+ */
+template <typename T, typename Backend>
+struct Epilogue {
+  /** The backend's pointer type for the epilogue tensors. */
+  using ConstPointer = typename Backend::template pointer_type<T const>;
+
+  /** Optional per-column bias, containing one value per output column. */
+  std::optional<ConstPointer> bias;
+  /** The activation applied after the bias. */
+  Activation activation = Activation::None;
+
+  /**
+   * Get the set of operations enabled in this epilogue.
+   *
+   * \return The epilogue parameters to pass to the kernels.
+   */
+  EpilogueParams get_params() const {
+    EpilogueParams params;
+    params.bias = bias.has_value();
+    params.activation = activation;
+    return params;
+  }
+};
+
+}  // namespace matmul
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_INCLUDE_MATMUL_EPILOGUE_H_
@@ -0,0 +1,112 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_MATMUL_GROUPED_LAUNCH_H_
+#define SYCLDNN_INCLUDE_MATMUL_GROUPED_LAUNCH_H_
+
+/**
+ * \file
+ * Implements the \ref sycldnn::matmul::launch_grouped() function, which
+ * asynchronously dispatches the SYCL kernel required to perform a group of
+ * matrix multiplies with different shapes.
+ */
+#include "sycldnn/backend/backend_helpers.h"
+#include "sycldnn/mem_object.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/internal/matmul/grouped_launch.h"
+#include "sycldnn/matmul/grouped_params.h"
+
+namespace sycldnn {
+namespace matmul {
+/**
+ * Launch a grouped matrix multiplication.
+ *
+ * Will compute:
+ *   output[i] = alpha * op(lhs[i]) * op(rhs[i]) + beta * output[i]
+ * where i ranges over the problems and op(X) is either X or X^T if TransposeX
+ * is true. Each problem has its own m, k and n, and its matrices are found at
+ * the offsets given in the problems array, which is read on the device. All
+ * problems are computed by a single kernel, which distributes the output
+ * tiles of every problem across its work-groups.
+ *
+ * \param lhs A pointer to the memory containing the left hand matrices.
+ * \param rhs A pointer to the memory containing the right hand matrices.
+ * \param output A pointer to the memory containing the output matrices.
+ * \param problems A pointer to the memory containing params.n_problems
+ *                 problem descriptions.
+ * \param params The parameters shared by all problems.
+ * \param backend The backend implementation, used to map between pointer
+ *                representations.
+ * \return Returns an SNNStatus containing the SYCL event tied to the kernel
+ *         launch and a StatusCode enum showing if the launch was OK or
+ *         whether it encountered some problem.
+ */
+template <typename T, bool TransposeLHS, bool TransposeRHS, typename Backend,
+          typename = typename std::enable_if<
+              !sycldnn::backend::is_usm_backend_v<Backend>>::type>
+SNNStatus launch_grouped(
+    typename Backend::template pointer_type<T const> lhs,
+    typename Backend::template pointer_type<T const> rhs,
+    typename Backend::template pointer_type<T> output,
+    typename Backend::template pointer_type<GroupedMatmulProblem const>
+        problems,
+    GroupedMatmulParams const& params, Backend& backend) {
+  return internal::sublaunch_grouped<T, TransposeLHS, TransposeRHS>(
+      lhs, rhs, output, problems, params, backend);
+}
+
+/**
+ * Launch a grouped matrix multiplication.
+ *
+ * Will compute:
+ *   output[i] = alpha * op(lhs[i]) * op(rhs[i]) + beta * output[i]
+ * where i ranges over the problems and op(X) is either X or X^T if TransposeX
+ * is true. Each problem has its own m, k and n, and its matrices are found at
+ * the offsets given in the problems array, which is read on the device. All
+ * problems are computed by a single kernel, which distributes the output
+ * tiles of every problem across its work-groups.
+ *
+ * \param lhs A pointer to the memory containing the left hand matrices.
+ * \param rhs A pointer to the memory containing the right hand matrices.
+ * \param output A pointer to the memory containing the output matrices.
+ * \param problems A pointer to the memory containing params.n_problems
+ *                 problem descriptions.
+ * \param params The parameters shared by all problems.
+ * \param backend The backend implementation, used to map between pointer
+ *                representations.
+ * \param events Events which should be completed before the operation.
+ * \return Returns an SNNStatus containing the SYCL event tied to the kernel
+ *         launch and a StatusCode enum showing if the launch was OK or
+ *         whether it encountered some problem.
+ */
+template <typename T, bool TransposeLHS, bool TransposeRHS, typename Backend,
+          typename = typename std::enable_if<
+              sycldnn::backend::is_usm_backend_v<Backend>>::type>
+SNNStatus launch_grouped(
+    typename Backend::template pointer_type<T const> lhs,
+    typename Backend::template pointer_type<T const> rhs,
+    typename Backend::template pointer_type<T> output,
+    typename Backend::template pointer_type<GroupedMatmulProblem const>
+        problems,
+    GroupedMatmulParams const& params, Backend& backend,
+    const std::vector<cl::sycl::event>& events = {}) {
+  return internal::sublaunch_grouped<T, TransposeLHS, TransposeRHS>(
+      lhs, rhs, output, problems, params, backend, events);
+}
+
+}  // namespace matmul
+}  // namespace sycldnn
+#endif  // SYCLDNN_INCLUDE_MATMUL_GROUPED_LAUNCH_H_
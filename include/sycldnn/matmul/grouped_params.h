@@ -0,0 +1,93 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_MATMUL_GROUPED_PARAMS_H_
+#define SYCLDNN_INCLUDE_MATMUL_GROUPED_PARAMS_H_
+
+/**
+ * \file
+ * Defines the \ref sycldnn::matmul::GroupedMatmulProblem and
+ * \ref sycldnn::matmul::GroupedMatmulParams structs, which describe a group
+ * of independent matrix multiplies with different shapes computed in a single
+ * launch.
+ */
+
+#include <cstddef>
+
+namespace sycldnn {
+namespace matmul {
+
+/**
+ * The shape and location of a single problem in a grouped matmul.
+ *
+ * An array of these is passed to the grouped matmul in device memory, so the
+ * shapes can be computed on the device without a round trip to the host.
+ */
+struct GroupedMatmulProblem {
+  /** The type of the params is int, matching MatmulParams. */
+  using Index = int;
+
+  /** The number of rows (columns if TransposeLHS) in the left hand matrix. */
+  Index m;
+
+  /** The number of columns (rows if TransposeLHS) in the left hand matrix and
+   * the number of rows (columns if TransposeRHS) in the right hand matrix. */
+  Index k;
+
+  /** The number of columns (rows if TransposeRHS) in the right hand matrix.
+   */
+  Index n;
+
+  /** Offset of the problem's left hand matrix in the lhs tensor. */
+  Index lhs_offset;
+
+  /** Offset of the problem's right hand matrix in the rhs tensor. */
+  Index rhs_offset;
+
+  /** Offset of the problem's output matrix in the output tensor. */
+  Index output_offset;
+};
+
+/** Struct that contains the values shared by every problem in a grouped
+ * matmul. */
+struct GroupedMatmulParams {
+  /** The type of the params is int, matching MatmulParams. */
+  using Index = int;
+
+  /** The number of problems in the group. Must be a positive value. */
+  Index n_problems;
+
+  /** The total number of elements in the lhs tensor, covering every
+   * problem's left hand matrix. */
+  size_t lhs_size;
+
+  /** The total number of elements in the rhs tensor, covering every
+   * problem's right hand matrix. */
+  size_t rhs_size;
+
+  /** The total number of elements in the output tensor, covering every
+   * problem's output matrix. */
+  size_t output_size;
+
+  /**A scalar value to scale the output tensor.*/
+  float beta = 0.f;
+
+  /**A scalar value to scale the product of the matrices.*/
+  float alpha = 1.f;
+};
+
+}  // namespace matmul
+}  // namespace sycldnn
+#endif  // SYCLDNN_INCLUDE_MATMUL_GROUPED_PARAMS_H_
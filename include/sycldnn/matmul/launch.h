@@ -27,16 +27,20 @@
 
 #include "sycldnn/helpers/macros.h"
 #include "sycldnn/internal/matmul/launch.h"
+#include "sycldnn/matmul/epilogue.h"
 #include "sycldnn/matmul/params.h"
+#include "sycldnn/matmul/workspace_size.h"
 
 namespace sycldnn {
 namespace matmul {
 /**
  * Launch a batched matrix multiplication.
  *
- * Will compute: output[i] = beta * output[i] + op(lhs[i]) * op(rhs[i])
- * where i ranges over the number of batches and op(X) is either X or X^T if
- * TransposeX is true.
+ * Will compute:
+ *   output[i] = epilogue(alpha * op(lhs[i]) * op(rhs[i]) + beta * output[i])
+ * where i ranges over the number of batches, op(X) is either X or X^T if
+ * TransposeX is true, and the epilogue adds the per-column bias and applies
+ * the activation.
  *
  * \param lhs A pointer to the memory representing the left hand matrix.
  * \param rhs A pointer to the memory representing the right hand matrix.
@@ -44,6 +48,8 @@ namespace matmul {
  * \param params The parameters of the matrix multiplication operation.
  * \param backend The backend implementation, used to map between pointer
  *                representations.
+ * \param epilogue Optional operations to apply to the output values before
+ *                 they are written.
  * \return Returns an SNNStatus containing the SYCL event tied to the kernel
  *         launches and a StatusCode enum showing if the launch was OK or
  *         whether it encountered some problem.
@@ -54,17 +60,103 @@ template <typename T, bool TransposeLHS, bool TransposeRHS, typename Backend,
 SNNStatus launch(typename Backend::template pointer_type<T const> lhs,
                  typename Backend::template pointer_type<T const> rhs,
                  typename Backend::template pointer_type<T> output,
-                 MatmulParams const& params, Backend& backend) {
-  return internal::sublaunch<T, TransposeLHS, TransposeRHS>(lhs, rhs, output,
-                                                            params, backend);
+                 MatmulParams const& params, Backend& backend,
+                 Epilogue<T, Backend> const& epilogue = {}) {
+  return internal::sublaunch<T, TransposeLHS, TransposeRHS>(
+      lhs, rhs, output, params, backend, {}, epilogue);
+}
+
+/**
+ * Launch a batched matrix multiplication, using the provided workspace.
+ *
+ * Will compute:
+ *   output[i] = epilogue(alpha * op(lhs[i]) * op(rhs[i]) + beta * output[i])
+ * where i ranges over the number of batches, op(X) is either X or X^T if
+ * TransposeX is true, and the epilogue adds the per-column bias and applies
+ * the activation.
+ *
+ * Matmuls with a large shared dimension and a small output may be split along
+ * the shared dimension, with the partial products stored in the workspace.
+ * The size of workspace needed is given by \ref query_workspace_size().
+ *
+ * \param lhs A pointer to the memory representing the left hand matrix.
+ * \param rhs A pointer to the memory representing the right hand matrix.
+ * \param output A pointer to the memory representing the output tensor.
+ * \param params The parameters of the matrix multiplication operation.
+ * \param backend The backend implementation, used to map between pointer
+ *                representations.
+ * \param workspace A pointer to a workspace buffer.
+ * \param workspace_size The number of elements available in the workspace
+ *                       buffer. If zero, the shared dimension is not
+ *                       split.
+ * \param epilogue Optional operations to apply to the output values before
+ *                 they are written.
+ * \return Returns an SNNStatus containing the SYCL event tied to the kernel
+ *         launches and a StatusCode enum showing if the launch was OK or
+ *         whether it encountered some problem.
+ */
+template <typename T, bool TransposeLHS, bool TransposeRHS, typename Backend,
+          typename = typename std::enable_if<
+              !sycldnn::backend::is_usm_backend_v<Backend>>::type>
+SNNStatus launch(typename Backend::template pointer_type<T const> lhs,
+                 typename Backend::template pointer_type<T const> rhs,
+                 typename Backend::template pointer_type<T> output,
+                 MatmulParams const& params, Backend& backend,
+                 typename Backend::template pointer_type<T> workspace,
+                 size_t workspace_size,
+                 Epilogue<T, Backend> const& epilogue = {}) {
+  return internal::sublaunch<T, TransposeLHS, TransposeRHS>(
+      lhs, rhs, output, params, backend, workspace, workspace_size, {},
+      epilogue);
 }
 
 /**
  * Launch a batched matrix multiplication.
  *
- * Will compute: output[i] = beta * output[i] + op(lhs[i]) * op(rhs[i])
- * where i ranges over the number of batches and op(X) is either X or X^T if
- * TransposeX is true.
+ * Will compute:
+ *   output[i] = epilogue(alpha * op(lhs[i]) * op(rhs[i]) + beta * output[i])
+ * where i ranges over the number of batches, op(X) is either X or X^T if
+ * TransposeX is true, and the epilogue adds the per-column bias and applies
+ * the activation.
+ *
+ * \param lhs A pointer to the memory representing the left hand matrix.
+ * \param rhs A pointer to the memory representing the right hand matrix.
+ * \param output A pointer to the memory representing the output tensor.
+ * \param params The parameters of the matrix multiplication operation.
+ * \param backend The backend implementation, used to map between pointer
+ *                representations.
+ * \param events Events which should be completed before the operation
+ * \param epilogue Optional operations to apply to the output values before
+ *                 they are written.
+ * \return Returns an SNNStatus containing the SYCL event tied to the kernel
+ *         launches and a StatusCode enum showing if the launch was OK or
+ *         whether it encountered some problem.
+ */
+template <typename T, bool TransposeLHS, bool TransposeRHS, typename Backend,
+          typename = typename std::enable_if<
+              sycldnn::backend::is_usm_backend_v<Backend>>::type>
+SNNStatus launch(typename Backend::template pointer_type<T const> lhs,
+                 typename Backend::template pointer_type<T const> rhs,
+                 typename Backend::template pointer_type<T> output,
+                 MatmulParams const& params, Backend& backend,
+                 const std::vector<cl::sycl::event>& events = {},
+                 Epilogue<T, Backend> const& epilogue = {}) {
+  return internal::sublaunch<T, TransposeLHS, TransposeRHS>(
+      lhs, rhs, output, params, backend, events, epilogue);
+}
+
+/**
+ * Launch a batched matrix multiplication, using the provided workspace.
+ *
+ * Will compute:
+ *   output[i] = epilogue(alpha * op(lhs[i]) * op(rhs[i]) + beta * output[i])
+ * where i ranges over the number of batches, op(X) is either X or X^T if
+ * TransposeX is true, and the epilogue adds the per-column bias and applies
+ * the activation.
+ *
+ * Matmuls with a large shared dimension and a small output may be split along
+ * the shared dimension, with the partial products stored in the workspace.
+ * The size of workspace needed is given by \ref query_workspace_size().
  *
  * \param lhs A pointer to the memory representing the left hand matrix.
  * \param rhs A pointer to the memory representing the right hand matrix.
@@ -72,7 +164,13 @@ SNNStatus launch(typename Backend::template pointer_type<T const> lhs,
  * \param params The parameters of the matrix multiplication operation.
  * \param backend The backend implementation, used to map between pointer
  *                representations.
+ * \param workspace A pointer to a workspace buffer.
+ * \param workspace_size The number of elements available in the workspace
+ *                       buffer. If zero, the shared dimension is not
+ *                       split.
  * \param events Events which should be completed before the operation
+ * \param epilogue Optional operations to apply to the output values before
+ *                 they are written.
  * \return Returns an SNNStatus containing the SYCL event tied to the kernel
  *         launches and a StatusCode enum showing if the launch was OK or
  *         whether it encountered some problem.
@@ -84,9 +182,13 @@ SNNStatus launch(typename Backend::template pointer_type<T const> lhs,
                  typename Backend::template pointer_type<T const> rhs,
                  typename Backend::template pointer_type<T> output,
                  MatmulParams const& params, Backend& backend,
-                 const std::vector<cl::sycl::event>& events = {}) {
+                 typename Backend::template pointer_type<T> workspace,
+                 size_t workspace_size,
+                 const std::vector<cl::sycl::event>& events = {},
+                 Epilogue<T, Backend> const& epilogue = {}) {
   return internal::sublaunch<T, TransposeLHS, TransposeRHS>(
-      lhs, rhs, output, params, backend, events);
+      lhs, rhs, output, params, backend, workspace, workspace_size, events,
+      epilogue);
 }
 
 }  // namespace matmul
@@ -17,6 +17,8 @@
 #define SYCLDNN_INCLUDE_MATMUL_PARAMS_H_
 #include "sycldnn/batch_format.h"
 
+#include <cstddef>
+
 /**
  * \file
  * Defines the \ref sycldnn::matmul::MatmulParams struct,
@@ -25,6 +27,9 @@
 namespace sycldnn {
 namespace matmul {
 
+/** Batch stride value indicating that the matrices are densely packed. */
+static constexpr int packed_batch_stride = -1;
+
 /** Struct that contains values used in a matmul op. */
 struct MatmulParams {
   /** The type of the params is int, providing a decent
@@ -52,8 +57,76 @@ struct MatmulParams {
 
   /** Specifies how the batches are strided in the tensor*/
   sycldnn::BatchFormat batch_type = sycldnn::BatchFormat::STRIDED;
+
+  /**A scalar value to scale the product of the matrices.*/
+  float alpha = 1.f;
+
+  /** The number of elements between consecutive left hand matrices. A stride
+   * of zero broadcasts a single matrix to every batch. Defaults to
+   * packed_batch_stride, which uses m * k.*/
+  Index lhs_batch_stride = packed_batch_stride;
+
+  /** The number of elements between consecutive right hand matrices. A stride
+   * of zero broadcasts a single matrix to every batch. Defaults to
+   * packed_batch_stride, which uses k * n.*/
+  Index rhs_batch_stride = packed_batch_stride;
+
+  /** The number of elements between consecutive output matrices. Must not be
+   * less than m * n. Defaults to packed_batch_stride, which uses m * n.*/
+  Index output_batch_stride = packed_batch_stride;
 };
 
+/**
+ * Get the number of elements between consecutive left hand matrices.
+ *
+ * \param params The matmul parameters.
+ * \return The left hand batch stride, resolving packed_batch_stride.
+ */
+inline MatmulParams::Index get_lhs_batch_stride(MatmulParams const& params) {
+  return params.lhs_batch_stride == packed_batch_stride
+             ? params.m * params.k
+             : params.lhs_batch_stride;
+}
+
+/**
+ * Get the number of elements between consecutive right hand matrices.
+ *
+ * \param params The matmul parameters.
+ * \return The right hand batch stride, resolving packed_batch_stride.
+ */
+inline MatmulParams::Index get_rhs_batch_stride(MatmulParams const& params) {
+  return params.rhs_batch_stride == packed_batch_stride
+             ? params.k * params.n
+             : params.rhs_batch_stride;
+}
+
+/**
+ * Get the number of elements between consecutive output matrices.
+ *
+ * \param params The matmul parameters.
+ * \return The output batch stride, resolving packed_batch_stride.
+ */
+inline MatmulParams::Index get_output_batch_stride(
+    MatmulParams const& params) {
+  return params.output_batch_stride == packed_batch_stride
+             ? params.m * params.n
+             : params.output_batch_stride;
+}
+
+/**
+ * Get the number of elements spanned by a batch of matrices.
+ *
+ * \param batches The number of matrices.
+ * \param stride The number of elements between consecutive matrices.
+ * \param matrix_size The number of elements in each matrix.
+ * \return The number of elements needed to hold all of the matrices.
+ */
+inline size_t get_batch_extent(MatmulParams::Index batches,
+                               MatmulParams::Index stride,
+                               MatmulParams::Index matrix_size) {
+  return static_cast<size_t>(batches - 1) * stride + matrix_size;
+}
+
 }  // namespace matmul
 }  // namespace sycldnn
 #endif  // SYCLDNN_INCLUDE_MATMUL_PARAMS_H_
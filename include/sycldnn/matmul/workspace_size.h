@@ -0,0 +1,59 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_INCLUDE_MATMUL_WORKSPACE_SIZE_H_
+#define SYCLDNN_INCLUDE_MATMUL_WORKSPACE_SIZE_H_
+
+/**
+ * \file
+ * Provides the \ref sycldnn::matmul::query_workspace_size() function, to get
+ * the size of the workspace buffer that a matmul can make use of.
+ */
+#include "sycldnn/internal/matmul/split_k.h"
+#include "sycldnn/matmul/params.h"
+
+#include <cstddef>
+
+namespace sycldnn {
+namespace matmul {
+
+/**
+ * Query the number of elements that a workspace buffer for the given matmul
+ * should hold.
+ *
+ * Matmuls with a large shared dimension and a small output are computed by
+ * splitting the shared dimension into partitions, and the workspace holds the
+ * partial products of each partition. The number of partitions depends on the
+ * device, so this gives the size needed for the largest number of partitions
+ * that may be used. Smaller workspaces limit the number of partitions, and a
+ * matmul which cannot be split does not need a workspace.
+ *
+ * \param params The parameters of the matrix multiplication operation.
+ * \return The recommended number of elements in a workspace buffer.
+ */
+inline size_t query_workspace_size(MatmulParams const& params) {
+  int const partitions = internal::max_split_k_partitions(params);
+  if (partitions < 2) {
+    return 0;
+  }
+  return static_cast<size_t>(partitions) *
+         static_cast<size_t>(params.batches) * static_cast<size_t>(params.m) *
+         static_cast<size_t>(params.n);
+}
+
+}  // namespace matmul
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_INCLUDE_MATMUL_WORKSPACE_SIZE_H_
@@ -80,6 +80,7 @@ inline sycldnn::ConvolutionLayer<T, Backend>* create_conv_layer(
     sycldnn::conv2d::Selector& selector,
     sycldnn::conv2d::Conv2DParams const& params) {
   DeviceMem weights;
+  // The output is allocated when the network plans its memory
   DeviceMem output;
   DeviceMem workspace;
   auto new_size = sycldnn::conv2d::query_workspace_size<
@@ -91,7 +92,6 @@ inline sycldnn::ConvolutionLayer<T, Backend>* create_conv_layer(
   auto sizes =
       sycldnn::conv2d::get_sizes<sycldnn::conv2d::conv_type::Forward>(params);
   weights = backend.template allocate<T>(sizes.filter_size);
-  output = backend.template allocate<T>(sizes.output_size);
 
   std::vector<char> filter(sizes.filter_size * sizeof(T));
   if (data_dir == "")
@@ -129,10 +129,8 @@ inline sycldnn::BiasAddLayer<T, Backend>* create_bias_layer(
     DeviceMem const input, Backend& backend, std::string const& data_dir,
     sycldnn::binaryop::BinaryParams const& params) {
   DeviceMem bias, output;
-  auto lhs_size = sycldnn::helpers::get_total_size(params.lhs_dims);
   auto rhs_size = sycldnn::helpers::get_total_size(params.rhs_dims);
   bias = backend.allocate<T>(rhs_size);
-  output = backend.allocate<T>(lhs_size);
 
   std::vector<char> biases(rhs_size * sizeof(T));
   if (data_dir == "")
@@ -176,8 +174,6 @@ inline sycldnn::BatchNormFrozenLayer<T, Backend>* create_batchnorm_layer(
   gamma = backend.template allocate<T>(params.channels);
   mean = backend.template allocate<T>(params.channels);
   variance = backend.template allocate<T>(params.channels);
-  output = backend.template allocate<T>(params.batch * params.rows *
-                                        params.cols * params.channels);
 
   std::vector<char> beta_vec(params.channels * sizeof(T));
   std::vector<char> gamma_vec(params.channels * sizeof(T));
@@ -282,7 +278,6 @@ inline sycldnn::ActivationLayer<T, Backend, ActivationFunc>*
 create_activation_layer(DeviceMem const input, Backend& backend,
                         sycldnn::pointwise::PointwiseParams const& params) {
   DeviceMem output;
-  output = backend.template allocate<T>(params.size);
   return new sycldnn::ActivationLayer<T, Backend, ActivationFunc>(
       params, input, output, backend);
 }
@@ -304,8 +299,6 @@ inline sycldnn::PoolingLayer<T, Backend, PoolingType>* create_pooling_layer(
     DeviceMem const input, Backend& backend,
     sycldnn::pooling::PoolingParams const& params) {
   DeviceMem output;
-  auto sizes = sycldnn::pooling::get_sizes<sycldnn::pooling::Forward>(params);
-  output = backend.allocate<T>(sizes.output_size);
   return new sycldnn::PoolingLayer<T, Backend, PoolingType>(params, input,
                                                             output, backend);
 }
@@ -325,7 +318,6 @@ inline sycldnn::FCLayer<T, Backend>* create_fc_layer(
   DeviceMem filter, output;
   auto filter_size = params.k * params.n;
   filter = backend.allocate<T>(filter_size);
-  output = backend.allocate<T>(params.n);
 
   std::vector<char> weights(filter_size * sizeof(T));
   if (data_dir == "")
@@ -362,8 +354,6 @@ inline sycldnn::SoftmaxLayer<T, Backend>* create_softmax_layer(
     sycldnn::softmax::SoftmaxParams const& params) {
   DeviceMem workspace, output;
   workspace = backend.allocate<T>(params.batch * params.rows * params.cols);
-  output = backend.allocate<T>(params.batch * params.rows * params.cols *
-                               params.channels);
   return new sycldnn::SoftmaxLayer<T, Backend>(params, input, workspace, output,
                                                backend);
 }
@@ -411,7 +401,7 @@ int main(int argc, char* argv[]) {
       network.get_output(), backend,
       make_pooling_params(1, 112, 64, 3, 2, sycldnn::PaddingMode::SAME)));
 
-  int layer_before_residual_connection = network.get_network_size() - 1;
+  size_t layer_before_residual_connection = network.get_network_size() - 1;
   // Residual Block start
   // Residual Conv start
   network.add_layer(create_conv_layer<DType>(
@@ -430,12 +420,14 @@ int main(int argc, char* argv[]) {
       data_dir + "conv2_block1_0_bn_moving_variance.bin",
       make_batchnorm_params(1, 56, 256)));
   // Residual Conv end
-  int residual_connection_reference = network.get_network_size() - 1;
+  size_t residual_connection_reference = network.get_network_size() - 1;
 
-  network.add_layer(create_conv_layer<DType>(
-      network.get_output(layer_before_residual_connection), backend,
-      data_dir + "conv2_block1_1_conv_kernel.bin", *selector,
-      make_conv_params(1, 56, 64, 64, 1, 1, sycldnn::PaddingMode::SAME)));
+  network.add_layer(
+      create_conv_layer<DType>(
+          network.get_output(layer_before_residual_connection), backend,
+          data_dir + "conv2_block1_1_conv_kernel.bin", *selector,
+          make_conv_params(1, 56, 64, 64, 1, 1, sycldnn::PaddingMode::SAME)),
+      {layer_before_residual_connection});
 
   network.add_layer(create_bias_layer<DType>(
       network.get_output(), backend, data_dir + "conv2_block1_1_conv_bias.bin",
@@ -487,9 +479,11 @@ int main(int argc, char* argv[]) {
       make_batchnorm_params(1, 56, 256)));
 
   // perform residual addition
-  network.add_layer(create_residual_layer<DType>(
-      network.get_output(residual_connection_reference), network.get_output(),
-      backend, make_bias_params(1, 1, 56 * 56 * 256)));
+  network.add_layer(
+      create_residual_layer<DType>(
+          network.get_output(residual_connection_reference),
+          network.get_output(), backend, make_bias_params(1, 1, 56 * 56 * 256)),
+      {residual_connection_reference, network.get_network_size() - 1});
   // residual addition complete, move to activation layer
   network.add_layer(create_activation_layer<DType, sycldnn::pointwise::Relu>(
       network.get_output(), backend, make_pointwise_params(56 * 56 * 256)));
@@ -551,9 +545,11 @@ int main(int argc, char* argv[]) {
       make_batchnorm_params(1, 56, 256)));
 
   // perform residual addition
-  network.add_layer(create_residual_layer<DType>(
-      network.get_output(residual_connection_reference), network.get_output(),
-      backend, make_bias_params(1, 1, 56 * 56 * 256)));
+  network.add_layer(
+      create_residual_layer<DType>(
+          network.get_output(residual_connection_reference),
+          network.get_output(), backend, make_bias_params(1, 1, 56 * 56 * 256)),
+      {residual_connection_reference, network.get_network_size() - 1});
   // residual addition complete, move to activation layer
   network.add_layer(create_activation_layer<DType, sycldnn::pointwise::Relu>(
       network.get_output(), backend, make_pointwise_params(56 * 56 * 256)));
@@ -615,9 +611,11 @@ int main(int argc, char* argv[]) {
       make_batchnorm_params(1, 56, 256)));
 
   // perform residual addition
-  network.add_layer(create_residual_layer<DType>(
-      network.get_output(residual_connection_reference), network.get_output(),
-      backend, make_bias_params(1, 1, 56 * 56 * 256)));
+  network.add_layer(
+      create_residual_layer<DType>(
+          network.get_output(residual_connection_reference),
+          network.get_output(), backend, make_bias_params(1, 1, 56 * 56 * 256)),
+      {residual_connection_reference, network.get_network_size() - 1});
   // residual addition complete, move to activation layer
   network.add_layer(create_activation_layer<DType, sycldnn::pointwise::Relu>(
       network.get_output(), backend, make_pointwise_params(56 * 56 * 256)));
@@ -642,10 +640,12 @@ int main(int argc, char* argv[]) {
       make_batchnorm_params(1, 28, 512)));
   // Residual Conv end
   residual_connection_reference = network.get_network_size() - 1;
-  network.add_layer(create_conv_layer<DType>(
-      network.get_output(layer_before_residual_connection), backend,
-      data_dir + "conv3_block1_1_conv_kernel.bin", *selector,
-      make_conv_params(1, 56, 256, 128, 1, 2, sycldnn::PaddingMode::SAME)));
+  network.add_layer(
+      create_conv_layer<DType>(
+          network.get_output(layer_before_residual_connection), backend,
+          data_dir + "conv3_block1_1_conv_kernel.bin", *selector,
+          make_conv_params(1, 56, 256, 128, 1, 2, sycldnn::PaddingMode::SAME)),
+      {layer_before_residual_connection});
 
   network.add_layer(create_bias_layer<DType>(
       network.get_output(), backend, data_dir + "conv3_block1_1_conv_bias.bin",
@@ -697,9 +697,11 @@ int main(int argc, char* argv[]) {
       make_batchnorm_params(1, 28, 512)));
 
   // perform residual addition
-  network.add_layer(create_residual_layer<DType>(
-      network.get_output(residual_connection_reference), network.get_output(),
-      backend, make_bias_params(1, 1, 28 * 28 * 512)));
+  network.add_layer(
+      create_residual_layer<DType>(
+          network.get_output(residual_connection_reference),
+          network.get_output(), backend, make_bias_params(1, 1, 28 * 28 * 512)),
+      {residual_connection_reference, network.get_network_size() - 1});
   // residual addition complete, move to activation layer
   network.add_layer(create_activation_layer<DType, sycldnn::pointwise::Relu>(
       network.get_output(), backend, make_pointwise_params(28 * 28 * 512)));
@@ -761,9 +763,11 @@ int main(int argc, char* argv[]) {
       make_batchnorm_params(1, 28, 512)));
 
   // perform residual addition
-  network.add_layer(create_residual_layer<DType>(
-      network.get_output(residual_connection_reference), network.get_output(),
-      backend, make_bias_params(1, 1, 28 * 28 * 512)));
+  network.add_layer(
+      create_residual_layer<DType>(
+          network.get_output(residual_connection_reference),
+          network.get_output(), backend, make_bias_params(1, 1, 28 * 28 * 512)),
+      {residual_connection_reference, network.get_network_size() - 1});
   // residual addition complete, move to activation layer
   network.add_layer(create_activation_layer<DType, sycldnn::pointwise::Relu>(
       network.get_output(), backend, make_pointwise_params(28 * 28 * 512)));
@@ -825,9 +829,11 @@ int main(int argc, char* argv[]) {
       make_batchnorm_params(1, 28, 512)));
 
   // perform residual addition
-  network.add_layer(create_residual_layer<DType>(
-      network.get_output(residual_connection_reference), network.get_output(),
-      backend, make_bias_params(1, 1, 28 * 28 * 512)));
+  network.add_layer(
+      create_residual_layer<DType>(
+          network.get_output(residual_connection_reference),
+          network.get_output(), backend, make_bias_params(1, 1, 28 * 28 * 512)),
+      {residual_connection_reference, network.get_network_size() - 1});
   // residual addition complete, move to activation layer
   network.add_layer(create_activation_layer<DType, sycldnn::pointwise::Relu>(
       network.get_output(), backend, make_pointwise_params(28 * 28 * 512)));
@@ -889,9 +895,11 @@ int main(int argc, char* argv[]) {
       make_batchnorm_params(1, 28, 512)));
 
   // perform residual addition
-  network.add_layer(create_residual_layer<DType>(
-      network.get_output(residual_connection_reference), network.get_output(),
-      backend, make_bias_params(1, 1, 28 * 28 * 512)));
+  network.add_layer(
+      create_residual_layer<DType>(
+          network.get_output(residual_connection_reference),
+          network.get_output(), backend, make_bias_params(1, 1, 28 * 28 * 512)),
+      {residual_connection_reference, network.get_network_size() - 1});
   // residual addition complete, move to activation layer
   network.add_layer(create_activation_layer<DType, sycldnn::pointwise::Relu>(
       network.get_output(), backend, make_pointwise_params(28 * 28 * 512)));
@@ -917,10 +925,12 @@ int main(int argc, char* argv[]) {
   // Residual Conv end
   residual_connection_reference = network.get_network_size() - 1;
 
-  network.add_layer(create_conv_layer<DType>(
-      network.get_output(layer_before_residual_connection), backend,
-      data_dir + "conv4_block1_1_conv_kernel.bin", *selector,
-      make_conv_params(1, 28, 512, 256, 1, 2, sycldnn::PaddingMode::SAME)));
+  network.add_layer(
+      create_conv_layer<DType>(
+          network.get_output(layer_before_residual_connection), backend,
+          data_dir + "conv4_block1_1_conv_kernel.bin", *selector,
+          make_conv_params(1, 28, 512, 256, 1, 2, sycldnn::PaddingMode::SAME)),
+      {layer_before_residual_connection});
 
   network.add_layer(create_bias_layer<DType>(
       network.get_output(), backend, data_dir + "conv4_block1_1_conv_bias.bin",
@@ -972,9 +982,12 @@ int main(int argc, char* argv[]) {
       make_batchnorm_params(1, 14, 1024)));
 
   // perform residual addition
-  network.add_layer(create_residual_layer<DType>(
-      network.get_output(residual_connection_reference), network.get_output(),
-      backend, make_bias_params(1, 1, 14 * 14 * 1024)));
+  network.add_layer(
+      create_residual_layer<DType>(
+          network.get_output(residual_connection_reference),
+          network.get_output(), backend,
+          make_bias_params(1, 1, 14 * 14 * 1024)),
+      {residual_connection_reference, network.get_network_size() - 1});
   // residual addition complete, move to activation layer
   network.add_layer(create_activation_layer<DType, sycldnn::pointwise::Relu>(
       network.get_output(), backend, make_pointwise_params(14 * 14 * 1024)));
@@ -1036,9 +1049,12 @@ int main(int argc, char* argv[]) {
       make_batchnorm_params(1, 14, 1024)));
 
   // perform residual addition
-  network.add_layer(create_residual_layer<DType>(
-      network.get_output(residual_connection_reference), network.get_output(),
-      backend, make_bias_params(1, 1, 14 * 14 * 1024)));
+  network.add_layer(
+      create_residual_layer<DType>(
+          network.get_output(residual_connection_reference),
+          network.get_output(), backend,
+          make_bias_params(1, 1, 14 * 14 * 1024)),
+      {residual_connection_reference, network.get_network_size() - 1});
   // residual addition complete, move to activation layer
   network.add_layer(create_activation_layer<DType, sycldnn::pointwise::Relu>(
       network.get_output(), backend, make_pointwise_params(14 * 14 * 1024)));
@@ -1100,9 +1116,12 @@ int main(int argc, char* argv[]) {
       make_batchnorm_params(1, 14, 1024)));
 
   // perform residual addition
-  network.add_layer(create_residual_layer<DType>(
-      network.get_output(residual_connection_reference), network.get_output(),
-      backend, make_bias_params(1, 1, 14 * 14 * 1024)));
+  network.add_layer(
+      create_residual_layer<DType>(
+          network.get_output(residual_connection_reference),
+          network.get_output(), backend,
+          make_bias_params(1, 1, 14 * 14 * 1024)),
+      {residual_connection_reference, network.get_network_size() - 1});
   // residual addition complete, move to activation layer
   network.add_layer(create_activation_layer<DType, sycldnn::pointwise::Relu>(
       network.get_output(), backend, make_pointwise_params(14 * 14 * 1024)));
@@ -1164,9 +1183,12 @@ int main(int argc, char* argv[]) {
       make_batchnorm_params(1, 14, 1024)));
 
   // perform residual addition
-  network.add_layer(create_residual_layer<DType>(
-      network.get_output(residual_connection_reference), network.get_output(),
-      backend, make_bias_params(1, 1, 14 * 14 * 1024)));
+  network.add_layer(
+      create_residual_layer<DType>(
+          network.get_output(residual_connection_reference),
+          network.get_output(), backend,
+          make_bias_params(1, 1, 14 * 14 * 1024)),
+      {residual_connection_reference, network.get_network_size() - 1});
   // residual addition complete, move to activation layer
   network.add_layer(create_activation_layer<DType, sycldnn::pointwise::Relu>(
       network.get_output(), backend, make_pointwise_params(14 * 14 * 1024)));
@@ -1228,9 +1250,12 @@ int main(int argc, char* argv[]) {
       make_batchnorm_params(1, 14, 1024)));
 
   // perform residual addition
-  network.add_layer(create_residual_layer<DType>(
-      network.get_output(residual_connection_reference), network.get_output(),
-      backend, make_bias_params(1, 1, 14 * 14 * 1024)));
+  network.add_layer(
+      create_residual_layer<DType>(
+          network.get_output(residual_connection_reference),
+          network.get_output(), backend,
+          make_bias_params(1, 1, 14 * 14 * 1024)),
+      {residual_connection_reference, network.get_network_size() - 1});
   // residual addition complete, move to activation layer
   network.add_layer(create_activation_layer<DType, sycldnn::pointwise::Relu>(
       network.get_output(), backend, make_pointwise_params(14 * 14 * 1024)));
@@ -1292,9 +1317,12 @@ int main(int argc, char* argv[]) {
       make_batchnorm_params(1, 14, 1024)));
 
   // perform residual addition
-  network.add_layer(create_residual_layer<DType>(
-      network.get_output(residual_connection_reference), network.get_output(),
-      backend, make_bias_params(1, 1, 14 * 14 * 1024)));
+  network.add_layer(
+      create_residual_layer<DType>(
+          network.get_output(residual_connection_reference),
+          network.get_output(), backend,
+          make_bias_params(1, 1, 14 * 14 * 1024)),
+      {residual_connection_reference, network.get_network_size() - 1});
   // residual addition complete, move to activation layer
   network.add_layer(create_activation_layer<DType, sycldnn::pointwise::Relu>(
       network.get_output(), backend, make_pointwise_params(14 * 14 * 1024)));
@@ -1319,10 +1347,12 @@ int main(int argc, char* argv[]) {
       make_batchnorm_params(1, 7, 2048)));
   // Residual Conv end
   residual_connection_reference = network.get_network_size() - 1;
-  network.add_layer(create_conv_layer<DType>(
-      network.get_output(layer_before_residual_connection), backend,
-      data_dir + "conv5_block1_1_conv_kernel.bin", *selector,
-      make_conv_params(1, 14, 1024, 512, 1, 2, sycldnn::PaddingMode::SAME)));
+  network.add_layer(
+      create_conv_layer<DType>(
+          network.get_output(layer_before_residual_connection), backend,
+          data_dir + "conv5_block1_1_conv_kernel.bin", *selector,
+          make_conv_params(1, 14, 1024, 512, 1, 2, sycldnn::PaddingMode::SAME)),
+      {layer_before_residual_connection});
 
   network.add_layer(create_bias_layer<DType>(
       network.get_output(), backend, data_dir + "conv5_block1_1_conv_bias.bin",
@@ -1374,9 +1404,11 @@ int main(int argc, char* argv[]) {
       make_batchnorm_params(1, 7, 2048)));
 
   // perform residual addition
-  network.add_layer(create_residual_layer<DType>(
-      network.get_output(residual_connection_reference), network.get_output(),
-      backend, make_bias_params(1, 1, 7 * 7 * 2048)));
+  network.add_layer(
+      create_residual_layer<DType>(
+          network.get_output(residual_connection_reference),
+          network.get_output(), backend, make_bias_params(1, 1, 7 * 7 * 2048)),
+      {residual_connection_reference, network.get_network_size() - 1});
   // residual addition complete, move to activation layer
   network.add_layer(create_activation_layer<DType, sycldnn::pointwise::Relu>(
       network.get_output(), backend, make_pointwise_params(7 * 7 * 2048)));
@@ -1438,9 +1470,11 @@ int main(int argc, char* argv[]) {
       make_batchnorm_params(1, 7, 2048)));
 
   // perform residual addition
-  network.add_layer(create_residual_layer<DType>(
-      network.get_output(residual_connection_reference), network.get_output(),
-      backend, make_bias_params(1, 1, 7 * 7 * 2048)));
+  network.add_layer(
+      create_residual_layer<DType>(
+          network.get_output(residual_connection_reference),
+          network.get_output(), backend, make_bias_params(1, 1, 7 * 7 * 2048)),
+      {residual_connection_reference, network.get_network_size() - 1});
   // residual addition complete, move to activation layer
   network.add_layer(create_activation_layer<DType, sycldnn::pointwise::Relu>(
       network.get_output(), backend, make_pointwise_params(7 * 7 * 2048)));
@@ -1502,9 +1536,11 @@ int main(int argc, char* argv[]) {
       make_batchnorm_params(1, 7, 2048)));
 
   // perform residual addition
-  network.add_layer(create_residual_layer<DType>(
-      network.get_output(residual_connection_reference), network.get_output(),
-      backend, make_bias_params(1, 1, 7 * 7 * 2048)));
+  network.add_layer(
+      create_residual_layer<DType>(
+          network.get_output(residual_connection_reference),
+          network.get_output(), backend, make_bias_params(1, 1, 7 * 7 * 2048)),
+      {residual_connection_reference, network.get_network_size() - 1});
   // residual addition complete, move to activation layer
   network.add_layer(create_activation_layer<DType, sycldnn::pointwise::Relu>(
       network.get_output(), backend, make_pointwise_params(7 * 7 * 2048)));
@@ -1531,6 +1567,10 @@ int main(int argc, char* argv[]) {
   std::cout << "classed as " << std::distance(output.begin(), index)
             << ", value " << (index != std::end(output) ? *index : 0.f)
             << std::endl;
+  std::cout << "layer outputs use " << network.get_planned_memory()
+            << " bytes, rather than " << network.get_unplanned_memory()
+            << " bytes, with " << network.get_num_in_place_layers()
+            << " layers running in place\n";
   int loops = 8;
   do {
     auto st = std::chrono::high_resolution_clock::now();
@@ -80,6 +80,7 @@ inline sycldnn::ConvolutionLayer<T, Backend>* create_conv_layer(
     sycldnn::conv2d::Selector& selector,
     sycldnn::conv2d::Conv2DParams const& params) {
   DeviceMem weights;
+  // The output is allocated when the network plans its memory
   DeviceMem output;
   DeviceMem workspace;
   auto new_size = sycldnn::conv2d::query_workspace_size<
@@ -91,7 +92,6 @@ inline sycldnn::ConvolutionLayer<T, Backend>* create_conv_layer(
   auto sizes =
       sycldnn::conv2d::get_sizes<sycldnn::conv2d::conv_type::Forward>(params);
   weights = backend.template allocate<T>(sizes.filter_size);
-  output = backend.template allocate<T>(sizes.output_size);
 
   std::vector<char> filter(sizes.filter_size * sizeof(T));
   if (data_dir == "")
@@ -129,10 +129,8 @@ inline sycldnn::BiasAddLayer<T, Backend>* create_bias_layer(
     DeviceMem const input, Backend& backend, std::string const& data_dir,
     sycldnn::binaryop::BinaryParams const& params) {
   DeviceMem bias, output;
-  auto lhs_size = sycldnn::helpers::get_total_size(params.lhs_dims);
   auto rhs_size = sycldnn::helpers::get_total_size(params.rhs_dims);
   bias = backend.allocate<T>(rhs_size);
-  output = backend.allocate<T>(lhs_size);
 
   std::vector<char> biases(rhs_size * sizeof(T));
   if (data_dir == "")
@@ -165,7 +163,6 @@ inline sycldnn::ActivationLayer<T, Backend, ActivationFunc>*
 create_activation_layer(DeviceMem const input, Backend& backend,
                         sycldnn::pointwise::PointwiseParams const& params) {
   DeviceMem output;
-  output = backend.template allocate<T>(params.size);
   return new sycldnn::ActivationLayer<T, Backend, ActivationFunc>(
       params, input, output, backend);
 }
@@ -187,8 +184,6 @@ inline sycldnn::PoolingLayer<T, Backend, PoolingType>* create_pooling_layer(
     DeviceMem const input, Backend& backend,
     sycldnn::pooling::PoolingParams const& params) {
   DeviceMem output;
-  auto sizes = sycldnn::pooling::get_sizes<sycldnn::pooling::Forward>(params);
-  output = backend.allocate<T>(sizes.output_size);
   return new sycldnn::PoolingLayer<T, Backend, PoolingType>(params, input,
                                                             output, backend);
 }
@@ -208,7 +203,6 @@ inline sycldnn::FCLayer<T, Backend>* create_fc_layer(
   DeviceMem filter, output;
   auto filter_size = params.k * params.n;
   filter = backend.allocate<T>(filter_size);
-  output = backend.allocate<T>(params.n);
 
   std::vector<char> weights(filter_size * sizeof(T));
   if (data_dir == "")
@@ -245,8 +239,6 @@ inline sycldnn::SoftmaxLayer<T, Backend>* create_softmax_layer(
     sycldnn::softmax::SoftmaxParams const& params) {
   DeviceMem workspace, output;
   workspace = backend.allocate<T>(params.batch * params.rows * params.cols);
-  output = backend.allocate<T>(params.batch * params.rows * params.cols *
-                               params.channels);
   return new sycldnn::SoftmaxLayer<T, Backend>(params, input, workspace, output,
                                                backend);
 }
@@ -497,6 +489,10 @@ int main(int argc, char* argv[]) {
   std::cout << "classed as " << std::distance(output.begin(), index)
             << ", value " << (index != std::end(output) ? *index : 0.f)
             << std::endl;
+  std::cout << "layer outputs use " << network.get_planned_memory()
+            << " bytes, rather than " << network.get_unplanned_memory()
+            << " bytes, with " << network.get_num_in_place_layers()
+            << " layers running in place\n";
 
   int loops = 8;
   do {
@@ -171,6 +171,40 @@ class BinaryOpVec {
   }
 };
 
+/**
+ * 1D kernel where the rhs operand is a single scalar, passed to the kernel as
+ * an argument rather than through device memory.
+ */
+template <typename T, typename Op, typename Index, int VectorWidth, bool IsUSM>
+class BinaryOpScalarRhsVec {
+  using DataT = typename helpers::VectorType<T, VectorWidth>::type;
+  using Load = helpers::io::Load<DataT>;
+  using Store = helpers::io::Store<DataT>;
+
+  ReadMem<T const, IsUSM> lhs_;
+  WriteMem<T, IsUSM> out_;
+  const T rhs_;
+  const Index size;
+
+ public:
+  BinaryOpScalarRhsVec(ReadMem<T const, IsUSM> lhs, T rhs,
+                       WriteMem<T, IsUSM> out)
+      : lhs_(lhs), out_(out), rhs_(rhs), size(out.get_extent()) {}
+
+  cl::sycl::range<1> get_range() { return {size_t(size / VectorWidth)}; }
+
+  SNN_ALWAYS_INLINE void operator()(cl::sycl::item<1> item) const {
+    Index idx = item.get_id(0) * VectorWidth;
+
+    const auto lhs = lhs_.get_pointer();
+    auto out = out_.get_pointer();
+
+    Op op;
+    auto lhs_val = Load()(lhs, idx);
+    Store()(out, idx, op(lhs_val, DataT(rhs_)));
+  }
+};
+
 /**
  * 2D kernel where the last lhs dimension is broadcasted.
  */
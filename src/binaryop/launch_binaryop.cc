@@ -182,12 +182,47 @@ SNNStatus launch_binaryop(MemObj<T const>& lhs, MemObj<T const>& rhs,
       events);
 }
 
+template <typename T, typename Op, int VectorWidth,
+          template <typename> class MemObj,
+          typename = std::enable_if<is_mem_obj_v<MemObj<T>, T>>>
+SNNStatus launch_scalar_kernel_with_vec_width(
+    MemObj<T const>& lhs, T rhs, MemObj<T>& out, cl::sycl::queue& queue,
+    const std::vector<cl::sycl::event>& events) {
+  constexpr bool is_usm = is_usm_obj_v<MemObj<T>, T>;
+  return queue_binaryop_scalar<
+      BinaryOpScalarRhsVec<T, Op, int, VectorWidth, is_usm>>(lhs, rhs, out,
+                                                             queue, events);
+}
+
+template <typename Op, typename T, template <typename> class MemObj>
+SNNStatus launch_binaryop_scalar(MemObj<T const>& lhs, T rhs, MemObj<T>& out,
+                                 cl::sycl::queue& queue,
+                                 const std::vector<cl::sycl::event>& events) {
+  SNN_VALIDATE_PARAM(lhs.get_extent() > 0, "Operand size cannot be zero.");
+  SNN_VALIDATE_PARAM(lhs.get_extent() == out.get_extent(),
+                     "Mismatching number of lhs and out elements");
+  size_t const size = out.get_extent();
+  if (size % 4 == 0) {
+    return launch_scalar_kernel_with_vec_width<T, Op, 4>(lhs, rhs, out, queue,
+                                                         events);
+  } else if (size % 2 == 0) {
+    return launch_scalar_kernel_with_vec_width<T, Op, 2>(lhs, rhs, out, queue,
+                                                         events);
+  } else {
+    return launch_scalar_kernel_with_vec_width<T, Op, 1>(lhs, rhs, out, queue,
+                                                         events);
+  }
+}
+
 #define INSTANTIATE_BINARYOP_LAUNCH(DTYPE, OP, MEMOBJ)                      \
   template SNN_EXPORT SNNStatus launch_binaryop<OP, DTYPE>(                 \
       MEMOBJ<DTYPE const> & inp1_access, MEMOBJ<DTYPE const> & inp2_access, \
       MEMOBJ<DTYPE> & outp_access, std::vector<int> lhs_dims,               \
       std::vector<int> rhs_dims, const std::vector<int>& out_dims,          \
-      cl::sycl::queue& queue, const std::vector<cl::sycl::event>& events);
+      cl::sycl::queue& queue, const std::vector<cl::sycl::event>& events); \
+  template SNN_EXPORT SNNStatus launch_binaryop_scalar<OP, DTYPE>(          \
+      MEMOBJ<DTYPE const> & lhs, DTYPE rhs, MEMOBJ<DTYPE> & out,            \
+      cl::sycl::queue & queue, const std::vector<cl::sycl::event>& events);
 
 #define INSTANTIATE_BINARYOP_FOR_TYPE(DTYPE, MEMOBJ) \
   INSTANTIATE_BINARYOP_LAUNCH(DTYPE, Add, MEMOBJ)    \
@@ -36,6 +36,11 @@ SNNStatus queue_binaryop(MemObj<T const>& lhs, MemObj<T const>& rhs,
                          cl::sycl::queue& queue,
                          const std::vector<cl::sycl::event>& events);
 
+template <typename Kernel, typename T, template <typename> class MemObj>
+SNNStatus queue_binaryop_scalar(MemObj<T const>& lhs, T rhs, MemObj<T>& out,
+                                cl::sycl::queue& queue,
+                                const std::vector<cl::sycl::event>& events);
+
 }  // namespace internal
 }  // namespace binaryop
 }  // namespace sycldnn
@@ -49,6 +49,21 @@ SNNStatus queue_binaryop(MemObj<T const>& lhs, MemObj<T const>& rhs,
   return {event, StatusCode::OK};
 }
 
+template <typename Kernel, typename T, template <typename> class MemObj>
+SNNStatus queue_binaryop_scalar(MemObj<T const>& lhs, T rhs, MemObj<T>& out,
+                                cl::sycl::queue& queue,
+                                const std::vector<cl::sycl::event>& events) {
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    cgh.depends_on(events);
+    auto lhs_mem = lhs.read_mem(cgh);
+    auto out_mem = out.write_mem(cgh);
+    Kernel binary_op(lhs_mem, rhs, out_mem);
+    cgh.parallel_for(binary_op.get_range(), binary_op);
+  });
+
+  return {event, StatusCode::OK};
+}
+
 }  // namespace internal
 }  // namespace binaryop
 }  // namespace sycldnn
@@ -16,6 +16,7 @@
 #ifndef SYCLDNN_SRC_CONV2D_DIRECT_KERNELS_H_
 #define SYCLDNN_SRC_CONV2D_DIRECT_KERNELS_H_
 
+#include "src/conv2d/epilogue/fused_epilogue.h"
 #include "src/helpers/math.h"
 #include "src/helpers/tensor_index.h"
 #include "src/helpers/vector_io.h"
@@ -30,7 +30,8 @@ struct DirectConv2D<T, Index, conv_type::Forward, UseFastDiv, StaticWindow,
   using IndexDivType = typename fast_div::IndexDiv<Index, UseFastDiv>::type;
 
   DirectConv2D(const Conv2DParams& params, const ReadMem<const T, isUSM> input,
-               const ReadMem<const T, isUSM> filter, WriteMem<T, isUSM> output)
+               const ReadMem<const T, isUSM> filter, WriteMem<T, isUSM> output,
+               FusedEpilogue<T, isUSM> epilogue)
       : n_elems_{params.batch * params.out_rows * params.out_cols *
                  params.features},
         div_features_{params.features},
@@ -49,9 +50,12 @@ struct DirectConv2D<T, Index, conv_type::Forward, UseFastDiv, StaticWindow,
         out_cols_{params.out_cols},
         pad_rows_{params.pad_rows},
         pad_cols_{params.pad_cols},
+                dilation_rows_{params.dilation_rows},
+        dilation_cols_{params.dilation_cols},
         input_mem_{input},
         filter_mem_{filter},
-        output_mem_{output} {}
+        output_mem_{output},
+        epilogue_{epilogue} {}
 
   inline SNN_ALWAYS_INLINE void operator()(cl::sycl::item<1> item) const {
     Index index = item.get_id(0);
@@ -98,13 +102,16 @@ struct DirectConv2D<T, Index, conv_type::Forward, UseFastDiv, StaticWindow,
         Index in_row_idx = in_chan_idx + rstart * in_cols_;
         Index fil_row_idx = fil_chan_idx + firstr * col_window;
         for (Index r = rstart, i = firstr; i < row_window;
-             ++r, ++i, in_row_idx += in_cols_, fil_row_idx += col_window) {
+             r += dilation_rows_, ++i,
+                   in_row_idx += dilation_rows_ * in_cols_,
+                   fil_row_idx += col_window) {
           if (r >= 0 && r < in_rows_) {
             Index in_col_idx = in_row_idx + cstart;
             Index fil_col_idx = fil_row_idx + firstc;
 
             for (Index c = cstart, j = firstc; j < col_window;
-                 ++c, ++j, ++in_col_idx, ++fil_col_idx) {
+                 c += dilation_cols_, ++j, in_col_idx += dilation_cols_,
+                       ++fil_col_idx) {
               if (c >= 0 && c < in_cols_) {
                 T in_val = input_data_n[in_col_idx];
                 T fil_val = filter_data_n[fil_col_idx];
@@ -115,7 +122,7 @@ struct DirectConv2D<T, Index, conv_type::Forward, UseFastDiv, StaticWindow,
         }  // row loop
       }    // channel loop
 
-      output_data[index] = out_val;
+      output_data[index] = epilogue_.apply(out_val, index, feature);
     }
   }
 
@@ -148,9 +155,12 @@ struct DirectConv2D<T, Index, conv_type::Forward, UseFastDiv, StaticWindow,
   const Index out_cols_;
   const Index pad_rows_;
   const Index pad_cols_;
+  const Index dilation_rows_;
+  const Index dilation_cols_;
   const ReadMem<const T, isUSM> input_mem_;
   const ReadMem<const T, isUSM> filter_mem_;
   WriteMem<T, isUSM> output_mem_;
+  const FusedEpilogue<T, isUSM> epilogue_;
 };
 template <typename T, typename Index, bool UseFastDiv, int StaticWindow,
           int StaticStride, bool isUSM>
@@ -181,6 +191,8 @@ struct DirectConv2D<T, Index, conv_type::InputBackprop, UseFastDiv,
                   1},
         pad_cols_{static_window_param(params.window_cols) - params.pad_cols -
                   1},
+                dilation_rows_{params.dilation_rows},
+        dilation_cols_{params.dilation_cols},
         input_mem_{input},
         filter_mem_{filter},
         output_mem_{output} {}
@@ -203,6 +215,12 @@ struct DirectConv2D<T, Index, conv_type::InputBackprop, UseFastDiv,
       const Index feature = tensor_idx.s1;
       const Index batch = tensor_idx.s0;
 
+      if (dilation_rows_ != 1 || dilation_cols_ != 1) {
+        output_data[index] = dilated_value(input_data, filter_data, batch,
+                                           row_idx, col_idx, feature);
+        continue;
+      }
+
       const Index col_stride = static_stride_param(stride_cols_);
       const auto col_window_struct =
           helpers::out_window_from_input(col_idx, col_stride, pad_cols_);
@@ -264,6 +282,56 @@ struct DirectConv2D<T, Index, conv_type::InputBackprop, UseFastDiv,
     return (StaticStride > 0 ? StaticStride : stride);
   }
 
+  /**
+   * Compute the input backprop value for a dilated convolution. The filter
+   * element k in the window for output index o covers the input index
+   * (o * stride - pad + k * dilation), so for each filter element check
+   * whether there is an output which uses this input index.
+   */
+  inline SNN_ALWAYS_INLINE T dilated_value(T const* input_data,
+                                           T const* filter_data, Index batch,
+                                           Index row_idx, Index col_idx,
+                                           Index feature) const {
+    const Index row_stride = static_stride_param(stride_rows_);
+    const Index col_stride = static_stride_param(stride_cols_);
+    const Index row_window = static_window_param(window_rows_);
+    const Index col_window = static_window_param(window_cols_);
+    // pad_rows_ and pad_cols_ hold the padding in the output space, so
+    // convert back to the input padding.
+    const Index in_pad_rows = row_window - 1 - pad_rows_;
+    const Index in_pad_cols = col_window - 1 - pad_cols_;
+
+    const auto input_data_n =
+        input_data + batch * channels_ * out_cols_ * out_rows_;
+    const auto filter_data_n = filter_data + feature * row_window * col_window;
+
+    T out_val{0};
+    for (Index i = 0; i < row_window; ++i) {
+      const Index padded_r = row_idx + in_pad_rows - i * dilation_rows_;
+      const Index r = padded_r / row_stride;
+      if (padded_r < 0 || padded_r % row_stride != 0 || r >= out_rows_) {
+        continue;
+      }
+      for (Index j = 0; j < col_window; ++j) {
+        const Index padded_c = col_idx + in_pad_cols - j * dilation_cols_;
+        const Index c = padded_c / col_stride;
+        if (padded_c < 0 || padded_c % col_stride != 0 || c >= out_cols_) {
+          continue;
+        }
+        Index in_idx = r * out_cols_ + c;
+        Index fil_idx = i * col_window + j;
+        for (Index channel = 0; channel < channels_; ++channel,
+                   in_idx += out_cols_ * out_rows_,
+                   fil_idx += features_ * row_window * col_window) {
+          T in_val = input_data_n[in_idx];
+          T fil_val = filter_data_n[fil_idx];
+          out_val = helpers::math::mad(in_val, fil_val, out_val);
+        }  // channel loop
+      }
+    }
+    return out_val;
+  }
+
   const Index n_elems_;
   const IndexDivType div_features_;
   const IndexDivType div_in_cols_;
@@ -281,6 +349,8 @@ struct DirectConv2D<T, Index, conv_type::InputBackprop, UseFastDiv,
   const Index out_cols_;
   const Index pad_rows_;
   const Index pad_cols_;
+  const Index dilation_rows_;
+  const Index dilation_cols_;
   const ReadMem<const T, isUSM> input_mem_;
   const ReadMem<const T, isUSM> filter_mem_;
   WriteMem<T, isUSM> output_mem_;
@@ -321,6 +391,8 @@ struct DirectConv2D<T, Index, conv_type::FilterBackprop, UseFastDiv, StaticOut,
         out_cols_{params.out_cols},
         pad_rows_{params.pad_rows},
         pad_cols_{params.pad_cols},
+                dilation_rows_{params.dilation_rows},
+        dilation_cols_{params.dilation_cols},
         input_mem_{input},
         filter_mem_{filter},
         output_mem_{output} {}
@@ -345,9 +417,9 @@ struct DirectConv2D<T, Index, conv_type::FilterBackprop, UseFastDiv, StaticOut,
       const Index channel = tensor_idx.s1;
       const Index feature = tensor_idx.s0;
 
-      const Index cstart = col_idx - pad_cols_;
+      const Index cstart = col_idx * dilation_cols_ - pad_cols_;
       const Index cend = cstart + window_cols_;
-      const Index rstart = row_idx - pad_rows_;
+      const Index rstart = row_idx * dilation_rows_ - pad_rows_;
       const Index rend = rstart + window_rows_;
 
       const Index row_stride = static_stride_param(stride_rows_);
@@ -417,6 +489,8 @@ struct DirectConv2D<T, Index, conv_type::FilterBackprop, UseFastDiv, StaticOut,
   const Index out_cols_;
   const Index pad_rows_;
   const Index pad_cols_;
+  const Index dilation_rows_;
+  const Index dilation_cols_;
   const ReadMem<const T, isUSM> input_mem_;
   const ReadMem<const T, isUSM> filter_mem_;
   WriteMem<T, isUSM> output_mem_;
@@ -17,11 +17,19 @@
 #define SYCLDNN_SRC_CONV2D_DIRECT_KERNELS_NHWC_H_
 
 #include "src/conv2d/direct/kernels.h"
+#include "src/helpers/group_index.h"
 
 namespace sycldnn {
 namespace conv2d {
 namespace internal {
 namespace direct {
+/*
+ * The NHWC kernels support grouped convolutions with an HWCF filter. Each
+ * output only depends on the channels in its group, and the filter only holds
+ * the channels for a single group, so the channel loops and filter strides use
+ * the number of channels in a group. Any vector of features is contained in a
+ * single group.
+ */
 template <typename T, typename Index, bool UseFastDiv, int StaticWindow,
           int StaticStride, int VectorWidth, bool isUSM>
 struct DirectConv2D<T, Index, conv_type::Forward, UseFastDiv, StaticWindow,
@@ -36,7 +44,8 @@ struct DirectConv2D<T, Index, conv_type::Forward, UseFastDiv, StaticWindow,
   using StoreData = helpers::io::Store<DataType>;
 
   DirectConv2D(const Conv2DParams& params, const ReadMem<const T, isUSM> input,
-               const ReadMem<const T, isUSM> filter, WriteMem<T, isUSM> output)
+               const ReadMem<const T, isUSM> filter, WriteMem<T, isUSM> output,
+               FusedEpilogue<T, isUSM> epilogue)
       : n_elems_{params.batch * params.out_rows * params.out_cols *
                  params.features / VectorWidth},
         div_features_{params.features / VectorWidth},
@@ -55,9 +64,14 @@ struct DirectConv2D<T, Index, conv_type::Forward, UseFastDiv, StaticWindow,
         out_cols_{params.out_cols},
         pad_rows_{params.pad_rows},
         pad_cols_{params.pad_cols},
+        dilation_rows_{params.dilation_rows},
+        dilation_cols_{params.dilation_cols},
+        group_index_{params.groups, params.channels, params.features,
+                     params.group_format},
         input_mem_{input},
         filter_mem_{filter},
-        output_mem_{output} {}
+        output_mem_{output},
+        epilogue_{epilogue} {}
 
   inline SNN_ALWAYS_INLINE void operator()(cl::sycl::item<1> item) const {
     Index index = item.get_id(0);
@@ -91,30 +105,36 @@ struct DirectConv2D<T, Index, conv_type::Forward, UseFastDiv, StaticWindow,
 
       DataType out_val{0};
 
-      const auto input_data_n =
-          input_data + batch * in_cols_ * in_rows_ * channels_;
+      const Index group = group_index_.group_of_feature(feature);
+      const Index group_channels = group_index_.channels;
+      const Index channel_stride = group_index_.stride();
+      const auto input_data_n = input_data +
+                                batch * in_cols_ * in_rows_ * channels_ +
+                                group_index_.first_channel(group);
       const auto filter_data_n = filter_data + feature;
       const Index row_window = static_window_param(window_rows_);
       const Index col_window = static_window_param(window_cols_);
 
       Index in_row_idx = rstart * in_cols_ * channels_;
-      Index fil_row_idx = firstr * col_window * channels_ * features_;
-      for (Index r = rstart, i = firstr; i < row_window; ++r, ++i,
-                 in_row_idx += in_cols_ * channels_,
-                 fil_row_idx += col_window * channels_ * features_) {
+      Index fil_row_idx = firstr * col_window * group_channels * features_;
+      for (Index r = rstart, i = firstr; i < row_window;
+           r += dilation_rows_, ++i,
+                 in_row_idx += dilation_rows_ * in_cols_ * channels_,
+                 fil_row_idx += col_window * group_channels * features_) {
         if (r >= 0 && r < in_rows_) {
           Index in_col_idx = in_row_idx + cstart * channels_;
-          Index fil_col_idx = fil_row_idx + firstc * channels_ * features_;
+          Index fil_col_idx = fil_row_idx + firstc * group_channels * features_;
 
-          for (Index c = cstart, j = firstc; j < col_window; ++c, ++j,
-                     in_col_idx += channels_,
-                     fil_col_idx += channels_ * features_) {
+          for (Index c = cstart, j = firstc; j < col_window;
+               c += dilation_cols_, ++j,
+                     in_col_idx += dilation_cols_ * channels_,
+                     fil_col_idx += group_channels * features_) {
             if (c >= 0 && c < in_cols_) {
               Index idx = in_col_idx;
               Index k_idx = fil_col_idx;
 
-              for (Index channel = 0; channel < channels_;
-                   ++channel, ++idx, k_idx += features_) {
+              for (Index channel = 0; channel < group_channels; ++channel,
+                         idx += channel_stride, k_idx += features_) {
                 DataType in_val = DataType{LoadScalar()(input_data_n, idx)};
                 DataType fil_vals = LoadData()(filter_data_n, k_idx);
 
@@ -125,7 +145,8 @@ struct DirectConv2D<T, Index, conv_type::Forward, UseFastDiv, StaticWindow,
         }
       }  // row loop
 
-      StoreData()(output_data, index * VectorWidth, out_val);
+      StoreData()(output_data, index * VectorWidth,
+                  epilogue_.apply(out_val, index * VectorWidth, feature));
     }
   }
 
@@ -158,9 +179,13 @@ struct DirectConv2D<T, Index, conv_type::Forward, UseFastDiv, StaticWindow,
   const Index out_cols_;
   const Index pad_rows_;
   const Index pad_cols_;
+  const Index dilation_rows_;
+  const Index dilation_cols_;
+  const helpers::GroupIndex<Index> group_index_;
   const ReadMem<const T, isUSM> input_mem_;
   const ReadMem<const T, isUSM> filter_mem_;
   WriteMem<T, isUSM> output_mem_;
+  const FusedEpilogue<T, isUSM> epilogue_;
 };
 template <typename T, typename Index, bool UseFastDiv, int StaticWindow,
           int StaticStride, int VectorWidth, bool isUSM>
@@ -199,6 +224,12 @@ struct DirectConv2D<T, Index, conv_type::InputBackprop, UseFastDiv,
                   1},
         pad_cols_{static_window_param(params.window_cols) - params.pad_cols -
                   1},
+        dilation_rows_{params.dilation_rows},
+        dilation_cols_{params.dilation_cols},
+        // The kernel parameters swap the channels and features, so swap them
+        // back to index the groups.
+        group_index_{params.groups, params.features, params.channels,
+                     params.group_format},
         input_mem_{input},
         filter_mem_{filter},
         output_mem_{output} {}
@@ -221,6 +252,13 @@ struct DirectConv2D<T, Index, conv_type::InputBackprop, UseFastDiv,
       const Index row_idx = tensor_idx.s1;
       const Index batch = tensor_idx.s0;
 
+      if (dilation_rows_ != 1 || dilation_cols_ != 1) {
+        StoreScalar()(output_data, index,
+                      dilated_value(input_data, filter_data, batch, row_idx,
+                                    col_idx, feature));
+        continue;
+      }
+
       const Index col_stride = static_stride_param(stride_cols_);
       const auto col_window_struct =
           helpers::out_window_from_input(col_idx, col_stride, pad_cols_);
@@ -235,34 +273,40 @@ struct DirectConv2D<T, Index, conv_type::InputBackprop, UseFastDiv,
 
       ScalarType out_val{0};
 
-      const auto input_data_n =
-          input_data + batch * out_cols_ * out_rows_ * channels_;
-      const auto filter_data_n = filter_data + feature * channels_;
+      const Index group = group_index_.group_of_channel(feature);
+      const Index group_features = group_index_.features;
+      const Index filter_pixel_size = group_index_.channels * channels_;
+      const Index vector_stride = VectorWidth * group_index_.stride();
+      const auto input_data_n = input_data +
+                                batch * out_cols_ * out_rows_ * channels_ +
+                                group_index_.first_feature(group);
+      const auto filter_data_n =
+          filter_data + group_index_.channel_in_group(feature) * channels_ +
+          group_index_.first_feature(group);
       const Index row_window = static_window_param(window_rows_);
       const Index col_window = static_window_param(window_cols_);
 
       Index in_row_idx = rstart * out_cols_ * channels_;
       Index fil_row_idx =
-          (row_window - firstr - 1) * col_window * features_ * channels_;
+          (row_window - firstr - 1) * col_window * filter_pixel_size;
       for (Index r = rstart, i = firstr; i < row_window; ++r, i += row_stride,
                  in_row_idx += out_cols_ * channels_,
-                 fil_row_idx -= row_stride * col_window * features_ *
-                                                         channels_) {
+                 fil_row_idx -= row_stride * col_window * filter_pixel_size) {
         if (r >= 0 && r < out_rows_) {
           Index in_col_idx = in_row_idx + cstart * channels_;
           Index fil_col_idx =
-              fil_row_idx + (col_window - firstc - 1) * features_ * channels_;
+              fil_row_idx + (col_window - firstc - 1) * filter_pixel_size;
 
           for (Index c = cstart, j = firstc; j < col_window; ++c,
                      j += col_stride, in_col_idx += channels_,
-                     fil_col_idx -= col_stride * features_ * channels_) {
+                     fil_col_idx -= col_stride * filter_pixel_size) {
             if (c >= 0 && c < out_cols_) {
               Index idx = in_col_idx;
               Index k_idx = fil_col_idx;
 
-              for (Index channel = 0; channel < channels_;
-                   channel += VectorWidth, idx += VectorWidth,
-                         k_idx += VectorWidth) {
+              for (Index channel = 0; channel < group_features;
+                   channel += VectorWidth, idx += vector_stride,
+                         k_idx += vector_stride) {
                 DataType in_val = LoadData()(input_data_n, idx);
                 DataType fil_val = LoadData()(filter_data_n, k_idx);
 
@@ -285,6 +329,66 @@ struct DirectConv2D<T, Index, conv_type::InputBackprop, UseFastDiv,
     return (StaticStride > 0 ? StaticStride : stride);
   }
 
+  /**
+   * Compute the input backprop value for a dilated convolution. The filter
+   * element k in the window for output index o covers the input index
+   * (o * stride - pad + k * dilation), so for each filter element check
+   * whether there is an output which uses this input index.
+   */
+  template <typename InputPointer, typename FilterPointer>
+  inline SNN_ALWAYS_INLINE ScalarType dilated_value(InputPointer input_data,
+                                                    FilterPointer filter_data,
+                                                    Index batch, Index row_idx,
+                                                    Index col_idx,
+                                                    Index feature) const {
+    const Index row_stride = static_stride_param(stride_rows_);
+    const Index col_stride = static_stride_param(stride_cols_);
+    const Index row_window = static_window_param(window_rows_);
+    const Index col_window = static_window_param(window_cols_);
+    // pad_rows_ and pad_cols_ hold the padding in the output space, so
+    // convert back to the input padding.
+    const Index in_pad_rows = row_window - 1 - pad_rows_;
+    const Index in_pad_cols = col_window - 1 - pad_cols_;
+
+    const Index group = group_index_.group_of_channel(feature);
+    const Index group_features = group_index_.features;
+    const Index filter_pixel_size = group_index_.channels * channels_;
+    const Index vector_stride = VectorWidth * group_index_.stride();
+    const auto input_data_n = input_data +
+                              batch * out_cols_ * out_rows_ * channels_ +
+                              group_index_.first_feature(group);
+    const auto filter_data_n =
+        filter_data + group_index_.channel_in_group(feature) * channels_ +
+        group_index_.first_feature(group);
+
+    ScalarType out_val{0};
+    for (Index i = 0; i < row_window; ++i) {
+      const Index padded_r = row_idx + in_pad_rows - i * dilation_rows_;
+      const Index r = padded_r / row_stride;
+      if (padded_r < 0 || padded_r % row_stride != 0 || r >= out_rows_) {
+        continue;
+      }
+      for (Index j = 0; j < col_window; ++j) {
+        const Index padded_c = col_idx + in_pad_cols - j * dilation_cols_;
+        const Index c = padded_c / col_stride;
+        if (padded_c < 0 || padded_c % col_stride != 0 || c >= out_cols_) {
+          continue;
+        }
+        Index idx = (r * out_cols_ + c) * channels_;
+        Index k_idx = (i * col_window + j) * filter_pixel_size;
+        for (Index channel = 0; channel < group_features;
+             channel += VectorWidth, idx += vector_stride,
+                   k_idx += vector_stride) {
+          DataType in_val = LoadData()(input_data_n, idx);
+          DataType fil_val = LoadData()(filter_data_n, k_idx);
+
+          out_val += helpers::math::dot(in_val, fil_val);
+        }  // channel loop
+      }
+    }
+    return out_val;
+  }
+
   const Index n_elems_;
   const IndexDivType div_features_;
   const IndexDivType div_in_cols_;
@@ -302,6 +406,9 @@ struct DirectConv2D<T, Index, conv_type::InputBackprop, UseFastDiv,
   const Index out_cols_;
   const Index pad_rows_;
   const Index pad_cols_;
+  const Index dilation_rows_;
+  const Index dilation_cols_;
+  const helpers::GroupIndex<Index> group_index_;
   const ReadMem<const T, isUSM> input_mem_;
   const ReadMem<const T, isUSM> filter_mem_;
   WriteMem<T, isUSM> output_mem_;
@@ -331,10 +438,11 @@ struct DirectConv2D<T, Index, conv_type::FilterBackprop, UseFastDiv, StaticOut,
 
   DirectConv2D(const Conv2DParams& params, const ReadMem<const T, isUSM> input,
                const ReadMem<const T, isUSM> filter, WriteMem<T, isUSM> output)
-      : n_elems_{params.out_rows * params.out_cols * params.channels *
-                 params.features / VectorWidth},
+      : n_elems_{params.out_rows * params.out_cols *
+                 (params.channels / params.groups) * params.features /
+                 VectorWidth},
         div_features_{params.features / VectorWidth},
-        div_channels_{params.channels},
+        div_channels_{params.channels / params.groups},
         div_out_cols_{params.out_cols},
         channels_{params.channels},
         features_{params.features},
@@ -349,6 +457,10 @@ struct DirectConv2D<T, Index, conv_type::FilterBackprop, UseFastDiv, StaticOut,
         out_cols_{params.out_cols},
         pad_rows_{params.pad_rows},
         pad_cols_{params.pad_cols},
+        dilation_rows_{params.dilation_rows},
+        dilation_cols_{params.dilation_cols},
+        group_index_{params.groups, params.channels, params.features,
+                     params.group_format},
         input_mem_{input},
         filter_mem_{filter},
         output_mem_{output} {}
@@ -365,16 +477,19 @@ struct DirectConv2D<T, Index, conv_type::FilterBackprop, UseFastDiv, StaticOut,
       const Index col_out = static_out_param(out_cols_);
       const auto tensor_idx =
           helpers::TensorIndexHelper<Index, UseFastDiv>::unflatten4d(
-              index, div_out_cols_, col_out, div_channels_, channels_,
-              div_features_, features_ / VectorWidth);
+              index, div_out_cols_, col_out, div_channels_,
+              group_index_.channels, div_features_, features_ / VectorWidth);
       const Index feature = tensor_idx.s3 * VectorWidth;
-      const Index channel = tensor_idx.s2;
+      // The filter only holds the channels in the feature's group.
+      const Index group = group_index_.group_of_feature(feature);
+      const Index channel = group_index_.first_channel(group) +
+                            tensor_idx.s2 * group_index_.stride();
       const Index col_idx = tensor_idx.s1;
       const Index row_idx = tensor_idx.s0;
 
-      const Index cstart = col_idx - pad_cols_;
+      const Index cstart = col_idx * dilation_cols_ - pad_cols_;
       const Index cend = cstart + window_cols_;
-      const Index rstart = row_idx - pad_rows_;
+      const Index rstart = row_idx * dilation_rows_ - pad_rows_;
       const Index rend = rstart + window_rows_;
 
       const Index row_stride = static_stride_param(stride_rows_);
@@ -444,6 +559,9 @@ struct DirectConv2D<T, Index, conv_type::FilterBackprop, UseFastDiv, StaticOut,
   const Index out_cols_;
   const Index pad_rows_;
   const Index pad_cols_;
+  const Index dilation_rows_;
+  const Index dilation_cols_;
+  const helpers::GroupIndex<Index> group_index_;
   const ReadMem<const T, isUSM> input_mem_;
   const ReadMem<const T, isUSM> filter_mem_;
   WriteMem<T, isUSM> output_mem_;
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 #include "sycldnn/internal/conv2d/direct.h"
+#include "sycldnn/internal/conv2d/epilogue.h"
 
 #include "sycldnn/format_type.h"
 #include "sycldnn/mem_object.h"
@@ -57,8 +58,8 @@ inline bool can_use_fast_div<conv_type::InputBackprop>(
 template <>
 inline bool can_use_fast_div<conv_type::FilterBackprop>(
     Conv2DParams const& params, int vec_width) {
-  return (params.features / vec_width) != 1 && params.channels != 1 &&
-         params.out_cols != 1;
+  return (params.features / vec_width) != 1 &&
+         (params.channels / params.groups) != 1 && params.out_cols != 1;
 }
 /**
  * Check whether the provided window and stride can be used with the given
@@ -75,13 +76,18 @@ inline bool can_use_static_conv(Conv2DParams const& params, int const window,
  * Check whether a given vector width can be used for the given convolution.
  *
  * Expects the convolution parameters to be the original parameters, not the
- * kernel parameters.
+ * kernel parameters. The vectors are loaded along the features, so for grouped
+ * convolutions each vector must lie within a single group.
  * */
 template <typename ConvType>
 inline bool can_use_vector_width(Conv2DParams const& params, int const width) {
+  if (params.groups > 1 &&
+      params.group_format == sycldnn::BatchFormat::INTERLEAVED) {
+    return width == 1;
+  }
   return params.input_format == DataFormat::NHWC &&
          params.filter_format == FilterFormat::HWCF &&
-         params.features % width == 0;
+         (params.features / params.groups) % width == 0;
 }
 
 /**
@@ -92,7 +98,8 @@ template <typename T, typename Index, typename ConvType, bool UseFastDiv,
           template <typename> class MemObj>
 struct queue_kernel_helper {
   SNNStatus operator()(MemObj<T const>&, MemObj<T const>&, MemObj<T>&,
-                       Conv2DParams const&, Index, cl::sycl::queue&,
+                       EpilogueMem<T, MemObj>&, Conv2DParams const&, Index,
+                       cl::sycl::queue&,
                        const std::vector<cl::sycl::event>& events) {
     SNN_UNUSED_VAR(events)
     return StatusCode::InvalidAlgorithm;
@@ -105,12 +112,13 @@ template <typename T, typename Index, typename ConvType, bool UseFastDiv,
 struct queue_kernel_helper<T, Index, ConvType, UseFastDiv, Window, Stride,
                            VectorWidth, layout::NHWC, MemObj> {
   SNNStatus operator()(MemObj<T const>& input, MemObj<T const>& filter,
-                       MemObj<T>& output, Conv2DParams const& params,
-                       Index output_size, cl::sycl::queue& queue,
+                       MemObj<T>& output, EpilogueMem<T, MemObj>& epilogue,
+                       Conv2DParams const& params, Index output_size,
+                       cl::sycl::queue& queue,
                        const std::vector<cl::sycl::event>& events) {
     return queue_direct_kernel<T, Index, ConvType, UseFastDiv, Window, Stride,
                                VectorWidth, layout::NHWC, MemObj>(
-        input, filter, output, params, output_size, queue, events);
+        input, filter, output, epilogue, params, output_size, queue, events);
   }
 };
 
@@ -120,12 +128,13 @@ template <typename T, typename Index, typename ConvType, bool UseFastDiv,
 struct queue_kernel_helper<T, Index, ConvType, UseFastDiv, Window, Stride, 1,
                            layout::NCHW, MemObj> {
   SNNStatus operator()(MemObj<T const>& input, MemObj<T const>& filter,
-                       MemObj<T>& output, Conv2DParams const& params,
-                       Index output_size, cl::sycl::queue& queue,
+                       MemObj<T>& output, EpilogueMem<T, MemObj>& epilogue,
+                       Conv2DParams const& params, Index output_size,
+                       cl::sycl::queue& queue,
                        const std::vector<cl::sycl::event>& events) {
     return queue_direct_kernel<T, Index, ConvType, UseFastDiv, Window, Stride,
                                /*VectorWidth=*/1, layout::NCHW, MemObj>(
-        input, filter, output, params, output_size, queue, events);
+        input, filter, output, epilogue, params, output_size, queue, events);
   }
 };
 #endif
@@ -134,19 +143,22 @@ template <typename T, typename Index, typename ConvType, bool UseFastDiv,
           int Window, int Stride, int VectorWidth,
           template <typename> class MemObj>
 SNNStatus launch_with_fast_div(MemObj<T const>& input, MemObj<T const>& filter,
-                               MemObj<T>& output, Conv2DParams const& params,
-                               Index output_size, cl::sycl::queue& queue,
+                               MemObj<T>& output,
+                               EpilogueMem<T, MemObj>& epilogue,
+                               Conv2DParams const& params, Index output_size,
+                               cl::sycl::queue& queue,
                                const std::vector<cl::sycl::event>& events) {
+  // Grouped convolutions are only supported by the NHWC kernels.
   if (params.input_format == DataFormat::NCHW &&
-      params.filter_format == FilterFormat::FCHW) {
+      params.filter_format == FilterFormat::FCHW && params.groups == 1) {
     return queue_kernel_helper<T, Index, ConvType, UseFastDiv, Window, Stride,
                                VectorWidth, layout::NCHW, MemObj>()(
-        input, filter, output, params, output_size, queue, events);
+        input, filter, output, epilogue, params, output_size, queue, events);
   } else if (params.input_format == DataFormat::NHWC &&
              params.filter_format == FilterFormat::HWCF) {
     return queue_kernel_helper<T, Index, ConvType, UseFastDiv, Window, Stride,
                                VectorWidth, layout::NHWC, MemObj>()(
-        input, filter, output, params, output_size, queue, events);
+        input, filter, output, epilogue, params, output_size, queue, events);
   }
   return StatusCode::InvalidAlgorithm;
 }
@@ -158,18 +170,22 @@ SNNStatus launch_with_fast_div(MemObj<T const>& input, MemObj<T const>& filter,
 template <typename T, typename Index, typename ConvType, int Window, int Stride,
           int VectorWidth, template <typename> class MemObj>
 SNNStatus launch_with_vector(MemObj<T const>& input, MemObj<T const>& filter,
-                             MemObj<T>& output, Conv2DParams const& params,
-                             Index output_size, cl::sycl::queue& queue,
+                             MemObj<T>& output,
+                             EpilogueMem<T, MemObj>& epilogue,
+                             Conv2DParams const& params, Index output_size,
+                             cl::sycl::queue& queue,
                              const std::vector<cl::sycl::event>& events) {
   auto kernel_params = direct::get_kernel_params<ConvType>(params);
   if (can_use_fast_div<ConvType>(kernel_params, VectorWidth)) {
     return launch_with_fast_div<T, Index, ConvType, true, Window, Stride,
                                 VectorWidth, MemObj>(
-        input, filter, output, kernel_params, output_size, queue, events);
+        input, filter, output, epilogue, kernel_params, output_size, queue,
+        events);
   } else {
     return launch_with_fast_div<T, Index, ConvType, false, Window, Stride,
                                 VectorWidth, MemObj>(
-        input, filter, output, kernel_params, output_size, queue, events);
+        input, filter, output, epilogue, kernel_params, output_size, queue,
+        events);
   }
 }
 
@@ -180,18 +196,19 @@ SNNStatus launch_with_vector(MemObj<T const>& input, MemObj<T const>& filter,
 template <typename T, typename Index, typename ConvType, int Window, int Stride,
           template <typename> class MemObj>
 SNNStatus launch_with_index(MemObj<T const>& input, MemObj<T const>& filter,
-                            MemObj<T>& output, Conv2DParams const& params,
-                            Index output_size, cl::sycl::queue& queue,
+                            MemObj<T>& output, EpilogueMem<T, MemObj>& epilogue,
+                            Conv2DParams const& params, Index output_size,
+                            cl::sycl::queue& queue,
                             const std::vector<cl::sycl::event>& events) {
   if (can_use_vector_width<ConvType>(params, 4)) {
     return launch_with_vector<T, Index, ConvType, Window, Stride, 4, MemObj>(
-        input, filter, output, params, output_size, queue, events);
+        input, filter, output, epilogue, params, output_size, queue, events);
   } else if (can_use_vector_width<ConvType>(params, 2)) {
     return launch_with_vector<T, Index, ConvType, Window, Stride, 2, MemObj>(
-        input, filter, output, params, output_size, queue, events);
+        input, filter, output, epilogue, params, output_size, queue, events);
   } else {
     return launch_with_vector<T, Index, ConvType, Window, Stride, 1, MemObj>(
-        input, filter, output, params, output_size, queue, events);
+        input, filter, output, epilogue, params, output_size, queue, events);
   }
 }
 
@@ -203,6 +220,7 @@ template <typename T, typename ConvType, int Window, int Stride,
           template <typename> class MemObj>
 SNNStatus launch_with_static_sizes(MemObj<T const>& input,
                                    MemObj<T const>& filter, MemObj<T>& output,
+                                   EpilogueMem<T, MemObj>& epilogue,
                                    Conv2DParams const& params,
                                    cl::sycl::queue& queue,
                                    const std::vector<cl::sycl::event>& events) {
@@ -211,15 +229,15 @@ SNNStatus launch_with_static_sizes(MemObj<T const>& input,
   if (output_size > static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
 #ifdef SNN_USE_INT64
     return launch_with_index<T, int64_t, ConvType, Window, Stride, MemObj>(
-        input, filter, output, params, static_cast<int64_t>(output_size), queue,
-        events);
+        input, filter, output, epilogue, params,
+        static_cast<int64_t>(output_size), queue, events);
 #else
     return StatusCode::IndexExceeded;
 #endif  // SNN_USE_INT64
   } else {
     return launch_with_index<T, int32_t, ConvType, Window, Stride, MemObj>(
-        input, filter, output, params, static_cast<int32_t>(output_size), queue,
-        events);
+        input, filter, output, epilogue, params,
+        static_cast<int32_t>(output_size), queue, events);
   }
 }
 }  // namespace
@@ -230,38 +248,39 @@ SNNStatus launch_with_static_sizes(MemObj<T const>& input,
  */
 template <typename T, typename ConvType, template <typename> class MemObj>
 SNNStatus launch_direct(MemObj<T const>& input, MemObj<T const>& filter,
-                        MemObj<T>& output, Conv2DParams const& params,
-                        cl::sycl::queue& queue,
+                        MemObj<T>& output, EpilogueMem<T, MemObj>& epilogue,
+                        Conv2DParams const& params, cl::sycl::queue& queue,
                         const std::vector<cl::sycl::event>& events) {
 #ifdef SNN_CONV2D_STATIC_DIRECT
   if (can_use_static_conv<ConvType>(params, 1, 1)) {
     return launch_with_static_sizes<T, ConvType, 1, 1, MemObj>(
-        input, filter, output, params, queue, events);
+        input, filter, output, epilogue, params, queue, events);
   } else if (can_use_static_conv<ConvType>(params, 3, 1)) {
     return launch_with_static_sizes<T, ConvType, 3, 1, MemObj>(
-        input, filter, output, params, queue, events);
+        input, filter, output, epilogue, params, queue, events);
   } else if (can_use_static_conv<ConvType>(params, 3, 2)) {
     return launch_with_static_sizes<T, ConvType, 3, 2, MemObj>(
-        input, filter, output, params, queue, events);
+        input, filter, output, epilogue, params, queue, events);
   } else if (can_use_static_conv<ConvType>(params, 5, 1)) {
     return launch_with_static_sizes<T, ConvType, 5, 1, MemObj>(
-        input, filter, output, params, queue, events);
+        input, filter, output, epilogue, params, queue, events);
   } else if (can_use_static_conv<ConvType>(params, 5, 2)) {
     return launch_with_static_sizes<T, ConvType, 5, 2, MemObj>(
-        input, filter, output, params, queue, events);
+        input, filter, output, epilogue, params, queue, events);
   } else
 #endif  // SNN_CONV2D_STATIC_DIRECT
   {
     return launch_with_static_sizes<T, ConvType, 0, 0, MemObj>(
-        input, filter, output, params, queue, events);
+        input, filter, output, epilogue, params, queue, events);
   }
 }
 
-#define INSTANTIATE_LAUNCHER(DTYPE, DIR, MEMOBJ)                   \
-  template SNN_EXPORT SNNStatus launch_direct<DTYPE, DIR, MEMOBJ>( \
-      MEMOBJ<DTYPE const> & input, MEMOBJ<DTYPE const> & filter,   \
-      MEMOBJ<DTYPE> & output, Conv2DParams const& params,          \
-      cl::sycl::queue& queue, const std::vector<cl::sycl::event>& events)
+#define INSTANTIATE_LAUNCHER(DTYPE, DIR, MEMOBJ)                     \
+  template SNN_EXPORT SNNStatus launch_direct<DTYPE, DIR, MEMOBJ>(   \
+      MEMOBJ<DTYPE const> & input, MEMOBJ<DTYPE const> & filter,     \
+      MEMOBJ<DTYPE> & output, EpilogueMem<DTYPE, MEMOBJ> & epilogue, \
+      Conv2DParams const& params, cl::sycl::queue& queue,            \
+      const std::vector<cl::sycl::event>& events)
 
 #ifdef SNN_ENABLE_USM
 #define INSTANTIATE_FOR_MEMOBJ(DTYPE, DIR)        \
@@ -24,6 +24,7 @@
 #include "src/conv2d/direct/kernels_nchw.h"
 #include "src/conv2d/direct/kernels_nhwc.h"
 #include "src/conv2d/direct/queue_direct_kernel.h"
+#include "src/conv2d/epilogue/fused_epilogue.h"
 
 namespace sycldnn {
 namespace conv2d {
@@ -43,6 +44,7 @@ template <typename T, typename Index, typename ConvType, bool UseFastDiv,
           template <typename> class MemObj>
 SNNStatus queue_direct_kernel(MemObj<T const>& in_mem, MemObj<T const>& fil_mem,
                               MemObj<T>& out_mem,
+                              EpilogueMem<T, MemObj>& epilogue,
                               Conv2DParams const& kernel_params,
                               Index output_size, cl::sycl::queue& queue,
                               const std::vector<cl::sycl::event>& events) {
@@ -63,9 +65,15 @@ SNNStatus queue_direct_kernel(MemObj<T const>& in_mem, MemObj<T const>& fil_mem,
     auto filter = fil_mem.read_mem(cgh);
     auto output = out_mem.write_mem(cgh);
 
-    Functor conv{kernel_params, input, filter, output};
-
-    cgh.parallel_for(cl::sycl::range<1>{n_threads}, conv);
+    if constexpr (std::is_same<ConvType, conv_type::Forward>::value) {
+      auto fused_epilogue = get_fused_epilogue(epilogue, cgh);
+      Functor conv{kernel_params, input, filter, output, fused_epilogue};
+      cgh.parallel_for(cl::sycl::range<1>{n_threads}, conv);
+    } else {
+      SNN_UNUSED_VAR(epilogue);
+      Functor conv{kernel_params, input, filter, output};
+      cgh.parallel_for(cl::sycl::range<1>{n_threads}, conv);
+    }
   });
   return {event, StatusCode::OK};
 }
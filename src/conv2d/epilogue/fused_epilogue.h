@@ -0,0 +1,108 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_CONV2D_EPILOGUE_FUSED_EPILOGUE_H_
+#define SYCLDNN_SRC_CONV2D_EPILOGUE_FUSED_EPILOGUE_H_
+
+#include "sycldnn/accessor_types.h"
+#include "sycldnn/helpers/macros.h"
+
+#include "sycldnn/conv2d/epilogue.h"
+
+#include "sycldnn/internal/conv2d/epilogue.h"
+
+#include "src/helpers/vector_io.h"
+#include "src/pointwise/kernels.h"
+
+#include <CL/sycl.hpp>
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+
+/**
+ * Device side epilogue, applied by a convolution kernel to its output values
+ * while they are still held in registers.
+ *
+ * The enabled operations are checked at runtime. These checks are uniform
+ * across all work items, so do not cause any divergence.
+ */
+template <typename T, bool IsUSM>
+struct FusedEpilogue {
+  /**
+   * Apply the epilogue to a value computed by a convolution kernel.
+   *
+   * \param val     The output value, either a scalar or a vector of values
+   *                in consecutive features.
+   * \param offset  The offset of the value in the output tensor.
+   * \param feature The feature of the (first element of the) value.
+   * \return The value to write to the output tensor.
+   */
+  template <typename DataType, typename Index>
+  inline SNN_ALWAYS_INLINE DataType apply(DataType val, Index offset,
+                                          Index feature) const {
+    using Load = helpers::io::Load<DataType>;
+    if (params.bias) {
+      val = val + Load()(bias.get_pointer(), feature);
+    }
+    if (params.scale) {
+      val = val * Load()(scale.get_pointer(), feature);
+    }
+    if (params.shift) {
+      val = val + Load()(shift.get_pointer(), feature);
+    }
+    if (params.residual) {
+      val = val + Load()(residual.get_pointer(), offset);
+    }
+    switch (params.activation) {
+      case Activation::Relu:
+        return pointwise::Relu<pointwise::Forward>{}.apply(val);
+      case Activation::Tanh:
+        return pointwise::Tanh<pointwise::Forward>{}.apply(val);
+      case Activation::None:
+      default:
+        return val;
+    }
+  }
+
+  /** The per-feature bias. */
+  ReadMem<T const, IsUSM> bias;
+  /** The per-feature scale. */
+  ReadMem<T const, IsUSM> scale;
+  /** The per-feature shift. */
+  ReadMem<T const, IsUSM> shift;
+  /** The residual tensor. */
+  ReadMem<T const, IsUSM> residual;
+  /** The operations enabled in the epilogue. */
+  EpilogueParams params;
+};
+
+/**
+ * Get the device side epilogue for the given memory objects, binding them to
+ * the command group handler.
+ */
+template <typename T, template <typename> class MemObj>
+FusedEpilogue<T, is_usm_obj_v<MemObj<T>, T>> get_fused_epilogue(
+    EpilogueMem<T, MemObj>& epilogue, cl::sycl::handler& cgh) {
+  return {epilogue.bias.read_mem(cgh), epilogue.scale.read_mem(cgh),
+          epilogue.shift.read_mem(cgh), epilogue.residual.read_mem(cgh),
+          epilogue.params};
+}
+
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_SRC_CONV2D_EPILOGUE_FUSED_EPILOGUE_H_
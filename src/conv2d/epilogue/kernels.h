@@ -0,0 +1,81 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_CONV2D_EPILOGUE_KERNELS_H_
+#define SYCLDNN_SRC_CONV2D_EPILOGUE_KERNELS_H_
+
+#include "sycldnn/accessor_types.h"
+#include "sycldnn/helpers/macros.h"
+
+#include "src/conv2d/epilogue/fused_epilogue.h"
+#include "src/helpers/vector_io.h"
+
+#include <CL/sycl.hpp>
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+namespace epilogue {
+
+/**
+ * SYCL kernel to apply a convolution epilogue in place to an output tensor.
+ *
+ * Used for the convolution algorithms whose output stage cannot apply the
+ * epilogue directly.
+ */
+template <typename T, typename Index, bool IsUSM>
+struct EpilogueKernel {
+  using Load = helpers::io::Load<T>;
+  using Store = helpers::io::Store<T>;
+
+  EpilogueKernel(ReadWriteMem<T, IsUSM> output,
+                 FusedEpilogue<T, IsUSM> epilogue, Index n_items,
+                 Index features, Index inner_size)
+      : output_{output},
+        epilogue_{epilogue},
+        n_items_{n_items},
+        features_{features},
+        inner_size_{inner_size} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::item<1> item) const {
+    Index const idx = item.get_id(0);
+    if (idx < n_items_) {
+      auto output_data = output_.get_pointer();
+      Index const feature = (idx / inner_size_) % features_;
+      T const value = Load()(output_data, idx);
+      Store()(output_data, idx, epilogue_.apply(value, idx, feature));
+    }
+  }
+
+ private:
+  ReadWriteMem<T, IsUSM> output_;
+  FusedEpilogue<T, IsUSM> epilogue_;
+  /** Number of elements in the output tensor. */
+  Index const n_items_;
+  /** Number of features in the output tensor. */
+  Index const features_;
+  /**
+   * Number of elements between consecutive features, 1 for NHWC and
+   * rows * cols for NCHW.
+   */
+  Index const inner_size_;
+};
+
+}  // namespace epilogue
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_SRC_CONV2D_EPILOGUE_KERNELS_H_
@@ -0,0 +1,104 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sycldnn/internal/conv2d/epilogue.h"
+
+#include "sycldnn/format_type.h"
+#include "sycldnn/mem_object.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/conv2d/conv_type.h"
+#include "sycldnn/conv2d/params.h"
+#include "sycldnn/conv2d/sizes.h"
+
+#include "src/conv2d/epilogue/queue_epilogue.h"
+
+#include <CL/sycl.hpp>
+
+#include <stddef.h>
+#include <cstdint>
+#include <limits>
+
+#include "sycldnn/export.h"
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+
+/**
+ * Launch the standalone epilogue over the output of a forward convolution,
+ * choosing the smallest index type which can address the output tensor.
+ */
+template <typename T, template <typename> class MemObj>
+SNNStatus launch_epilogue(MemObj<T>& output, EpilogueMem<T, MemObj>& epilogue,
+                          Conv2DParams const& params, cl::sycl::queue& queue,
+                          const std::vector<cl::sycl::event>& events) {
+  if (is_identity(epilogue.params)) {
+    return StatusCode::OK;
+  }
+  auto conv_sizes = get_sizes<conv_type::Forward>(params);
+  size_t const output_size = conv_sizes.output_size;
+  size_t const inner_size =
+      params.input_format == DataFormat::NCHW
+          ? static_cast<size_t>(params.out_rows) * params.out_cols
+          : 1;
+  if (output_size > static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
+#ifdef SNN_USE_INT64
+    return queue_epilogue<T, int64_t>(
+        output, epilogue, static_cast<int64_t>(output_size),
+        static_cast<int64_t>(params.features),
+        static_cast<int64_t>(inner_size), queue, events);
+#else
+    return StatusCode::IndexExceeded;
+#endif  // SNN_USE_INT64
+  } else {
+    return queue_epilogue<T, int32_t>(
+        output, epilogue, static_cast<int32_t>(output_size),
+        static_cast<int32_t>(params.features),
+        static_cast<int32_t>(inner_size), queue, events);
+  }
+}
+
+#define INSTANTIATE_LAUNCHER(DTYPE, MEMOBJ)                          \
+  template SNN_EXPORT SNNStatus launch_epilogue<DTYPE, MEMOBJ>(      \
+      MEMOBJ<DTYPE> & output, EpilogueMem<DTYPE, MEMOBJ> & epilogue, \
+      Conv2DParams const& params, cl::sycl::queue& queue,            \
+      const std::vector<cl::sycl::event>& events)
+
+#ifdef SNN_ENABLE_USM
+#define INSTANTIATE_FOR_TYPE(DTYPE)          \
+  INSTANTIATE_LAUNCHER(DTYPE, USMMemObject); \
+  INSTANTIATE_LAUNCHER(DTYPE, BufferMemObject);
+#else
+#define INSTANTIATE_FOR_TYPE(DTYPE) \
+  INSTANTIATE_LAUNCHER(DTYPE, BufferMemObject);
+#endif  // SNN_ENABLE_USM
+
+INSTANTIATE_FOR_TYPE(float);
+
+#ifdef SNN_USE_DOUBLE
+INSTANTIATE_FOR_TYPE(double);
+#endif  // SNN_USE_DOUBLE
+
+#ifdef SNN_USE_HALF
+INSTANTIATE_FOR_TYPE(cl::sycl::half);
+#endif  // SNN_USE_HALF
+
+#undef INSTANTIATE_FOR_TYPE
+#undef INSTANTIATE_LAUNCHER
+
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
@@ -0,0 +1,44 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_CONV2D_EPILOGUE_QUEUE_EPILOGUE_H_
+#define SYCLDNN_SRC_CONV2D_EPILOGUE_QUEUE_EPILOGUE_H_
+
+#include "sycldnn/mem_object.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/internal/conv2d/epilogue.h"
+
+#include <CL/sycl.hpp>
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+
+/**
+ * Queue a kernel to apply a convolution epilogue in place to the output
+ * tensor.
+ */
+template <typename T, typename Index, template <typename> class MemObj>
+SNNStatus queue_epilogue(MemObj<T>& output, EpilogueMem<T, MemObj>& epilogue,
+                         Index n_items, Index features, Index inner_size,
+                         cl::sycl::queue& queue,
+                         const std::vector<cl::sycl::event>& events);
+
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_SRC_CONV2D_EPILOGUE_QUEUE_EPILOGUE_H_
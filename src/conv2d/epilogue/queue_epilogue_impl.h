@@ -0,0 +1,57 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_CONV2D_EPILOGUE_QUEUE_EPILOGUE_IMPL_H_
+#define SYCLDNN_SRC_CONV2D_EPILOGUE_QUEUE_EPILOGUE_IMPL_H_
+
+#include "sycldnn/helpers/ratio.h"
+#include "sycldnn/mem_object.h"
+#include "sycldnn/status.h"
+
+#include "src/conv2d/epilogue/fused_epilogue.h"
+#include "src/conv2d/epilogue/kernels.h"
+#include "src/conv2d/epilogue/queue_epilogue.h"
+
+#include <CL/sycl.hpp>
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+
+template <typename T, typename Index, template <typename> class MemObj>
+SNNStatus queue_epilogue(MemObj<T>& out_mem, EpilogueMem<T, MemObj>& epilogue,
+                         Index n_items, Index features, Index inner_size,
+                         cl::sycl::queue& queue,
+                         const std::vector<cl::sycl::event>& events) {
+  constexpr bool is_usm = is_usm_obj_v<MemObj<T>, T>;
+  using Functor = epilogue::EpilogueKernel<T, Index, is_usm>;
+  size_t const n_threads = helpers::round_up_to_nearest_multiple(n_items, 64);
+
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    cgh.depends_on(events);
+    auto output = out_mem.read_write_mem(cgh);
+    auto fused_epilogue = get_fused_epilogue(epilogue, cgh);
+
+    Functor functor{output, fused_epilogue, n_items, features, inner_size};
+    cgh.parallel_for(cl::sycl::range<1>{n_threads}, functor);
+  });
+  return {event, StatusCode::OK};
+}
+
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_SRC_CONV2D_EPILOGUE_QUEUE_EPILOGUE_IMPL_H_
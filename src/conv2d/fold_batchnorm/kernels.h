@@ -0,0 +1,114 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_CONV2D_FOLD_BATCHNORM_KERNELS_H_
+#define SYCLDNN_SRC_CONV2D_FOLD_BATCHNORM_KERNELS_H_
+
+#include "sycldnn/accessor_types.h"
+#include "sycldnn/helpers/macros.h"
+
+#include "src/helpers/vector_io.h"
+
+#include <CL/sycl.hpp>
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+namespace fold_batchnorm {
+
+/**
+ * SYCL kernel to fold a frozen batchnorm into a convolution's filter and
+ * bias.
+ *
+ * The first filter_size work items each compute one element of the folded
+ * filter, and the following features work items each compute one element of
+ * the folded bias, so both tensors are written by a single kernel launch.
+ */
+template <typename T, typename Index, bool IsUSM>
+struct FoldBatchNormKernel {
+  using Load = helpers::io::Load<T>;
+  using Store = helpers::io::Store<T>;
+
+  FoldBatchNormKernel(ReadMem<T const, IsUSM> filter,
+                      ReadMem<T const, IsUSM> bias,
+                      ReadMem<T const, IsUSM> gamma,
+                      ReadMem<T const, IsUSM> beta,
+                      ReadMem<T const, IsUSM> mean,
+                      ReadMem<T const, IsUSM> variance,
+                      WriteMem<T, IsUSM> folded_filter,
+                      WriteMem<T, IsUSM> folded_bias, bool has_bias, T epsilon,
+                      Index filter_size, Index features, Index inner_size)
+      : filter_{filter},
+        bias_{bias},
+        gamma_{gamma},
+        beta_{beta},
+        mean_{mean},
+        variance_{variance},
+        folded_filter_{folded_filter},
+        folded_bias_{folded_bias},
+        has_bias_{has_bias},
+        epsilon_{epsilon},
+        filter_size_{filter_size},
+        features_{features},
+        inner_size_{inner_size} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::item<1> item) const {
+    Index const idx = item.get_id(0);
+    if (idx < filter_size_) {
+      Index const feature = (idx / inner_size_) % features_;
+      T const value = Load()(filter_.get_pointer(), idx);
+      Store()(folded_filter_.get_pointer(), idx, value * scale(feature));
+    } else if (idx < filter_size_ + features_) {
+      Index const feature = idx - filter_size_;
+      T const bias = has_bias_ ? Load()(bias_.get_pointer(), feature) : T{0};
+      T const mean = Load()(mean_.get_pointer(), feature);
+      T const beta = Load()(beta_.get_pointer(), feature);
+      Store()(folded_bias_.get_pointer(), feature,
+              (bias - mean) * scale(feature) + beta);
+    }
+  }
+
+ private:
+  /** Compute the batchnorm scale gamma / sqrt(variance + epsilon). */
+  T SNN_ALWAYS_INLINE scale(Index feature) const {
+    T const gamma = Load()(gamma_.get_pointer(), feature);
+    T const variance = Load()(variance_.get_pointer(), feature);
+    return gamma / cl::sycl::sqrt(variance + epsilon_);
+  }
+
+  ReadMem<T const, IsUSM> filter_;
+  ReadMem<T const, IsUSM> bias_;
+  ReadMem<T const, IsUSM> gamma_;
+  ReadMem<T const, IsUSM> beta_;
+  ReadMem<T const, IsUSM> mean_;
+  ReadMem<T const, IsUSM> variance_;
+  WriteMem<T, IsUSM> folded_filter_;
+  WriteMem<T, IsUSM> folded_bias_;
+  bool const has_bias_;
+  T const epsilon_;
+  /** Number of elements in the filter. */
+  Index const filter_size_;
+  /** Number of output features. */
+  Index const features_;
+  /** Number of filter elements between consecutive features. */
+  Index const inner_size_;
+};
+
+}  // namespace fold_batchnorm
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_SRC_CONV2D_FOLD_BATCHNORM_KERNELS_H_
@@ -0,0 +1,101 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sycldnn/internal/conv2d/fold_batchnorm.h"
+
+#include "sycldnn/mem_object.h"
+#include "sycldnn/status.h"
+
+#include "src/conv2d/fold_batchnorm/queue_fold_batchnorm.h"
+
+#include <CL/sycl.hpp>
+
+#include <stddef.h>
+#include <cstdint>
+#include <limits>
+
+#include "sycldnn/export.h"
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+
+/**
+ * Launch the batchnorm folding kernel, choosing the smallest index type which
+ * can address both the filter and the bias.
+ */
+template <typename T, template <typename> class MemObj>
+SNNStatus launch_fold_batchnorm(
+    MemObj<T const>& filter, MemObj<T const>& bias, MemObj<T const>& gamma,
+    MemObj<T const>& beta, MemObj<T const>& mean, MemObj<T const>& variance,
+    MemObj<T>& folded_filter, MemObj<T>& folded_bias, bool has_bias,
+    float epsilon, FoldSizes const& sizes, cl::sycl::queue& queue,
+    const std::vector<cl::sycl::event>& events) {
+  size_t const total_size = sizes.filter_size + sizes.features;
+  if (total_size > static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
+#ifdef SNN_USE_INT64
+    return queue_fold_batchnorm<T, int64_t>(
+        filter, bias, gamma, beta, mean, variance, folded_filter, folded_bias,
+        has_bias, static_cast<T>(epsilon),
+        static_cast<int64_t>(sizes.filter_size),
+        static_cast<int64_t>(sizes.features),
+        static_cast<int64_t>(sizes.inner_size), queue, events);
+#else
+    return StatusCode::IndexExceeded;
+#endif  // SNN_USE_INT64
+  } else {
+    return queue_fold_batchnorm<T, int32_t>(
+        filter, bias, gamma, beta, mean, variance, folded_filter, folded_bias,
+        has_bias, static_cast<T>(epsilon),
+        static_cast<int32_t>(sizes.filter_size),
+        static_cast<int32_t>(sizes.features),
+        static_cast<int32_t>(sizes.inner_size), queue, events);
+  }
+}
+
+#define INSTANTIATE_LAUNCHER(DTYPE, MEMOBJ)                           \
+  template SNN_EXPORT SNNStatus launch_fold_batchnorm<DTYPE, MEMOBJ>( \
+      MEMOBJ<DTYPE const> & filter, MEMOBJ<DTYPE const> & bias,       \
+      MEMOBJ<DTYPE const> & gamma, MEMOBJ<DTYPE const> & beta,        \
+      MEMOBJ<DTYPE const> & mean, MEMOBJ<DTYPE const> & variance,     \
+      MEMOBJ<DTYPE> & folded_filter, MEMOBJ<DTYPE> & folded_bias,     \
+      bool has_bias, float epsilon, FoldSizes const& sizes,           \
+      cl::sycl::queue& queue, const std::vector<cl::sycl::event>& events)
+
+#ifdef SNN_ENABLE_USM
+#define INSTANTIATE_FOR_TYPE(DTYPE)          \
+  INSTANTIATE_LAUNCHER(DTYPE, USMMemObject); \
+  INSTANTIATE_LAUNCHER(DTYPE, BufferMemObject);
+#else
+#define INSTANTIATE_FOR_TYPE(DTYPE) \
+  INSTANTIATE_LAUNCHER(DTYPE, BufferMemObject);
+#endif  // SNN_ENABLE_USM
+
+INSTANTIATE_FOR_TYPE(float);
+
+#ifdef SNN_USE_DOUBLE
+INSTANTIATE_FOR_TYPE(double);
+#endif  // SNN_USE_DOUBLE
+
+#ifdef SNN_USE_HALF
+INSTANTIATE_FOR_TYPE(cl::sycl::half);
+#endif  // SNN_USE_HALF
+
+#undef INSTANTIATE_FOR_TYPE
+#undef INSTANTIATE_LAUNCHER
+
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
@@ -0,0 +1,44 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_CONV2D_FOLD_BATCHNORM_QUEUE_FOLD_BATCHNORM_H_
+#define SYCLDNN_SRC_CONV2D_FOLD_BATCHNORM_QUEUE_FOLD_BATCHNORM_H_
+
+#include "sycldnn/mem_object.h"
+#include "sycldnn/status.h"
+
+#include <CL/sycl.hpp>
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+
+/**
+ * Queue a kernel to fold a frozen batchnorm into a convolution's filter and
+ * bias.
+ */
+template <typename T, typename Index, template <typename> class MemObj>
+SNNStatus queue_fold_batchnorm(
+    MemObj<T const>& filter, MemObj<T const>& bias, MemObj<T const>& gamma,
+    MemObj<T const>& beta, MemObj<T const>& mean, MemObj<T const>& variance,
+    MemObj<T>& folded_filter, MemObj<T>& folded_bias, bool has_bias,
+    T epsilon, Index filter_size, Index features, Index inner_size,
+    cl::sycl::queue& queue, const std::vector<cl::sycl::event>& events);
+
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_SRC_CONV2D_FOLD_BATCHNORM_QUEUE_FOLD_BATCHNORM_H_
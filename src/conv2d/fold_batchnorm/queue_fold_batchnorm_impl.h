@@ -0,0 +1,68 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_CONV2D_FOLD_BATCHNORM_QUEUE_FOLD_BATCHNORM_IMPL_H_
+#define SYCLDNN_SRC_CONV2D_FOLD_BATCHNORM_QUEUE_FOLD_BATCHNORM_IMPL_H_
+
+#include "sycldnn/helpers/ratio.h"
+#include "sycldnn/mem_object.h"
+#include "sycldnn/status.h"
+
+#include "src/conv2d/fold_batchnorm/kernels.h"
+#include "src/conv2d/fold_batchnorm/queue_fold_batchnorm.h"
+
+#include <CL/sycl.hpp>
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+
+template <typename T, typename Index, template <typename> class MemObj>
+SNNStatus queue_fold_batchnorm(
+    MemObj<T const>& fil_mem, MemObj<T const>& bias_mem,
+    MemObj<T const>& gamma_mem, MemObj<T const>& beta_mem,
+    MemObj<T const>& mean_mem, MemObj<T const>& var_mem,
+    MemObj<T>& out_fil_mem, MemObj<T>& out_bias_mem, bool has_bias,
+    T epsilon, Index filter_size, Index features, Index inner_size,
+    cl::sycl::queue& queue, const std::vector<cl::sycl::event>& events) {
+  constexpr bool is_usm = is_usm_obj_v<MemObj<T>, T>;
+  using Functor = fold_batchnorm::FoldBatchNormKernel<T, Index, is_usm>;
+  size_t const n_threads =
+      helpers::round_up_to_nearest_multiple(filter_size + features, 64);
+
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    cgh.depends_on(events);
+    auto filter = fil_mem.read_mem(cgh);
+    auto bias = bias_mem.read_mem(cgh);
+    auto gamma = gamma_mem.read_mem(cgh);
+    auto beta = beta_mem.read_mem(cgh);
+    auto mean = mean_mem.read_mem(cgh);
+    auto variance = var_mem.read_mem(cgh);
+    auto folded_filter = out_fil_mem.write_mem(cgh);
+    auto folded_bias = out_bias_mem.write_mem(cgh);
+
+    Functor functor(filter, bias, gamma, beta, mean, variance, folded_filter,
+                    folded_bias, has_bias, epsilon, filter_size, features,
+                    inner_size);
+    cgh.parallel_for(cl::sycl::range<1>{n_threads}, functor);
+  });
+  return {event, StatusCode::OK};
+}
+
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_SRC_CONV2D_FOLD_BATCHNORM_QUEUE_FOLD_BATCHNORM_IMPL_H_
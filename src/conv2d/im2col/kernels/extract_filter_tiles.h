@@ -17,6 +17,7 @@
 #define SYCLDNN_SRC_CONV2D_IM2COL_KERNELS_H_
 
 #include "sycldnn/accessor_types.h"
+#include "sycldnn/batch_format.h"
 
 #include "sycldnn/conv2d/conv_type.h"
 #include "sycldnn/conv2d/params.h"
@@ -31,6 +32,15 @@ namespace conv2d {
 namespace internal {
 namespace im2col {
 
+/**
+ * Mirror the filter and swap the channel and feature dimensions so that it can
+ * be used in an input backprop matrix multiply.
+ *
+ * A grouped filter has shape [R, S, C / G, F]. The transformed filter for a
+ * strided group convolution stores each group contiguously as
+ * [G, R, S, F / G, C / G], while for an interleaved group convolution the
+ * groups are the innermost dimension, [R, S, F / G, C / G, G].
+ */
 template <typename T, typename Index, bool isUSM>
 struct ExtractFilterTiles {
   using Load = helpers::io::Load<T>;
@@ -39,12 +49,15 @@ struct ExtractFilterTiles {
   ExtractFilterTiles(Conv2DParams const& params,
                      ReadMem<T const, isUSM> const& input,
                      WriteMem<T, isUSM> const& output)
-      : n_items_{params.window_rows * params.window_cols * params.channels *
-                 params.features},
+      : n_items_{params.window_rows * params.window_cols *
+                 (params.channels / params.groups) * params.features},
         n_window_rows_{params.window_rows},
         n_window_cols_{params.window_cols},
-        n_channels_{params.channels},
+        n_groups_{params.groups},
+        n_channels_{params.channels / params.groups},
         n_features_{params.features},
+        n_group_features_{params.features / params.groups},
+        interleaved_{params.group_format == sycldnn::BatchFormat::INTERLEAVED},
         input_mem_{input},
         output_mem_{output} {}
 
@@ -68,10 +81,28 @@ struct ExtractFilterTiles {
 
       Index const out_row = n_window_rows_ - 1 - row;
       Index const out_col = n_window_cols_ - 1 - col;
-      Index const out_idx =
-          ((out_row * n_window_cols_ + out_col) * n_features_ + feature) *
-              n_channels_ +
-          channel;
+      Index const out_rs = out_row * n_window_cols_ + out_col;
+
+      Index out_idx;
+      if (n_groups_ == 1) {
+        out_idx = (out_rs * n_features_ + feature) * n_channels_ + channel;
+      } else if (interleaved_) {
+        Index const group = feature % n_groups_;
+        Index const group_feature = feature / n_groups_;
+        out_idx =
+            ((out_rs * n_group_features_ + group_feature) * n_channels_ +
+             channel) *
+                n_groups_ +
+            group;
+      } else {
+        Index const group = feature / n_group_features_;
+        Index const group_feature = feature % n_group_features_;
+        Index const n_window = n_window_rows_ * n_window_cols_;
+        out_idx = ((group * n_window + out_rs) * n_group_features_ +
+                   group_feature) *
+                      n_channels_ +
+                  channel;
+      }
       Store()(output_data, out_idx, in_val);
     }
   }
@@ -80,8 +111,11 @@ struct ExtractFilterTiles {
   Index const n_items_;
   Index const n_window_rows_;
   Index const n_window_cols_;
+  Index const n_groups_;
   Index const n_channels_;
   Index const n_features_;
+  Index const n_group_features_;
+  bool const interleaved_;
   ReadMem<T const, isUSM> input_mem_;
   WriteMem<T, isUSM> output_mem_;
 };
@@ -72,6 +72,8 @@ struct ExtractInputTiles<T, Index, VectorWidth, conv_type::Forward, isUSM> {
         out_cols_{params.out_cols},
         pad_rows_{params.window_rows - params.pad_rows - 1},
         pad_cols_{params.window_cols - params.pad_cols - 1},
+        dilation_rows_{params.dilation_rows},
+        dilation_cols_{params.dilation_cols},
         input_accessor_{input},
         output_accessor_{output} {}
 
@@ -117,6 +119,12 @@ struct ExtractInputTiles<T, Index, VectorWidth, conv_type::Forward, isUSM> {
           group_channel;
       VecType in_val = Load()(input_data, in_idx);
 
+      if (dilation_rows_ != 1 || dilation_cols_ != 1) {
+        store_dilated(output_data, in_val, batch, row_idx, col_idx, group,
+                      group_channel);
+        return;
+      }
+
       auto const col_window_struct =
           helpers::out_window_from_input(col_idx, stride_cols_, pad_cols_);
       Index const cstart = col_window_struct.window_start;
@@ -148,6 +156,50 @@ struct ExtractInputTiles<T, Index, VectorWidth, conv_type::Forward, isUSM> {
   }
 
  private:
+  /**
+   * Write the input value to every tile which uses it in a dilated
+   * convolution. The filter element k in a window covers the input element
+   * (out_idx * stride - pad + k * dilation), so for each filter element check
+   * whether there is an output index which uses this input.
+   */
+  template <typename Pointer>
+  void SNN_ALWAYS_INLINE store_dilated(Pointer output_data, VecType in_val,
+                                       Index batch, Index row_idx,
+                                       Index col_idx, Index group,
+                                       Index group_channel) const {
+    // pad_rows_ and pad_cols_ hold the padding in the output space, so
+    // convert back to the input padding.
+    Index const in_pad_rows = window_rows_ - 1 - pad_rows_;
+    Index const in_pad_cols = window_cols_ - 1 - pad_cols_;
+    for (Index in_r = 0; in_r < window_rows_; ++in_r) {
+      Index const padded_r = row_idx + in_pad_rows - in_r * dilation_rows_;
+      if (padded_r < 0) {
+        break;
+      }
+      Index const r = padded_r / stride_rows_;
+      if (padded_r % stride_rows_ != 0 || r >= out_rows_) {
+        continue;
+      }
+      for (Index in_c = 0; in_c < window_cols_; ++in_c) {
+        Index const padded_c = col_idx + in_pad_cols - in_c * dilation_cols_;
+        if (padded_c < 0) {
+          break;
+        }
+        Index const c = padded_c / stride_cols_;
+        if (padded_c % stride_cols_ != 0 || c >= out_cols_) {
+          continue;
+        }
+        auto tile_start =
+            output_data +
+            (((group * batch_ + batch) * out_rows_ + r) * out_cols_ + c) *
+                tile_size_;
+        Index tile_idx =
+            (in_r * window_cols_ + in_c) * channels_ + group_channel;
+        Store()(tile_start, tile_idx, in_val);
+      }
+    }
+  }
+
   Index const tile_size_;
   Index const groups_;
   Index const channels_;
@@ -163,10 +215,19 @@ struct ExtractInputTiles<T, Index, VectorWidth, conv_type::Forward, isUSM> {
   Index const out_cols_;
   Index const pad_rows_;
   Index const pad_cols_;
+  Index const dilation_rows_;
+  Index const dilation_cols_;
   ReadMem<T const, isUSM> input_accessor_;
   WriteMem<T, isUSM> output_accessor_;
 };
 
+/**
+ * Input backprop transform, with one thread per entry of the output gradient.
+ *
+ * As in the forward transform, strided group convolutions write the tiles for
+ * each group contiguously, while interleaved group convolutions keep the
+ * groups as the innermost dimension of each tile.
+ */
 template <typename T, typename Index, int VectorWidth, bool isUSM>
 struct ExtractInputTiles<T, Index, VectorWidth, conv_type::InputBackprop,
                          isUSM> {
@@ -177,9 +238,16 @@ struct ExtractInputTiles<T, Index, VectorWidth, conv_type::InputBackprop,
   ExtractInputTiles(Index tile_size, Conv2DParams const& params,
                     ReadMem<T const, isUSM> const& input,
                     WriteMem<T, isUSM> const& output)
-      : tile_size_{tile_size},
+      : tile_size_{params.group_format == sycldnn::BatchFormat::STRIDED
+                       ? tile_size
+                       : tile_size * params.groups},
+        groups_{params.group_format == sycldnn::BatchFormat::STRIDED
+                    ? params.groups
+                    : 1},
         channels_{params.channels},
-        features_{params.features},
+        features_{params.group_format == sycldnn::BatchFormat::STRIDED
+                      ? params.features / params.groups
+                      : params.features},
         batch_{params.batch},
         in_rows_{params.in_rows},
         in_cols_{params.in_cols},
@@ -191,6 +259,8 @@ struct ExtractInputTiles<T, Index, VectorWidth, conv_type::InputBackprop,
         out_cols_{params.out_cols},
         pad_rows_{params.pad_rows},
         pad_cols_{params.pad_cols},
+        dilation_rows_{params.dilation_rows},
+        dilation_cols_{params.dilation_cols},
         input_accessor_{input},
         output_accessor_{output} {}
 
@@ -209,29 +279,48 @@ struct ExtractInputTiles<T, Index, VectorWidth, conv_type::InputBackprop,
       row_idx = tensor_idx.s1;
       batch = tensor_idx.s0;
     }
-    if (feature < features_ && col_idx < out_cols_ && row_idx < out_rows_ &&
-        batch < batch_) {
+
+    Index group;
+    Index group_feature;
+    if (groups_ == 1) {
+      group = 0;
+      group_feature = feature;
+    } else {
+      auto feature_groups_idx =
+          helpers::TensorIndexHelper<Index, false>::unflatten2d(
+              feature, features_, features_);
+
+      group = feature_groups_idx.s0;
+      group_feature = feature_groups_idx.s1;
+    }
+
+    if (group_feature < features_ && group < groups_ && col_idx < out_cols_ &&
+        row_idx < out_rows_ && batch < batch_) {
       auto input_data = input_accessor_.get_pointer();
       auto output_data = output_accessor_.get_pointer();
 
       Index const in_idx =
-          ((batch * out_rows_ + row_idx) * out_cols_ + col_idx) * features_ +
-          feature;
+          (((batch * out_rows_ + row_idx) * out_cols_ + col_idx) * groups_ +
+           group) *
+              features_ +
+          group_feature;
       VecType in_val = Load()(input_data, in_idx);
 
       Index const cstart = col_idx * stride_cols_ - pad_cols_;
       Index const rstart = row_idx * stride_rows_ - pad_rows_;
 
-      for (Index r = rstart, in_r = window_rows_ - 1; in_r >= 0; ++r, --in_r) {
+      for (Index r = rstart, in_r = window_rows_ - 1; in_r >= 0;
+           r += dilation_rows_, --in_r) {
         if (r >= 0 && r < in_rows_) {
           for (Index c = cstart, in_c = window_cols_ - 1; in_c >= 0;
-               ++c, --in_c) {
+               c += dilation_cols_, --in_c) {
             if (c >= 0 && c < in_cols_) {
               auto tile_start =
                   output_data +
-                  ((batch * in_rows_ + r) * in_cols_ + c) * tile_size_;
+                  (((group * batch_ + batch) * in_rows_ + r) * in_cols_ + c) *
+                      tile_size_;
               Index tile_idx =
-                  (in_r * window_cols_ + in_c) * features_ + feature;
+                  (in_r * window_cols_ + in_c) * features_ + group_feature;
               Store()(tile_start, tile_idx, in_val);
             }
           }
@@ -242,6 +331,7 @@ struct ExtractInputTiles<T, Index, VectorWidth, conv_type::InputBackprop,
 
  private:
   Index const tile_size_;
+  Index const groups_;
   Index const channels_;
   Index const features_;
   Index const batch_;
@@ -255,6 +345,8 @@ struct ExtractInputTiles<T, Index, VectorWidth, conv_type::InputBackprop,
   Index const out_cols_;
   Index const pad_rows_;
   Index const pad_cols_;
+  Index const dilation_rows_;
+  Index const dilation_cols_;
   ReadMem<T const, isUSM> input_accessor_;
   WriteMem<T, isUSM> output_accessor_;
 };
@@ -385,6 +477,94 @@ struct ExtractInputTiles<T, Index, VectorWidth, conv_type::FilterBackprop,
   WriteMem<T, isUSM> output_accessor_;
 };
 
+/**
+ * Forward input transform for NCHW tensors with FCHW filters.
+ *
+ * Each work item writes one entry of the transform, so that neighbouring work
+ * items write neighbouring tile entries. The entries of each tile are ordered
+ * (channel x window row x window col) to match an FCHW filter, and any
+ * entries which fall in the padding are written as zero, so the transform
+ * buffer does not need to be zeroed first.
+ */
+template <typename T, typename Index, bool isUSM>
+struct ExtractInputTilesNCHW {
+  ExtractInputTilesNCHW(Index tile_size, Conv2DParams const& params,
+                        ReadMem<T const, isUSM> const& input,
+                        WriteMem<T, isUSM> const& output)
+      : n_elems_{params.batch * params.out_rows * params.out_cols * tile_size},
+        tile_size_{tile_size},
+        channels_{params.channels},
+        in_rows_{params.in_rows},
+        in_cols_{params.in_cols},
+        window_rows_{params.window_rows},
+        window_cols_{params.window_cols},
+        stride_rows_{params.stride_rows},
+        stride_cols_{params.stride_cols},
+        out_rows_{params.out_rows},
+        out_cols_{params.out_cols},
+        pad_rows_{params.pad_rows},
+        pad_cols_{params.pad_cols},
+        dilation_rows_{params.dilation_rows},
+        dilation_cols_{params.dilation_cols},
+        input_accessor_{input},
+        output_accessor_{output} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::item<1> item) const {
+    Index const index = item.get_id(0);
+    if (index < n_elems_) {
+      auto input_data = input_accessor_.get_pointer();
+      auto output_data = output_accessor_.get_pointer();
+
+      auto const tile_entry_idx =
+          helpers::TensorIndexHelper<Index, false>::unflatten2d(
+              index, tile_size_, tile_size_);
+      auto const tile_idx =
+          helpers::TensorIndexHelper<Index, false>::unflatten3d(
+              tile_entry_idx.s0, out_rows_, out_rows_, out_cols_, out_cols_);
+      auto const entry_idx =
+          helpers::TensorIndexHelper<Index, false>::unflatten3d(
+              tile_entry_idx.s1, window_rows_, window_rows_, window_cols_,
+              window_cols_);
+      Index const batch = tile_idx.s0;
+      Index const channel = entry_idx.s0;
+
+      Index const in_row = tile_idx.s1 * stride_rows_ - pad_rows_ +
+                           entry_idx.s1 * dilation_rows_;
+      Index const in_col = tile_idx.s2 * stride_cols_ - pad_cols_ +
+                           entry_idx.s2 * dilation_cols_;
+
+      T value{0};
+      if (in_row >= 0 && in_row < in_rows_ && in_col >= 0 &&
+          in_col < in_cols_) {
+        Index const in_idx =
+            ((batch * channels_ + channel) * in_rows_ + in_row) * in_cols_ +
+            in_col;
+        value = helpers::io::Load<T>()(input_data, in_idx);
+      }
+      helpers::io::Store<T>()(output_data, index, value);
+    }
+  }
+
+ private:
+  Index const n_elems_;
+  Index const tile_size_;
+  Index const channels_;
+  Index const in_rows_;
+  Index const in_cols_;
+  Index const window_rows_;
+  Index const window_cols_;
+  Index const stride_rows_;
+  Index const stride_cols_;
+  Index const out_rows_;
+  Index const out_cols_;
+  Index const pad_rows_;
+  Index const pad_cols_;
+  Index const dilation_rows_;
+  Index const dilation_cols_;
+  ReadMem<T const, isUSM> input_accessor_;
+  WriteMem<T, isUSM> output_accessor_;
+};
+
 }  // namespace im2col
 }  // namespace internal
 }  // namespace conv2d
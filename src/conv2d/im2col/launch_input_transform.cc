@@ -20,6 +20,8 @@
 #include "sycldnn/conv2d/conv_type.h"
 #include "sycldnn/conv2d/params.h"
 
+#include "sycldnn/data_format.h"
+
 #include "sycldnn/internal/conv2d/im2col/launch_input_transform.h"
 
 #include "src/conv2d/im2col/queue_input_transform.h"
@@ -28,6 +30,7 @@
 #include <stddef.h>
 #include <cstdint>
 #include <limits>
+#include <type_traits>
 
 #include <CL/sycl.hpp>
 
@@ -42,6 +45,11 @@ namespace {
 /** Get the required number of threads for the input transform. */
 template <typename ConvType>
 size_t get_thread_size(Conv2DParams const& params, int vector_width) {
+  if (params.input_format == DataFormat::NCHW) {
+    // The NCHW transform uses one thread per entry of the transform.
+    return params.batch * params.out_rows * params.out_cols *
+           params.window_rows * params.window_cols * params.channels;
+  }
   return params.batch * params.in_rows * params.in_cols * params.channels /
          vector_width;
 }
@@ -55,6 +63,9 @@ size_t get_thread_size<conv_type::InputBackprop>(Conv2DParams const& params,
 /** Check whether a certain vector size can be used for the given parameters. */
 template <typename ConvType>
 bool can_use_vector(Conv2DParams const& params, int vector_width) {
+  if (params.input_format == DataFormat::NCHW) {
+    return false;
+  }
   if (params.group_format == sycldnn::BatchFormat::STRIDED) {
     return (params.channels / params.groups) % vector_width == 0;
   } else {
@@ -78,6 +89,12 @@ SNNStatus launch_with_index(MemObj<T const>& input, MemObj<T>& output,
                             Conv2DParams const& params, int n_tiles,
                             int tile_size, cl::sycl::queue& queue,
                             const std::vector<cl::sycl::event>& events) {
+  if (std::is_same<ConvType, conv_type::Forward>::value &&
+      params.input_format == DataFormat::NCHW) {
+    // The NCHW transform writes every entry, including the padding.
+    return queue_input_transform<T, Index, VectorWidth, ConvType>(
+        input, output, params, tile_size, queue, events);
+  }
   auto status = queue_zero_out_transform<T, VectorWidth>(
       output, n_tiles, params.groups * tile_size, queue, events);
   if (status.status != StatusCode::OK) {
@@ -20,11 +20,15 @@
 
 #include "sycldnn/conv2d/params.h"
 
+#include "sycldnn/data_format.h"
+
 #include "sycldnn/helpers/ratio.h"
 
 #include "src/conv2d/im2col/kernels/extract_input_tiles.h"
 #include "src/conv2d/im2col/queue_input_transform.h"
 
+#include <type_traits>
+
 #include <CL/sycl.hpp>
 
 namespace sycldnn {
@@ -75,6 +79,26 @@ SNNStatus queue_input_transform(MemObj<T const>& input_mem,
 
   using Functor = ExtractInputTiles<T, Index, VectorWidth, ConvType, is_usm>;
 
+#ifdef SNN_ENABLE_NCHW
+  if constexpr (std::is_same<ConvType, conv_type::Forward>::value &&
+                VectorWidth == 1) {
+    if (params.input_format == DataFormat::NCHW) {
+      using NCHWFunctor = ExtractInputTilesNCHW<T, Index, is_usm>;
+      auto event = queue.submit([&](cl::sycl::handler& cgh) {
+        cgh.depends_on(events);
+        auto input = input_mem.read_mem(cgh);
+        auto output = output_mem.write_mem(cgh);
+        size_t const n_threads = round_up(params.batch * params.out_rows *
+                                          params.out_cols * tile_size);
+        NCHWFunctor conv{tile_size, params, input, output};
+
+        cgh.parallel_for(cl::sycl::range<1>{n_threads}, conv);
+      });
+      return SNNStatus{event, StatusCode::OK};
+    }
+  }
+#endif  // SNN_ENABLE_NCHW
+
   auto event = queue.submit([&](cl::sycl::handler& cgh) {
     cgh.depends_on(events);
     auto input = input_mem.read_mem(cgh);
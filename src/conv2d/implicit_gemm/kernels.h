@@ -0,0 +1,427 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_CONV2D_IMPLICIT_GEMM_KERNELS_H_
+#define SYCLDNN_SRC_CONV2D_IMPLICIT_GEMM_KERNELS_H_
+
+#include "sycldnn/accessor_types.h"
+
+#include "sycldnn/conv2d/conv_type.h"
+#include "sycldnn/conv2d/params.h"
+
+#include "src/conv2d/epilogue/fused_epilogue.h"
+#include "src/helpers/tensor_index.h"
+#include "src/helpers/vector_element.h"
+#include "src/helpers/vector_io.h"
+#include "src/matmul/blocks.h"
+
+#include <array>
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+namespace implicit_gemm {
+
+/**
+ * Matrix sizes of the GEMM computed by an implicit GEMM convolution.
+ *
+ * The convolution is computed as the matrix multiply [m x k] * [k x n] where
+ * one operand is the matrix that im2col would have materialised. Instead of
+ * writing that matrix to a workspace, the kernels compute the address of each
+ * of its elements from the convolution parameters as it is loaded.
+ */
+struct GemmSizes {
+  /** Number of rows in the output matrix. */
+  int m;
+  /** Number of columns in the output matrix. */
+  int n;
+};
+
+/**
+ * Get the GEMM sizes for the convolution.
+ *
+ * Forward:        [batch*out_rows*out_cols x features]
+ * InputBackprop:  [batch*in_rows*in_cols x channels]
+ * FilterBackprop: [window_rows*window_cols*channels x features]
+ */
+template <typename ConvType>
+inline GemmSizes get_gemm_sizes(Conv2DParams const& params);
+
+/** \copydoc get_gemm_sizes() */
+template <>
+inline GemmSizes get_gemm_sizes<conv_type::Forward>(
+    Conv2DParams const& params) {
+  return {params.batch * params.out_rows * params.out_cols, params.features};
+}
+
+/** \copydoc get_gemm_sizes() */
+template <>
+inline GemmSizes get_gemm_sizes<conv_type::InputBackprop>(
+    Conv2DParams const& params) {
+  return {params.batch * params.in_rows * params.in_cols, params.channels};
+}
+
+/** \copydoc get_gemm_sizes() */
+template <>
+inline GemmSizes get_gemm_sizes<conv_type::FilterBackprop>(
+    Conv2DParams const& params) {
+  return {params.window_rows * params.window_cols * params.channels,
+          params.features};
+}
+
+template <typename T, typename Index, typename ConvType, int RowTile,
+          int AccTile, int ColTile, bool IsUSM>
+struct ImplicitGemmConv2D;
+
+/**
+ * Forward implicit GEMM convolution.
+ *
+ * Each row of the GEMM is an output pixel and each column an output feature.
+ * The accumulation dimension runs over the filter window and then the input
+ * channels, so for each window position a block of rows reads AccTile
+ * contiguous channels from each of its input pixels.
+ */
+template <typename T, typename Index, int RowTile, int AccTile, int ColTile,
+          bool IsUSM>
+struct ImplicitGemmConv2D<T, Index, conv_type::Forward, RowTile, AccTile,
+                          ColTile, IsUSM> {
+ private:
+  using LhsBlock = matmul::VectorBlock<T, RowTile, AccTile>;
+  using LhsVector = typename LhsBlock::VectorType;
+  using OutBlock = matmul::VectorBlock<T, RowTile, ColTile>;
+
+ public:
+  ImplicitGemmConv2D(ReadMem<T const, IsUSM> const& input,
+                     ReadMem<T const, IsUSM> const& filter,
+                     WriteMem<T, IsUSM> const& output,
+                     FusedEpilogue<T, IsUSM> const& epilogue,
+                     Conv2DParams const& params)
+      : input_{input},
+        filter_{filter},
+        output_{output},
+        epilogue_{epilogue},
+        p_{params},
+        n_rows_{params.batch * params.out_rows * params.out_cols} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::nd_item<2> item) const {
+    Index const row = item.get_global_id(0) * RowTile;
+    Index const col = item.get_global_id(1) * ColTile;
+
+    if (row < n_rows_ && col < p_.features) {
+      std::array<bool, RowTile> valid_row;
+      std::array<Index, RowTile> batch_offset;
+      std::array<Index, RowTile> in_row;
+      std::array<Index, RowTile> in_col;
+      for (int i = 0; i < RowTile; ++i) {
+        valid_row[i] = row + i < n_rows_;
+        auto const pos = helpers::TensorIndexHelper<Index, false>::unflatten3d(
+            row + i, p_.out_rows, p_.out_rows, p_.out_cols, p_.out_cols);
+        batch_offset[i] = pos.s0 * p_.in_rows * p_.in_cols * p_.channels;
+        in_row[i] = pos.s1 * p_.stride_rows - p_.pad_rows;
+        in_col[i] = pos.s2 * p_.stride_cols - p_.pad_cols;
+      }
+      std::array<bool, ColTile> valid_col;
+      for (int i = 0; i < ColTile; ++i) {
+        valid_col[i] = col + i < p_.features;
+      }
+
+      auto const input_ptr = input_.get_pointer();
+      auto const filter_ptr = filter_.get_pointer() + col;
+      auto out_block = OutBlock{};
+      for (Index win_row = 0; win_row < p_.window_rows; ++win_row) {
+        for (Index win_col = 0; win_col < p_.window_cols; ++win_col) {
+          std::array<bool, RowTile> in_window;
+          std::array<Index, RowTile> pixel_offset;
+          for (int i = 0; i < RowTile; ++i) {
+            Index const r = in_row[i] + win_row * p_.dilation_rows;
+            Index const c = in_col[i] + win_col * p_.dilation_cols;
+            in_window[i] = valid_row[i] && r >= 0 && r < p_.in_rows &&
+                           c >= 0 && c < p_.in_cols;
+            pixel_offset[i] =
+                batch_offset[i] + (r * p_.in_cols + c) * p_.channels;
+          }
+          Index filter_offset =
+              (win_row * p_.window_cols + win_col) * p_.channels * p_.features;
+          for (Index channel = 0; channel < p_.channels; channel += AccTile) {
+            std::array<bool, AccTile> valid_acc;
+            for (int i = 0; i < AccTile; ++i) {
+              valid_acc[i] = channel + i < p_.channels;
+            }
+            LhsBlock lhs_block;
+            for (int i = 0; i < RowTile; ++i) {
+              lhs_block.data(i) =
+                  in_window[i]
+                      ? matmul::load_row<LhsVector, AccTile>(
+                            input_ptr + pixel_offset[i] + channel, valid_acc)
+                      : LhsVector{0};
+            }
+            auto rhs_block = matmul::load_block<AccTile, ColTile>(
+                filter_ptr + filter_offset, p_.features, valid_acc, valid_col);
+            matmul::block_mmacc(lhs_block, rhs_block, out_block);
+            filter_offset += AccTile * p_.features;
+          }
+        }
+      }
+
+      namespace vec_elem = helpers::vector_element;
+      for (int i = 0; i < RowTile; ++i) {
+        for (int j = 0; j < ColTile; ++j) {
+          if (valid_row[i] && valid_col[j]) {
+            Index const offset = (row + i) * p_.features + col + j;
+            vec_elem::set(out_block.data(i), j,
+                          epilogue_.apply(vec_elem::get(out_block.data(i), j),
+                                          offset, col + j));
+          }
+        }
+      }
+      auto out_ptr = output_.get_pointer() + row * p_.features + col;
+      matmul::store_block<RowTile, ColTile>(out_block, out_ptr, p_.features,
+                                            valid_row, valid_col);
+    }
+  }
+
+ private:
+  ReadMem<T const, IsUSM> input_;
+  ReadMem<T const, IsUSM> filter_;
+  WriteMem<T, IsUSM> output_;
+  FusedEpilogue<T, IsUSM> const epilogue_;
+  Conv2DParams const p_;
+  Index const n_rows_;
+};
+
+/**
+ * Input backprop implicit GEMM convolution.
+ *
+ * Each row of the GEMM is an input pixel and each column an input channel.
+ * The accumulation dimension runs over the filter window and then the
+ * features, where the output error pixel used for a window position is only
+ * valid if the strided convolution actually reads the input pixel there.
+ */
+template <typename T, typename Index, int RowTile, int AccTile, int ColTile,
+          bool IsUSM>
+struct ImplicitGemmConv2D<T, Index, conv_type::InputBackprop, RowTile, AccTile,
+                          ColTile, IsUSM> {
+ private:
+  using LhsBlock = matmul::VectorBlock<T, RowTile, AccTile>;
+  using LhsVector = typename LhsBlock::VectorType;
+  using OutBlock = matmul::VectorBlock<T, RowTile, ColTile>;
+
+ public:
+  ImplicitGemmConv2D(ReadMem<T const, IsUSM> const& input,
+                     ReadMem<T const, IsUSM> const& filter,
+                     WriteMem<T, IsUSM> const& output,
+                     Conv2DParams const& params)
+      : input_{input},
+        filter_{filter},
+        output_{output},
+        p_{params},
+        n_rows_{params.batch * params.in_rows * params.in_cols} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::nd_item<2> item) const {
+    Index const row = item.get_global_id(0) * RowTile;
+    Index const col = item.get_global_id(1) * ColTile;
+
+    if (row < n_rows_ && col < p_.channels) {
+      std::array<bool, RowTile> valid_row;
+      std::array<Index, RowTile> batch_offset;
+      std::array<Index, RowTile> padded_row;
+      std::array<Index, RowTile> padded_col;
+      for (int i = 0; i < RowTile; ++i) {
+        valid_row[i] = row + i < n_rows_;
+        auto const pos = helpers::TensorIndexHelper<Index, false>::unflatten3d(
+            row + i, p_.in_rows, p_.in_rows, p_.in_cols, p_.in_cols);
+        batch_offset[i] = pos.s0 * p_.out_rows * p_.out_cols * p_.features;
+        padded_row[i] = pos.s1 + p_.pad_rows;
+        padded_col[i] = pos.s2 + p_.pad_cols;
+      }
+      std::array<bool, ColTile> valid_col;
+      for (int i = 0; i < ColTile; ++i) {
+        valid_col[i] = col + i < p_.channels;
+      }
+
+      auto const input_ptr = input_.get_pointer();
+      auto const filter_ptr = filter_.get_pointer();
+      auto out_block = OutBlock{};
+      for (Index win_row = 0; win_row < p_.window_rows; ++win_row) {
+        for (Index win_col = 0; win_col < p_.window_cols; ++win_col) {
+          std::array<bool, RowTile> in_window;
+          std::array<Index, RowTile> pixel_offset;
+          for (int i = 0; i < RowTile; ++i) {
+            Index const r = padded_row[i] - win_row * p_.dilation_rows;
+            Index const c = padded_col[i] - win_col * p_.dilation_cols;
+            Index const out_r = r / p_.stride_rows;
+            Index const out_c = c / p_.stride_cols;
+            in_window[i] = valid_row[i] && r >= 0 && c >= 0 &&
+                           out_r * p_.stride_rows == r &&
+                           out_c * p_.stride_cols == c && out_r < p_.out_rows &&
+                           out_c < p_.out_cols;
+            pixel_offset[i] =
+                batch_offset[i] + (out_r * p_.out_cols + out_c) * p_.features;
+          }
+          // The filter is stored as HWCF, so the [features x channels] block
+          // needed here is a transposed load.
+          Index filter_offset =
+              ((win_row * p_.window_cols + win_col) * p_.channels + col) *
+              p_.features;
+          for (Index feature = 0; feature < p_.features; feature += AccTile) {
+            std::array<bool, AccTile> valid_acc;
+            for (int i = 0; i < AccTile; ++i) {
+              valid_acc[i] = feature + i < p_.features;
+            }
+            LhsBlock lhs_block;
+            for (int i = 0; i < RowTile; ++i) {
+              lhs_block.data(i) =
+                  in_window[i]
+                      ? matmul::load_row<LhsVector, AccTile>(
+                            input_ptr + pixel_offset[i] + feature, valid_acc)
+                      : LhsVector{0};
+            }
+            auto rhs_block = matmul::load<AccTile, ColTile, true>(
+                filter_ptr + filter_offset, p_.features, valid_acc, valid_col);
+            matmul::block_mmacc(lhs_block, rhs_block, out_block);
+            filter_offset += AccTile;
+          }
+        }
+      }
+
+      auto out_ptr = output_.get_pointer() + row * p_.channels + col;
+      matmul::store_block<RowTile, ColTile>(out_block, out_ptr, p_.channels,
+                                            valid_row, valid_col);
+    }
+  }
+
+ private:
+  ReadMem<T const, IsUSM> input_;
+  ReadMem<T const, IsUSM> filter_;
+  WriteMem<T, IsUSM> output_;
+  Conv2DParams const p_;
+  Index const n_rows_;
+};
+
+/**
+ * Filter backprop implicit GEMM convolution.
+ *
+ * Each row of the GEMM is a filter element (window row, window column and
+ * channel) and each column a feature. The accumulation dimension runs over
+ * every output pixel in the batch, so the output errors are read as a
+ * contiguous row major matrix while the input values are gathered.
+ */
+template <typename T, typename Index, int RowTile, int AccTile, int ColTile,
+          bool IsUSM>
+struct ImplicitGemmConv2D<T, Index, conv_type::FilterBackprop, RowTile,
+                          AccTile, ColTile, IsUSM> {
+ private:
+  using LhsBlock = matmul::VectorBlock<T, RowTile, AccTile>;
+  using OutBlock = matmul::VectorBlock<T, RowTile, ColTile>;
+  using Load = helpers::io::Load<T>;
+
+ public:
+  ImplicitGemmConv2D(ReadMem<T const, IsUSM> const& input,
+                     ReadMem<T const, IsUSM> const& filter,
+                     WriteMem<T, IsUSM> const& output,
+                     Conv2DParams const& params)
+      : input_{input},
+        filter_{filter},
+        output_{output},
+        p_{params},
+        n_rows_{params.window_rows * params.window_cols * params.channels} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::nd_item<2> item) const {
+    namespace vec_elem = helpers::vector_element;
+    Index const row = item.get_global_id(0) * RowTile;
+    Index const col = item.get_global_id(1) * ColTile;
+
+    if (row < n_rows_ && col < p_.features) {
+      std::array<bool, RowTile> valid_row;
+      std::array<Index, RowTile> row_offset;
+      std::array<Index, RowTile> col_offset;
+      std::array<Index, RowTile> channel;
+      for (int i = 0; i < RowTile; ++i) {
+        valid_row[i] = row + i < n_rows_;
+        auto const pos = helpers::TensorIndexHelper<Index, false>::unflatten3d(
+            row + i, p_.window_cols, p_.window_cols, p_.channels, p_.channels);
+        row_offset[i] = pos.s0 * p_.dilation_rows - p_.pad_rows;
+        col_offset[i] = pos.s1 * p_.dilation_cols - p_.pad_cols;
+        channel[i] = pos.s2;
+      }
+      std::array<bool, ColTile> valid_col;
+      for (int i = 0; i < ColTile; ++i) {
+        valid_col[i] = col + i < p_.features;
+      }
+
+      auto const input_ptr = input_.get_pointer();
+      auto const error_ptr = filter_.get_pointer() + col;
+      auto out_block = OutBlock{};
+      for (Index batch = 0; batch < p_.batch; ++batch) {
+        Index const batch_offset =
+            batch * p_.in_rows * p_.in_cols * p_.channels;
+        for (Index out_row = 0; out_row < p_.out_rows; ++out_row) {
+          std::array<bool, RowTile> valid_in_row;
+          std::array<Index, RowTile> in_row_offset;
+          for (int i = 0; i < RowTile; ++i) {
+            Index const r = out_row * p_.stride_rows + row_offset[i];
+            valid_in_row[i] = valid_row[i] && r >= 0 && r < p_.in_rows;
+            in_row_offset[i] =
+                batch_offset + r * p_.in_cols * p_.channels + channel[i];
+          }
+          Index error_offset =
+              (batch * p_.out_rows + out_row) * p_.out_cols * p_.features;
+          for (Index out_col = 0; out_col < p_.out_cols; out_col += AccTile) {
+            std::array<bool, AccTile> valid_acc;
+            for (int j = 0; j < AccTile; ++j) {
+              valid_acc[j] = out_col + j < p_.out_cols;
+            }
+            LhsBlock lhs_block;
+            for (int i = 0; i < RowTile; ++i) {
+              for (int j = 0; j < AccTile; ++j) {
+                Index const c =
+                    (out_col + j) * p_.stride_cols + col_offset[i];
+                bool const valid = valid_in_row[i] && valid_acc[j] && c >= 0 &&
+                                   c < p_.in_cols;
+                vec_elem::set(
+                    lhs_block.data(i), j,
+                    valid ? Load()(input_ptr,
+                                   in_row_offset[i] + c * p_.channels)
+                          : T{0});
+              }
+            }
+            auto rhs_block = matmul::load_block<AccTile, ColTile>(
+                error_ptr + error_offset, p_.features, valid_acc, valid_col);
+            matmul::block_mmacc(lhs_block, rhs_block, out_block);
+            error_offset += AccTile * p_.features;
+          }
+        }
+      }
+
+      auto out_ptr = output_.get_pointer() + row * p_.features + col;
+      matmul::store_block<RowTile, ColTile>(out_block, out_ptr, p_.features,
+                                            valid_row, valid_col);
+    }
+  }
+
+ private:
+  ReadMem<T const, IsUSM> input_;
+  ReadMem<T const, IsUSM> filter_;
+  WriteMem<T, IsUSM> output_;
+  Conv2DParams const p_;
+  Index const n_rows_;
+};
+
+}  // namespace implicit_gemm
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_SRC_CONV2D_IMPLICIT_GEMM_KERNELS_H_
@@ -0,0 +1,124 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sycldnn/internal/conv2d/implicit_gemm.h"
+
+#include "sycldnn/internal/conv2d/epilogue.h"
+
+#include "sycldnn/format_type.h"
+#include "sycldnn/mem_object.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/conv2d/conv_type.h"
+
+#include "sycldnn/conv2d/params.h"
+#include "sycldnn/conv2d/sizes.h"
+
+#include "src/conv2d/implicit_gemm/queue_implicit_gemm_kernel.h"
+
+#include <CL/sycl.hpp>
+
+#include <stddef.h>
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+#include "sycldnn/export.h"
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+namespace {
+
+// Tile sizes of the implicit GEMM. These must match the sizes instantiated in
+// src/conv2d/CMakeLists.txt.
+constexpr int row_tile = 4;
+constexpr int acc_tile = 4;
+constexpr int col_tile = 4;
+
+}  // namespace
+
+/**
+ * Launch the implicit GEMM convolution, choosing the smallest index type which
+ * can address each of the input, filter and output tensors.
+ */
+template <typename T, typename ConvType, template <typename> class MemObj>
+SNNStatus launch_implicit_gemm(MemObj<T const>& input, MemObj<T const>& filter,
+                               MemObj<T>& output,
+                               EpilogueMem<T, MemObj>& epilogue,
+                               Conv2DParams const& params,
+                               cl::sycl::queue& queue,
+                               const std::vector<cl::sycl::event>& events) {
+  if (params.input_format != DataFormat::NHWC ||
+      params.filter_format != FilterFormat::HWCF || params.groups != 1) {
+    return StatusCode::InvalidAlgorithm;
+  }
+  auto conv_sizes = get_sizes<ConvType>(params);
+  size_t const max_size = std::max(
+      {conv_sizes.input_size, conv_sizes.filter_size, conv_sizes.output_size});
+  if (max_size > static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
+#ifdef SNN_USE_INT64
+    return queue_implicit_gemm<T, int64_t, ConvType, row_tile, acc_tile,
+                               col_tile>(input, filter, output, epilogue,
+                                         params, queue, events);
+#else
+    return StatusCode::IndexExceeded;
+#endif  // SNN_USE_INT64
+  } else {
+    return queue_implicit_gemm<T, int32_t, ConvType, row_tile, acc_tile,
+                               col_tile>(input, filter, output, epilogue,
+                                         params, queue, events);
+  }
+}
+
+#define INSTANTIATE_LAUNCHER(DTYPE, DIR, MEMOBJ)                          \
+  template SNN_EXPORT SNNStatus launch_implicit_gemm<DTYPE, DIR, MEMOBJ>( \
+      MEMOBJ<DTYPE const> & input, MEMOBJ<DTYPE const> & filter,          \
+      MEMOBJ<DTYPE> & output, EpilogueMem<DTYPE, MEMOBJ> & epilogue,      \
+      Conv2DParams const& params, cl::sycl::queue& queue,                 \
+      const std::vector<cl::sycl::event>& events)
+
+#ifdef SNN_ENABLE_USM
+#define INSTANTIATE_FOR_MEMOBJ(DTYPE, DIR)        \
+  INSTANTIATE_LAUNCHER(DTYPE, DIR, USMMemObject); \
+  INSTANTIATE_LAUNCHER(DTYPE, DIR, BufferMemObject);
+#else
+#define INSTANTIATE_FOR_MEMOBJ(DTYPE, DIR) \
+  INSTANTIATE_LAUNCHER(DTYPE, DIR, BufferMemObject);
+
+#endif  // SNN_ENABLE_USM
+
+#define INSTANTIATE_FOR_TYPE(DTYPE)                        \
+  INSTANTIATE_FOR_MEMOBJ(DTYPE, conv_type::Forward);       \
+  INSTANTIATE_FOR_MEMOBJ(DTYPE, conv_type::InputBackprop); \
+  INSTANTIATE_FOR_MEMOBJ(DTYPE, conv_type::FilterBackprop);
+
+INSTANTIATE_FOR_TYPE(float);
+
+#ifdef SNN_USE_DOUBLE
+INSTANTIATE_FOR_TYPE(double);
+#endif  // SNN_USE_DOUBLE
+
+#ifdef SNN_USE_HALF
+INSTANTIATE_FOR_TYPE(cl::sycl::half);
+#endif  // SNN_USE_HALF
+
+#undef INSTANTIATE_FOR_TYPE
+#undef INSTANTIATE_LAUNCHER
+#undef INSTANTIATE_FOR_MEMOBJ
+
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
@@ -0,0 +1,51 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_CONV2D_IMPLICIT_GEMM_QUEUE_IMPLICIT_GEMM_KERNEL_H_
+#define SYCLDNN_SRC_CONV2D_IMPLICIT_GEMM_QUEUE_IMPLICIT_GEMM_KERNEL_H_
+
+#include "sycldnn/mem_object.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/conv2d/params.h"
+
+#include "sycldnn/internal/conv2d/epilogue.h"
+
+#include <CL/sycl.hpp>
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+
+/**
+ * Queue the implicit GEMM convolution kernel, which computes each
+ * RowTile x ColTile block of the output matrix directly from the input
+ * tensors without materialising the im2col patch matrix. The epilogue is
+ * only applied by forward convolutions.
+ */
+template <typename T, typename Index, typename ConvType, int RowTile,
+          int AccTile, int ColTile, template <typename> class MemObj>
+SNNStatus queue_implicit_gemm(MemObj<T const>& input, MemObj<T const>& filter,
+                              MemObj<T>& output,
+                              EpilogueMem<T, MemObj>& epilogue,
+                              Conv2DParams const& params,
+                              cl::sycl::queue& queue,
+                              const std::vector<cl::sycl::event>& events);
+
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_SRC_CONV2D_IMPLICIT_GEMM_QUEUE_IMPLICIT_GEMM_KERNEL_H_
@@ -0,0 +1,90 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_CONV2D_IMPLICIT_GEMM_QUEUE_IMPLICIT_GEMM_KERNEL_IMPL_H_
+#define SYCLDNN_SRC_CONV2D_IMPLICIT_GEMM_QUEUE_IMPLICIT_GEMM_KERNEL_IMPL_H_
+
+#include "sycldnn/mem_object.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/helpers/ratio.h"
+
+#include "sycldnn/conv2d/params.h"
+
+#include "src/conv2d/epilogue/fused_epilogue.h"
+#include "src/conv2d/implicit_gemm/kernels.h"
+#include "src/conv2d/implicit_gemm/queue_implicit_gemm_kernel.h"
+
+#include <CL/sycl.hpp>
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+
+template <typename T, typename Index, typename ConvType, int RowTile,
+          int AccTile, int ColTile, template <typename> class MemObj>
+SNNStatus queue_implicit_gemm(MemObj<T const>& input_mem,
+                              MemObj<T const>& filter_mem,
+                              MemObj<T>& output_mem,
+                              EpilogueMem<T, MemObj>& epilogue,
+                              Conv2DParams const& params,
+                              cl::sycl::queue& queue,
+                              const std::vector<cl::sycl::event>& events) {
+  constexpr bool is_usm = is_usm_obj_v<MemObj<T>, T>;
+  constexpr size_t wg_row = 8;
+  constexpr size_t wg_col = 4;
+
+  auto const gemm_sizes = implicit_gemm::get_gemm_sizes<ConvType>(params);
+  size_t const output_size_row =
+      helpers::round_ratio_up(gemm_sizes.m, RowTile);
+  size_t const output_size_col =
+      helpers::round_ratio_up(gemm_sizes.n, ColTile);
+  size_t const n_row_threads =
+      helpers::round_up_to_nearest_multiple(output_size_row, wg_row);
+  size_t const n_col_threads =
+      helpers::round_up_to_nearest_multiple(output_size_col, wg_col);
+
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    cgh.depends_on(events);
+    auto input = input_mem.read_mem(cgh);
+    auto filter = filter_mem.read_mem(cgh);
+    auto output = output_mem.write_mem(cgh);
+
+    using Functor = implicit_gemm::ImplicitGemmConv2D<
+        T, Index, ConvType, RowTile, AccTile, ColTile, is_usm>;
+    cl::sycl::nd_range<2> const range{
+        cl::sycl::range<2>{n_row_threads, n_col_threads},
+        cl::sycl::range<2>{std::min(wg_row, n_row_threads),
+                           std::min(wg_col, n_col_threads)},
+    };
+
+    if constexpr (std::is_same<ConvType, conv_type::Forward>::value) {
+      auto fused_epilogue = get_fused_epilogue(epilogue, cgh);
+      Functor functor{input, filter, output, fused_epilogue, params};
+      cgh.parallel_for(range, functor);
+    } else {
+      SNN_UNUSED_VAR(epilogue);
+      Functor functor{input, filter, output, params};
+      cgh.parallel_for(range, functor);
+    }
+  });
+  return {event, StatusCode::OK};
+}
+
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_SRC_CONV2D_IMPLICIT_GEMM_QUEUE_IMPLICIT_GEMM_KERNEL_IMPL_H_
@@ -0,0 +1,121 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_CONV2D_SELECTOR_DECISION_TABLE_H_
+#define SYCLDNN_SRC_CONV2D_SELECTOR_DECISION_TABLE_H_
+
+#include "sycldnn/conv2d/algorithm.h"
+#include "sycldnn/conv2d/params.h"
+
+#include "src/helpers/size_bucket.h"
+
+#include <stddef.h>
+#include <cstdlib>
+#include <limits>
+
+/**
+ * \file
+ * Contains the decision tables used to select convolution algorithms from
+ * benchmark results, and the lookup into those tables.
+ */
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+
+/** Bucket value in a DecisionEntry which matches convolutions of any size. */
+constexpr int any_bucket = -1;
+
+/**
+ * An entry in a decision table, giving the fastest algorithm for convolutions
+ * with a square window and stride whose sizes fall into the given buckets.
+ *
+ * The channels, features and positions are bucketed by their base 2
+ * logarithm, as computed by helpers::size_bucket(). The positions are the
+ * number of output elements in each feature map, summed over the batch.
+ */
+struct DecisionEntry {
+  /** The window size. */
+  int window;
+  /** The stride. */
+  int stride;
+  /** The bucket of the number of input channels. */
+  int channels;
+  /** The bucket of the number of output features. */
+  int features;
+  /** The bucket of the batch * out_rows * out_cols output positions. */
+  int positions;
+  /** The fastest algorithm for convolutions matching this entry. */
+  Algorithm algorithm;
+};
+
+/** A decision table for a single device family and convolution type. */
+struct DecisionTable {
+  /** Pointer to the table entries. */
+  DecisionEntry const* entries;
+  /** Number of entries in the table. */
+  size_t size;
+};
+
+/**
+ * Select an algorithm from a decision table.
+ *
+ * Only entries with the same window and stride as the convolution are
+ * considered, and of those the entry with the closest buckets is used. Square
+ * windows and strides are required.
+ *
+ * \param table  The decision table to select from.
+ * \param params The convolution parameters.
+ * \return The algorithm in the closest table entry, or Algorithm::NotSupported
+ *         if the table has no entries for the window and stride.
+ */
+inline Algorithm select_from_table(DecisionTable const& table,
+                                   Conv2DParams const& params) {
+  if (params.window_rows != params.window_cols ||
+      params.stride_rows != params.stride_cols) {
+    return Algorithm::NotSupported;
+  }
+  int const channels = helpers::size_bucket(params.channels);
+  int const features = helpers::size_bucket(params.features);
+  int const positions = helpers::size_bucket(
+      static_cast<size_t>(params.batch) * params.out_rows * params.out_cols);
+  auto distance = [](int entry_bucket, int bucket) {
+    return entry_bucket == any_bucket ? 0 : std::abs(entry_bucket - bucket);
+  };
+
+  Algorithm selected = Algorithm::NotSupported;
+  int best_distance = std::numeric_limits<int>::max();
+  for (size_t i = 0; i < table.size; ++i) {
+    DecisionEntry const& entry = table.entries[i];
+    if (entry.window != params.window_rows ||
+        entry.stride != params.stride_rows) {
+      continue;
+    }
+    int const entry_distance = distance(entry.channels, channels) +
+                               distance(entry.features, features) +
+                               distance(entry.positions, positions);
+    if (entry_distance < best_distance) {
+      best_distance = entry_distance;
+      selected = entry.algorithm;
+    }
+  }
+  return selected;
+}
+
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_SRC_CONV2D_SELECTOR_DECISION_TABLE_H_
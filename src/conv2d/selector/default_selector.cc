@@ -14,15 +14,26 @@
  * limitations under the License.
  */
 #include "sycldnn/conv2d/algorithm.h"
+#include "sycldnn/conv2d/conv_type.h"
 #include "sycldnn/conv2d/params.h"
+#include "sycldnn/data_format.h"
+#include "sycldnn/filter_format.h"
 
 #include "sycldnn/conv2d/selector/default_selector.h"
 #include "sycldnn/helpers/macros.h"
 
 #include "sycldnn/conv2d/selector/selector.h"
 
+#ifdef SNN_SELECTOR_TABLES_GENERATED
+#include "src/conv2d/selector/decision_table.h"
+
+#include "generated/conv2d/selector/selector_tables.h"
+#endif  // SNN_SELECTOR_TABLES_GENERATED
+
+#include <algorithm>
 #include <memory>
 #include <string>
+#include <type_traits>
 
 #include <CL/sycl.hpp>
 
@@ -36,6 +47,114 @@
 
 namespace {
 
+/** Check whether the convolution uses a dilated filter window. */
+bool is_dilated(sycldnn::conv2d::Conv2DParams const& params) {
+  return params.dilation_rows != 1 || params.dilation_cols != 1;
+}
+
+/**
+ * Check whether the convolution must use the direct algorithm because of its
+ * data layout. The other algorithms only support NCHW tensors for the forward
+ * pass, and only when built with NCHW support.
+ */
+template <bool IsForward>
+bool requires_direct(sycldnn::conv2d::Conv2DParams const& params) {
+  if (params.input_format != sycldnn::DataFormat::NCHW) {
+    return false;
+  }
+#ifdef SNN_ENABLE_NCHW
+  return !IsForward;
+#else
+  return true;
+#endif  // SNN_ENABLE_NCHW
+}
+
+/**
+ * Check whether the tiled algorithm provides kernels for the convolution
+ * window. Tiled is supported for 1x1s1, 1x1s2, 3x3s1, 3x3s2, 5x5s1, including
+ * dilated windows.
+ */
+bool supports_tiled_window(sycldnn::conv2d::Conv2DParams const& params) {
+  if (params.stride_rows != params.stride_cols ||
+      params.window_rows != params.window_cols) {
+    return false;
+  }
+  return (params.window_rows == 5 && params.stride_rows == 1) ||
+         ((params.window_rows == 1 || params.window_rows == 3) &&
+          (params.stride_rows == 1 || params.stride_rows == 2));
+}
+
+/**
+ * Choose an algorithm for a group convolution, which is supported by the
+ * direct and tiled algorithms for HWCF filters and by im2col for the forward
+ * pass and HWCF input backprop. The tiled input backprop kernels are not
+ * selected by default, matching the ungrouped input backprop. The tiled filter
+ * backprop kernel handles any window, so is preferred over direct for HWCF.
+ * No algorithm supports group convolutions with NCHW inputs.
+ */
+template <typename ConvType>
+sycldnn::conv2d::Algorithm select_grouped(
+    sycldnn::conv2d::Conv2DParams const& params) {
+  using Forward = sycldnn::conv2d::conv_type::Forward;
+  using FilterBackprop = sycldnn::conv2d::conv_type::FilterBackprop;
+  if (params.input_format != sycldnn::DataFormat::NHWC) {
+    return sycldnn::conv2d::Algorithm::NotSupported;
+  }
+  if (std::is_same<ConvType, FilterBackprop>::value) {
+    return params.filter_format == sycldnn::FilterFormat::HWCF
+               ? sycldnn::conv2d::Algorithm::Tiled
+               : sycldnn::conv2d::Algorithm::Direct;
+  }
+  if (std::is_same<ConvType, Forward>::value &&
+      params.filter_format == sycldnn::FilterFormat::HWCF &&
+      supports_tiled_window(params)) {
+    return sycldnn::conv2d::Algorithm::Tiled;
+  }
+  return sycldnn::conv2d::Algorithm::Im2col;
+}
+
+/** Number of Winograd tiles of size tile x tile needed to cover a tensor. */
+int winograd_tile_count(int batch, int rows, int cols, int tile) {
+  return batch * ((rows + tile - 1) / tile) * ((cols + tile - 1) / tile);
+}
+
+/**
+ * Choose between the Winograd variants for an undilated stride 1 convolution
+ * whose Winograd output tiles cover a rows x cols tensor, or return
+ * NotSupported if Winograd should not be used.
+ *
+ * Larger output tiles cut the number of tiles, and so the batched matmul work,
+ * but their transforms are more expensive and their edge tiles waste more
+ * work. They are only chosen when the channel depth is enough to amortise the
+ * transforms over the matmul, and there are enough tiles that the tensor is
+ * not dominated by partially filled edge tiles.
+ */
+sycldnn::conv2d::Algorithm select_winograd(
+    sycldnn::conv2d::Conv2DParams const& params, int rows, int cols) {
+  int const depth = std::min(params.channels, params.features);
+  if (params.window_rows == 3 && params.window_cols == 3) {
+    if (depth >= 64 && std::min(rows, cols) >= 24 &&
+        winograd_tile_count(params.batch, rows, cols, 6) >= 64) {
+      return sycldnn::conv2d::Algorithm::Winograd6x6;
+    }
+    return sycldnn::conv2d::Algorithm::WinogradLarge;
+  }
+  if ((params.window_rows == 1 && params.window_cols == 3) ||
+      (params.window_rows == 3 && params.window_cols == 1)) {
+    return sycldnn::conv2d::Algorithm::Winograd;
+  }
+  if (params.window_rows == 5 && params.window_cols == 5) {
+    if (depth >= 32 && std::min(rows, cols) >= 16 &&
+        winograd_tile_count(params.batch, rows, cols, 4) >= 64) {
+      return sycldnn::conv2d::Algorithm::Winograd5x5Large;
+    }
+    if (depth >= 16) {
+      return sycldnn::conv2d::Algorithm::Winograd5x5;
+    }
+  }
+  return sycldnn::conv2d::Algorithm::NotSupported;
+}
+
 /**
  * A selector which makes no assumption about the underlying device.
  * This is chosen as a fall-back when the available device is not recognised.
@@ -48,32 +167,28 @@ class DefaultSelector : public sycldnn::conv2d::Selector {
    */
   sycldnn::conv2d::Algorithm select_forward(
       sycldnn::conv2d::Conv2DParams const& params) override {
-    // Im2Col is the only algorithm that supports Grouped Convolution.
     if (params.groups > 1) {
-      return sycldnn::conv2d::Algorithm::Im2col;
+      return select_grouped<sycldnn::conv2d::conv_type::Forward>(params);
+    }
+    if (requires_direct<true>(params)) {
+      return sycldnn::conv2d::Algorithm::Direct;
     }
     // For 1x1s1 the convolution is equivalent to a matrix multiply.
     if (params.stride_rows == 1 && params.stride_cols == 1 &&
         params.window_rows == 1 && params.window_cols == 1) {
       return sycldnn::conv2d::Algorithm::Matmul;
     }
-    // Winograd is supported for 1x3s1, 3x1s1, 3x3s1.
-    if (params.stride_rows == 1 && params.stride_cols == 1) {
-      if (params.window_rows == 3 && params.window_cols == 3) {
-        return sycldnn::conv2d::Algorithm::WinogradLarge;
-      } else if ((params.window_rows == 1 && params.window_cols == 3) ||
-                 (params.window_rows == 3 && params.window_cols == 1)) {
-        return sycldnn::conv2d::Algorithm::Winograd;
+    // Winograd is supported for undilated 1x3s1, 3x1s1, 3x3s1 and 5x5s1.
+    if (params.stride_rows == 1 && params.stride_cols == 1 &&
+        !is_dilated(params)) {
+      auto winograd_algo =
+          select_winograd(params, params.out_rows, params.out_cols);
+      if (winograd_algo != sycldnn::conv2d::Algorithm::NotSupported) {
+        return winograd_algo;
       }
     }
-    // Tiled is supported for 1x1s1, 1x1s2, 3x3s1, 3x3s2, 5x5s1.
-    if (params.stride_rows == params.stride_cols &&
-        params.window_rows == params.window_cols) {
-      if ((params.window_rows == 5 && params.stride_rows == 1) ||
-          ((params.window_rows == 1 || params.window_rows == 3) &&
-           (params.stride_rows == 1 || params.stride_rows == 2))) {
-        return sycldnn::conv2d::Algorithm::Tiled;
-      }
+    if (supports_tiled_window(params)) {
+      return sycldnn::conv2d::Algorithm::Tiled;
     }
     // Fallback to use Im2col for anything else.
     return sycldnn::conv2d::Algorithm::Im2col;
@@ -85,18 +200,25 @@ class DefaultSelector : public sycldnn::conv2d::Selector {
    */
   sycldnn::conv2d::Algorithm select_input_backprop(
       sycldnn::conv2d::Conv2DParams const& params) override {
+    if (params.groups > 1) {
+      return select_grouped<sycldnn::conv2d::conv_type::InputBackprop>(params);
+    }
+    if (requires_direct<false>(params)) {
+      return sycldnn::conv2d::Algorithm::Direct;
+    }
     // For 1x1s1 the convolution is equivalent to a matrix multiply.
     if (params.stride_rows == 1 && params.stride_cols == 1 &&
         params.window_rows == 1 && params.window_cols == 1) {
       return sycldnn::conv2d::Algorithm::Matmul;
     }
-    // Winograd is supported for 1x3s1, 3x1s1, 3x3s1.
-    if (params.stride_rows == 1 && params.stride_cols == 1) {
-      if (params.window_rows == 3 && params.window_cols == 3) {
-        return sycldnn::conv2d::Algorithm::WinogradLarge;
-      } else if ((params.window_rows == 1 && params.window_cols == 3) ||
-                 (params.window_rows == 3 && params.window_cols == 1)) {
-        return sycldnn::conv2d::Algorithm::Winograd;
+    // Winograd is supported for undilated 1x3s1, 3x1s1, 3x3s1 and 5x5s1. The
+    // Winograd tiles cover the input tensor for the input backprop.
+    if (params.stride_rows == 1 && params.stride_cols == 1 &&
+        !is_dilated(params)) {
+      auto winograd_algo =
+          select_winograd(params, params.in_rows, params.in_cols);
+      if (winograd_algo != sycldnn::conv2d::Algorithm::NotSupported) {
+        return winograd_algo;
       }
     }
     // Fallback to use Im2col for anything else.
@@ -109,13 +231,21 @@ class DefaultSelector : public sycldnn::conv2d::Selector {
    */
   sycldnn::conv2d::Algorithm select_filter_backprop(
       sycldnn::conv2d::Conv2DParams const& params) override {
+    if (params.groups > 1) {
+      return select_grouped<sycldnn::conv2d::conv_type::FilterBackprop>(
+          params);
+    }
+    if (requires_direct<false>(params)) {
+      return sycldnn::conv2d::Algorithm::Direct;
+    }
     // For 1x1s1 the convolution is equivalent to a matrix multiply.
     if (params.stride_rows == 1 && params.stride_cols == 1 &&
         params.window_rows == 1 && params.window_cols == 1) {
       return sycldnn::conv2d::Algorithm::Matmul;
     }
-    // Winograd is supported for 1x3s1, 3x1s1, 3x3s1.
-    if (params.stride_rows == 1 && params.stride_cols == 1) {
+    // Winograd is supported for undilated 1x3s1, 3x1s1, 3x3s1.
+    if (params.stride_rows == 1 && params.stride_cols == 1 &&
+        !is_dilated(params)) {
       if (params.window_rows == 3 && params.window_cols == 3) {
         return sycldnn::conv2d::Algorithm::WinogradLarge;
       } else if ((params.window_rows == 1 && params.window_cols == 3) ||
@@ -130,95 +260,94 @@ class DefaultSelector : public sycldnn::conv2d::Selector {
   char const* name() const override { return "DefaultSelector"; }
 };
 
-/** A selector which assumes the underlying device to run on is an Intel CPU. */
-class IntelCPUSelector final : public DefaultSelector {
- public:
-  sycldnn::conv2d::Algorithm select_forward(
-      sycldnn::conv2d::Conv2DParams const& params) override {
-    return this->DefaultSelector::select_forward(params);
-  }
-
-  sycldnn::conv2d::Algorithm select_input_backprop(
-      sycldnn::conv2d::Conv2DParams const& params) override {
-    return this->DefaultSelector::select_input_backprop(params);
-  }
-
-  sycldnn::conv2d::Algorithm select_filter_backprop(
-      sycldnn::conv2d::Conv2DParams const& params) override {
-    return this->DefaultSelector::select_filter_backprop(params);
-  }
-
-  char const* name() const override { return "IntelCPUSelector"; }
-};
-
-/** A selector which assumes the underlying device to run on is an Intel GPU. */
-class IntelGPUSelector final : public DefaultSelector {
+#ifdef SNN_SELECTOR_TABLES_GENERATED
+/**
+ * A selector for a family of devices, which selects algorithms using decision
+ * tables generated from benchmark results by generate_selector_tables.py.
+ *
+ * The benchmarks only cover undilated, ungrouped NHWC convolutions with HWCF
+ * filters, so any other convolutions, and any which are not covered by the
+ * tables, fall back to the DefaultSelector.
+ */
+class TableSelector final : public DefaultSelector {
  public:
-  sycldnn::conv2d::Algorithm select_forward(
-      sycldnn::conv2d::Conv2DParams const& params) override {
-    return this->DefaultSelector::select_forward(params);
-  }
-
-  sycldnn::conv2d::Algorithm select_input_backprop(
-      sycldnn::conv2d::Conv2DParams const& params) override {
-    return this->DefaultSelector::select_input_backprop(params);
-  }
-
-  sycldnn::conv2d::Algorithm select_filter_backprop(
-      sycldnn::conv2d::Conv2DParams const& params) override {
-    return this->DefaultSelector::select_filter_backprop(params);
-  }
-
-  char const* name() const override { return "IntelGPUSelector"; }
-};
+  /**
+   * Construct a selector using the given decision tables.
+   * \param name            The name of the selector.
+   * \param forward         Decision table for forward convolutions.
+   * \param input_backprop  Decision table for input backprop convolutions.
+   * \param filter_backprop Decision table for filter backprop convolutions.
+   */
+  TableSelector(char const* name,
+                sycldnn::conv2d::internal::DecisionTable forward,
+                sycldnn::conv2d::internal::DecisionTable input_backprop,
+                sycldnn::conv2d::internal::DecisionTable filter_backprop)
+      : name_{name},
+        forward_{forward},
+        input_backprop_{input_backprop},
+        filter_backprop_{filter_backprop} {}
 
-/** A selector which assumes the underlying device to run on is an ARM GPU. */
-class ARMGPUSelector final : public DefaultSelector {
- public:
   sycldnn::conv2d::Algorithm select_forward(
       sycldnn::conv2d::Conv2DParams const& params) override {
+    auto algo = select_from(forward_, params);
+    if (algo != sycldnn::conv2d::Algorithm::NotSupported) {
+      return algo;
+    }
     return this->DefaultSelector::select_forward(params);
   }
 
   sycldnn::conv2d::Algorithm select_input_backprop(
       sycldnn::conv2d::Conv2DParams const& params) override {
+    auto algo = select_from(input_backprop_, params);
+    if (algo != sycldnn::conv2d::Algorithm::NotSupported) {
+      return algo;
+    }
     return this->DefaultSelector::select_input_backprop(params);
   }
 
   sycldnn::conv2d::Algorithm select_filter_backprop(
       sycldnn::conv2d::Conv2DParams const& params) override {
+    auto algo = select_from(filter_backprop_, params);
+    if (algo != sycldnn::conv2d::Algorithm::NotSupported) {
+      return algo;
+    }
     return this->DefaultSelector::select_filter_backprop(params);
   }
 
-  char const* name() const override { return "ARMGPUSelector"; }
-};
+  char const* name() const override { return name_; }
 
-/** A selector which assumes the underlying device to run on is an AMD GPU. */
-class AMDGPUSelector final : public DefaultSelector {
- public:
-  sycldnn::conv2d::Algorithm select_forward(
-      sycldnn::conv2d::Conv2DParams const& params) override {
-    return this->DefaultSelector::select_forward(params);
-  }
-
-  sycldnn::conv2d::Algorithm select_input_backprop(
-      sycldnn::conv2d::Conv2DParams const& params) override {
-    return this->DefaultSelector::select_input_backprop(params);
-  }
-
-  sycldnn::conv2d::Algorithm select_filter_backprop(
-      sycldnn::conv2d::Conv2DParams const& params) override {
-    return this->DefaultSelector::select_filter_backprop(params);
+ private:
+  /**
+   * Look up the algorithm in a decision table, or return NotSupported for
+   * convolutions which the benchmarks do not cover.
+   */
+  static sycldnn::conv2d::Algorithm select_from(
+      sycldnn::conv2d::internal::DecisionTable const& table,
+      sycldnn::conv2d::Conv2DParams const& params) {
+    if (is_dilated(params) || params.groups != 1 ||
+        params.input_format != sycldnn::DataFormat::NHWC ||
+        params.filter_format != sycldnn::FilterFormat::HWCF) {
+      return sycldnn::conv2d::Algorithm::NotSupported;
+    }
+    return sycldnn::conv2d::internal::select_from_table(table, params);
   }
 
-  char const* name() const override { return "AMDGPUSelector"; }
+  char const* name_;
+  sycldnn::conv2d::internal::DecisionTable forward_;
+  sycldnn::conv2d::internal::DecisionTable input_backprop_;
+  sycldnn::conv2d::internal::DecisionTable filter_backprop_;
 };
+#endif  // SNN_SELECTOR_TABLES_GENERATED
 
 /** A selector specialised for PowerVR GPUs. */
 class PowerVRSelector final : public DefaultSelector {
  public:
   sycldnn::conv2d::Algorithm select_forward(
       sycldnn::conv2d::Conv2DParams const& params) override {
+    if (is_dilated(params) || requires_direct<true>(params) ||
+        params.groups > 1) {
+      return this->DefaultSelector::select_forward(params);
+    }
     if (params.stride_cols > 1 && params.stride_cols > 1) {
       return sycldnn::conv2d::Algorithm::Im2col;
     }
@@ -257,26 +386,46 @@ namespace conv2d {
 SNN_EXPORT std::unique_ptr<Selector> get_default_selector(
     const cl::sycl::device& device) {
   auto vendor = device.get_info<cl::sycl::info::device::vendor>();
+  bool is_img = vendor.find("Imagination Technologies") != std::string::npos;
+  bool is_gpu = device.is_gpu();
+
+  std::unique_ptr<Selector> selector{};
+
+  // The Intel, AMD and ARM selectors are only available when built with
+  // tables generated from benchmark results of those devices.
+#ifdef SNN_SELECTOR_TABLES_GENERATED
   bool is_intel = vendor.find("Intel(R) Corporation") != std::string::npos;
   bool is_amd =
       vendor.find("Advanced Micro Devices, Inc.") != std::string::npos;
   bool is_arm = vendor.find("ARM") != std::string::npos;
-  bool is_img = vendor.find("Imagination Technologies") != std::string::npos;
-
   bool is_cpu = device.is_cpu();
-  bool is_gpu = device.is_gpu();
-
-  std::unique_ptr<Selector> selector{};
 
+  namespace tables = internal::selector_tables;
   if (is_intel && is_cpu) {
-    selector.reset(new IntelCPUSelector{});
+    selector.reset(new TableSelector{"IntelCPUSelector",
+                                     tables::intel_cpu_forward,
+                                     tables::intel_cpu_input_backprop,
+                                     tables::intel_cpu_filter_backprop});
   } else if (is_intel && is_gpu) {
-    selector.reset(new IntelGPUSelector{});
+    selector.reset(new TableSelector{"IntelGPUSelector",
+                                     tables::intel_gpu_forward,
+                                     tables::intel_gpu_input_backprop,
+                                     tables::intel_gpu_filter_backprop});
   } else if (is_amd && is_gpu) {
-    selector.reset(new AMDGPUSelector{});
+    selector.reset(new TableSelector{"AMDGPUSelector", tables::amd_gpu_forward,
+                                     tables::amd_gpu_input_backprop,
+                                     tables::amd_gpu_filter_backprop});
   } else if (is_arm && is_gpu) {
-    selector.reset(new ARMGPUSelector{});
-  } else if (is_img && is_gpu) {
+    selector.reset(new TableSelector{"ARMGPUSelector", tables::arm_gpu_forward,
+                                     tables::arm_gpu_input_backprop,
+                                     tables::arm_gpu_filter_backprop});
+  }
+  if (selector) {
+    return selector;
+  }
+#endif  // SNN_SELECTOR_TABLES_GENERATED
+
+  if (is_img && is_gpu) {
     selector.reset(new PowerVRSelector{});
   } else {
     selector.reset(new DefaultSelector{});
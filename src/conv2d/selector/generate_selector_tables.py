@@ -0,0 +1,291 @@
+#!/usr/bin/python3
+#
+# Copyright Codeplay Software Ltd.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use these files except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+"""
+Generate the conv2d selector decision tables from benchmark results.
+
+The inputs are the CSV results of the bench/conv2d model benchmarks, for
+example as produced by:
+
+    bench/conv2d/resnet_bench --benchmark_format=csv > resnet.csv
+
+For every device family and convolution type the fastest algorithm is found
+for each benchmarked configuration. Configurations are grouped by window,
+stride and the base 2 logarithm of their channels, features and output
+positions, and the algorithm with the lowest total time over a group is used
+for that group. Windows where a single algorithm is always fastest are
+collapsed into one entry.
+
+The output is a C++ header which is included by
+src/conv2d/selector/default_selector.cc.
+"""
+
+from __future__ import print_function
+
+import argparse
+import csv
+import os
+import re
+import sys
+from collections import defaultdict
+
+FAMILIES = ['intel_cpu', 'intel_gpu', 'amd_gpu', 'arm_gpu']
+
+CONV_TYPES = [
+    ('Forward', 'forward'),
+    ('InputBackprop', 'input_backprop'),
+    ('FilterBackprop', 'filter_backprop'),
+]
+
+# Enumerators of Algorithm which do not name a convolution algorithm.
+NOT_ALGORITHMS = ['NotSupported', 'NumAlgorithms']
+
+DEFAULT_ALGORITHM_HEADER = os.path.join(
+    os.path.dirname(os.path.abspath(__file__)), '..', '..', '..', 'include',
+    'sycldnn', 'conv2d', 'algorithm.h')
+
+ANY_BUCKET = -1
+
+HEADER = """/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_CONV2D_SELECTOR_SELECTOR_TABLES_H_
+#define SYCLDNN_SRC_CONV2D_SELECTOR_SELECTOR_TABLES_H_
+
+// DO NOT MODIFY BY HAND
+// This file was automatically generated by generate_selector_tables.py.
+// Results for {num_results} benchmarks were used to generate this file.
+
+#include "src/conv2d/selector/decision_table.h"
+
+/**
+ * \\file
+ * Contains the decision tables used by the device specific selectors in
+ * default_selector.cc. Empty tables defer all selections to the
+ * DefaultSelector.
+ */
+
+namespace sycldnn {{
+namespace conv2d {{
+namespace internal {{
+namespace selector_tables {{
+"""
+
+FOOTER = """
+}  // namespace selector_tables
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_SRC_CONV2D_SELECTOR_SELECTOR_TABLES_H_
+"""
+
+
+def size_bucket(size):
+    """ Get the bucket of a size, matching src/helpers/size_bucket.h. """
+    return max(int(size), 1).bit_length() - 1
+
+
+def read_results(filename):
+    """ Read the rows of a benchmark CSV file, skipping the context lines. """
+    with open(filename) as inp:
+        lines = inp.readlines()
+    for start, line in enumerate(lines):
+        if line.startswith('name,'):
+            return list(csv.DictReader(lines[start:]))
+    print('No benchmark results found in {}'.format(filename), file=sys.stderr)
+    return []
+
+
+def parse_label(label):
+    """ Split a benchmark label of comma separated key=value pairs. """
+    return dict(kv.split('=', 1) for kv in label.split(',') if '=' in kv)
+
+
+def get_family(label):
+    """ Get the device family of a benchmark from its device info. """
+    vendor = label.get('vendor_name', '')
+    device = label.get('device_name', '')
+    if 'Intel' in vendor:
+        if re.search(r'CPU|Xeon|Core\(TM\)', device):
+            return 'intel_cpu'
+        return 'intel_gpu'
+    if 'Advanced Micro Devices' in vendor:
+        return 'amd_gpu'
+    if 'ARM' in vendor:
+        return 'arm_gpu'
+    return None
+
+
+def read_algorithms(filename):
+    """ Read the names of the algorithms in the Algorithm enum. """
+    with open(filename) as inp:
+        source = inp.read()
+    source = re.sub(r'/\*.*?\*/|//[^\n]*', '', source, flags=re.S)
+    enum = re.search(r'enum class Algorithm\s*{([^}]*)}', source)
+    if enum is None:
+        sys.exit('No Algorithm enum found in {}'.format(filename))
+    names = [name.strip() for name in enum.group(1).split(',')]
+    return [name for name in names if name and name not in NOT_ALGORITHMS]
+
+
+def get_algorithm(label, algorithms):
+    """ Get the algorithm benchmarked, from the name of the selector used. """
+    selector = label.get('@selector', '')
+    if selector.endswith('Selector'):
+        selector = selector[:-len('Selector')]
+    return selector if selector in algorithms else None
+
+
+def collect_timings(filenames, algorithms):
+    """
+    Collect the fastest time of each algorithm for each benchmarked
+    convolution, keyed by device family, convolution type and convolution
+    configuration.
+    """
+    timings = defaultdict(lambda: defaultdict(dict))
+    num_results = 0
+    for filename in filenames:
+        for row in read_results(filename):
+            if row.get('error_occurred', '').lower() == 'true':
+                continue
+            label = parse_label(row.get('label', ''))
+            if label.get('@library') != 'SYCL-DNN':
+                continue
+            family = get_family(label)
+            algorithm = get_algorithm(label, algorithms)
+            conv_type = label.get('@conv_type')
+            if family is None or algorithm is None or conv_type is None:
+                continue
+            sizes = {
+                key: int(float(row[key]))
+                for key in [
+                    'batch', 'channels', 'features', 'out_rows', 'out_cols',
+                    'fil_rows', 'fil_cols', 'stride_rows', 'stride_cols'
+                ]
+            }
+            if (sizes['fil_rows'] != sizes['fil_cols'] or
+                    sizes['stride_rows'] != sizes['stride_cols']):
+                continue
+            config = (sizes['fil_rows'], sizes['stride_rows'],
+                      sizes['channels'], sizes['features'],
+                      sizes['batch'] * sizes['out_rows'] * sizes['out_cols'])
+            time = float(row['real_time'])
+            algo_times = timings[(family, conv_type)][config]
+            algo_times[algorithm] = min(time,
+                                        algo_times.get(algorithm, time))
+            num_results += 1
+    return timings, num_results
+
+
+def choose_algorithm(configs):
+    """
+    Choose the algorithm for a group of configurations. Prefer the algorithm
+    with the lowest total time among those which ran every configuration, and
+    otherwise the algorithm which was fastest for the most configurations.
+    """
+    common = set.intersection(*[set(times) for times in configs])
+    if common:
+        return min(
+            sorted(common),
+            key=lambda algo: sum(times[algo] for times in configs))
+    wins = defaultdict(int)
+    for times in configs:
+        wins[min(sorted(times), key=lambda algo: times[algo])] += 1
+    return max(sorted(wins), key=lambda algo: wins[algo])
+
+
+def build_table(configs):
+    """ Build the decision table entries for one family and conv type. """
+    buckets = defaultdict(list)
+    for config, times in configs.items():
+        window, stride, channels, features, positions = config
+        key = (window, stride, size_bucket(channels), size_bucket(features),
+               size_bucket(positions))
+        buckets[key].append(times)
+
+    by_window = defaultdict(list)
+    for key in sorted(buckets):
+        by_window[key[:2]].append(key[2:] + (choose_algorithm(buckets[key]),))
+
+    entries = []
+    for (window, stride), window_entries in sorted(by_window.items()):
+        if len(set(entry[-1] for entry in window_entries)) == 1:
+            entries.append((window, stride, ANY_BUCKET, ANY_BUCKET, ANY_BUCKET,
+                            window_entries[0][-1]))
+        else:
+            entries.extend((window, stride) + entry for entry in window_entries)
+    return entries
+
+
+def format_table(name, entries):
+    """ Format the C++ definition of a decision table. """
+    if not entries:
+        return 'constexpr DecisionTable {}{{nullptr, 0}};\n'.format(name)
+    lines = ['constexpr DecisionEntry {}_entries[] = {{'.format(name)]
+    for entry in entries:
+        buckets = [
+            'any_bucket' if bucket == ANY_BUCKET else str(bucket)
+            for bucket in entry[2:5]
+        ]
+        lines.append('    {{{}, {}, {}, Algorithm::{}}},'.format(
+            entry[0], entry[1], ', '.join(buckets), entry[5]))
+    lines.append('};')
+    lines.append('constexpr DecisionTable {0}{{{0}_entries, {1}}};'.format(
+        name, len(entries)))
+    return '\n'.join(lines) + '\n'
+
+
+def generate_selector_tables(filenames, output, algorithm_header):
+    algorithms = read_algorithms(algorithm_header)
+    timings, num_results = collect_timings(filenames, algorithms)
+    tables = []
+    for family in FAMILIES:
+        for conv_type, suffix in CONV_TYPES:
+            entries = build_table(timings.get((family, conv_type), {}))
+            tables.append(format_table(family + '_' + suffix, entries))
+    with open(output, 'w') as out:
+        out.write(HEADER.format(num_results=num_results))
+        for table in tables:
+            out.write('\n')
+            out.write(table)
+        out.write(FOOTER)
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description=__doc__.split('\n\n')[0])
+    parser.add_argument(
+        '--output', required=True, help='Path of the header to generate')
+    parser.add_argument(
+        '--algorithm-header',
+        default=DEFAULT_ALGORITHM_HEADER,
+        help='Path of sycldnn/conv2d/algorithm.h')
+    parser.add_argument(
+        'results', nargs='*', help='Benchmark results in CSV format')
+    args = parser.parse_args()
+    generate_selector_tables(args.results, args.output,
+                             args.algorithm_header)
@@ -0,0 +1,251 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_CONV2D_TILED_FILTER_BACKPROP_KERNELS_H_
+#define SYCLDNN_SRC_CONV2D_TILED_FILTER_BACKPROP_KERNELS_H_
+
+#include "sycldnn/accessor_types.h"
+
+#include "sycldnn/conv2d/params.h"
+
+#include "sycldnn/helpers/macros.h"
+#include "sycldnn/helpers/minmax.h"
+#include "sycldnn/helpers/ratio.h"
+
+#include "src/helpers/group_index.h"
+#include "src/helpers/math.h"
+#include "src/helpers/tensor_index.h"
+#include "src/helpers/vector_io.h"
+#include "src/helpers/vector_type.h"
+#include "src/helpers/workgroup_reduce.h"
+
+#include <CL/sycl.hpp>
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+namespace tiled {
+
+/**
+ * Tiled filter backprop kernel for NHWC inputs and HWCF filters.
+ *
+ * The kernel is launched over a 2D range. Each column of work items computes
+ * a vector of VectorWidth features of the filter gradient for a single filter
+ * row, filter column and channel. The work items in a column are all in the
+ * same work-group, and split the batch * out_cols output positions between
+ * them, with each work item looping over the output rows of its positions.
+ * The partial sums are then reduced across the work-group in local memory.
+ *
+ * When the filter gradient has too few vectors to occupy the device, the
+ * output rows are split into n_splits chunks. Each chunk is reduced by its
+ * own column of work items, which writes a partial filter gradient at an
+ * offset of split * filter_size in the output. These partial gradients are
+ * summed by TiledFilterBackpropCombine.
+ *
+ * The number of work items in each column must be a power of two.
+ */
+template <typename T, typename Index, int VectorWidth, bool IsUSM>
+struct TiledFilterBackprop {
+  using DataType = typename helpers::VectorType<T, VectorWidth>::type;
+  using ScalarLoad = helpers::io::Load<T>;
+  using Load = helpers::io::Load<DataType>;
+  using Store = helpers::io::Store<DataType>;
+
+  TiledFilterBackprop(Index n_reduce_items, Index n_splits,
+                      Conv2DParams const& params,
+                      ReadMem<T const, IsUSM> const& input,
+                      ReadMem<T const, IsUSM> const& output_grad,
+                      LocalAccessor<T> const& workspace,
+                      WriteMem<T, IsUSM> const& filter_grad)
+      : n_reduce_items_{n_reduce_items},
+        n_filter_vectors_{params.window_rows * params.window_cols *
+                          (params.channels / params.groups) *
+                          (params.features / VectorWidth)},
+        n_splits_{n_splits},
+        rows_per_split_{helpers::round_ratio_up_above_zero(params.out_rows,
+                                                           n_splits)},
+        n_positions_{params.batch * params.out_cols},
+        channels_{params.channels},
+        features_{params.features},
+        in_rows_{params.in_rows},
+        in_cols_{params.in_cols},
+        window_cols_{params.window_cols},
+        out_rows_{params.out_rows},
+        out_cols_{params.out_cols},
+        stride_rows_{params.stride_rows},
+        stride_cols_{params.stride_cols},
+        dilation_rows_{params.dilation_rows},
+        dilation_cols_{params.dilation_cols},
+        pad_rows_{params.pad_rows},
+        pad_cols_{params.pad_cols},
+        group_index_{params.groups, params.channels, params.features,
+                     params.group_format},
+        input_{input},
+        output_grad_{output_grad},
+        workspace_{workspace},
+        filter_grad_{filter_grad} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::nd_item<2> item) const {
+    Index const reduce_idx = item.get_local_id(0);
+    Index const global_idx = item.get_global_id(1);
+    Index const split = global_idx / n_filter_vectors_;
+    Index const fil_idx = global_idx - split * n_filter_vectors_;
+
+    DataType out_val{0};
+    if (split < n_splits_) {
+      auto const input_data = input_.get_pointer();
+      auto const error_data = output_grad_.get_pointer();
+
+      auto const filter_idx =
+          helpers::TensorIndexHelper<Index, false>::unflatten4d(
+              fil_idx, window_cols_, window_cols_, group_index_.channels,
+              group_index_.channels, features_ / VectorWidth,
+              features_ / VectorWidth);
+      Index const feature = filter_idx.s3 * VectorWidth;
+      Index const group = group_index_.group_of_feature(feature);
+      Index const channel = group_index_.first_channel(group) +
+                            filter_idx.s2 * group_index_.stride();
+      Index const row_offset = filter_idx.s0 * dilation_rows_ - pad_rows_;
+      Index const col_offset = filter_idx.s1 * dilation_cols_ - pad_cols_;
+
+      // Only the output rows whose window includes an input row contribute.
+      Index const first_row =
+          row_offset >= 0 ? 0
+                          : (stride_rows_ - 1 - row_offset) / stride_rows_;
+      Index const last_row = in_rows_ - 1 - row_offset;
+      Index const end_row =
+          last_row < 0 ? 0
+                       : helpers::min(out_rows_, last_row / stride_rows_ + 1);
+      Index const row_begin = helpers::max(first_row, split * rows_per_split_);
+      Index const row_end =
+          helpers::min(end_row, (split + 1) * rows_per_split_);
+
+      for (Index pos = reduce_idx; pos < n_positions_;
+           pos += n_reduce_items_) {
+        auto const pos_idx =
+            helpers::TensorIndexHelper<Index, false>::unflatten2d(
+                pos, out_cols_, out_cols_);
+        Index const batch = pos_idx.s0;
+        Index const out_col = pos_idx.s1;
+        Index const in_col = out_col * stride_cols_ + col_offset;
+        if (in_col < 0 || in_col >= in_cols_) {
+          continue;
+        }
+        Index in_idx =
+            ((batch * in_rows_ + row_begin * stride_rows_ + row_offset) *
+                 in_cols_ +
+             in_col) *
+                channels_ +
+            channel;
+        Index error_idx =
+            ((batch * out_rows_ + row_begin) * out_cols_ + out_col) *
+                features_ +
+            feature;
+        for (Index row = row_begin; row < row_end; ++row) {
+          DataType in_val{ScalarLoad()(input_data, in_idx)};
+          DataType error_val = Load()(error_data, error_idx);
+          out_val = helpers::math::mad(in_val, error_val, out_val);
+
+          in_idx += stride_rows_ * in_cols_ * channels_;
+          error_idx += out_cols_ * features_;
+        }
+      }
+    }
+
+    // The reduction has to be outside any conditional, to ensure that all
+    // work items reach the barriers used in the reduction.
+    out_val = helpers::reduce::workgroup_reduce<helpers::reduce::Sum, Index>(
+        out_val, item,
+        workspace_.template get_multi_ptr<sycl::access::decorated::legacy>());
+
+    if (reduce_idx == 0 && split < n_splits_) {
+      auto output_data = filter_grad_.get_pointer();
+      Store()(output_data,
+              (split * n_filter_vectors_ + fil_idx) * VectorWidth, out_val);
+    }
+  }
+
+ private:
+  Index const n_reduce_items_;
+  Index const n_filter_vectors_;
+  Index const n_splits_;
+  Index const rows_per_split_;
+  Index const n_positions_;
+  Index const channels_;
+  Index const features_;
+  Index const in_rows_;
+  Index const in_cols_;
+  Index const window_cols_;
+  Index const out_rows_;
+  Index const out_cols_;
+  Index const stride_rows_;
+  Index const stride_cols_;
+  Index const dilation_rows_;
+  Index const dilation_cols_;
+  Index const pad_rows_;
+  Index const pad_cols_;
+  helpers::GroupIndex<Index> const group_index_;
+  ReadMem<T const, IsUSM> const input_;
+  ReadMem<T const, IsUSM> const output_grad_;
+  LocalAccessor<T> workspace_;
+  WriteMem<T, IsUSM> filter_grad_;
+};
+
+/**
+ * Sum the partial filter gradients written by a split TiledFilterBackprop.
+ *
+ * The kernel is launched over a 1D range with one work item for each vector
+ * of VectorWidth elements in the filter gradient.
+ */
+template <typename T, typename Index, int VectorWidth, bool IsUSM>
+struct TiledFilterBackpropCombine {
+  using DataType = typename helpers::VectorType<T, VectorWidth>::type;
+  using Load = helpers::io::Load<DataType>;
+  using Store = helpers::io::Store<DataType>;
+
+  TiledFilterBackpropCombine(Index filter_size, Index n_splits,
+                             ReadMem<T const, IsUSM> const& partials,
+                             WriteMem<T, IsUSM> const& filter_grad)
+      : filter_size_{filter_size},
+        n_splits_{n_splits},
+        partials_{partials},
+        filter_grad_{filter_grad} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::item<1> item) const {
+    Index const idx = item.get_id(0) * VectorWidth;
+    auto const partials_data = partials_.get_pointer();
+
+    DataType out_val = Load()(partials_data, idx);
+    for (Index split = 1; split < n_splits_; ++split) {
+      out_val += Load()(partials_data, split * filter_size_ + idx);
+    }
+
+    auto output_data = filter_grad_.get_pointer();
+    Store()(output_data, idx, out_val);
+  }
+
+ private:
+  Index const filter_size_;
+  Index const n_splits_;
+  ReadMem<T const, IsUSM> const partials_;
+  WriteMem<T, IsUSM> filter_grad_;
+};
+
+}  // namespace tiled
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_SRC_CONV2D_TILED_FILTER_BACKPROP_KERNELS_H_
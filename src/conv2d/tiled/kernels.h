@@ -22,6 +22,7 @@
 #include "sycldnn/conv2d/params.h"
 
 #include "src/helpers/fast_div.h"
+#include "src/helpers/group_index.h"
 #include "src/helpers/math.h"
 #include "src/helpers/register_tile.h"
 #include "src/helpers/tensor_index.h"
@@ -30,6 +31,7 @@
 #include "src/helpers/vector_type.h"
 #include "src/helpers/window_index.h"
 
+#include "src/conv2d/epilogue/fused_epilogue.h"
 #include "src/conv2d/tiled/tile_info.h"
 #include "src/conv2d/tiled/tiles.h"
 
@@ -53,6 +55,10 @@ struct TiledConv2D;
  * be controlled using the FeatureVectorWidth template. The channel
  * vectorisation needs the kernel to be modified so that the loop over the
  * channels is split into a vectorised part and a scalar part.
+ *
+ * Grouped convolutions are supported, as long as each vector of channels and
+ * features is contained in a single group. The loop over the channels then
+ * only covers the channels in the output feature's group.
  */
 template <typename T, typename Index, int OutTileRows, int OutTileCols,
           int ChannelVectorWidth, int FeatureVectorWidth, bool UseFastDiv,
@@ -73,8 +79,8 @@ struct TiledConv2D<T, Index, conv_type::Forward, OutTileRows, OutTileCols,
 
  public:
   TiledConv2D(ReadMem<T const, IsUSM> input, ReadMem<T const, IsUSM> filter,
-              WriteMem<T, IsUSM> output, Conv2DParams const& params,
-              TileInfo const& tile_info)
+              WriteMem<T, IsUSM> output, FusedEpilogue<T, IsUSM> epilogue,
+              Conv2DParams const& params, TileInfo const& tile_info)
       : n_tile_cols_{tile_info.n_cols},
         n_tile_rows_{tile_info.n_rows},
         n_feature_vectors_{tile_info.output_vectors},
@@ -92,9 +98,14 @@ struct TiledConv2D<T, Index, conv_type::Forward, OutTileRows, OutTileCols,
         out_cols_{params.out_cols},
         pad_rows_{params.pad_rows},
         pad_cols_{params.pad_cols},
+        dilation_rows_{params.dilation_rows},
+        dilation_cols_{params.dilation_cols},
+        group_index_{params.groups, params.channels, params.features,
+                     params.group_format},
         input_mem_{std::move(input)},
         filter_mem_{std::move(filter)},
-        output_mem_{std::move(output)} {}
+        output_mem_{std::move(output)},
+        epilogue_{std::move(epilogue)} {}
 
   void SNN_ALWAYS_INLINE operator()(cl::sycl::item<1> item) const {
     Index const index = item.get_id(0);
@@ -109,8 +120,15 @@ struct TiledConv2D<T, Index, conv_type::Forward, OutTileRows, OutTileCols,
               index, div_n_tile_rows_, n_tile_rows_, div_n_tile_cols_,
               n_tile_cols_, div_feature_vectors_, n_feature_vectors_);
       Index const feature = tensor_idx.s3 * FeatureVectorWidth;
-      Index const col_idx = tensor_idx.s2 * OutTileCols;
-      Index const row_idx = tensor_idx.s1 * OutTileRows;
+      // With dilation the outputs are split into phases, where each phase
+      // only uses every dilation'th input row and column, so is a dense
+      // convolution. The tiles of each phase are interleaved.
+      Index const col_phase = tensor_idx.s2 % dilation_cols_;
+      Index const col_idx =
+          col_phase + (tensor_idx.s2 - col_phase) * OutTileCols;
+      Index const row_phase = tensor_idx.s1 % dilation_rows_;
+      Index const row_idx =
+          row_phase + (tensor_idx.s1 - row_phase) * OutTileRows;
       Index const batch = tensor_idx.s0;
 
       const auto col_window =
@@ -121,27 +139,37 @@ struct TiledConv2D<T, Index, conv_type::Forward, OutTileRows, OutTileCols,
       const Index rstart = row_window.window_start;
 
       Output out_tile{};
+      Index const group = group_index_.group_of_feature(feature);
+      Index const group_channels = group_index_.channels;
       Index filter_offset = feature;
-      Index input_channel_offset = batch * in_cols_ * in_rows_ * channels_;
-      for (Index channel = 0; channel < channels_;
+      Index input_channel_offset = batch * in_cols_ * in_rows_ * channels_ +
+                                   group_index_.first_channel(group);
+      for (Index channel = 0; channel < group_channels;
            channel += ChannelVectorWidth) {
-        Filter filter_tile{filter_data, filter_offset, channels_, features_};
+        Filter filter_tile{filter_data, filter_offset, group_channels,
+                           features_};
 
         Index input_offset =
             input_channel_offset + rstart * in_cols_ * channels_;
         for (Index i = 0; i < InputTileRows; ++i) {
-          if (rstart + i >= 0 && rstart + i < in_rows_) {
-            auto input_tile = Input::load_input_row(
-                input_data, input_offset, cstart, in_cols_, channels_);
+          Index const row = rstart + i * dilation_rows_;
+          if (row >= 0 && row < in_rows_) {
+            auto input_tile = Input::load_dilated_input_row(
+                input_data, input_offset, cstart, dilation_cols_, in_cols_,
+                channels_);
             convolve_tile(input_tile, filter_tile, out_tile, i);
           }
-          input_offset += in_cols_ * channels_;
+          input_offset += dilation_rows_ * in_cols_ * channels_;
         }
-        input_channel_offset += ChannelVectorWidth;
+        input_channel_offset += ChannelVectorWidth * group_index_.stride();
         filter_offset += ChannelVectorWidth * features_;
       }
-      out_tile.write_out(output_data, batch, row_idx, out_rows_, col_idx,
-                         out_cols_, feature, features_);
+      out_tile.apply_epilogue(epilogue_, batch, row_idx, dilation_rows_,
+                              out_rows_, col_idx, dilation_cols_, out_cols_,
+                              feature, features_);
+      out_tile.write_out_dilated(output_data, batch, row_idx, dilation_rows_,
+                                 out_rows_, col_idx, dilation_cols_,
+                                 out_cols_, feature, features_);
     }
   }
 
@@ -205,9 +233,13 @@ struct TiledConv2D<T, Index, conv_type::Forward, OutTileRows, OutTileCols,
   const Index out_cols_;
   const Index pad_rows_;
   const Index pad_cols_;
+  const Index dilation_rows_;
+  const Index dilation_cols_;
+  const helpers::GroupIndex<Index> group_index_;
   const ReadMem<const T, IsUSM> input_mem_;
   const ReadMem<const T, IsUSM> filter_mem_;
   WriteMem<T, IsUSM> output_mem_;
+  FusedEpilogue<T, IsUSM> const epilogue_;
 };
 template <typename T, typename Index, int OutTileRows, int OutTileCols,
           int ChannelVectorWidth, int FeatureVectorWidth, bool UseFastDiv,
@@ -247,6 +279,8 @@ struct TiledConv2D<T, Index, conv_type::InputBackprop, OutTileRows, OutTileCols,
         out_cols_{params.out_cols},
         pad_rows_{params.pad_rows},
         pad_cols_{params.pad_cols},
+        group_index_{params.groups, params.channels, params.features,
+                     params.group_format},
         input_mem_{std::move(input)},
         filter_mem_{std::move(filter)},
         output_mem_{std::move(output)} {}
@@ -279,12 +313,19 @@ struct TiledConv2D<T, Index, conv_type::InputBackprop, OutTileRows, OutTileCols,
 
       Output out_tile{};
 
-      Index filter_offset = channel * features_;
-      Index input_feat_offset = batch * out_cols_ * out_rows_ * features_;
-      for (Index feature = 0; feature < features_;
+      // The filter only holds the channels in a single group, and each
+      // channel only depends on the features in its group.
+      Index const group = group_index_.group_of_channel(channel);
+      Index const group_channels = group_index_.channels;
+      Index const feature_stride = FeatureVectorWidth * group_index_.stride();
+      Index filter_offset = group_index_.channel_in_group(channel) * features_ +
+                            group_index_.first_feature(group);
+      Index input_feat_offset = batch * out_cols_ * out_rows_ * features_ +
+                                group_index_.first_feature(group);
+      for (Index feature = 0; feature < group_index_.features;
            feature += FeatureVectorWidth) {
-        Filter filter_tile{filter_data, filter_offset, channels_, features_,
-                           mirror_filter_tag{}};
+        Filter filter_tile{filter_data, filter_offset, group_channels,
+                           features_, mirror_filter_tag{}};
 
         Index input_offset = input_feat_offset + rstart * out_cols_ * features_;
         for (Index r = rstart, i = first_row; i < InputTileRows;
@@ -296,8 +337,8 @@ struct TiledConv2D<T, Index, conv_type::InputBackprop, OutTileRows, OutTileCols,
           }
           input_offset += out_cols_ * features_;
         }
-        input_feat_offset += FeatureVectorWidth;
-        filter_offset += FeatureVectorWidth;
+        input_feat_offset += feature_stride;
+        filter_offset += feature_stride;
       }
       out_tile.write_out(output_data, batch, row_idx, in_rows_, col_idx,
                          in_cols_, channel, channels_);
@@ -389,6 +430,7 @@ struct TiledConv2D<T, Index, conv_type::InputBackprop, OutTileRows, OutTileCols,
   const Index out_cols_;
   const Index pad_rows_;
   const Index pad_cols_;
+  const helpers::GroupIndex<Index> group_index_;
   const ReadMem<const T, IsUSM> input_mem_;
   const ReadMem<const T, IsUSM> filter_mem_;
   WriteMem<T, IsUSM> output_mem_;
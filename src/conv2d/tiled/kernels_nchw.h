@@ -0,0 +1,202 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_CONV2D_TILED_KERNELS_NCHW_H_
+#define SYCLDNN_SRC_CONV2D_TILED_KERNELS_NCHW_H_
+
+#include "sycldnn/accessor_types.h"
+
+#include "sycldnn/conv2d/params.h"
+
+#include "src/helpers/fast_div.h"
+#include "src/helpers/math.h"
+#include "src/helpers/tensor_index.h"
+#include "src/helpers/window_index.h"
+
+#include "src/conv2d/epilogue/fused_epilogue.h"
+#include "src/conv2d/tiled/tile_info.h"
+#include "src/conv2d/tiled/tiles.h"
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+namespace tiled {
+
+/**
+ * Forward convolution of an NCHW input with an FCHW filter, using the same
+ * tiled direct computation as the NHWC TiledConv2D kernel.
+ *
+ * Each work item computes an OutTileRows x OutTileCols tile of a single
+ * output feature plane. The work items are ordered so that neighbouring items
+ * compute neighbouring tiles in the same plane, and so read neighbouring input
+ * rows. The NCHW layout does not allow vectorising over channels or features,
+ * so the tiles hold scalar values.
+ */
+template <typename T, typename Index, int OutTileRows, int OutTileCols,
+          bool UseFastDiv, int WindowRows, int WindowCols, int Stride,
+          bool IsUSM>
+struct TiledConv2DNCHW {
+ private:
+  using IndexDivType = typename fast_div::IndexDiv<Index, UseFastDiv>::type;
+  static constexpr auto InputTileCols = (OutTileCols - 1) * Stride + WindowCols;
+  static constexpr auto InputTileRows = (OutTileRows - 1) * Stride + WindowRows;
+  using Input = InputRow<T, 1, InputTileCols>;
+  using Filter = FilterTile<T, 1, 1, WindowRows, WindowCols>;
+  using Output = OutputTile<T, 1, OutTileRows, OutTileCols>;
+
+ public:
+  TiledConv2DNCHW(ReadMem<T const, IsUSM> input,
+                  ReadMem<T const, IsUSM> filter, WriteMem<T, IsUSM> output,
+                  FusedEpilogue<T, IsUSM> epilogue, Conv2DParams const& params,
+                  TileInfo const& tile_info)
+      : n_tile_cols_{tile_info.n_cols},
+        n_tile_rows_{tile_info.n_rows},
+        div_features_{params.features},
+        div_n_tile_cols_{n_tile_cols_},
+        div_n_tile_rows_{n_tile_rows_},
+        n_elems_{params.batch * params.features * n_tile_rows_ *
+                 n_tile_cols_},
+        channels_{params.channels},
+        features_{params.features},
+        in_rows_{params.in_rows},
+        in_cols_{params.in_cols},
+        out_rows_{params.out_rows},
+        out_cols_{params.out_cols},
+        pad_rows_{params.pad_rows},
+        pad_cols_{params.pad_cols},
+        dilation_rows_{params.dilation_rows},
+        dilation_cols_{params.dilation_cols},
+        input_mem_{std::move(input)},
+        filter_mem_{std::move(filter)},
+        output_mem_{std::move(output)},
+        epilogue_{std::move(epilogue)} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::item<1> item) const {
+    Index const index = item.get_id(0);
+
+    if (index < n_elems_) {
+      auto input_data = input_mem_.get_pointer();
+      auto filter_data = filter_mem_.get_pointer();
+      auto output_data = output_mem_.get_pointer();
+
+      auto const tensor_idx =
+          helpers::TensorIndexHelper<Index, UseFastDiv>::unflatten4d(
+              index, div_features_, features_, div_n_tile_rows_,
+              n_tile_rows_, div_n_tile_cols_, n_tile_cols_);
+      Index const batch = tensor_idx.s0;
+      Index const feature = tensor_idx.s1;
+      // The dilation phases are interleaved in the same way as the NHWC
+      // kernel.
+      Index const row_phase = tensor_idx.s2 % dilation_rows_;
+      Index const row_idx =
+          row_phase + (tensor_idx.s2 - row_phase) * OutTileRows;
+      Index const col_phase = tensor_idx.s3 % dilation_cols_;
+      Index const col_idx =
+          col_phase + (tensor_idx.s3 - col_phase) * OutTileCols;
+
+      const auto col_window =
+          helpers::in_window_from_output(col_idx, Stride, pad_cols_);
+      const Index cstart = col_window.window_start;
+      const auto row_window =
+          helpers::in_window_from_output(row_idx, Stride, pad_rows_);
+      const Index rstart = row_window.window_start;
+
+      Output out_tile{};
+      Index const plane_size = in_rows_ * in_cols_;
+      Index filter_offset = feature * channels_ * WindowRows * WindowCols;
+      Index input_plane_offset = batch * channels_ * plane_size;
+      for (Index channel = 0; channel < channels_; ++channel) {
+        // An FCHW filter is an HWCF filter with a single channel and feature,
+        // so the filter and input tiles are loaded with unit strides.
+        Filter filter_tile{filter_data, filter_offset, Index{1}, Index{1}};
+
+        Index input_offset = input_plane_offset + rstart * in_cols_;
+        for (Index i = 0; i < InputTileRows; ++i) {
+          Index const row = rstart + i * dilation_rows_;
+          if (row >= 0 && row < in_rows_) {
+            auto input_tile = Input::load_dilated_input_row(
+                input_data, input_offset, cstart, dilation_cols_, in_cols_,
+                Index{1});
+            convolve_tile(input_tile, filter_tile, out_tile, i);
+          }
+          input_offset += dilation_rows_ * in_cols_;
+        }
+        input_plane_offset += plane_size;
+        filter_offset += WindowRows * WindowCols;
+      }
+      Index const plane = batch * features_ + feature;
+      out_tile.apply_epilogue_nchw(epilogue_, plane, row_idx, dilation_rows_,
+                                   out_rows_, col_idx, dilation_cols_,
+                                   out_cols_, feature);
+      // Writing an NCHW plane is the same as writing an NHWC tensor with a
+      // single feature and a batch for each plane.
+      out_tile.write_out_dilated(output_data, plane, row_idx, dilation_rows_,
+                                 out_rows_, col_idx, dilation_cols_,
+                                 out_cols_, Index{0}, Index{1});
+    }
+  }
+
+ private:
+  void SNN_ALWAYS_INLINE convolve_tile(Input const& input, Filter const& filter,
+                                       Output& output,
+                                       int const row_idx) const {
+    SNN_PRAGMA_UNROLL
+    for (int out_row = 0; out_row < OutTileRows; ++out_row) {
+      int const filter_row = row_idx - out_row * Stride;
+      if (filter_row >= 0 && filter_row < WindowRows) {
+        int in_offset = 0;
+        SNN_PRAGMA_UNROLL
+        for (int out_col = 0; out_col < OutTileCols; ++out_col) {
+          SNN_PRAGMA_UNROLL
+          for (int filter_col = 0; filter_col < WindowCols; ++filter_col) {
+            output.data(out_row, out_col) = helpers::math::mad(
+                input.data(in_offset + filter_col),
+                filter.data(filter_row, filter_col, 0),
+                output.data(out_row, out_col));
+          }
+          in_offset += Stride;
+        }
+      }
+    }
+  }
+
+  const Index n_tile_cols_;
+  const Index n_tile_rows_;
+  const IndexDivType div_features_;
+  const IndexDivType div_n_tile_cols_;
+  const IndexDivType div_n_tile_rows_;
+  const Index n_elems_;
+  const Index channels_;
+  const Index features_;
+  const Index in_rows_;
+  const Index in_cols_;
+  const Index out_rows_;
+  const Index out_cols_;
+  const Index pad_rows_;
+  const Index pad_cols_;
+  const Index dilation_rows_;
+  const Index dilation_cols_;
+  const ReadMem<const T, IsUSM> input_mem_;
+  const ReadMem<const T, IsUSM> filter_mem_;
+  WriteMem<T, IsUSM> output_mem_;
+  FusedEpilogue<T, IsUSM> const epilogue_;
+};
+
+}  // namespace tiled
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_SRC_CONV2D_TILED_KERNELS_NCHW_H_
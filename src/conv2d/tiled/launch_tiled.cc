@@ -15,6 +15,11 @@
  */
 #include "sycldnn/internal/conv2d/tiled.h"
 
+#include "sycldnn/internal/conv2d/epilogue.h"
+#include "sycldnn/internal/conv2d/tiled/filter_backprop_splits.h"
+
+#include "sycldnn/data_format.h"
+#include "sycldnn/filter_format.h"
 #include "sycldnn/mem_object.h"
 #include "sycldnn/status.h"
 
@@ -24,10 +29,14 @@
 #include "sycldnn/helpers/ratio.h"
 
 #include "src/conv2d/tiled/kernel_params.h"
+#include "src/conv2d/tiled/local_kernels.h"
+#include "src/conv2d/tiled/queue_tiled_filter_backprop.h"
 #include "src/conv2d/tiled/queue_tiled_kernel.h"
+#include "src/conv2d/tiled/queue_tiled_local_kernel.h"
 #include "src/conv2d/tiled/tile_info.h"
 
 #include <stddef.h>
+#include <algorithm>
 #include <cstdint>
 #include <limits>
 #include <type_traits>
@@ -50,9 +59,10 @@ inline bool can_use_fast_div<conv_type::Forward>(Conv2DParams const& params,
                                                  int /*channel_vector_width*/,
                                                  int feature_vector_width,
                                                  int tile_rows, int tile_cols) {
-  return params.features / feature_vector_width != 1 &&
-         helpers::round_ratio_up_above_zero(params.out_rows, tile_rows) != 1 &&
-         helpers::round_ratio_up_above_zero(params.out_cols, tile_cols) != 1;
+  auto const tile_info = tiled::get_tile_info<conv_type::Forward>(
+      params, tile_rows, tile_cols, 1, feature_vector_width);
+  return tile_info.output_vectors != 1 && tile_info.n_rows != 1 &&
+         tile_info.n_cols != 1;
 }
 template <>
 inline bool can_use_fast_div<conv_type::InputBackprop>(
@@ -62,6 +72,21 @@ inline bool can_use_fast_div<conv_type::InputBackprop>(
          helpers::round_ratio_up_above_zero(params.in_rows, tile_rows) != 1 &&
          helpers::round_ratio_up_above_zero(params.in_cols, tile_cols) != 1;
 }
+/**
+ * Check whether the vector widths can be used for a grouped convolution. Each
+ * vector of channels and of features must be contained in a single group.
+ */
+inline bool can_use_group_vectors(Conv2DParams const& params,
+                                  int channel_vector, int feature_vector) {
+  if (params.groups == 1) {
+    return true;
+  }
+  if (params.group_format == sycldnn::BatchFormat::INTERLEAVED) {
+    return channel_vector == 1 && feature_vector == 1;
+  }
+  return (params.channels / params.groups) % channel_vector == 0 &&
+         (params.features / params.groups) % feature_vector == 0;
+}
 template <typename ConvType>
 inline bool can_use_sizes(Conv2DParams const& params, int channel_vector,
                           int feature_vector, int window, int stride);
@@ -71,10 +96,19 @@ inline bool can_use_sizes<conv_type::Forward>(Conv2DParams const& params,
                                               int const feature_vector,
                                               int const window,
                                               int const stride) {
+#ifdef SNN_ENABLE_NCHW
+  // The NCHW kernel does not support vectorisation.
+  bool const can_use_layout =
+      params.input_format == DataFormat::NHWC ||
+      (channel_vector == 1 && feature_vector == 1);
+#else
+  bool const can_use_layout = params.input_format == DataFormat::NHWC;
+#endif  // SNN_ENABLE_NCHW
   return (params.window_rows == window && params.window_cols == window &&
           params.stride_rows == stride && params.stride_cols == stride &&
           params.features % feature_vector == 0 &&
-          params.channels % channel_vector == 0);
+          params.channels % channel_vector == 0 && can_use_layout &&
+          can_use_group_vectors(params, channel_vector, feature_vector));
 }
 template <>
 inline bool can_use_sizes<conv_type::InputBackprop>(Conv2DParams const& params,
@@ -82,10 +116,14 @@ inline bool can_use_sizes<conv_type::InputBackprop>(Conv2DParams const& params,
                                                     int const feature_vector,
                                                     int const window,
                                                     int const stride) {
-  return (params.window_rows == window && params.window_cols == window &&
+  // Only the forward tiled kernel supports dilation and the NCHW layout.
+  return (params.input_format == DataFormat::NHWC &&
+          params.window_rows == window && params.window_cols == window &&
           params.stride_rows == stride && params.stride_cols == stride &&
+          params.dilation_rows == 1 && params.dilation_cols == 1 &&
           params.features % feature_vector == 0 &&
-          params.channels % channel_vector == 0);
+          params.channels % channel_vector == 0 &&
+          can_use_group_vectors(params, channel_vector, feature_vector));
 }
 
 /**
@@ -97,6 +135,7 @@ template <typename T, typename Index, typename ConvType, int TileRows,
           int Window, int Stride, template <typename> class MemObj>
 SNNStatus launch_with_index_type(MemObj<T const>& input,
                                  MemObj<T const>& filter, MemObj<T>& output,
+                                 EpilogueMem<T, MemObj>& epilogue,
                                  Conv2DParams const& params,
                                  tiled::TileInfo const& tile_info,
                                  cl::sycl::queue& queue,
@@ -107,12 +146,14 @@ SNNStatus launch_with_index_type(MemObj<T const>& input,
     return queue_tiled_kernel<T, Index, ConvType, TileRows, TileCols,
                               ChannelVectorWidth, FeatureVectorWidth, true,
                               Window, Window, Stride>(
-        input, filter, output, kernel_params, tile_info, queue, events);
+        input, filter, output, epilogue, kernel_params, tile_info, queue,
+        events);
   } else {
     return queue_tiled_kernel<T, Index, ConvType, TileRows, TileCols,
                               ChannelVectorWidth, FeatureVectorWidth, false,
                               Window, Window, Stride>(
-        input, filter, output, kernel_params, tile_info, queue, events);
+        input, filter, output, epilogue, kernel_params, tile_info, queue,
+        events);
   }
 }
 /**
@@ -123,8 +164,8 @@ template <typename T, typename ConvType, int TileRows, int TileCols,
           int ChannelVectorWidth, int FeatureVectorWidth, int Window,
           int Stride, template <typename> class MemObj>
 SNNStatus launch_with_sizes(MemObj<T const>& input, MemObj<T const>& filter,
-                            MemObj<T>& output, Conv2DParams const& params,
-                            cl::sycl::queue& queue,
+                            MemObj<T>& output, EpilogueMem<T, MemObj>& epilogue,
+                            Conv2DParams const& params, cl::sycl::queue& queue,
                             const std::vector<cl::sycl::event>& events) {
   auto const tile_info = tiled::get_tile_info<ConvType>(
       params, TileRows, TileCols, ChannelVectorWidth, FeatureVectorWidth);
@@ -134,16 +175,18 @@ SNNStatus launch_with_sizes(MemObj<T const>& input, MemObj<T const>& filter,
 #ifdef SNN_USE_INT64
     return launch_with_index_type<T, int64_t, ConvType, TileRows, TileCols,
                                   ChannelVectorWidth, FeatureVectorWidth,
-                                  Window, Stride>(input, filter, output, params,
-                                                  tile_info, queue, events);
+                                  Window, Stride>(input, filter, output,
+                                                  epilogue, params, tile_info,
+                                                  queue, events);
 #else
     return StatusCode::IndexExceeded;
 #endif  // SNN_USE_INT64
   } else {
     return launch_with_index_type<T, int32_t, ConvType, TileRows, TileCols,
                                   ChannelVectorWidth, FeatureVectorWidth,
-                                  Window, Stride>(input, filter, output, params,
-                                                  tile_info, queue, events);
+                                  Window, Stride>(input, filter, output,
+                                                  epilogue, params, tile_info,
+                                                  queue, events);
   }
 }
 
@@ -153,6 +196,7 @@ template <typename T, typename ConvType, template <typename> class MemObj,
               std::is_same<ConvType, conv_type::Forward>::value, int>::type = 0>
 inline SNNStatus launch_tiled_impl(MemObj<T const>& input,
                                    MemObj<T const>& filter, MemObj<T>& output,
+                                   EpilogueMem<T, MemObj>& epilogue,
                                    Conv2DParams const& params,
                                    cl::sycl::queue& queue,
                                    const std::vector<cl::sycl::event>& events) {
@@ -162,7 +206,7 @@ inline SNNStatus launch_tiled_impl(MemObj<T const>& input,
                               stride)) {                                      \
     return launch_with_sizes<T, ConvType, tile_row, tile_col, channel_vector, \
                              feature_vector, window, stride>(                 \
-        input, filter, output, params, queue, events);                        \
+        input, filter, output, epilogue, params, queue, events);              \
   }
 
 // clang-format off
@@ -236,6 +280,7 @@ template <
         std::is_same<ConvType, conv_type::InputBackprop>::value, int>::type = 0>
 inline SNNStatus launch_tiled_impl(MemObj<T const>& input,
                                    MemObj<T const>& filter, MemObj<T>& output,
+                                   EpilogueMem<T, MemObj>& epilogue,
                                    Conv2DParams const& params,
                                    cl::sycl::queue& queue,
                                    const std::vector<cl::sycl::event>& events) {
@@ -259,40 +304,266 @@ inline SNNStatus launch_tiled_impl(MemObj<T const>& input,
 
 #undef LAUNCH_IF_MATCH
 
-/** Internal tile size launcher for FilterBackprop.  */
+/**
+ * Queue the tiled filter backprop kernel. If the reduction is split then the
+ * partial filter gradients are written to the workspace and summed into the
+ * filter gradient by a second kernel.
+ */
+template <typename T, typename Index, int VectorWidth,
+          template <typename> class MemObj>
+SNNStatus launch_filter_backprop_with_index_type(
+    MemObj<T const>& input, MemObj<T const>& output_grad,
+    MemObj<T>& filter_grad, MemObj<T>& workspace, size_t n_splits,
+    Conv2DParams const& params, cl::sycl::queue& queue,
+    const std::vector<cl::sycl::event>& events) {
+  if (n_splits <= 1) {
+    return queue_tiled_filter_backprop<T, Index, VectorWidth>(
+        input, output_grad, filter_grad, params, 1, queue, events);
+  }
+  auto status = queue_tiled_filter_backprop<T, Index, VectorWidth>(
+      input, output_grad, workspace, params, n_splits, queue, events);
+  if (status.status != StatusCode::OK) {
+    return status;
+  }
+  auto partials = workspace.as_const();
+  return queue_tiled_filter_backprop_combine<T, Index, VectorWidth>(
+      partials, filter_grad, params, n_splits, queue, {status.event});
+}
+
+/**
+ * Choose how many chunks of output rows to split the filter backprop
+ * reduction into, check what data type is required to fit the index sizes,
+ * and launch the tiled filter backprop kernels.
+ *
+ * The reduction is split when the filter gradient has too few vectors to
+ * give each compute unit several work-groups, limited by the number of
+ * partial filter gradients which fit in the workspace.
+ */
+template <typename T, int VectorWidth, template <typename> class MemObj>
+SNNStatus launch_filter_backprop_with_vector(
+    MemObj<T const>& input, MemObj<T const>& output_grad,
+    MemObj<T>& filter_grad, MemObj<T>& workspace, size_t workspace_size,
+    Conv2DParams const& params, cl::sycl::queue& queue,
+    const std::vector<cl::sycl::event>& events) {
+  size_t const filter_size = tiled::filter_backprop_filter_size(params);
+  size_t const n_filter_vectors = filter_size / VectorWidth;
+  size_t const n_compute_units =
+      queue.get_device().get_info<cl::sycl::info::device::max_compute_units>();
+  size_t const target_groups =
+      std::min(tiled::filter_backprop_groups_per_unit * n_compute_units,
+               tiled::filter_backprop_max_groups);
+  size_t const n_splits = std::min(
+      tiled::filter_backprop_splits(params, n_filter_vectors, target_groups),
+      workspace_size / filter_size);
+
+  size_t const in_size = static_cast<size_t>(params.batch) * params.in_rows *
+                         params.in_cols * params.channels;
+  size_t const out_size = static_cast<size_t>(params.batch) *
+                          params.out_rows * params.out_cols * params.features;
+  size_t const partials_size = n_splits * filter_size;
+  if (std::max({in_size, out_size, partials_size}) >
+      static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
+#ifdef SNN_USE_INT64
+    return launch_filter_backprop_with_index_type<T, int64_t, VectorWidth>(
+        input, output_grad, filter_grad, workspace, n_splits, params, queue,
+        events);
+#else
+    return StatusCode::IndexExceeded;
+#endif  // SNN_USE_INT64
+  } else {
+    return launch_filter_backprop_with_index_type<T, int32_t, VectorWidth>(
+        input, output_grad, filter_grad, workspace, n_splits, params, queue,
+        events);
+  }
+}
+
+/**
+ * Launch the tiled filter backprop using the widest feature vectors which
+ * the convolution supports.
+ *
+ * The filter backprop kernel supports any window size, stride and dilation,
+ * so it is not specialised on the tile sizes.
+ */
+template <typename T, template <typename> class MemObj>
+SNNStatus launch_filter_backprop(MemObj<T const>& input,
+                                 MemObj<T const>& output_grad,
+                                 MemObj<T>& filter_grad, MemObj<T>& workspace,
+                                 size_t workspace_size,
+                                 Conv2DParams const& params,
+                                 cl::sycl::queue& queue,
+                                 const std::vector<cl::sycl::event>& events) {
+  if (params.input_format != DataFormat::NHWC ||
+      params.filter_format != FilterFormat::HWCF) {
+    return StatusCode::InvalidAlgorithm;
+  }
+  if (params.features % 4 == 0 && can_use_group_vectors(params, 1, 4)) {
+    return launch_filter_backprop_with_vector<T, 4>(
+        input, output_grad, filter_grad, workspace, workspace_size, params,
+        queue, events);
+  } else if (params.features % 2 == 0 && can_use_group_vectors(params, 1, 2)) {
+    return launch_filter_backprop_with_vector<T, 2>(
+        input, output_grad, filter_grad, workspace, workspace_size, params,
+        queue, events);
+  } else {
+    return launch_filter_backprop_with_vector<T, 1>(
+        input, output_grad, filter_grad, workspace, workspace_size, params,
+        queue, events);
+  }
+}
+
+/**
+ * Internal launcher for FilterBackprop without a workspace, so the reduction
+ * is never split. The filter argument holds the output gradient, and the
+ * filter gradient is written to the output.
+ */
 template <typename T, typename ConvType, template <typename> class MemObj,
           typename std::enable_if<
               std::is_same<ConvType, conv_type::FilterBackprop>::value,
               int>::type = 0>
-inline SNNStatus launch_tiled_impl(
-    MemObj<T const>& /*input*/, MemObj<T const>& /*filter*/,
-    MemObj<T>& /*output*/, Conv2DParams const& /*params*/,
-    cl::sycl::queue& /*queue*/,
-    const std::vector<cl::sycl::event>& /*events*/) {
-  // Tiled algorithm is not supported for filter backprop.
+inline SNNStatus launch_tiled_impl(MemObj<T const>& input,
+                                   MemObj<T const>& filter, MemObj<T>& output,
+                                   EpilogueMem<T, MemObj>& /*epilogue*/,
+                                   Conv2DParams const& params,
+                                   cl::sycl::queue& queue,
+                                   const std::vector<cl::sycl::event>& events) {
+  // The output is passed as the workspace, but is never used as one as the
+  // workspace size is zero.
+  return launch_filter_backprop<T>(input, filter, output, output, 0, params,
+                                   queue, events);
+}
+
+/**
+ * Check what data type is required to fit the index sizes, and launch the
+ * local memory tiled kernel.
+ */
+template <typename T, typename ConvType, int TileRows, int TileCols,
+          int Window, int Stride, template <typename> class MemObj>
+SNNStatus launch_local_with_sizes(MemObj<T const>& input,
+                                  MemObj<T const>& filter, MemObj<T>& output,
+                                  EpilogueMem<T, MemObj>& epilogue,
+                                  Conv2DParams const& params,
+                                  cl::sycl::queue& queue,
+                                  const std::vector<cl::sycl::event>& events) {
+  auto const shape = tiled::get_local_conv_shape<ConvType>(params);
+  size_t const in_size = static_cast<size_t>(shape.batch) * shape.in_rows *
+                         shape.in_cols * shape.in_depth;
+  size_t const out_size = static_cast<size_t>(shape.batch) * shape.out_rows *
+                          shape.out_cols * shape.out_depth;
+  size_t const n_threads =
+      tiled::get_local_n_groups(shape, TileRows, TileCols) *
+      tiled::LocalWorkGroup::Size;
+  size_t const max_size = std::max({in_size, out_size, n_threads});
+  if (max_size > static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
+#ifdef SNN_USE_INT64
+    return queue_tiled_local_kernel<T, int64_t, ConvType, TileRows, TileCols,
+                                    Window, Stride>(input, filter, output,
+                                                    epilogue, shape, queue,
+                                                    events);
+#else
+    return StatusCode::IndexExceeded;
+#endif  // SNN_USE_INT64
+  } else {
+    return queue_tiled_local_kernel<T, int32_t, ConvType, TileRows, TileCols,
+                                    Window, Stride>(input, filter, output,
+                                                    epilogue, shape, queue,
+                                                    events);
+  }
+}
+
+/**
+ * Internal tile size launcher for the local memory tiled kernels.
+ *
+ * The local memory kernels do not support dilation, groups or the NCHW
+ * layout, and only support stride 1 for input backprop.
+ */
+template <typename T, typename ConvType, template <typename> class MemObj>
+inline SNNStatus launch_tiled_local_impl(
+    MemObj<T const>& input, MemObj<T const>& filter, MemObj<T>& output,
+    EpilogueMem<T, MemObj>& epilogue, Conv2DParams const& params,
+    cl::sycl::queue& queue, const std::vector<cl::sycl::event>& events) {
+  if (params.dilation_rows != 1 || params.dilation_cols != 1 ||
+      params.groups != 1 || params.input_format != DataFormat::NHWC) {
+    return StatusCode::InvalidAlgorithm;
+  }
+#define LAUNCH_IF_MATCH(params, window, stride, tile_row, tile_col)         \
+  if (params.window_rows == window && params.window_cols == window &&       \
+      params.stride_rows == stride && params.stride_cols == stride) {       \
+    return launch_local_with_sizes<T, ConvType, tile_row, tile_col, window, \
+                                   stride>(input, filter, output, epilogue, \
+                                           params, queue, events);          \
+  }
+
+  if constexpr (std::is_same<ConvType, conv_type::Forward>::value) {
+    // clang-format off
+    LAUNCH_IF_MATCH(params, 3, 2, 2, 2)
+    // clang-format on
+  }
+  if constexpr (!std::is_same<ConvType, conv_type::FilterBackprop>::value) {
+    // clang-format off
+    LAUNCH_IF_MATCH(params, 3, 1, 2, 2)
+    LAUNCH_IF_MATCH(params, 5, 1, 2, 2)
+    // clang-format on
+  }
+#undef LAUNCH_IF_MATCH
+
   return StatusCode::InvalidAlgorithm;
 }
 }  // namespace
 
 template <typename T, typename ConvType, template <typename> class MemObj>
 inline SNNStatus launch_tiled(MemObj<T const>& input, MemObj<T const>& filter,
-                              MemObj<T>& output, Conv2DParams const& params,
+                              MemObj<T>& output,
+                              EpilogueMem<T, MemObj>& epilogue,
+                              Conv2DParams const& params,
                               cl::sycl::queue& queue,
                               const std::vector<cl::sycl::event>& events) {
-  return launch_tiled_impl<T, ConvType>(input, filter, output, params, queue,
-                                        events);
+  return launch_tiled_impl<T, ConvType>(input, filter, output, epilogue, params,
+                                        queue, events);
 }
 
-#define INSTANTIATE_LAUNCHER(DTYPE, DIR, MEM_OBJ)                  \
-  template SNN_EXPORT SNNStatus launch_tiled<DTYPE, DIR>(          \
-      MEM_OBJ<DTYPE const> & input, MEM_OBJ<DTYPE const> & filter, \
-      MEM_OBJ<DTYPE> & output, Conv2DParams const& params,         \
+template <typename T, typename ConvType, template <typename> class MemObj>
+inline SNNStatus launch_tiled_local(
+    MemObj<T const>& input, MemObj<T const>& filter, MemObj<T>& output,
+    EpilogueMem<T, MemObj>& epilogue, Conv2DParams const& params,
+    cl::sycl::queue& queue, const std::vector<cl::sycl::event>& events) {
+  return launch_tiled_local_impl<T, ConvType>(input, filter, output, epilogue,
+                                              params, queue, events);
+}
+
+template <typename T, template <typename> class MemObj>
+inline SNNStatus launch_tiled_filter_backprop(
+    MemObj<T const>& input, MemObj<T const>& output_grad,
+    MemObj<T>& filter_grad, MemObj<T>& workspace, size_t workspace_size,
+    Conv2DParams const& params, cl::sycl::queue& queue,
+    const std::vector<cl::sycl::event>& events) {
+  return launch_filter_backprop<T>(input, output_grad, filter_grad, workspace,
+                                   workspace_size, params, queue, events);
+}
+
+#define INSTANTIATE_LAUNCHER(DTYPE, DIR, MEM_OBJ)                          \
+  template SNN_EXPORT SNNStatus launch_tiled<DTYPE, DIR>(                  \
+      MEM_OBJ<DTYPE const> & input, MEM_OBJ<DTYPE const> & filter,         \
+      MEM_OBJ<DTYPE> & output, EpilogueMem<DTYPE, MEM_OBJ> & epilogue,     \
+      Conv2DParams const& params, cl::sycl::queue& queue,                  \
+      const std::vector<cl::sycl::event>& events);                         \
+  template SNN_EXPORT SNNStatus launch_tiled_local<DTYPE, DIR>(            \
+      MEM_OBJ<DTYPE const> & input, MEM_OBJ<DTYPE const> & filter,         \
+      MEM_OBJ<DTYPE> & output, EpilogueMem<DTYPE, MEM_OBJ> & epilogue,     \
+      Conv2DParams const& params, cl::sycl::queue& queue,                  \
+      const std::vector<cl::sycl::event>& events)
+
+#define INSTANTIATE_FILTER_BACKPROP_LAUNCHER(DTYPE, MEM_OBJ)            \
+  template SNN_EXPORT SNNStatus launch_tiled_filter_backprop<DTYPE>(    \
+      MEM_OBJ<DTYPE const> & input, MEM_OBJ<DTYPE const> & output_grad, \
+      MEM_OBJ<DTYPE> & filter_grad, MEM_OBJ<DTYPE> & workspace,         \
+      size_t workspace_size, Conv2DParams const& params,                \
       cl::sycl::queue& queue, const std::vector<cl::sycl::event>& events)
 
-#define INSTANTIATE_FOR_TYPE(DTYPE, MEM_OBJ)                      \
-  INSTANTIATE_LAUNCHER(DTYPE, conv_type::Forward, MEM_OBJ);       \
-  INSTANTIATE_LAUNCHER(DTYPE, conv_type::InputBackprop, MEM_OBJ); \
-  INSTANTIATE_LAUNCHER(DTYPE, conv_type::FilterBackprop, MEM_OBJ)
+#define INSTANTIATE_FOR_TYPE(DTYPE, MEM_OBJ)                       \
+  INSTANTIATE_LAUNCHER(DTYPE, conv_type::Forward, MEM_OBJ);        \
+  INSTANTIATE_LAUNCHER(DTYPE, conv_type::InputBackprop, MEM_OBJ);  \
+  INSTANTIATE_LAUNCHER(DTYPE, conv_type::FilterBackprop, MEM_OBJ); \
+  INSTANTIATE_FILTER_BACKPROP_LAUNCHER(DTYPE, MEM_OBJ)
 
 #ifdef SNN_ENABLE_USM
 INSTANTIATE_FOR_TYPE(float, USMMemObject);
@@ -314,6 +585,7 @@ INSTANTIATE_FOR_TYPE(cl::sycl::half, BufferMemObject);
 #endif  // SNN_USE_HALF
 
 #undef INSTANTIATE_FOR_TYPE
+#undef INSTANTIATE_FILTER_BACKPROP_LAUNCHER
 #undef INSTANTIATE_LAUNCHER
 
 }  // namespace internal
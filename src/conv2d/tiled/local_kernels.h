@@ -0,0 +1,463 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_CONV2D_TILED_LOCAL_KERNELS_H_
+#define SYCLDNN_SRC_CONV2D_TILED_LOCAL_KERNELS_H_
+
+#include "sycldnn/accessor_types.h"
+
+#include "sycldnn/conv2d/conv_type.h"
+#include "sycldnn/conv2d/params.h"
+
+#include "sycldnn/helpers/ratio.h"
+
+#include "src/conv2d/epilogue/fused_epilogue.h"
+#include "src/helpers/math.h"
+#include "src/helpers/register_tile.h"
+#include "src/helpers/tensor_index.h"
+#include "src/helpers/vector_io.h"
+
+#include <type_traits>
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+namespace tiled {
+
+/**
+ * Shape of the work-groups used by the local memory tiled kernels.
+ *
+ * Each work-group computes a block of Rows x Cols register tiles, for
+ * Features consecutive output channels. The input is staged in local memory
+ * Channels input channels at a time.
+ */
+struct LocalWorkGroup {
+  /** Number of register tiles in the row direction of a work-group. */
+  static constexpr int Rows = 4;
+  /** Number of register tiles in the column direction of a work-group. */
+  static constexpr int Cols = 4;
+  /** Number of output channels computed by a work-group. */
+  static constexpr int Features = 8;
+  /** Number of input channels staged in local memory at a time. */
+  static constexpr int Channels = 8;
+  /** Total number of work items in a work-group. */
+  static constexpr int Size = Rows * Cols * Features;
+};
+
+/**
+ * Sizes of the local memory buffers required by the local memory tiled
+ * kernel.
+ */
+template <int TileRows, int TileCols, int Window, int Stride>
+struct LocalTileSizes {
+  /** Number of rows in the input patch used by a work-group. */
+  static constexpr int PatchRows =
+      (LocalWorkGroup::Rows * TileRows - 1) * Stride + Window;
+  /** Number of columns in the input patch used by a work-group. */
+  static constexpr int PatchCols =
+      (LocalWorkGroup::Cols * TileCols - 1) * Stride + Window;
+  /** Number of elements in the local input patch. */
+  static constexpr int InputSize =
+      PatchRows * PatchCols * LocalWorkGroup::Channels;
+  /** Number of elements in the local filter slice. */
+  static constexpr int FilterSize =
+      Window * Window * LocalWorkGroup::Channels * LocalWorkGroup::Features;
+};
+
+/**
+ * The shape of the convolution as seen by the local memory kernel.
+ *
+ * Input backprop is computed as a forward convolution of the output errors
+ * with the mirrored filter, so the kernel works in terms of the tensor it
+ * reads and the tensor it writes rather than the convolution's input and
+ * output.
+ */
+struct LocalConvShape {
+  /** Number of images in the batch. */
+  int batch;
+  /** Number of rows in the tensor read by the kernel. */
+  int in_rows;
+  /** Number of columns in the tensor read by the kernel. */
+  int in_cols;
+  /** Number of channels in the tensor read by the kernel. */
+  int in_depth;
+  /** Number of rows in the tensor written by the kernel. */
+  int out_rows;
+  /** Number of columns in the tensor written by the kernel. */
+  int out_cols;
+  /** Number of channels in the tensor written by the kernel. */
+  int out_depth;
+  /** Padding applied to the top of the tensor read by the kernel. */
+  int pad_rows;
+  /** Padding applied to the left of the tensor read by the kernel. */
+  int pad_cols;
+};
+
+/**
+ * Get the shape of the convolution as computed by the local memory kernel.
+ *
+ * \param params The convolution parameters, as passed by the user.
+ * \return The shape of the tensors read and written by the kernel.
+ */
+template <typename ConvType>
+inline LocalConvShape get_local_conv_shape(Conv2DParams const& params);
+
+/** \copydoc get_local_conv_shape() */
+template <>
+inline LocalConvShape get_local_conv_shape<conv_type::Forward>(
+    Conv2DParams const& params) {
+  return {params.batch,    params.in_rows,  params.in_cols,
+          params.channels, params.out_rows, params.out_cols,
+          params.features, params.pad_rows, params.pad_cols};
+}
+
+/** \copydoc get_local_conv_shape() */
+template <>
+inline LocalConvShape get_local_conv_shape<conv_type::InputBackprop>(
+    Conv2DParams const& params) {
+  // The output errors are convolved with the mirrored filter, using the
+  // output padding pad_out = window - 1 - pad_in.
+  return {params.batch,
+          params.out_rows,
+          params.out_cols,
+          params.features,
+          params.in_rows,
+          params.in_cols,
+          params.channels,
+          params.window_rows - 1 - params.pad_rows,
+          params.window_cols - 1 - params.pad_cols};
+}
+
+/**
+ * Get the number of work-groups needed to compute the convolution.
+ *
+ * \param shape The shape of the convolution computed by the kernel.
+ * \param tile_rows Number of rows in each register tile.
+ * \param tile_cols Number of columns in each register tile.
+ * \return The total number of work-groups required.
+ */
+inline size_t get_local_n_groups(LocalConvShape const& shape, int tile_rows,
+                                 int tile_cols) {
+  size_t const row_groups = helpers::round_ratio_up_above_zero(
+      shape.out_rows, LocalWorkGroup::Rows * tile_rows);
+  size_t const col_groups = helpers::round_ratio_up_above_zero(
+      shape.out_cols, LocalWorkGroup::Cols * tile_cols);
+  size_t const feature_groups = helpers::round_ratio_up_above_zero(
+      shape.out_depth, LocalWorkGroup::Features);
+  return shape.batch * row_groups * col_groups * feature_groups;
+}
+
+/**
+ * Index into the HWCF filter tensor for an element of the filter as used by
+ * the local memory kernel.
+ */
+template <typename ConvType>
+struct LocalFilterIndex;
+
+/** Forward convolutions use the filter as given. */
+template <>
+struct LocalFilterIndex<conv_type::Forward> {
+  /** Get the offset of filter element (row, col, in_ch, out_ch). */
+  template <typename Index>
+  static SNN_ALWAYS_INLINE Index get(Index row, Index col, Index in_ch,
+                                     Index out_ch, Index window,
+                                     Index in_depth, Index out_depth) {
+    return ((row * window + col) * in_depth + in_ch) * out_depth + out_ch;
+  }
+};
+
+/**
+ * Input backprop uses the filter mirrored in both spatial dimensions, with
+ * the channels and features swapped.
+ */
+template <>
+struct LocalFilterIndex<conv_type::InputBackprop> {
+  /** Get the offset of filter element (row, col, in_ch, out_ch). */
+  template <typename Index>
+  static SNN_ALWAYS_INLINE Index get(Index row, Index col, Index in_ch,
+                                     Index out_ch, Index window,
+                                     Index in_depth, Index out_depth) {
+    Index const mirror_row = window - 1 - row;
+    Index const mirror_col = window - 1 - col;
+    return ((mirror_row * window + mirror_col) * out_depth + out_ch) *
+               in_depth +
+           in_ch;
+  }
+};
+
+/**
+ * Tiled convolution which stages the input patch and filter slice used by a
+ * work-group in local memory.
+ *
+ * In the register tiled kernel each work item loads the input rows its tile
+ * needs directly from global memory, so the halos shared by neighbouring
+ * tiles are fetched many times. Here the work-group cooperatively loads the
+ * whole input patch covered by its LocalWorkGroup::Rows x
+ * LocalWorkGroup::Cols block of tiles, together with the filter values for
+ * its LocalWorkGroup::Features output channels, before each work item
+ * computes its TileRows x TileCols register tile from local memory.
+ *
+ * Only stride 1 is supported for input backprop, where the computation is a
+ * forward convolution of the output errors with the mirrored filter.
+ */
+template <typename T, typename Index, typename ConvType, int TileRows,
+          int TileCols, int Window, int Stride, bool IsUSM>
+struct TiledLocalConv2D {
+ private:
+  using Sizes = LocalTileSizes<TileRows, TileCols, Window, Stride>;
+  using FilterIndex = LocalFilterIndex<ConvType>;
+  using Load = helpers::io::Load<T>;
+  using Store = helpers::io::Store<T>;
+  static constexpr int InputTileRows = (TileRows - 1) * Stride + Window;
+  static constexpr int InputTileCols = (TileCols - 1) * Stride + Window;
+  static constexpr int BlockRows = LocalWorkGroup::Rows * TileRows;
+  static constexpr int BlockCols = LocalWorkGroup::Cols * TileCols;
+
+  static_assert(std::is_same<ConvType, conv_type::Forward>::value ||
+                    (std::is_same<ConvType, conv_type::InputBackprop>::value &&
+                     Stride == 1),
+                "The local memory tiled kernel only supports forward and "
+                "stride 1 input backprop convolutions.");
+
+ public:
+  TiledLocalConv2D(ReadMem<T const, IsUSM> input,
+                   ReadMem<T const, IsUSM> filter, WriteMem<T, IsUSM> output,
+                   FusedEpilogue<T, IsUSM> epilogue,
+                   LocalAccessor<T> local_input, LocalAccessor<T> local_filter,
+                   LocalConvShape const& shape)
+      : n_row_groups_{helpers::round_ratio_up_above_zero(shape.out_rows,
+                                                         BlockRows)},
+        n_col_groups_{helpers::round_ratio_up_above_zero(shape.out_cols,
+                                                         BlockCols)},
+        n_feature_groups_{helpers::round_ratio_up_above_zero(
+            shape.out_depth, LocalWorkGroup::Features)},
+        in_rows_{shape.in_rows},
+        in_cols_{shape.in_cols},
+        in_depth_{shape.in_depth},
+        out_rows_{shape.out_rows},
+        out_cols_{shape.out_cols},
+        out_depth_{shape.out_depth},
+        pad_rows_{shape.pad_rows},
+        pad_cols_{shape.pad_cols},
+        input_mem_{std::move(input)},
+        filter_mem_{std::move(filter)},
+        output_mem_{std::move(output)},
+        epilogue_{std::move(epilogue)},
+        local_input_{std::move(local_input)},
+        local_filter_{std::move(local_filter)} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::nd_item<1> item) const {
+    Index const local_idx = item.get_local_id(0);
+    Index const group_idx = item.get_group(0);
+
+    auto const group = helpers::TensorIndexHelper<Index, false>::unflatten4d(
+        group_idx, n_row_groups_, n_row_groups_, n_col_groups_, n_col_groups_,
+        n_feature_groups_, n_feature_groups_);
+    Index const batch = group.s0;
+    Index const block_row = group.s1 * BlockRows;
+    Index const block_col = group.s2 * BlockCols;
+    Index const block_feature = group.s3 * LocalWorkGroup::Features;
+
+    // Consecutive work items compute consecutive features, so that the reads
+    // from the local filter and the writes to the output are contiguous.
+    Index const local_feature = local_idx % LocalWorkGroup::Features;
+    Index const local_tile = local_idx / LocalWorkGroup::Features;
+    Index const local_col = local_tile % LocalWorkGroup::Cols;
+    Index const local_row = local_tile / LocalWorkGroup::Cols;
+
+    Index const patch_row = block_row * Stride - pad_rows_;
+    Index const patch_col = block_col * Stride - pad_cols_;
+    Index const input_batch_offset = batch * in_rows_ * in_cols_ * in_depth_;
+
+    helpers::RegisterTile2D<T, TileRows, TileCols> out_tile{};
+
+    for (Index channel = 0; channel < in_depth_;
+         channel += LocalWorkGroup::Channels) {
+      load_input_patch(local_idx, input_batch_offset, patch_row, patch_col,
+                       channel);
+      load_filter_slice(local_idx, channel, block_feature);
+      item.barrier(cl::sycl::access::fence_space::local_space);
+
+      convolve_patch(out_tile, local_row * TileRows * Stride,
+                     local_col * TileCols * Stride, local_feature);
+      // All work items must finish reading the local buffers before they are
+      // overwritten by the next channel block.
+      item.barrier(cl::sycl::access::fence_space::local_space);
+    }
+
+    write_out(out_tile, batch, block_row + local_row * TileRows,
+              block_col + local_col * TileCols, block_feature + local_feature);
+  }
+
+ private:
+  /**
+   * Cooperatively load the input patch for LocalWorkGroup::Channels channels
+   * into local memory, zero filling the padding and any channels past the
+   * end of the tensor.
+   */
+  void SNN_ALWAYS_INLINE load_input_patch(Index local_idx,
+                                          Index input_batch_offset,
+                                          Index patch_row, Index patch_col,
+                                          Index channel) const {
+    auto input_data = input_mem_.get_pointer();
+    for (Index idx = local_idx; idx < Sizes::InputSize;
+         idx += LocalWorkGroup::Size) {
+      Index const local_ch = idx % LocalWorkGroup::Channels;
+      Index const pixel = idx / LocalWorkGroup::Channels;
+      Index const col = patch_col + pixel % Sizes::PatchCols;
+      Index const row = patch_row + pixel / Sizes::PatchCols;
+      Index const ch = channel + local_ch;
+      T value{0};
+      if (row >= 0 && row < in_rows_ && col >= 0 && col < in_cols_ &&
+          ch < in_depth_) {
+        Index const offset =
+            input_batch_offset + (row * in_cols_ + col) * in_depth_ + ch;
+        value = Load()(input_data, offset);
+      }
+      local_input_[idx] = value;
+    }
+  }
+
+  /**
+   * Cooperatively load the filter values for the work-group's features and
+   * the current block of channels into local memory.
+   */
+  void SNN_ALWAYS_INLINE load_filter_slice(Index local_idx, Index channel,
+                                           Index block_feature) const {
+    auto filter_data = filter_mem_.get_pointer();
+    for (Index idx = local_idx; idx < Sizes::FilterSize;
+         idx += LocalWorkGroup::Size) {
+      Index const local_feat = idx % LocalWorkGroup::Features;
+      Index const rest = idx / LocalWorkGroup::Features;
+      Index const local_ch = rest % LocalWorkGroup::Channels;
+      Index const window_idx = rest / LocalWorkGroup::Channels;
+      Index const col = window_idx % Window;
+      Index const row = window_idx / Window;
+      Index const ch = channel + local_ch;
+      Index const feat = block_feature + local_feat;
+      T value{0};
+      if (ch < in_depth_ && feat < out_depth_) {
+        Index const offset = FilterIndex::get(row, col, ch, feat, Index{Window},
+                                              in_depth_, out_depth_);
+        value = Load()(filter_data, offset);
+      }
+      local_filter_[idx] = value;
+    }
+  }
+
+  /**
+   * Accumulate the contribution of the staged channels to this work item's
+   * register tile, reading both the input and the filter from local memory.
+   */
+  void SNN_ALWAYS_INLINE convolve_patch(
+      helpers::RegisterTile2D<T, TileRows, TileCols>& out_tile,
+      Index first_row, Index first_col, Index local_feature) const {
+    SNN_PRAGMA_UNROLL
+    for (int local_ch = 0; local_ch < LocalWorkGroup::Channels; ++local_ch) {
+      helpers::RegisterTile2D<T, Window, Window> filter_tile;
+      SNN_PRAGMA_UNROLL
+      for (int r = 0; r < Window; ++r) {
+        SNN_PRAGMA_UNROLL
+        for (int c = 0; c < Window; ++c) {
+          Index const idx = ((r * Window + c) * LocalWorkGroup::Channels +
+                             local_ch) *
+                                LocalWorkGroup::Features +
+                            local_feature;
+          filter_tile.data(r, c) = local_filter_[idx];
+        }
+      }
+      SNN_PRAGMA_UNROLL
+      for (int in_row = 0; in_row < InputTileRows; ++in_row) {
+        helpers::RegisterTile1D<T, InputTileCols> input_row;
+        Index const row_offset =
+            (first_row + in_row) * Sizes::PatchCols + first_col;
+        SNN_PRAGMA_UNROLL
+        for (int in_col = 0; in_col < InputTileCols; ++in_col) {
+          input_row.data(in_col) =
+              local_input_[(row_offset + in_col) * LocalWorkGroup::Channels +
+                           local_ch];
+        }
+        SNN_PRAGMA_UNROLL
+        for (int out_row = 0; out_row < TileRows; ++out_row) {
+          int const filter_row = in_row - out_row * Stride;
+          if (filter_row >= 0 && filter_row < Window) {
+            SNN_PRAGMA_UNROLL
+            for (int out_col = 0; out_col < TileCols; ++out_col) {
+              SNN_PRAGMA_UNROLL
+              for (int filter_col = 0; filter_col < Window; ++filter_col) {
+                out_tile.data(out_row, out_col) = helpers::math::mad(
+                    input_row.data(out_col * Stride + filter_col),
+                    filter_tile.data(filter_row, filter_col),
+                    out_tile.data(out_row, out_col));
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  /**
+   * Apply the epilogue to the register tile and write it to the output,
+   * skipping out of bounds values.
+   */
+  void SNN_ALWAYS_INLINE
+  write_out(helpers::RegisterTile2D<T, TileRows, TileCols> const& out_tile,
+            Index batch, Index row, Index col, Index feature) const {
+    if (feature >= out_depth_) {
+      return;
+    }
+    auto output_data = output_mem_.get_pointer();
+    SNN_PRAGMA_UNROLL
+    for (int i = 0; i < TileRows; ++i) {
+      SNN_PRAGMA_UNROLL
+      for (int j = 0; j < TileCols; ++j) {
+        if (row + i < out_rows_ && col + j < out_cols_) {
+          Index const offset =
+              ((batch * out_rows_ + row + i) * out_cols_ + col + j) *
+                  out_depth_ +
+              feature;
+          Store()(output_data, offset,
+                  epilogue_.apply(out_tile.data(i, j), offset, feature));
+        }
+      }
+    }
+  }
+
+  const Index n_row_groups_;
+  const Index n_col_groups_;
+  const Index n_feature_groups_;
+  const Index in_rows_;
+  const Index in_cols_;
+  const Index in_depth_;
+  const Index out_rows_;
+  const Index out_cols_;
+  const Index out_depth_;
+  const Index pad_rows_;
+  const Index pad_cols_;
+  const ReadMem<const T, IsUSM> input_mem_;
+  const ReadMem<const T, IsUSM> filter_mem_;
+  WriteMem<T, IsUSM> output_mem_;
+  const FusedEpilogue<T, IsUSM> epilogue_;
+  LocalAccessor<T> local_input_;
+  LocalAccessor<T> local_filter_;
+};
+
+}  // namespace tiled
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_SRC_CONV2D_TILED_LOCAL_KERNELS_H_
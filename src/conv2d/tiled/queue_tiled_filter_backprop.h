@@ -0,0 +1,63 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_CONV2D_TILED_QUEUE_TILED_FILTER_BACKPROP_H_
+#define SYCLDNN_SRC_CONV2D_TILED_QUEUE_TILED_FILTER_BACKPROP_H_
+
+#include "sycldnn/mem_object.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/conv2d/params.h"
+
+#include <CL/sycl.hpp>
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+
+/**
+ * Queue the tiled filter backprop kernel, which reduces the partial filter
+ * gradients of each work-group in local memory.
+ *
+ * If n_splits is greater than one, the output rows are split into n_splits
+ * chunks and the filter_grad memory object must hold n_splits partial filter
+ * gradients, which are then summed by queue_tiled_filter_backprop_combine.
+ *
+ * Returns StatusCode::InvalidAlgorithm if the device cannot provide the local
+ * memory required by the reduction.
+ */
+template <typename T, typename Index, int VectorWidth,
+          template <typename> class MemObj>
+SNNStatus queue_tiled_filter_backprop(
+    MemObj<T const>& input, MemObj<T const>& output_grad,
+    MemObj<T>& filter_grad, Conv2DParams const& params, size_t n_splits,
+    cl::sycl::queue& queue, const std::vector<cl::sycl::event>& events);
+
+/**
+ * Queue the kernel which sums the n_splits partial filter gradients written
+ * by a split tiled filter backprop into the filter gradient.
+ */
+template <typename T, typename Index, int VectorWidth,
+          template <typename> class MemObj>
+SNNStatus queue_tiled_filter_backprop_combine(
+    MemObj<T const>& partials, MemObj<T>& filter_grad,
+    Conv2DParams const& params, size_t n_splits, cl::sycl::queue& queue,
+    const std::vector<cl::sycl::event>& events);
+
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_SRC_CONV2D_TILED_QUEUE_TILED_FILTER_BACKPROP_H_
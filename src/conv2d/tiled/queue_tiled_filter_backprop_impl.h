@@ -0,0 +1,144 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_CONV2D_TILED_QUEUE_TILED_FILTER_BACKPROP_IMPL_H_
+#define SYCLDNN_SRC_CONV2D_TILED_QUEUE_TILED_FILTER_BACKPROP_IMPL_H_
+
+#include "sycldnn/accessor_types.h"
+#include "sycldnn/mem_object.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/conv2d/params.h"
+
+#include "sycldnn/helpers/ratio.h"
+
+#include "src/conv2d/tiled/filter_backprop_kernels.h"
+#include "src/conv2d/tiled/queue_tiled_filter_backprop.h"
+
+#include <algorithm>
+
+#include <CL/sycl.hpp>
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+
+namespace {
+
+/** Largest number of work items to use in each filter reduction. */
+constexpr size_t max_reduce_items = 256;
+
+/** Get the largest power of two which is not greater than the given value. */
+inline size_t pow2_at_most(size_t value) {
+  size_t result = 1;
+  while (result * 2 <= value) {
+    result *= 2;
+  }
+  return result;
+}
+
+}  // namespace
+
+template <typename T, typename Index, int VectorWidth,
+          template <typename> class MemObj>
+SNNStatus queue_tiled_filter_backprop(
+    MemObj<T const>& in_mem, MemObj<T const>& err_mem, MemObj<T>& out_mem,
+    Conv2DParams const& params, size_t n_splits, cl::sycl::queue& queue,
+    const std::vector<cl::sycl::event>& events) {
+  using Functor = tiled::TiledFilterBackprop<T, Index, VectorWidth,
+                                             is_usm_obj_v<MemObj<T>, T>>;
+
+  cl::sycl::device device = queue.get_device();
+  size_t const max_workgroup_size =
+      device.get_info<cl::sycl::info::device::max_work_group_size>();
+  size_t const local_mem_size =
+      device.get_info<cl::sycl::info::device::local_mem_size>();
+
+  // Each work-group reduces over the batch * out_cols output positions, so
+  // there is no benefit to using more work items than positions.
+  size_t const n_positions =
+      static_cast<size_t>(params.batch) * params.out_cols;
+  size_t reduce_items = pow2_at_most(
+      std::min({max_workgroup_size, max_reduce_items, n_positions}));
+  while (reduce_items > 1 &&
+         reduce_items * VectorWidth * sizeof(T) > local_mem_size) {
+    reduce_items /= 2;
+  }
+  if (reduce_items * VectorWidth * sizeof(T) > local_mem_size) {
+    return StatusCode::InvalidAlgorithm;
+  }
+  size_t const workspace_size = reduce_items * VectorWidth;
+  size_t const n_filter_vectors =
+      static_cast<size_t>(params.window_rows) * params.window_cols *
+      (params.channels / params.groups) * (params.features / VectorWidth);
+
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    cgh.depends_on(events);
+    auto input = in_mem.read_mem(cgh);
+    auto output_grad = err_mem.read_mem(cgh);
+    auto filter_grad = out_mem.write_mem(cgh);
+
+    LocalAccessor<T> workspace{cl::sycl::range<1>{workspace_size}, cgh};
+
+    Functor conv{static_cast<Index>(reduce_items),
+                 static_cast<Index>(n_splits),
+                 params,
+                 input,
+                 output_grad,
+                 workspace,
+                 filter_grad};
+
+    cgh.parallel_for(
+        cl::sycl::nd_range<2>{
+            cl::sycl::range<2>{reduce_items, n_splits * n_filter_vectors},
+            cl::sycl::range<2>{reduce_items, 1}},
+        conv);
+  });
+  return {event, StatusCode::OK};
+}
+
+template <typename T, typename Index, int VectorWidth,
+          template <typename> class MemObj>
+SNNStatus queue_tiled_filter_backprop_combine(
+    MemObj<T const>& partials_mem, MemObj<T>& out_mem,
+    Conv2DParams const& params, size_t n_splits, cl::sycl::queue& queue,
+    const std::vector<cl::sycl::event>& events) {
+  using Functor = tiled::TiledFilterBackpropCombine<
+      T, Index, VectorWidth, is_usm_obj_v<MemObj<T>, T>>;
+
+  size_t const filter_size = static_cast<size_t>(params.window_rows) *
+                             params.window_cols *
+                             (params.channels / params.groups) *
+                             params.features;
+  size_t const n_threads = filter_size / VectorWidth;
+
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    cgh.depends_on(events);
+    auto partials = partials_mem.read_mem(cgh);
+    auto filter_grad = out_mem.write_mem(cgh);
+
+    Functor combine{static_cast<Index>(filter_size),
+                    static_cast<Index>(n_splits), partials, filter_grad};
+
+    cgh.parallel_for(cl::sycl::range<1>{n_threads}, combine);
+  });
+  return {event, StatusCode::OK};
+}
+
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_SRC_CONV2D_TILED_QUEUE_TILED_FILTER_BACKPROP_IMPL_H_
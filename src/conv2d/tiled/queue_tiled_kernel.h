@@ -21,6 +21,8 @@
 
 #include "sycldnn/conv2d/params.h"
 
+#include "sycldnn/internal/conv2d/epilogue.h"
+
 #include "src/conv2d/tiled/tile_info.h"
 
 #include <CL/sycl.hpp>
@@ -35,6 +37,7 @@ template <typename T, typename Index, typename ConvType, int TileRows,
           template <typename> class MemObj>
 SNNStatus queue_tiled_kernel(MemObj<T const>& input, MemObj<T const>& filter,
                              MemObj<T>& output,
+                             EpilogueMem<T, MemObj>& epilogue,
                              Conv2DParams const& kernel_params,
                              tiled::TileInfo const& tile_info,
                              cl::sycl::queue& queue,
@@ -16,6 +16,7 @@
 #ifndef SYCLDNN_SRC_CONV2D_TILED_QUEUE_TILED_KERNEL_IMPL_H_
 #define SYCLDNN_SRC_CONV2D_TILED_QUEUE_TILED_KERNEL_IMPL_H_
 
+#include "sycldnn/data_format.h"
 #include "sycldnn/mem_object.h"
 #include "sycldnn/status.h"
 
@@ -23,7 +24,9 @@
 
 #include "sycldnn/conv2d/params.h"
 
+#include "src/conv2d/epilogue/fused_epilogue.h"
 #include "src/conv2d/tiled/kernels.h"
+#include "src/conv2d/tiled/kernels_nchw.h"
 #include "src/conv2d/tiled/tile_info.h"
 
 #include <CL/sycl.hpp>
@@ -60,6 +63,7 @@ template <typename T, typename Index, typename ConvType, int TileRows,
           template <typename> class MemObj>
 SNNStatus queue_tiled_kernel(MemObj<T const>& in_mem, MemObj<T const>& fil_mem,
                              MemObj<T>& out_mem,
+                             EpilogueMem<T, MemObj>& epilogue,
                              Conv2DParams const& kernel_params,
                              tiled::TileInfo const& tile_info,
                              cl::sycl::queue& queue,
@@ -75,10 +79,32 @@ SNNStatus queue_tiled_kernel(MemObj<T const>& in_mem, MemObj<T const>& fil_mem,
     auto filter = fil_mem.read_mem(cgh);
     auto output = out_mem.write_mem(cgh);
 
-    Functor conv{input, filter, output, kernel_params, tile_info};
     auto threads = get_thread_range(kernel_params, tile_info, queue);
 
-    cgh.parallel_for(threads, conv);
+    if constexpr (std::is_same<ConvType, conv_type::Forward>::value) {
+      auto fused_epilogue = get_fused_epilogue(epilogue, cgh);
+#ifdef SNN_ENABLE_NCHW
+      if constexpr (ChannelVectorWidth == 1 && FeatureVectorWidth == 1) {
+        if (kernel_params.input_format == DataFormat::NCHW) {
+          using NCHWFunctor =
+              tiled::TiledConv2DNCHW<T, Index, TileRows, TileCols, UseFastDiv,
+                                     WindowRows, WindowCols, Stride,
+                                     is_usm_obj_v<MemObj<T>, T>>;
+          NCHWFunctor conv{input,         filter,   output, fused_epilogue,
+                           kernel_params, tile_info};
+          cgh.parallel_for(threads, conv);
+          return;
+        }
+      }
+#endif  // SNN_ENABLE_NCHW
+      Functor conv{input, filter, output, fused_epilogue, kernel_params,
+                   tile_info};
+      cgh.parallel_for(threads, conv);
+    } else {
+      SNN_UNUSED_VAR(epilogue);
+      Functor conv{input, filter, output, kernel_params, tile_info};
+      cgh.parallel_for(threads, conv);
+    }
   });
   SNNStatus ok_status{event, StatusCode::OK};
   return ok_status;
@@ -0,0 +1,53 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_CONV2D_TILED_QUEUE_TILED_LOCAL_KERNEL_H_
+#define SYCLDNN_SRC_CONV2D_TILED_QUEUE_TILED_LOCAL_KERNEL_H_
+
+#include "sycldnn/mem_object.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/internal/conv2d/epilogue.h"
+
+#include "src/conv2d/tiled/local_kernels.h"
+
+#include <CL/sycl.hpp>
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+
+/**
+ * Queue the tiled convolution kernel which stages its input patch and filter
+ * slice in local memory.
+ *
+ * Returns StatusCode::InvalidAlgorithm if the device cannot support the
+ * work-group size or the amount of local memory required by the kernel.
+ */
+template <typename T, typename Index, typename ConvType, int TileRows,
+          int TileCols, int Window, int Stride,
+          template <typename> class MemObj>
+SNNStatus queue_tiled_local_kernel(MemObj<T const>& input,
+                                   MemObj<T const>& filter, MemObj<T>& output,
+                                   EpilogueMem<T, MemObj>& epilogue,
+                                   tiled::LocalConvShape const& shape,
+                                   cl::sycl::queue& queue,
+                                   const std::vector<cl::sycl::event>& events);
+
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_SRC_CONV2D_TILED_QUEUE_TILED_LOCAL_KERNEL_H_
@@ -0,0 +1,91 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_CONV2D_TILED_QUEUE_TILED_LOCAL_KERNEL_IMPL_H_
+#define SYCLDNN_SRC_CONV2D_TILED_QUEUE_TILED_LOCAL_KERNEL_IMPL_H_
+
+#include "sycldnn/accessor_types.h"
+#include "sycldnn/mem_object.h"
+#include "sycldnn/status.h"
+
+#include "src/conv2d/epilogue/fused_epilogue.h"
+#include "src/conv2d/tiled/local_kernels.h"
+#include "src/conv2d/tiled/queue_tiled_local_kernel.h"
+
+#include <CL/sycl.hpp>
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+
+template <typename T, typename Index, typename ConvType, int TileRows,
+          int TileCols, int Window, int Stride,
+          template <typename> class MemObj>
+SNNStatus queue_tiled_local_kernel(MemObj<T const>& in_mem,
+                                   MemObj<T const>& fil_mem,
+                                   MemObj<T>& out_mem,
+                                   EpilogueMem<T, MemObj>& epilogue,
+                                   tiled::LocalConvShape const& shape,
+                                   cl::sycl::queue& queue,
+                                   const std::vector<cl::sycl::event>& events) {
+  using Functor =
+      tiled::TiledLocalConv2D<T, Index, ConvType, TileRows, TileCols, Window,
+                              Stride, is_usm_obj_v<MemObj<T>, T>>;
+  using Sizes = tiled::LocalTileSizes<TileRows, TileCols, Window, Stride>;
+  constexpr size_t workgroup_size = tiled::LocalWorkGroup::Size;
+
+  cl::sycl::device device = queue.get_device();
+  size_t const max_workgroup_size =
+      device.get_info<cl::sycl::info::device::max_work_group_size>();
+  size_t const local_mem_size =
+      device.get_info<cl::sycl::info::device::local_mem_size>();
+  size_t const required_local_mem =
+      (Sizes::InputSize + Sizes::FilterSize) * sizeof(T);
+  if (workgroup_size > max_workgroup_size ||
+      required_local_mem > local_mem_size) {
+    return StatusCode::InvalidAlgorithm;
+  }
+
+  size_t const n_threads =
+      tiled::get_local_n_groups(shape, TileRows, TileCols) * workgroup_size;
+
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    cgh.depends_on(events);
+    auto input = in_mem.read_mem(cgh);
+    auto filter = fil_mem.read_mem(cgh);
+    auto output = out_mem.write_mem(cgh);
+    auto fused_epilogue = get_fused_epilogue(epilogue, cgh);
+
+    LocalAccessor<T> local_input{
+        cl::sycl::range<1>{static_cast<size_t>(Sizes::InputSize)}, cgh};
+    LocalAccessor<T> local_filter{
+        cl::sycl::range<1>{static_cast<size_t>(Sizes::FilterSize)}, cgh};
+
+    Functor conv{input, filter, output, fused_epilogue, local_input,
+                 local_filter, shape};
+
+    cgh.parallel_for(
+        cl::sycl::nd_range<1>{cl::sycl::range<1>{n_threads},
+                              cl::sycl::range<1>{workgroup_size}},
+        conv);
+  });
+  return {event, StatusCode::OK};
+}
+
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_SRC_CONV2D_TILED_QUEUE_TILED_LOCAL_KERNEL_IMPL_H_
@@ -56,8 +56,17 @@ template <typename ConvType>
 inline TileInfo get_tile_info(Conv2DParams const& params, int tile_rows,
                               int tile_cols, int /*channel_vector*/,
                               int feature_vector) {
-  auto rows = helpers::round_ratio_up_above_zero(params.out_rows, tile_rows);
-  auto cols = helpers::round_ratio_up_above_zero(params.out_cols, tile_cols);
+  // A dilated convolution is split into dilation_rows * dilation_cols
+  // independent dense convolutions, one for each phase of the output. Each
+  // phase is tiled separately, with tiles from different phases interleaved.
+  auto phase_rows = helpers::round_ratio_up_above_zero(params.out_rows,
+                                                       params.dilation_rows);
+  auto phase_cols = helpers::round_ratio_up_above_zero(params.out_cols,
+                                                       params.dilation_cols);
+  auto rows = params.dilation_rows *
+              helpers::round_ratio_up_above_zero(phase_rows, tile_rows);
+  auto cols = params.dilation_cols *
+              helpers::round_ratio_up_above_zero(phase_cols, tile_cols);
   auto output_vector = params.features / feature_vector;
   return {rows, cols, output_vector};
 }
@@ -79,6 +79,22 @@ struct InputRow final
     };
   }
 
+  /**
+   * Dilated input row factory method. Will load Width values from the input
+   * row, starting at the given column and stepping by dilation columns
+   * between each value.
+   */
+  template <typename Index, MULTI_PTR_TEMPLATE_DECL>
+  static InputRow SNN_ALWAYS_INLINE load_dilated_input_row(
+      cl::sycl::multi_ptr<T const, MULTI_PTR_TEMPLATE> input,
+      Index const offset, Index const col, Index const dilation,
+      Index const n_cols, Index const n_channels) {
+    if (dilation == 1) {
+      return load_input_row(input, offset, col, n_cols, n_channels);
+    }
+    return {input, offset, col, dilation, n_cols, n_channels};
+  }
+
  private:
   template <typename Index, MULTI_PTR_TEMPLATE_DECL>
   SNN_ALWAYS_INLINE InputRow(
@@ -107,6 +123,23 @@ struct InputRow final
       idx += n_channels;
     }
   }
+
+  template <typename Index, MULTI_PTR_TEMPLATE_DECL>
+  SNN_ALWAYS_INLINE InputRow(
+      cl::sycl::multi_ptr<T const, MULTI_PTR_TEMPLATE> input,
+      Index const offset, Index const col, Index const dilation,
+      Index const n_cols, Index const n_channels) {
+    Index idx = offset + col * n_channels;
+    Index const step = dilation * n_channels;
+    SNN_PRAGMA_UNROLL
+    for (int i = 0; i < Width; ++i) {
+      Index const this_col = col + i * dilation;
+      data(i) = (this_col < 0 || this_col >= n_cols)
+                    ? VecType{0}
+                    : helpers::io::Load<VecType>()(input, idx);
+      idx += step;
+    }
+  }
 };
 
 /** A WindowRows x WindowCols tile from the filter tensor. */
@@ -189,7 +222,104 @@ struct OutputTile final
     }
   }
 
+  /**
+   * Apply a convolution epilogue to the elements of the tile which lie within
+   * the output tensor. The tile elements are spaced row_step rows and
+   * col_step columns apart, matching write_out_dilated.
+   */
+  template <typename Epilogue, typename Index>
+  void SNN_ALWAYS_INLINE apply_epilogue(
+      Epilogue const& epilogue, Index const batch, Index const out_row,
+      Index const row_step, Index const n_rows, Index const out_col,
+      Index const col_step, Index const n_cols, Index const feature,
+      Index const n_features) {
+    Index const offset =
+        ((batch * n_rows + out_row) * n_cols + out_col) * n_features + feature;
+    apply_epilogue_at(epilogue, offset, out_row, row_step, n_rows, out_col,
+                      col_step, n_cols, feature, n_features);
+  }
+
+  /**
+   * Apply a convolution epilogue to the elements of a tile in an NCHW output
+   * tensor, where the tile lies in the feature plane with index
+   * batch * n_features + feature.
+   */
+  template <typename Epilogue, typename Index>
+  void SNN_ALWAYS_INLINE apply_epilogue_nchw(
+      Epilogue const& epilogue, Index const plane, Index const out_row,
+      Index const row_step, Index const n_rows, Index const out_col,
+      Index const col_step, Index const n_cols, Index const feature) {
+    Index const offset = (plane * n_rows + out_row) * n_cols + out_col;
+    apply_epilogue_at(epilogue, offset, out_row, row_step, n_rows, out_col,
+                      col_step, n_cols, feature, Index{1});
+  }
+
+  /**
+   * Write out a tile whose elements are spaced row_step rows and col_step
+   * columns apart in the output tensor, as computed by a dilated
+   * convolution.
+   */
+  template <typename Index, MULTI_PTR_TEMPLATE_DECL>
+  void SNN_ALWAYS_INLINE write_out_dilated(
+      cl::sycl::multi_ptr<T, MULTI_PTR_TEMPLATE> output, Index const batch,
+      Index const out_row, Index const row_step, Index const n_rows,
+      Index const out_col, Index const col_step, Index const n_cols,
+      Index const feature, Index const n_features) {
+    if (row_step == 1 && col_step == 1) {
+      write_out(output, batch, out_row, n_rows, out_col, n_cols, feature,
+                n_features);
+      return;
+    }
+    Index const offset =
+        ((batch * n_rows + out_row) * n_cols + out_col) * n_features + feature;
+
+    Index row_idx = offset;
+    SNN_PRAGMA_UNROLL
+    for (int tile_row = 0; tile_row < OutTileRows; ++tile_row) {
+      if (out_row + tile_row * row_step < n_rows) {
+        Index idx = row_idx;
+        SNN_PRAGMA_UNROLL
+        for (int tile_col = 0; tile_col < OutTileCols; ++tile_col) {
+          if (out_col + tile_col * col_step < n_cols) {
+            helpers::io::Store<VecType>()(output, idx,
+                                          data(tile_row, tile_col));
+          }
+          idx += col_step * n_features;
+        }
+      }
+      row_idx += row_step * n_cols * n_features;
+    }
+  }
+
  private:
+  /**
+   * Apply the epilogue to the tile elements starting at the given offset,
+   * where consecutive columns of the output are col_stride elements apart.
+   */
+  template <typename Epilogue, typename Index>
+  void SNN_ALWAYS_INLINE apply_epilogue_at(
+      Epilogue const& epilogue, Index const offset, Index const out_row,
+      Index const row_step, Index const n_rows, Index const out_col,
+      Index const col_step, Index const n_cols, Index const feature,
+      Index const col_stride) {
+    Index row_idx = offset;
+    SNN_PRAGMA_UNROLL
+    for (int tile_row = 0; tile_row < OutTileRows; ++tile_row) {
+      if (out_row + tile_row * row_step < n_rows) {
+        Index idx = row_idx;
+        SNN_PRAGMA_UNROLL
+        for (int tile_col = 0; tile_col < OutTileCols; ++tile_col) {
+          if (out_col + tile_col * col_step < n_cols) {
+            data(tile_row, tile_col) =
+                epilogue.apply(data(tile_row, tile_col), idx, feature);
+          }
+          idx += col_step * col_stride;
+        }
+      }
+      row_idx += row_step * n_cols * col_stride;
+    }
+  }
+
   template <typename Index, MULTI_PTR_TEMPLATE_DECL>
   void SNN_ALWAYS_INLINE write_out_checked(
       cl::sycl::multi_ptr<T, MULTI_PTR_TEMPLATE> output, Index const batch,
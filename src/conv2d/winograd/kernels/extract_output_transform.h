@@ -24,6 +24,7 @@
 
 #include "src/helpers/tensor_index.h"
 
+#include "src/conv2d/epilogue/fused_epilogue.h"
 #include "src/conv2d/winograd/kernels/tiles.h"
 
 namespace sycldnn {
@@ -31,12 +32,17 @@ namespace conv2d {
 namespace internal {
 namespace winograd {
 
+/**
+ * Output transform for forward and input backprop convolutions, which applies
+ * the epilogue to the output values as they are written.
+ */
 template <typename T, typename Index, int M, int N, int R, int S,
           typename ConvType, bool Accumulate, bool IsUSM>
 struct ExtractOutputTiles {
   ExtractOutputTiles(Conv2DParams const& params, TileInfo const& tile_info,
                      ReadMem<T const, IsUSM> const& input,
-                     WriteMem<T, IsUSM> const& output)
+                     WriteMem<T, IsUSM> const& output,
+                     FusedEpilogue<T, IsUSM> const& epilogue)
       : n_threads_{params.batch * tile_info.rows * tile_info.cols *
                    params.features},
         n_tiles_{tile_info.number * params.batch},
@@ -46,7 +52,8 @@ struct ExtractOutputTiles {
         n_out_cols_{params.out_cols},
         n_features_{params.features},
         input_mem_{input},
-        output_mem_{output} {}
+        output_mem_{output},
+        epilogue_{epilogue} {}
 
   void SNN_ALWAYS_INLINE operator()(cl::sycl::item<1> item) const {
     Index const index = item.get_id(0);
@@ -82,9 +89,9 @@ struct ExtractOutputTiles {
 
       SYCLOutputWindow<Index> out_w{rend - row, cend - col, offset};
 
-      OutputData<T, M, N, R, S>::write_output(output_data, out_w, n_out_cols_,
-                                              n_features_,
-                                              OutputTile<T, M, N, R, S>{tmp});
+      OutputData<T, M, N, R, S>::write_output(
+          output_data, out_w, n_out_cols_, n_features_,
+          OutputTile<T, M, N, R, S>{tmp}, epilogue_, feature);
     }
   }
 
@@ -98,6 +105,7 @@ struct ExtractOutputTiles {
   Index const n_features_;
   ReadMem<T const, IsUSM> input_mem_;
   WriteMem<T, IsUSM> output_mem_;
+  FusedEpilogue<T, IsUSM> const epilogue_;
 };
 
 template <typename T, typename Index, int M, int N, int R, int S,
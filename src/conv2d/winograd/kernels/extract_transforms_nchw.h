@@ -0,0 +1,231 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_CONV2D_WINOGRAD_KERNELS_EXTRACT_TRANSFORMS_NCHW_H_
+#define SYCLDNN_SRC_CONV2D_WINOGRAD_KERNELS_EXTRACT_TRANSFORMS_NCHW_H_
+
+#include "sycldnn/accessor_types.h"
+
+#include "sycldnn/conv2d/params.h"
+#include "sycldnn/helpers/minmax.h"
+
+#include "src/helpers/tensor_index.h"
+
+#include "src/conv2d/epilogue/fused_epilogue.h"
+#include "src/conv2d/winograd/kernels/tiles.h"
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+namespace winograd {
+
+/**
+ * Input transform for forward convolutions on NCHW tensors.
+ *
+ * The transformed tiles are written in the same layout as the NHWC transform,
+ * so the batched matmul is shared between the two layouts. Each channel plane
+ * of an NCHW tensor is read as a single channel NHWC image, and neighbouring
+ * work items transform neighbouring tiles in the same plane.
+ */
+template <typename T, typename Index, int M, int N, int R, int S, bool IsUSM>
+struct ExtractInputTilesNCHW {
+  ExtractInputTilesNCHW(Conv2DParams const& params, TileInfo const& tile_info,
+                        ReadMem<T const, IsUSM> const& input,
+                        WriteMem<T, IsUSM> const& output)
+      : n_elems_{params.batch * tile_info.rows * tile_info.cols *
+                 params.channels},
+        n_tiles_{tile_info.number * params.batch},
+        n_tile_rows_{tile_info.rows},
+        n_tile_cols_{tile_info.cols},
+        n_in_cols_{params.in_cols},
+        n_in_rows_{params.in_rows},
+        n_channels_{params.channels},
+        n_pad_cols_{params.pad_cols},
+        n_pad_rows_{params.pad_rows},
+        input_mem_{input},
+        output_mem_{output} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::item<1> item) const {
+    Index const index = item.get_id(0);
+    if (index < n_elems_) {
+      auto input_data = input_mem_.get_pointer();
+      auto output_data = output_mem_.get_pointer();
+
+      auto const tensor_idx =
+          helpers::TensorIndexHelper<Index, false>::unflatten4d(
+              index, n_channels_, n_channels_, n_tile_rows_, n_tile_rows_,
+              n_tile_cols_, n_tile_cols_);
+      Index const col_idx = tensor_idx.s3;
+      Index const row_idx = tensor_idx.s2;
+      Index const channel_idx = tensor_idx.s1;
+      Index const batch = tensor_idx.s0;
+      Index const tile_idx = (batch * n_tile_rows_ + row_idx) * n_tile_cols_ +
+                             col_idx;
+
+      Index const cstart = col_idx * N - n_pad_cols_;
+      Index const rstart = row_idx * M - n_pad_rows_;
+
+      Index const plane = batch * n_channels_ + channel_idx;
+      InputTile<T, M, N, R, S> inp(input_data, plane, rstart, n_in_rows_,
+                                   cstart, n_in_cols_, Index{0}, Index{1});
+
+      OutputData<T, M, N, R, S>::write_transformed_input(
+          output_data, tile_idx, channel_idx, n_tiles_, n_channels_,
+          TransformedInputTile<T, M, N, R, S>{inp});
+    }
+  }
+
+ private:
+  Index const n_elems_;
+  Index const n_tiles_;
+  Index const n_tile_rows_;
+  Index const n_tile_cols_;
+  Index const n_in_cols_;
+  Index const n_in_rows_;
+  Index const n_channels_;
+  Index const n_pad_cols_;
+  Index const n_pad_rows_;
+  ReadMem<T const, IsUSM> input_mem_;
+  WriteMem<T, IsUSM> output_mem_;
+};
+
+/**
+ * Filter transform for forward convolutions with FCHW filters, writing the
+ * same transformed layout as the HWCF filter transform.
+ */
+template <typename T, typename Index, int M, int N, int R, int S, bool IsUSM>
+struct ExtractFilterTilesFCHW {
+  ExtractFilterTilesFCHW(Conv2DParams const& params,
+                         TileInfo const& /*unused*/,
+                         ReadMem<T const, IsUSM> const& filter,
+                         WriteMem<T, IsUSM> const& output)
+      : n_tiles_{params.channels * params.features},
+        n_channels_{params.channels},
+        n_features_{params.features},
+        filter_mem_{filter},
+        output_mem_{output} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::item<1> item) const {
+    Index const index = item.get_id(0);
+    if (index < n_tiles_) {
+      auto filter_data = filter_mem_.get_pointer();
+      auto output_data = output_mem_.get_pointer();
+
+      auto const channel_feature_idx =
+          helpers::TensorIndexHelper<Index, false>::unflatten2d(
+              index, n_features_, n_features_);
+      Index const feature_idx = channel_feature_idx.s1;
+      Index const channel_idx = channel_feature_idx.s0;
+
+      FilterTile<T, M, N, R, S, conv_type::Forward> filter(
+          filter_data, channel_idx, feature_idx, n_channels_, FCHWLayout{});
+      TransformedFilterTile<T, M, N, R, S> transformed{filter};
+
+      OutputData<T, M, N, R, S>::write_transformed_filter(
+          output_data, feature_idx, channel_idx, n_features_, n_channels_,
+          transformed);
+    }
+  }
+
+ private:
+  Index const n_tiles_;
+  Index const n_channels_;
+  Index const n_features_;
+  ReadMem<T const, IsUSM> filter_mem_;
+  WriteMem<T, IsUSM> output_mem_;
+};
+
+/**
+ * Output transform for forward convolutions on NCHW tensors, which applies
+ * the epilogue to the output values as they are written.
+ *
+ * Each output tile lies within a single feature plane, so is written as a
+ * single channel NHWC tile into that plane.
+ */
+template <typename T, typename Index, int M, int N, int R, int S, bool IsUSM>
+struct ExtractOutputTilesNCHW {
+  ExtractOutputTilesNCHW(Conv2DParams const& params, TileInfo const& tile_info,
+                         ReadMem<T const, IsUSM> const& input,
+                         WriteMem<T, IsUSM> const& output,
+                         FusedEpilogue<T, IsUSM> const& epilogue)
+      : n_threads_{params.batch * tile_info.rows * tile_info.cols *
+                   params.features},
+        n_tiles_{tile_info.number * params.batch},
+        n_tile_rows_{tile_info.rows},
+        n_tile_cols_{tile_info.cols},
+        n_out_rows_{params.out_rows},
+        n_out_cols_{params.out_cols},
+        n_features_{params.features},
+        input_mem_{input},
+        output_mem_{output},
+        epilogue_{epilogue} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::item<1> item) const {
+    Index const index = item.get_id(0);
+    if (index < n_threads_) {
+      auto input_data = input_mem_.get_pointer();
+      auto output_data = output_mem_.get_pointer();
+
+      auto const tensor_idx =
+          helpers::TensorIndexHelper<Index, false>::unflatten4d(
+              index, n_features_, n_features_, n_tile_rows_, n_tile_rows_,
+              n_tile_cols_, n_tile_cols_);
+      Index const col_idx = tensor_idx.s3;
+      Index const row_idx = tensor_idx.s2;
+      Index const feature = tensor_idx.s1;
+      Index const batch = tensor_idx.s0;
+      Index const tile_idx = (batch * n_tile_rows_ + row_idx) * n_tile_cols_ +
+                             col_idx;
+
+      IntermediateTile<T, M, N, R, S> tmp{input_data, tile_idx, n_tiles_,
+                                          feature, n_features_};
+
+      Index const col = col_idx * N;
+      Index const cend = helpers::min(col + N, n_out_cols_);
+
+      Index const row = row_idx * M;
+      Index const rend = helpers::min(row + M, n_out_rows_);
+
+      Index const offset =
+          ((batch * n_features_ + feature) * n_out_rows_ + row) * n_out_cols_ +
+          col;
+
+      SYCLOutputWindow<Index> out_w{rend - row, cend - col, offset};
+
+      OutputData<T, M, N, R, S>::write_output(
+          output_data, out_w, n_out_cols_, Index{1},
+          OutputTile<T, M, N, R, S>{tmp}, epilogue_, feature);
+    }
+  }
+
+ private:
+  Index const n_threads_;
+  Index const n_tiles_;
+  Index const n_tile_rows_;
+  Index const n_tile_cols_;
+  Index const n_out_rows_;
+  Index const n_out_cols_;
+  Index const n_features_;
+  ReadMem<T const, IsUSM> input_mem_;
+  WriteMem<T, IsUSM> output_mem_;
+  FusedEpilogue<T, IsUSM> const epilogue_;
+};
+
+}  // namespace winograd
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_SRC_CONV2D_WINOGRAD_KERNELS_EXTRACT_TRANSFORMS_NCHW_H_
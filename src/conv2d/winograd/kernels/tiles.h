@@ -84,6 +84,9 @@ using BaseFilterTile = helpers::RegisterTile2D<T, R, S>;
 template <typename T, int M, int N, int R, int S, typename ConvType>
 struct FilterTile;
 
+/** Tag used to select the FCHW filter loader for NCHW convolutions. */
+struct FCHWLayout {};
+
 template <typename T, int M, int N, int R, int S>
 struct FilterTile<T, M, N, R, S, conv_type::Forward> final
     : public BaseFilterTile<T, M, N, R, S> {
@@ -115,6 +118,25 @@ struct FilterTile<T, M, N, R, S, conv_type::Forward> final
       }
     }
   }
+  /**
+   * Read the filter data from a filter in (Feature x Channel x Height x Width)
+   * format, as used with NCHW inputs. The R x S window for each channel and
+   * feature pair is contiguous in this format.
+   */
+  template <typename PtrT, MULTI_PTR_TEMPLATE_DECL, typename Index>
+  SNN_ALWAYS_INLINE FilterTile(
+      cl::sycl::multi_ptr<PtrT const, MULTI_PTR_TEMPLATE> input,
+      Index const channel, Index const feature, Index const n_channels,
+      FCHWLayout /*tag*/) {
+    input += (feature * n_channels + channel) * R * S;
+    SNN_PRAGMA_UNROLL
+    for (int r = 0; r < R; ++r) {
+      SNN_PRAGMA_UNROLL
+      for (int c = 0; c < S; ++c) {
+        data(r, c) = helpers::io::Load<T>()(input, r * S + c);
+      }
+    }
+  }
 };
 
 template <typename T, int M, int N, int R, int S>
@@ -367,6 +389,30 @@ struct OutputData {
       }
     }
   }
+  /**
+   * Write the output tile to the output memory as in write_output(), applying
+   * the epilogue to each value before it is stored.
+   *
+   * The epilogue is given the offset of each value from the start of the
+   * output buffer, along with the feature shared by all values in the tile.
+   */
+  template <typename Epilogue, typename PtrT, MULTI_PTR_TEMPLATE_DECL,
+            typename Index>
+  static SNN_ALWAYS_INLINE void write_output(
+      cl::sycl::multi_ptr<PtrT, MULTI_PTR_TEMPLATE> output,
+      SYCLOutputWindow<Index> const& window, Index const n_cols,
+      Index const n_channels, OutputTile<T, M, N, R, S> const& tile,
+      Epilogue const& epilogue, Index const feature) {
+    output += window.offset;
+    for (int r = 0; r < M && r < window.rsize; ++r) {
+      for (int c = 0; c < N && c < window.csize; ++c) {
+        Index idx = (r * n_cols + c) * n_channels;
+        T const val = epilogue.apply(tile.data(r, c), window.offset + idx,
+                                     feature);
+        helpers::io::Store<T>()(output, idx, val);
+      }
+    }
+  }
   /**
    * Write the output tile to the correct output memory. The output pointer
    * should be at the start of the output buffer. The resulting output shape is
@@ -17,6 +17,7 @@
 #define SYCLDNN_SRC_CONV2D_WINOGRAD_KERNELS_TILES_IMPL_H_
 
 #include "src/conv2d/winograd/kernels/tiles.h"
+#include "src/conv2d/winograd/kernels/transform_matrices.h"
 
 #include "src/helpers/math.h"
 #include "src/helpers/register_tile.h"
@@ -1362,6 +1363,211 @@ struct OutputTile<T, 4, 4, 3, 3> final : public BaseOutputTile<T, 4, 4, 3, 3> {
   }
 };
 
+/**
+ * Filter tile transform computed from the TransformMatrices for F(M, R) along
+ * the rows and F(N, S) along the columns, as U = G g G^T.
+ *
+ * Used for the larger tile sizes, where writing out the transform by hand
+ * would be impractical. As the loops are fully unrolled and the coefficients
+ * are compile time constants, only the non-zero terms are computed.
+ */
+template <typename T, int M, int N, int R, int S>
+struct MatrixTransformedFilterTile
+    : public BaseTransformedFilterTile<T, M, N, R, S> {
+  using BaseTransformedFilterTile<T, M, N, R, S>::data;
+  /**
+   * Apply the Winograd transform to the filter tile.
+   */
+  template <typename ConvType>
+  SNN_ALWAYS_INLINE explicit MatrixTransformedFilterTile(
+      FilterTile<T, M, N, R, S, ConvType> const& filter)
+      : BaseTransformedFilterTile<T, M, N, R, S>{} {
+    using Scalar = typename ScalarType<T>::type;
+    using RowMatrices = TransformMatrices<M, R>;
+    using ColMatrices = TransformMatrices<N, S>;
+    constexpr int A = M + R - 1;
+    constexpr int B = N + S - 1;
+    helpers::RegisterTile2D<T, A, S> inter{};
+    SNN_PRAGMA_UNROLL
+    for (int i = 0; i < A; ++i) {
+      SNN_PRAGMA_UNROLL
+      for (int c = 0; c < S; ++c) {
+        T acc{Scalar{0}};
+        SNN_PRAGMA_UNROLL
+        for (int r = 0; r < R; ++r) {
+          accumulate_coefficient(acc, RowMatrices::filter(i, r),
+                                 filter.data(r, c));
+        }
+        inter.data(i, c) = acc;
+      }
+    }
+    SNN_PRAGMA_UNROLL
+    for (int i = 0; i < A; ++i) {
+      SNN_PRAGMA_UNROLL
+      for (int j = 0; j < B; ++j) {
+        T acc{Scalar{0}};
+        SNN_PRAGMA_UNROLL
+        for (int c = 0; c < S; ++c) {
+          accumulate_coefficient(acc, ColMatrices::filter(j, c),
+                                 inter.data(i, c));
+        }
+        data(i, j) = acc;
+      }
+    }
+  }
+};
+
+/**
+ * Input tile transform computed from the TransformMatrices for F(M, R) along
+ * the rows and F(N, S) along the columns, as V = B^T d B.
+ */
+template <typename T, int M, int N, int R, int S>
+struct MatrixTransformedInputTile
+    : public BaseTransformedInputTile<T, M, N, R, S> {
+  using BaseTransformedInputTile<T, M, N, R, S>::data;
+  /**
+   * Apply the Winograd transform to the input tile.
+   */
+  SNN_ALWAYS_INLINE explicit MatrixTransformedInputTile(
+      InputTile<T, M, N, R, S> const& inp)
+      : BaseTransformedInputTile<T, M, N, R, S>{} {
+    using Scalar = typename ScalarType<T>::type;
+    using RowMatrices = TransformMatrices<M, R>;
+    using ColMatrices = TransformMatrices<N, S>;
+    constexpr int A = M + R - 1;
+    constexpr int B = N + S - 1;
+    helpers::RegisterTile2D<T, A, B> inter{};
+    SNN_PRAGMA_UNROLL
+    for (int i = 0; i < A; ++i) {
+      SNN_PRAGMA_UNROLL
+      for (int c = 0; c < B; ++c) {
+        T acc{Scalar{0}};
+        SNN_PRAGMA_UNROLL
+        for (int r = 0; r < A; ++r) {
+          accumulate_coefficient(acc, RowMatrices::input(i, r),
+                                 inp.data(r, c));
+        }
+        inter.data(i, c) = acc;
+      }
+    }
+    SNN_PRAGMA_UNROLL
+    for (int i = 0; i < A; ++i) {
+      SNN_PRAGMA_UNROLL
+      for (int j = 0; j < B; ++j) {
+        T acc{Scalar{0}};
+        SNN_PRAGMA_UNROLL
+        for (int c = 0; c < B; ++c) {
+          accumulate_coefficient(acc, ColMatrices::input(j, c),
+                                 inter.data(i, c));
+        }
+        data(i, j) = acc;
+      }
+    }
+  }
+};
+
+/**
+ * Output tile transform computed from the TransformMatrices for F(M, R) along
+ * the rows and F(N, S) along the columns, as Y = A^T m A.
+ */
+template <typename T, int M, int N, int R, int S>
+struct MatrixOutputTile : public BaseOutputTile<T, M, N, R, S> {
+  using BaseOutputTile<T, M, N, R, S>::data;
+  /**
+   * Apply the inverse Winograd transform to the intermediate tile.
+   */
+  SNN_ALWAYS_INLINE explicit MatrixOutputTile(
+      IntermediateTile<T, M, N, R, S> const& tile)
+      : BaseOutputTile<T, M, N, R, S>{} {
+    using Scalar = typename ScalarType<T>::type;
+    using RowMatrices = TransformMatrices<M, R>;
+    using ColMatrices = TransformMatrices<N, S>;
+    constexpr int A = M + R - 1;
+    constexpr int B = N + S - 1;
+    helpers::RegisterTile2D<T, M, B> inter{};
+    SNN_PRAGMA_UNROLL
+    for (int i = 0; i < M; ++i) {
+      SNN_PRAGMA_UNROLL
+      for (int c = 0; c < B; ++c) {
+        T acc{Scalar{0}};
+        SNN_PRAGMA_UNROLL
+        for (int r = 0; r < A; ++r) {
+          accumulate_coefficient(acc, RowMatrices::output(i, r),
+                                 tile.data(r, c));
+        }
+        inter.data(i, c) = acc;
+      }
+    }
+    SNN_PRAGMA_UNROLL
+    for (int i = 0; i < M; ++i) {
+      SNN_PRAGMA_UNROLL
+      for (int j = 0; j < N; ++j) {
+        T acc{Scalar{0}};
+        SNN_PRAGMA_UNROLL
+        for (int c = 0; c < B; ++c) {
+          accumulate_coefficient(acc, ColMatrices::output(j, c),
+                                 inter.data(i, c));
+        }
+        data(i, j) = acc;
+      }
+    }
+  }
+};
+
+template <typename T>
+struct TransformedFilterTile<T, 6, 6, 3, 3> final
+    : public MatrixTransformedFilterTile<T, 6, 6, 3, 3> {
+  using MatrixTransformedFilterTile<T, 6, 6, 3, 3>::MatrixTransformedFilterTile;
+};
+
+template <typename T>
+struct TransformedInputTile<T, 6, 6, 3, 3> final
+    : public MatrixTransformedInputTile<T, 6, 6, 3, 3> {
+  using MatrixTransformedInputTile<T, 6, 6, 3, 3>::MatrixTransformedInputTile;
+};
+
+template <typename T>
+struct OutputTile<T, 6, 6, 3, 3> final
+    : public MatrixOutputTile<T, 6, 6, 3, 3> {
+  using MatrixOutputTile<T, 6, 6, 3, 3>::MatrixOutputTile;
+};
+
+template <typename T>
+struct TransformedFilterTile<T, 2, 2, 5, 5> final
+    : public MatrixTransformedFilterTile<T, 2, 2, 5, 5> {
+  using MatrixTransformedFilterTile<T, 2, 2, 5, 5>::MatrixTransformedFilterTile;
+};
+
+template <typename T>
+struct TransformedInputTile<T, 2, 2, 5, 5> final
+    : public MatrixTransformedInputTile<T, 2, 2, 5, 5> {
+  using MatrixTransformedInputTile<T, 2, 2, 5, 5>::MatrixTransformedInputTile;
+};
+
+template <typename T>
+struct OutputTile<T, 2, 2, 5, 5> final
+    : public MatrixOutputTile<T, 2, 2, 5, 5> {
+  using MatrixOutputTile<T, 2, 2, 5, 5>::MatrixOutputTile;
+};
+
+template <typename T>
+struct TransformedFilterTile<T, 4, 4, 5, 5> final
+    : public MatrixTransformedFilterTile<T, 4, 4, 5, 5> {
+  using MatrixTransformedFilterTile<T, 4, 4, 5, 5>::MatrixTransformedFilterTile;
+};
+
+template <typename T>
+struct TransformedInputTile<T, 4, 4, 5, 5> final
+    : public MatrixTransformedInputTile<T, 4, 4, 5, 5> {
+  using MatrixTransformedInputTile<T, 4, 4, 5, 5>::MatrixTransformedInputTile;
+};
+
+template <typename T>
+struct OutputTile<T, 4, 4, 5, 5> final
+    : public MatrixOutputTile<T, 4, 4, 5, 5> {
+  using MatrixOutputTile<T, 4, 4, 5, 5>::MatrixOutputTile;
+};
+
 }  // namespace winograd
 }  // namespace internal
 }  // namespace conv2d
@@ -0,0 +1,220 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_CONV2D_WINOGRAD_KERNELS_TRANSFORM_MATRICES_H_
+#define SYCLDNN_SRC_CONV2D_WINOGRAD_KERNELS_TRANSFORM_MATRICES_H_
+
+#include "sycldnn/helpers/macros.h"
+
+#include <CL/sycl.hpp>
+
+namespace sycldnn {
+namespace conv2d {
+namespace internal {
+namespace winograd {
+
+/**
+ * A rational coefficient in one of the Winograd transform matrices.
+ *
+ * The coefficients are stored as integer ratios so that the transforms can be
+ * evaluated in the precision of the data type, without needing double
+ * precision support on the device.
+ */
+struct Coefficient {
+  /** Numerator of the coefficient. */
+  int num;
+  /** Denominator of the coefficient. */
+  int den;
+};
+
+/** Scalar type underlying a data type, used to compute the coefficients. */
+template <typename T>
+struct ScalarType {
+  /** Scalar type. */
+  using type = T;
+};
+
+/** The scalar type of a SYCL vector is its element type. */
+template <typename T, int Width>
+struct ScalarType<cl::sycl::vec<T, Width>> {
+  /** Scalar type. */
+  using type = T;
+};
+
+/**
+ * Multiply a value by a transform coefficient and add it to an accumulator.
+ *
+ * Zero coefficients are skipped and unit coefficients avoid the
+ * multiplication, so when the transform loops are fully unrolled only the
+ * non-trivial terms of the transform remain.
+ */
+template <typename T>
+inline SNN_ALWAYS_INLINE void accumulate_coefficient(T& acc, Coefficient coeff,
+                                                     T const& val) {
+  using Scalar = typename ScalarType<T>::type;
+  if (coeff.num == 0) {
+    return;
+  }
+  if (coeff.den == 1 && coeff.num == 1) {
+    acc += val;
+  } else if (coeff.den == 1 && coeff.num == -1) {
+    acc -= val;
+  } else {
+    acc += val *
+           (static_cast<Scalar>(coeff.num) / static_cast<Scalar>(coeff.den));
+  }
+}
+
+/**
+ * Transform matrices for the 1D Winograd algorithm F(M, R), computing M
+ * outputs of an R element filter from A = M + R - 1 inputs.
+ *
+ * Each specialisation provides:
+ *  - filter(i, k): the A x R filter transform matrix G,
+ *  - input(i, k):  the A x A input transform matrix B^T,
+ *  - output(j, i): the M x A output transform matrix A^T,
+ * such that y = A^T [(G g) . (B^T d)] computes the correlation of d and g.
+ *
+ * The 2D transforms are formed by applying the 1D transforms to both the rows
+ * and the columns of a tile.
+ */
+template <int M, int R>
+struct TransformMatrices;
+
+/**
+ * Transform matrices for F(6, 3), using the interpolation points
+ * 0, 1, -1, 2, -2, 1/2, -1/2 and infinity. Including the half integer points
+ * keeps the magnitude of the coefficients small, which in turn keeps the
+ * numerical error comparable to the smaller F(4, 3) transform.
+ */
+template <>
+struct TransformMatrices<6, 3> {
+  /** Filter transform matrix G. */
+  static constexpr Coefficient filter(int i, int k) {
+    constexpr Coefficient g[8][3] = {
+        {{1, 1}, {0, 1}, {0, 1}},
+        {{-2, 9}, {-2, 9}, {-2, 9}},
+        {{-2, 9}, {2, 9}, {-2, 9}},
+        {{1, 90}, {1, 45}, {2, 45}},
+        {{1, 90}, {-1, 45}, {2, 45}},
+        {{32, 45}, {16, 45}, {8, 45}},
+        {{32, 45}, {-16, 45}, {8, 45}},
+        {{0, 1}, {0, 1}, {1, 1}}};
+    return g[i][k];
+  }
+  /** Input transform matrix B^T. */
+  static constexpr Coefficient input(int i, int k) {
+    constexpr Coefficient bt[8][8] = {
+        {{1, 1}, {0, 1}, {-21, 4}, {0, 1}, {21, 4}, {0, 1}, {-1, 1}, {0, 1}},
+        {{0, 1}, {1, 1}, {1, 1}, {-17, 4}, {-17, 4}, {1, 1}, {1, 1}, {0, 1}},
+        {{0, 1}, {-1, 1}, {1, 1}, {17, 4}, {-17, 4}, {-1, 1}, {1, 1}, {0, 1}},
+        {{0, 1}, {1, 2}, {1, 4}, {-5, 2}, {-5, 4}, {2, 1}, {1, 1}, {0, 1}},
+        {{0, 1}, {-1, 2}, {1, 4}, {5, 2}, {-5, 4}, {-2, 1}, {1, 1}, {0, 1}},
+        {{0, 1}, {2, 1}, {4, 1}, {-5, 2}, {-5, 1}, {1, 2}, {1, 1}, {0, 1}},
+        {{0, 1}, {-2, 1}, {4, 1}, {5, 2}, {-5, 1}, {-1, 2}, {1, 1}, {0, 1}},
+        {{0, 1}, {-1, 1}, {0, 1}, {21, 4}, {0, 1}, {-21, 4}, {0, 1}, {1, 1}}};
+    return bt[i][k];
+  }
+  /** Output transform matrix A^T. */
+  static constexpr Coefficient output(int j, int i) {
+    constexpr Coefficient at[6][8] = {
+        {{1, 1}, {1, 1}, {1, 1}, {1, 1}, {1, 1}, {1, 1}, {1, 1}, {0, 1}},
+        {{0, 1}, {1, 1}, {-1, 1}, {2, 1}, {-2, 1}, {1, 2}, {-1, 2}, {0, 1}},
+        {{0, 1}, {1, 1}, {1, 1}, {4, 1}, {4, 1}, {1, 4}, {1, 4}, {0, 1}},
+        {{0, 1}, {1, 1}, {-1, 1}, {8, 1}, {-8, 1}, {1, 8}, {-1, 8}, {0, 1}},
+        {{0, 1}, {1, 1}, {1, 1}, {16, 1}, {16, 1}, {1, 16}, {1, 16}, {0, 1}},
+        {{0, 1}, {1, 1}, {-1, 1}, {32, 1}, {-32, 1}, {1, 32}, {-1, 32},
+         {1, 1}}};
+    return at[j][i];
+  }
+};
+
+/**
+ * Transform matrices for F(2, 5), using the interpolation points
+ * 0, 1, -1, 2, -2 and infinity.
+ */
+template <>
+struct TransformMatrices<2, 5> {
+  /** Filter transform matrix G. */
+  static constexpr Coefficient filter(int i, int k) {
+    constexpr Coefficient g[6][5] = {
+        {{1, 4}, {0, 1}, {0, 1}, {0, 1}, {0, 1}},
+        {{-1, 6}, {-1, 6}, {-1, 6}, {-1, 6}, {-1, 6}},
+        {{-1, 6}, {1, 6}, {-1, 6}, {1, 6}, {-1, 6}},
+        {{1, 24}, {1, 12}, {1, 6}, {1, 3}, {2, 3}},
+        {{1, 24}, {-1, 12}, {1, 6}, {-1, 3}, {2, 3}},
+        {{0, 1}, {0, 1}, {0, 1}, {0, 1}, {1, 1}}};
+    return g[i][k];
+  }
+  /** Input transform matrix B^T. */
+  static constexpr Coefficient input(int i, int k) {
+    constexpr Coefficient bt[6][6] = {
+        {{4, 1}, {0, 1}, {-5, 1}, {0, 1}, {1, 1}, {0, 1}},
+        {{0, 1}, {-4, 1}, {-4, 1}, {1, 1}, {1, 1}, {0, 1}},
+        {{0, 1}, {4, 1}, {-4, 1}, {-1, 1}, {1, 1}, {0, 1}},
+        {{0, 1}, {-2, 1}, {-1, 1}, {2, 1}, {1, 1}, {0, 1}},
+        {{0, 1}, {2, 1}, {-1, 1}, {-2, 1}, {1, 1}, {0, 1}},
+        {{0, 1}, {4, 1}, {0, 1}, {-5, 1}, {0, 1}, {1, 1}}};
+    return bt[i][k];
+  }
+  /** Output transform matrix A^T. */
+  static constexpr Coefficient output(int j, int i) {
+    constexpr Coefficient at[2][6] = {
+        {{1, 1}, {1, 1}, {1, 1}, {1, 1}, {1, 1}, {0, 1}},
+        {{0, 1}, {1, 1}, {-1, 1}, {2, 1}, {-2, 1}, {1, 1}}};
+    return at[j][i];
+  }
+};
+
+/**
+ * Transform matrices for F(4, 5). These use the same interpolation points as
+ * F(6, 3), so share the same input transform.
+ */
+template <>
+struct TransformMatrices<4, 5> {
+  /** Filter transform matrix G. */
+  static constexpr Coefficient filter(int i, int k) {
+    constexpr Coefficient g[8][5] = {
+        {{1, 1}, {0, 1}, {0, 1}, {0, 1}, {0, 1}},
+        {{-2, 9}, {-2, 9}, {-2, 9}, {-2, 9}, {-2, 9}},
+        {{-2, 9}, {2, 9}, {-2, 9}, {2, 9}, {-2, 9}},
+        {{1, 90}, {1, 45}, {2, 45}, {4, 45}, {8, 45}},
+        {{1, 90}, {-1, 45}, {2, 45}, {-4, 45}, {8, 45}},
+        {{32, 45}, {16, 45}, {8, 45}, {4, 45}, {2, 45}},
+        {{32, 45}, {-16, 45}, {8, 45}, {-4, 45}, {2, 45}},
+        {{0, 1}, {0, 1}, {0, 1}, {0, 1}, {1, 1}}};
+    return g[i][k];
+  }
+  /** Input transform matrix B^T. */
+  static constexpr Coefficient input(int i, int k) {
+    return TransformMatrices<6, 3>::input(i, k);
+  }
+  /** Output transform matrix A^T. */
+  static constexpr Coefficient output(int j, int i) {
+    constexpr Coefficient at[4][8] = {
+        {{1, 1}, {1, 1}, {1, 1}, {1, 1}, {1, 1}, {1, 1}, {1, 1}, {0, 1}},
+        {{0, 1}, {1, 1}, {-1, 1}, {2, 1}, {-2, 1}, {1, 2}, {-1, 2}, {0, 1}},
+        {{0, 1}, {1, 1}, {1, 1}, {4, 1}, {4, 1}, {1, 4}, {1, 4}, {0, 1}},
+        {{0, 1}, {1, 1}, {-1, 1}, {8, 1}, {-8, 1}, {1, 8}, {-1, 8}, {1, 1}}};
+    return at[j][i];
+  }
+};
+
+}  // namespace winograd
+}  // namespace internal
+}  // namespace conv2d
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_SRC_CONV2D_WINOGRAD_KERNELS_TRANSFORM_MATRICES_H_
@@ -50,11 +50,17 @@ SNNStatus launch_filter_transform(MemObj<T const>& input, MemObj<T>& transform,
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::Forward, 2, 2, 3, 3, MEM_OBJ)        \
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::Forward, 1, 2, 1, 3, MEM_OBJ)        \
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::Forward, 2, 1, 3, 1, MEM_OBJ)        \
+  INSTANTIATE_LAUNCHER(DTYPE, conv_type::Forward, 6, 6, 3, 3, MEM_OBJ)        \
+  INSTANTIATE_LAUNCHER(DTYPE, conv_type::Forward, 2, 2, 5, 5, MEM_OBJ)        \
+  INSTANTIATE_LAUNCHER(DTYPE, conv_type::Forward, 4, 4, 5, 5, MEM_OBJ)        \
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::InputBackprop, 4, 4, 3, 3, MEM_OBJ)  \
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::InputBackprop, 3, 3, 3, 3, MEM_OBJ)  \
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::InputBackprop, 2, 2, 3, 3, MEM_OBJ)  \
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::InputBackprop, 1, 2, 1, 3, MEM_OBJ)  \
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::InputBackprop, 2, 1, 3, 1, MEM_OBJ)  \
+  INSTANTIATE_LAUNCHER(DTYPE, conv_type::InputBackprop, 6, 6, 3, 3, MEM_OBJ)  \
+  INSTANTIATE_LAUNCHER(DTYPE, conv_type::InputBackprop, 2, 2, 5, 5, MEM_OBJ)  \
+  INSTANTIATE_LAUNCHER(DTYPE, conv_type::InputBackprop, 4, 4, 5, 5, MEM_OBJ)  \
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::FilterBackprop, 3, 3, 3, 3, MEM_OBJ) \
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::FilterBackprop, 3, 3, 2, 2, MEM_OBJ) \
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::FilterBackprop, 1, 3, 1, 2, MEM_OBJ) \
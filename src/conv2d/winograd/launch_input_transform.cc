@@ -17,6 +17,8 @@
 
 #include "sycldnn/conv2d/conv_type.h"
 
+#include "sycldnn/data_format.h"
+
 #include "src/conv2d/winograd/queue_input_transform.h"
 
 #include "sycldnn/export.h"
@@ -27,7 +29,9 @@ namespace internal {
 namespace winograd {
 
 inline bool can_use_vector(Conv2DParams const& params, int vector) {
-  return params.channels % vector == 0;
+  // The channels are not contiguous in NCHW tensors, so cannot be vectorised.
+  return params.input_format == DataFormat::NHWC &&
+         params.channels % vector == 0;
 }
 
 template <typename T, typename ConvType, int M, int N, int R, int S,
@@ -66,11 +70,17 @@ SNNStatus launch_input_transform(MemObj<T const>& input, MemObj<T>& transform,
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::Forward, 3, 3, 3, 3, MEM_OBJ)        \
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::Forward, 2, 2, 3, 3, MEM_OBJ)        \
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::Forward, 2, 1, 3, 1, MEM_OBJ)        \
+  INSTANTIATE_LAUNCHER(DTYPE, conv_type::Forward, 6, 6, 3, 3, MEM_OBJ)        \
+  INSTANTIATE_LAUNCHER(DTYPE, conv_type::Forward, 2, 2, 5, 5, MEM_OBJ)        \
+  INSTANTIATE_LAUNCHER(DTYPE, conv_type::Forward, 4, 4, 5, 5, MEM_OBJ)        \
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::Forward, 1, 2, 1, 3, MEM_OBJ)        \
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::InputBackprop, 4, 4, 3, 3, MEM_OBJ)  \
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::InputBackprop, 3, 3, 3, 3, MEM_OBJ)  \
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::InputBackprop, 2, 2, 3, 3, MEM_OBJ)  \
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::InputBackprop, 2, 1, 3, 1, MEM_OBJ)  \
+  INSTANTIATE_LAUNCHER(DTYPE, conv_type::InputBackprop, 6, 6, 3, 3, MEM_OBJ)  \
+  INSTANTIATE_LAUNCHER(DTYPE, conv_type::InputBackprop, 2, 2, 5, 5, MEM_OBJ)  \
+  INSTANTIATE_LAUNCHER(DTYPE, conv_type::InputBackprop, 4, 4, 5, 5, MEM_OBJ)  \
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::InputBackprop, 1, 2, 1, 3, MEM_OBJ)  \
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::FilterBackprop, 3, 3, 3, 3, MEM_OBJ) \
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::FilterBackprop, 3, 3, 2, 2, MEM_OBJ) \
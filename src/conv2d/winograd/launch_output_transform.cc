@@ -29,20 +29,23 @@ namespace winograd {
 template <typename T, typename ConvType, int M, int N, int R, int S,
           bool Accumulate, template <typename> class MemObj>
 SNNStatus launch_output_transform(MemObj<T const>& intermediate,
-                                  MemObj<T>& output, Conv2DParams const& params,
+                                  MemObj<T>& output,
+                                  EpilogueMem<T, MemObj>& epilogue,
+                                  Conv2DParams const& params,
                                   TileInfo const& tile_info,
                                   cl::sycl::queue& queue,
                                   const std::vector<cl::sycl::event>& events) {
   return queue_output_transform<T, int, ConvType, M, N, R, S, Accumulate>(
-      intermediate, output, params, tile_info, queue, events);
+      intermediate, output, epilogue, params, tile_info, queue, events);
 }
 
-#define INSTANTIATE_LAUNCHER(DTYPE, CTYPE, M, N, R, S, ACC, MEM_OBJ) \
-  template SNN_EXPORT SNNStatus                                      \
-  launch_output_transform<DTYPE, CTYPE, M, N, R, S, ACC>(            \
-      MEM_OBJ<DTYPE const> & intermediate, MEM_OBJ<DTYPE> & output,  \
-      Conv2DParams const& params, TileInfo const& tile_info,         \
-      cl::sycl::queue& queue, const std::vector<cl::sycl::event>& events);
+#define INSTANTIATE_LAUNCHER(DTYPE, CTYPE, M, N, R, S, ACC, MEM_OBJ)    \
+  template SNN_EXPORT SNNStatus                                         \
+  launch_output_transform<DTYPE, CTYPE, M, N, R, S, ACC>(               \
+      MEM_OBJ<DTYPE const> & intermediate, MEM_OBJ<DTYPE> & output,     \
+      EpilogueMem<DTYPE, MEM_OBJ> & epilogue, Conv2DParams const& params, \
+      TileInfo const& tile_info, cl::sycl::queue& queue,                \
+      const std::vector<cl::sycl::event>& events);
 
 #define INSTANTIATE_FOR_TYPE(DTYPE, MEM_OBJ)                                  \
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::Forward, 4, 4, 3, 3, false, MEM_OBJ) \
@@ -50,6 +53,9 @@ SNNStatus launch_output_transform(MemObj<T const>& intermediate,
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::Forward, 2, 2, 3, 3, false, MEM_OBJ) \
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::Forward, 1, 2, 1, 3, false, MEM_OBJ) \
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::Forward, 2, 1, 3, 1, false, MEM_OBJ) \
+  INSTANTIATE_LAUNCHER(DTYPE, conv_type::Forward, 6, 6, 3, 3, false, MEM_OBJ) \
+  INSTANTIATE_LAUNCHER(DTYPE, conv_type::Forward, 2, 2, 5, 5, false, MEM_OBJ) \
+  INSTANTIATE_LAUNCHER(DTYPE, conv_type::Forward, 4, 4, 5, 5, false, MEM_OBJ) \
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::InputBackprop, 4, 4, 3, 3, false,    \
                        MEM_OBJ)                                               \
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::InputBackprop, 3, 3, 3, 3, false,    \
@@ -60,6 +66,12 @@ SNNStatus launch_output_transform(MemObj<T const>& intermediate,
                        MEM_OBJ)                                               \
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::InputBackprop, 2, 1, 3, 1, false,    \
                        MEM_OBJ)                                               \
+  INSTANTIATE_LAUNCHER(DTYPE, conv_type::InputBackprop, 6, 6, 3, 3, false,    \
+                       MEM_OBJ)                                               \
+  INSTANTIATE_LAUNCHER(DTYPE, conv_type::InputBackprop, 2, 2, 5, 5, false,    \
+                       MEM_OBJ)                                               \
+  INSTANTIATE_LAUNCHER(DTYPE, conv_type::InputBackprop, 4, 4, 5, 5, false,    \
+                       MEM_OBJ)                                               \
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::FilterBackprop, 3, 3, 3, 3, true,    \
                        MEM_OBJ)                                               \
   INSTANTIATE_LAUNCHER(DTYPE, conv_type::FilterBackprop, 3, 3, 3, 3, false,   \
@@ -16,11 +16,15 @@
 #ifndef SYCLDNN_SRC_CONV2D_WINOGRAD_QUEUE_FILTER_TRANSFORM_IMPL_H_
 #define SYCLDNN_SRC_CONV2D_WINOGRAD_QUEUE_FILTER_TRANSFORM_IMPL_H_
 
+#include "sycldnn/filter_format.h"
 #include "sycldnn/mem_object.h"
 
 #include "src/conv2d/winograd/queue_filter_transform.h"
 
 #include "src/conv2d/winograd/kernels/extract_filter_transform.h"
+#include "src/conv2d/winograd/kernels/extract_transforms_nchw.h"
+
+#include <type_traits>
 
 namespace sycldnn {
 namespace conv2d {
@@ -67,6 +71,25 @@ SNNStatus queue_filter_transform(MemObj<T const>& filter_mem,
   using Functor = ExtractFilterTiles<T, Index, M, N, R, S, ConvType,
                                      is_usm_obj_v<MemObj<T>, T>>;
 
+#ifdef SNN_ENABLE_NCHW
+  if constexpr (std::is_same<ConvType, conv_type::Forward>::value) {
+    if (params.filter_format == FilterFormat::FCHW) {
+      using FCHWFunctor = ExtractFilterTilesFCHW<T, Index, M, N, R, S,
+                                                 is_usm_obj_v<MemObj<T>, T>>;
+      auto event = queue.submit([&](cl::sycl::handler& cgh) {
+        cgh.depends_on(events);
+        auto filter = filter_mem.read_mem(cgh);
+        auto transform = transform_mem.write_mem(cgh);
+        auto range = get_thread_range<ConvType>(params, tile_info);
+        FCHWFunctor conv{params, tile_info, filter, transform};
+
+        cgh.parallel_for(range, conv);
+      });
+      return SNNStatus{event, StatusCode::OK};
+    }
+  }
+#endif  // SNN_ENABLE_NCHW
+
   auto event = queue.submit([&](cl::sycl::handler& cgh) {
     cgh.depends_on(events);
     auto filter = filter_mem.read_mem(cgh);
@@ -16,11 +16,15 @@
 #ifndef SYCLDNN_SRC_CONV2D_WINOGRAD_QUEUE_INPUT_TRANSFORM_IMPL_H_
 #define SYCLDNN_SRC_CONV2D_WINOGRAD_QUEUE_INPUT_TRANSFORM_IMPL_H_
 
+#include "sycldnn/data_format.h"
 #include "sycldnn/mem_object.h"
 
 #include "src/conv2d/winograd/queue_input_transform.h"
 
 #include "src/conv2d/winograd/kernels/extract_input_transform.h"
+#include "src/conv2d/winograd/kernels/extract_transforms_nchw.h"
+
+#include <type_traits>
 
 namespace sycldnn {
 namespace conv2d {
@@ -57,6 +61,26 @@ SNNStatus queue_input_transform(MemObj<T const>& input_mem,
   using Functor = ExtractInputTiles<T, Index, ChannelVector, M, N, R, S,
                                     ConvType, is_usm_obj_v<MemObj<T>, T>>;
 
+#ifdef SNN_ENABLE_NCHW
+  if constexpr (std::is_same<ConvType, conv_type::Forward>::value &&
+                ChannelVector == 1) {
+    if (params.input_format == DataFormat::NCHW) {
+      using NCHWFunctor = ExtractInputTilesNCHW<T, Index, M, N, R, S,
+                                                is_usm_obj_v<MemObj<T>, T>>;
+      auto event = queue.submit([&](cl::sycl::handler& cgh) {
+        cgh.depends_on(events);
+        auto input = input_mem.read_mem(cgh);
+        auto transform = transform_mem.write_mem(cgh);
+        auto range = get_thread_range(params, tile_info, ChannelVector);
+        NCHWFunctor conv{params, tile_info, input, transform};
+
+        cgh.parallel_for(range, conv);
+      });
+      return SNNStatus{event, StatusCode::OK};
+    }
+  }
+#endif  // SNN_ENABLE_NCHW
+
   auto event = queue.submit([&](cl::sycl::handler& cgh) {
     cgh.depends_on(events);
     auto input = input_mem.read_mem(cgh);
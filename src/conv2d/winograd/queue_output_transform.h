@@ -20,6 +20,7 @@
 #include "sycldnn/status.h"
 
 #include "sycldnn/conv2d/params.h"
+#include "sycldnn/internal/conv2d/epilogue.h"
 #include "sycldnn/internal/conv2d/winograd/tile_info.h"
 
 #include <CL/sycl.hpp>
@@ -33,6 +34,7 @@ template <typename T, typename Index, typename ConvType, int M, int N, int R,
           int S, bool Accumulate, template <typename> class MemObj>
 SNNStatus queue_output_transform(MemObj<T const>& intermediate,
                                  MemObj<T>& output,
+                                 EpilogueMem<T, MemObj>& epilogue,
                                  Conv2DParams const& kernel_params,
                                  TileInfo const& tile_info,
                                  cl::sycl::queue& queue,
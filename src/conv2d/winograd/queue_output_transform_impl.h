@@ -16,11 +16,16 @@
 #ifndef SYCLDNN_SRC_CONV2D_WINOGRAD_QUEUE_OUTPUT_TRANSFORM_IMPL_H_
 #define SYCLDNN_SRC_CONV2D_WINOGRAD_QUEUE_OUTPUT_TRANSFORM_IMPL_H_
 
+#include "sycldnn/data_format.h"
 #include "sycldnn/mem_object.h"
 
 #include "src/conv2d/winograd/queue_output_transform.h"
 
+#include "src/conv2d/epilogue/fused_epilogue.h"
 #include "src/conv2d/winograd/kernels/extract_output_transform.h"
+#include "src/conv2d/winograd/kernels/extract_transforms_nchw.h"
+
+#include <type_traits>
 
 namespace sycldnn {
 namespace conv2d {
@@ -62,6 +67,7 @@ template <typename T, typename Index, typename ConvType, int M, int N, int R,
           int S, bool Accumulate, template <typename> class MemObj>
 SNNStatus queue_output_transform(MemObj<T const>& intermediate_mem,
                                  MemObj<T>& output_mem,
+                                 EpilogueMem<T, MemObj>& epilogue,
                                  Conv2DParams const& params,
                                  TileInfo const& tile_info,
                                  cl::sycl::queue& queue,
@@ -74,9 +80,28 @@ SNNStatus queue_output_transform(MemObj<T const>& intermediate_mem,
     auto intermediate = intermediate_mem.read_mem(cgh);
     auto output = output_mem.write_mem(cgh);
     auto range = get_thread_range<ConvType>(params, tile_info);
-    Functor conv{params, tile_info, intermediate, output};
-
-    cgh.parallel_for(range, conv);
+    if constexpr (std::is_same<ConvType, conv_type::FilterBackprop>::value) {
+      SNN_UNUSED_VAR(epilogue);
+      Functor conv{params, tile_info, intermediate, output};
+      cgh.parallel_for(range, conv);
+    } else {
+      auto fused_epilogue = get_fused_epilogue(epilogue, cgh);
+#ifdef SNN_ENABLE_NCHW
+      if constexpr (std::is_same<ConvType, conv_type::Forward>::value) {
+        if (params.input_format == DataFormat::NCHW) {
+          using NCHWFunctor =
+              ExtractOutputTilesNCHW<T, Index, M, N, R, S,
+                                     is_usm_obj_v<MemObj<T>, T>>;
+          NCHWFunctor conv{params, tile_info, intermediate, output,
+                           fused_epilogue};
+          cgh.parallel_for(range, conv);
+          return;
+        }
+      }
+#endif  // SNN_ENABLE_NCHW
+      Functor conv{params, tile_info, intermediate, output, fused_epilogue};
+      cgh.parallel_for(range, conv);
+    }
   });
   return SNNStatus{event, StatusCode::OK};
 }
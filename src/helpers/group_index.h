@@ -0,0 +1,94 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_HELPERS_GROUP_INDEX_H_
+#define SYCLDNN_SRC_HELPERS_GROUP_INDEX_H_
+
+#include "sycldnn/batch_format.h"
+
+#include "sycldnn/helpers/macros.h"
+
+namespace sycldnn {
+namespace helpers {
+
+/**
+ * Index helper for grouped convolutions.
+ *
+ * The channels and the features of a grouped convolution are split into
+ * `groups` equally sized groups. With a strided group format the group is the
+ * outer dimension, so channel `c` of group `g` is stored at
+ * `g * channels + c`. With an interleaved group format the group is the inner
+ * dimension, so the same channel is stored at `c * groups + g`. The features
+ * are laid out in the same way.
+ *
+ * The filter of a grouped convolution only holds the channels in a single
+ * group, so has shape [rows, cols, channels, groups * features] for HWCF.
+ *
+ * When there is a single group every method reduces to the ungrouped index.
+ */
+template <typename Index>
+struct GroupIndex {
+  GroupIndex(Index n_groups, Index total_channels, Index total_features,
+             BatchFormat group_format)
+      : groups{n_groups},
+        channels{total_channels / n_groups},
+        features{total_features / n_groups},
+        interleaved{group_format == BatchFormat::INTERLEAVED} {}
+
+  /** Get the group which contains the given feature. */
+  Index SNN_ALWAYS_INLINE group_of_feature(Index feature) const {
+    return interleaved ? feature % groups : feature / features;
+  }
+
+  /** Get the group which contains the given channel. */
+  Index SNN_ALWAYS_INLINE group_of_channel(Index channel) const {
+    return interleaved ? channel % groups : channel / channels;
+  }
+
+  /** Get the index of the given channel inside its group. */
+  Index SNN_ALWAYS_INLINE channel_in_group(Index channel) const {
+    return interleaved ? channel / groups : channel % channels;
+  }
+
+  /** Get the index of the first channel in the given group. */
+  Index SNN_ALWAYS_INLINE first_channel(Index group) const {
+    return interleaved ? group : group * channels;
+  }
+
+  /** Get the index of the first feature in the given group. */
+  Index SNN_ALWAYS_INLINE first_feature(Index group) const {
+    return interleaved ? group : group * features;
+  }
+
+  /**
+   * Get the distance between consecutive channels, or consecutive features,
+   * in the same group.
+   */
+  Index SNN_ALWAYS_INLINE stride() const { return interleaved ? groups : 1; }
+
+  /** Number of groups. */
+  Index groups;
+  /** Number of channels in each group. */
+  Index channels;
+  /** Number of features in each group. */
+  Index features;
+  /** Whether the groups are the innermost dimension. */
+  bool interleaved;
+};
+
+}  // namespace helpers
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_SRC_HELPERS_GROUP_INDEX_H_
@@ -0,0 +1,40 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_HELPERS_SIZE_BUCKET_H_
+#define SYCLDNN_SRC_HELPERS_SIZE_BUCKET_H_
+
+#include <stddef.h>
+
+namespace sycldnn {
+namespace helpers {
+
+/**
+ * Compute the bucket of a size used to key tuning tables, which is the floor
+ * of its base 2 logarithm. Sizes of 0 and 1 are both in bucket 0.
+ */
+inline int size_bucket(size_t size) {
+  int bucket = 0;
+  while (size > 1) {
+    size >>= 1;
+    ++bucket;
+  }
+  return bucket;
+}
+
+}  // namespace helpers
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_SRC_HELPERS_SIZE_BUCKET_H_
@@ -0,0 +1,89 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_MATMUL_FUSED_EPILOGUE_H_
+#define SYCLDNN_SRC_MATMUL_FUSED_EPILOGUE_H_
+
+#include "sycldnn/accessor_types.h"
+#include "sycldnn/helpers/macros.h"
+
+#include "sycldnn/matmul/epilogue.h"
+
+#include "sycldnn/internal/matmul/epilogue.h"
+
+#include "src/pointwise/kernels.h"
+
+#include <CL/sycl.hpp>
+
+namespace sycldnn {
+namespace matmul {
+namespace internal {
+
+/**
+ * Device side epilogue, applied by a matmul kernel to its output values while
+ * they are still held in registers.
+ *
+ * The enabled operations are checked at runtime. These checks are uniform
+ * across all work items, so do not cause any divergence.
+ */
+template <typename T, bool IsUSM>
+struct FusedEpilogue {
+  /**
+   * Apply the epilogue to a value computed by a matmul kernel.
+   *
+   * \param val The output value.
+   * \param col The column of the value in the output matrix.
+   * \return The value to write to the output matrix.
+   */
+  template <typename Index>
+  inline SNN_ALWAYS_INLINE T apply(T val, Index col) const {
+    if (params.bias) {
+      val += bias.get_pointer()[col];
+    }
+    switch (params.activation) {
+      case Activation::Relu:
+        return pointwise::Relu<pointwise::Forward>{}.apply(val);
+      case Activation::Tanh:
+        return pointwise::Tanh<pointwise::Forward>{}.apply(val);
+      case Activation::None:
+      default:
+        return val;
+    }
+  }
+
+  /** Whether any epilogue operations are enabled. */
+  inline SNN_ALWAYS_INLINE bool enabled() const { return !is_identity(params); }
+
+  /** The per-column bias. */
+  ReadMem<T const, IsUSM> bias;
+  /** The operations enabled in the epilogue. */
+  EpilogueParams params;
+};
+
+/**
+ * Get the device side epilogue for the given memory objects, binding them to
+ * the command group handler.
+ */
+template <typename T, template <typename> class MemObj>
+FusedEpilogue<T, is_usm_obj_v<MemObj<T>, T>> get_fused_epilogue(
+    EpilogueMem<T, MemObj>& epilogue, cl::sycl::handler& cgh) {
+  return {epilogue.bias.read_mem(cgh), epilogue.params};
+}
+
+}  // namespace internal
+}  // namespace matmul
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_SRC_MATMUL_FUSED_EPILOGUE_H_
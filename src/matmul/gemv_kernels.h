@@ -0,0 +1,219 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_MATMUL_GEMV_KERNELS_H_
+#define SYCLDNN_SRC_MATMUL_GEMV_KERNELS_H_
+
+#include "sycldnn/accessor_types.h"
+#include "sycldnn/matmul/params.h"
+
+#include "sycldnn/helpers/macros.h"
+
+#include "src/helpers/math.h"
+#include "src/helpers/vector_io.h"
+#include "src/helpers/workgroup_reduce.h"
+#include "src/matmul/fused_epilogue.h"
+
+#include <CL/sycl.hpp>
+
+/**
+ * \file
+ * Contains the matrix-vector kernels used for matmuls where either m or n is
+ * one. The matmul is treated as a product of a matrix with rows x k elements
+ * and a vector of k elements, giving an output vector of rows elements. For
+ * m == 1 the matrix is the RHS and the output is a row vector, while for
+ * n == 1 the matrix is the LHS and the output is a column vector.
+ */
+
+namespace sycldnn {
+namespace matmul {
+
+/** Number of work items in the work-groups used by the GEMV kernels. */
+static constexpr int gemv_workgroup_size = 64;
+
+namespace internal {
+
+/**
+ * Scale and store a single output value of a GEMV kernel, adding the existing
+ * output if beta is non-zero and applying the epilogue.
+ */
+template <typename T, typename Index, bool IsUSM>
+inline SNN_ALWAYS_INLINE void store_gemv_output(
+    ReadWriteMem<T, IsUSM> const& output,
+    FusedEpilogue<T, IsUSM> const& epilogue, MatmulParams const& params,
+    Index offset, Index row, T value) {
+  using Load = helpers::io::Load<T>;
+  using Store = helpers::io::Store<T>;
+  auto output_data = output.get_pointer();
+  if (params.alpha != 1.f) {
+    value *= static_cast<T>(params.alpha);
+  }
+  if (params.beta != 0.f) {
+    value = helpers::math::mad(static_cast<T>(params.beta),
+                               Load()(output_data, offset), value);
+  }
+  if (epilogue.enabled()) {
+    // Only a row vector output has more than one column.
+    Index const col = params.n == 1 ? 0 : row;
+    value = epilogue.apply(value, col);
+  }
+  Store()(output_data, offset, value);
+}
+
+}  // namespace internal
+
+/**
+ * GEMV kernel for matrices stored with the shared dimension contiguous in
+ * memory, such as a transposed RHS with m == 1 or a non-transposed LHS with
+ * n == 1.
+ *
+ * Each work-group computes a single output value. The work items read
+ * consecutive elements of the matrix row and the vector, striding over the
+ * shared dimension by the work-group size, and the partial sums are then
+ * combined with a work-group reduction.
+ *
+ * The kernel is launched over a 2D range of [batch, rows * work-group size],
+ * with work-groups of [1, gemv_workgroup_size].
+ */
+template <typename T, typename Index, bool IsUSM>
+struct GemvReductionKernel {
+  using Load = helpers::io::Load<T>;
+
+  GemvReductionKernel(ReadMem<T const, IsUSM> const& matrix,
+                      ReadMem<T const, IsUSM> const& vector,
+                      ReadWriteMem<T, IsUSM> const& output,
+                      internal::FusedEpilogue<T, IsUSM> const& epilogue,
+                      LocalAccessor<T> workspace, MatmulParams const& params)
+      : matrix_{matrix},
+        vector_{vector},
+        output_{output},
+        epilogue_{epilogue},
+        workspace_{std::move(workspace)},
+        params_{params},
+        rows_{params.m == 1 ? params.n : params.m},
+        matrix_stride_{params.m == 1 ? get_rhs_batch_stride(params)
+                                     : get_lhs_batch_stride(params)},
+        vector_stride_{params.m == 1 ? get_lhs_batch_stride(params)
+                                     : get_rhs_batch_stride(params)} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::nd_item<2> item) const {
+    Index const batch = item.get_group(0);
+    Index const row = item.get_group(1);
+    Index const lane = item.get_local_id(1);
+
+    auto matrix_data = matrix_.get_pointer();
+    auto vector_data = vector_.get_pointer();
+    Index const matrix_offset = batch * matrix_stride_ + row * params_.k;
+    Index const vector_offset = batch * vector_stride_;
+
+    T sum{0};
+    for (Index acc = lane; acc < params_.k; acc += gemv_workgroup_size) {
+      sum = helpers::math::mad(Load()(matrix_data, matrix_offset + acc),
+                               Load()(vector_data, vector_offset + acc), sum);
+    }
+    sum = helpers::reduce::workgroup_reduce<helpers::reduce::Sum, Index>(
+        sum, item,
+        workspace_.template get_multi_ptr<sycl::access::decorated::legacy>());
+
+    if (lane == 0) {
+      internal::store_gemv_output(
+          output_, epilogue_, params_,
+          batch * get_output_batch_stride(params_) + row, row, sum);
+    }
+  }
+
+ private:
+  ReadMem<T const, IsUSM> matrix_;
+  ReadMem<T const, IsUSM> vector_;
+  ReadWriteMem<T, IsUSM> output_;
+  internal::FusedEpilogue<T, IsUSM> epilogue_;
+  LocalAccessor<T> workspace_;
+  MatmulParams params_;
+  Index rows_;
+  Index matrix_stride_;
+  Index vector_stride_;
+};
+
+/**
+ * GEMV kernel for matrices stored with the output dimension contiguous in
+ * memory, such as a non-transposed RHS with m == 1 or a transposed LHS with
+ * n == 1.
+ *
+ * Each work item computes a single output value over the whole shared
+ * dimension. Consecutive work items read consecutive elements of each row of
+ * the matrix, while all work items read the same element of the vector, so
+ * no reduction between work items is needed.
+ *
+ * The kernel is launched over a 2D range of [batch, rows rounded up to the
+ * work-group size], with work-groups of [1, gemv_workgroup_size].
+ */
+template <typename T, typename Index, bool IsUSM>
+struct GemvKernel {
+  using Load = helpers::io::Load<T>;
+
+  GemvKernel(ReadMem<T const, IsUSM> const& matrix,
+             ReadMem<T const, IsUSM> const& vector,
+             ReadWriteMem<T, IsUSM> const& output,
+             internal::FusedEpilogue<T, IsUSM> const& epilogue,
+             MatmulParams const& params)
+      : matrix_{matrix},
+        vector_{vector},
+        output_{output},
+        epilogue_{epilogue},
+        params_{params},
+        rows_{params.m == 1 ? params.n : params.m},
+        matrix_stride_{params.m == 1 ? get_rhs_batch_stride(params)
+                                     : get_lhs_batch_stride(params)},
+        vector_stride_{params.m == 1 ? get_lhs_batch_stride(params)
+                                     : get_rhs_batch_stride(params)} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::nd_item<2> item) const {
+    Index const batch = item.get_global_id(0);
+    Index const row = item.get_global_id(1);
+    if (row >= rows_) {
+      return;
+    }
+
+    auto matrix_data = matrix_.get_pointer();
+    auto vector_data = vector_.get_pointer();
+    Index matrix_offset = batch * matrix_stride_ + row;
+    Index const vector_offset = batch * vector_stride_;
+
+    T sum{0};
+    for (Index acc = 0; acc < params_.k; ++acc) {
+      sum = helpers::math::mad(Load()(matrix_data, matrix_offset),
+                               Load()(vector_data, vector_offset + acc), sum);
+      matrix_offset += rows_;
+    }
+    internal::store_gemv_output(output_, epilogue_, params_,
+                                batch * get_output_batch_stride(params_) + row,
+                                row, sum);
+  }
+
+ private:
+  ReadMem<T const, IsUSM> matrix_;
+  ReadMem<T const, IsUSM> vector_;
+  ReadWriteMem<T, IsUSM> output_;
+  internal::FusedEpilogue<T, IsUSM> epilogue_;
+  MatmulParams params_;
+  Index rows_;
+  Index matrix_stride_;
+  Index vector_stride_;
+};
+
+}  // namespace matmul
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_SRC_MATMUL_GEMV_KERNELS_H_
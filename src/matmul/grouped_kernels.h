@@ -0,0 +1,212 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_MATMUL_GROUPED_KERNELS_H_
+#define SYCLDNN_SRC_MATMUL_GROUPED_KERNELS_H_
+
+#include "sycldnn/accessor_types.h"
+#include "sycldnn/matmul/grouped_params.h"
+
+#include "sycldnn/helpers/macros.h"
+
+#include "src/helpers/math.h"
+#include "src/helpers/register_tile.h"
+#include "src/helpers/vector_io.h"
+
+#include <CL/sycl.hpp>
+
+namespace sycldnn {
+namespace matmul {
+
+/**
+ * Shape of the work-groups used by the grouped matmul kernel, and the tiles
+ * of the output computed by each work item.
+ *
+ * Each work-group computes one block of BlockRows x BlockCols outputs at a
+ * time, with each work item computing a RowTile x ColTile register tile.
+ */
+struct GroupedMatmulTiles {
+  /** Number of output rows computed by each work item. */
+  static constexpr int RowTile = 4;
+  /** Number of output columns computed by each work item. */
+  static constexpr int ColTile = 4;
+  /** Number of work items in the row direction of a work-group. */
+  static constexpr int Rows = 8;
+  /** Number of work items in the column direction of a work-group. */
+  static constexpr int Cols = 8;
+  /** Number of output rows computed by a work-group. */
+  static constexpr int BlockRows = RowTile * Rows;
+  /** Number of output columns computed by a work-group. */
+  static constexpr int BlockCols = ColTile * Cols;
+};
+
+/**
+ * Matrix multiply kernel computing a group of problems with different shapes.
+ *
+ * The output of every problem is split into blocks of BlockRows x BlockCols,
+ * and the blocks of all problems are numbered consecutively, in the order of
+ * the problems. The kernel is launched with a fixed number of work-groups,
+ * which act as a tile scheduler: work-group g computes blocks g, g + G,
+ * g + 2G, ... where G is the number of work-groups, until every block is
+ * computed. Block numbers only increase, so each work-group walks through the
+ * problem array once, reading each problem's shape from device memory.
+ *
+ * The kernel is launched over a 2D range of [work-groups * Rows, Cols], with
+ * work-groups of [Rows, Cols].
+ */
+template <typename T, typename Index, bool TransposeLHS, bool TransposeRHS,
+          bool IsUSM>
+struct GroupedMatmulKernel {
+  using Tiles = GroupedMatmulTiles;
+  using Load = helpers::io::Load<T>;
+  using Store = helpers::io::Store<T>;
+
+  using ProblemMem = ReadMem<GroupedMatmulProblem const, IsUSM>;
+
+  GroupedMatmulKernel(ReadMem<T const, IsUSM> const& lhs,
+                      ReadMem<T const, IsUSM> const& rhs,
+                      ReadWriteMem<T, IsUSM> const& output,
+                      ProblemMem const& problems,
+                      GroupedMatmulParams const& params)
+      : lhs_{lhs},
+        rhs_{rhs},
+        output_{output},
+        problems_{problems},
+        n_problems_{params.n_problems},
+        alpha_{params.alpha},
+        beta_{params.beta} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::nd_item<2> item) const {
+    Index const n_groups = item.get_group_range(0);
+    Index const local_row = item.get_local_id(0);
+    Index const local_col = item.get_local_id(1);
+    auto problems = problems_.get_pointer();
+
+    Index problem_idx = 0;
+    GroupedMatmulProblem problem = problems[0];
+    Index first_block = 0;
+    Index col_blocks = n_col_blocks(problem);
+    Index n_blocks = n_row_blocks(problem) * col_blocks;
+
+    for (Index block = item.get_group(0);; block += n_groups) {
+      while (block >= first_block + n_blocks) {
+        ++problem_idx;
+        if (problem_idx >= n_problems_) {
+          return;
+        }
+        first_block += n_blocks;
+        problem = problems[problem_idx];
+        col_blocks = n_col_blocks(problem);
+        n_blocks = n_row_blocks(problem) * col_blocks;
+      }
+      Index const problem_block = block - first_block;
+      Index const row =
+          (problem_block / col_blocks) * Tiles::BlockRows +
+          local_row * Tiles::RowTile;
+      Index const col =
+          (problem_block % col_blocks) * Tiles::BlockCols +
+          local_col * Tiles::ColTile;
+      compute_tile(problem, row, col);
+    }
+  }
+
+ private:
+  static Index SNN_ALWAYS_INLINE
+  n_row_blocks(GroupedMatmulProblem const& problem) {
+    return (problem.m + Tiles::BlockRows - 1) / Tiles::BlockRows;
+  }
+
+  static Index SNN_ALWAYS_INLINE
+  n_col_blocks(GroupedMatmulProblem const& problem) {
+    return (problem.n + Tiles::BlockCols - 1) / Tiles::BlockCols;
+  }
+
+  /**
+   * Compute this work item's register tile of the given problem's output,
+   * starting at the given row and column. Values past the edges of the
+   * matrices are treated as zero and are not stored.
+   */
+  void SNN_ALWAYS_INLINE compute_tile(GroupedMatmulProblem const& problem,
+                                      Index row, Index col) const {
+    constexpr int RowTile = Tiles::RowTile;
+    constexpr int ColTile = Tiles::ColTile;
+    auto lhs_data = lhs_.get_pointer();
+    auto rhs_data = rhs_.get_pointer();
+
+    helpers::RegisterTile2D<T, RowTile, ColTile> out_tile{};
+    for (Index acc = 0; acc < problem.k; ++acc) {
+      helpers::RegisterTile1D<T, RowTile> lhs_tile;
+      SNN_PRAGMA_UNROLL
+      for (int i = 0; i < RowTile; ++i) {
+        Index const offset = TransposeLHS ? acc * problem.m + row + i
+                                          : (row + i) * problem.k + acc;
+        lhs_tile.data(i) = row + i < problem.m
+                               ? Load()(lhs_data, problem.lhs_offset + offset)
+                               : T{0};
+      }
+      helpers::RegisterTile1D<T, ColTile> rhs_tile;
+      SNN_PRAGMA_UNROLL
+      for (int j = 0; j < ColTile; ++j) {
+        Index const offset = TransposeRHS ? (col + j) * problem.k + acc
+                                          : acc * problem.n + col + j;
+        rhs_tile.data(j) = col + j < problem.n
+                               ? Load()(rhs_data, problem.rhs_offset + offset)
+                               : T{0};
+      }
+      SNN_PRAGMA_UNROLL
+      for (int i = 0; i < RowTile; ++i) {
+        SNN_PRAGMA_UNROLL
+        for (int j = 0; j < ColTile; ++j) {
+          out_tile.data(i, j) = helpers::math::mad(
+              lhs_tile.data(i), rhs_tile.data(j), out_tile.data(i, j));
+        }
+      }
+    }
+
+    auto output_data = output_.get_pointer();
+    SNN_PRAGMA_UNROLL
+    for (int i = 0; i < RowTile; ++i) {
+      SNN_PRAGMA_UNROLL
+      for (int j = 0; j < ColTile; ++j) {
+        if (row + i < problem.m && col + j < problem.n) {
+          Index const offset =
+              problem.output_offset + (row + i) * problem.n + col + j;
+          T value = out_tile.data(i, j);
+          if (alpha_ != 1.f) {
+            value *= static_cast<T>(alpha_);
+          }
+          if (beta_ != 0.f) {
+            value = helpers::math::mad(static_cast<T>(beta_),
+                                       Load()(output_data, offset), value);
+          }
+          Store()(output_data, offset, value);
+        }
+      }
+    }
+  }
+
+  ReadMem<T const, IsUSM> lhs_;
+  ReadMem<T const, IsUSM> rhs_;
+  ReadWriteMem<T, IsUSM> output_;
+  ProblemMem problems_;
+  Index n_problems_;
+  float alpha_;
+  float beta_;
+};
+
+}  // namespace matmul
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_SRC_MATMUL_GROUPED_KERNELS_H_
@@ -0,0 +1,81 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "sycldnn/internal/matmul/grouped_launch.h"
+#include "sycldnn/matmul/grouped_params.h"
+
+#include "sycldnn/mem_object.h"
+
+#include "src/matmul/queue_grouped_kernel.h"
+
+#include <CL/sycl.hpp>
+
+namespace sycldnn {
+namespace matmul {
+namespace internal {
+
+// Launch the grouped matrix multiply kernel for the passed parameters.
+template <typename T, bool TransposeLHS, bool TransposeRHS,
+          template <typename> class MemObj>
+SNNStatus launch_grouped(MemObj<T const>& lhs, MemObj<T const>& rhs,
+                         MemObj<T>& output,
+                         MemObj<GroupedMatmulProblem const>& problems,
+                         GroupedMatmulParams const& params,
+                         cl::sycl::queue& queue,
+                         const std::vector<cl::sycl::event>& events) {
+  return queue_grouped_kernel<T, int, TransposeLHS, TransposeRHS, MemObj>(
+      lhs, rhs, output, problems, params, queue, events);
+}
+
+#define INSTANTIATE_LAUNCHER(DTYPE, TLHS, TRHS, MEMOBJ)                    \
+  template SNN_EXPORT SNNStatus launch_grouped<DTYPE, TLHS, TRHS, MEMOBJ>( \
+      MEMOBJ<DTYPE const> & lhs, MEMOBJ<DTYPE const> & rhs,                \
+      MEMOBJ<DTYPE> & output,                                              \
+      MEMOBJ<GroupedMatmulProblem const> & problems,                       \
+      GroupedMatmulParams const& params, cl::sycl::queue& queue,           \
+      const std::vector<cl::sycl::event>& events);
+
+#ifdef SNN_ENABLE_USM
+#define INSTANTIATE_FOR_MEMOBJ(DTYPE, TLHS, TRHS)          \
+  INSTANTIATE_LAUNCHER(DTYPE, TLHS, TRHS, BufferMemObject) \
+  INSTANTIATE_LAUNCHER(DTYPE, TLHS, TRHS, USMMemObject)
+#else
+#define INSTANTIATE_FOR_MEMOBJ(DTYPE, TLHS, TRHS) \
+  INSTANTIATE_LAUNCHER(DTYPE, TLHS, TRHS, BufferMemObject)
+#endif  // SNN_ENABLE_USM
+
+#define INSTANTIATE_FOR_TYPE(DTYPE)          \
+  INSTANTIATE_FOR_MEMOBJ(DTYPE, true, true)  \
+  INSTANTIATE_FOR_MEMOBJ(DTYPE, false, true) \
+  INSTANTIATE_FOR_MEMOBJ(DTYPE, true, false) \
+  INSTANTIATE_FOR_MEMOBJ(DTYPE, false, false)
+
+INSTANTIATE_FOR_TYPE(float);
+
+#ifdef SNN_USE_DOUBLE
+INSTANTIATE_FOR_TYPE(double);
+#endif  // SNN_USE_DOUBLE
+
+#ifdef SNN_USE_HALF
+INSTANTIATE_FOR_TYPE(cl::sycl::half);
+#endif  // SNN_USE_HALF
+
+#undef INSTANTIATE_FOR_TYPE
+#undef INSTANTIATE_FOR_MEMOBJ
+#undef INSTANTIATE_LAUNCHER
+
+}  // namespace internal
+}  // namespace matmul
+}  // namespace sycldnn
@@ -20,6 +20,7 @@
 #include "sycldnn/status.h"
 
 #include "src/matmul/blocks.h"
+#include "src/matmul/fused_epilogue.h"
 
 namespace sycldnn {
 namespace matmul {
@@ -28,8 +29,14 @@ template <typename T, typename Index, bool TransposeLHS, bool TransposeRHS,
 struct MatmulKernel {
   MatmulKernel(ReadMem<T const, IsUSM> const& lhs,
                ReadMem<T const, IsUSM> const& rhs,
-               ReadWriteMem<T, IsUSM> const& output, MatmulParams const& params)
-      : lhs_{lhs}, rhs_{rhs}, output_{output}, params_{params} {}
+               ReadWriteMem<T, IsUSM> const& output,
+               internal::FusedEpilogue<T, IsUSM> const& epilogue,
+               MatmulParams const& params)
+      : lhs_{lhs},
+        rhs_{rhs},
+        output_{output},
+        epilogue_{epilogue},
+        params_{params} {}
 
   void SNN_ALWAYS_INLINE operator()(cl::sycl::nd_item<3> item) const {
     Index batch = item.get_global_id(0);
@@ -37,9 +44,10 @@ struct MatmulKernel {
     Index col = item.get_global_id(2) * ColTile;
 
     if (row < params_.m && col < params_.n) {
-      auto lhs_ptr = lhs_.get_pointer() + batch * params_.m * params_.k;
-      auto rhs_ptr = rhs_.get_pointer() + batch * params_.k * params_.n;
-      auto out_ptr = output_.get_pointer() + batch * params_.m * params_.n;
+      auto lhs_ptr = lhs_.get_pointer() + batch * get_lhs_batch_stride(params_);
+      auto rhs_ptr = rhs_.get_pointer() + batch * get_rhs_batch_stride(params_);
+      auto out_ptr =
+          output_.get_pointer() + batch * get_output_batch_stride(params_);
 
       auto const lhs_ld = TransposeLHS ? params_.m : params_.k;
       auto const lhs_step = (TransposeLHS ? params_.m : 1) * AccTile;
@@ -65,17 +73,21 @@ struct MatmulKernel {
       bool const internal_row_block = valid_row[RowTile - 1];
       bool const internal_col_block = valid_col[ColTile - 1];
 
-      auto out_block = VectorBlock<T, RowTile, ColTile>{};
-      if (params_.beta != static_cast<T>(0)) {
-        // Convert out_ptr from multi_ptr<T> to multi_ptr<T const>
-        auto const_out_ptr =
-            cl::sycl::multi_ptr<T const,
-                                cl::sycl::access::address_space::global_space>{
-                out_ptr.get()};
+      // Convert out_ptr from multi_ptr<T> to multi_ptr<T const>
+      auto const_out_ptr =
+          cl::sycl::multi_ptr<T const,
+                              cl::sycl::access::address_space::global_space>{
+              out_ptr.get()};
+      bool const scale_product = params_.alpha != 1.f;
+      bool const add_output = params_.beta != 0.f;
 
+      // Without alpha the scaled output can be used as the initial value of
+      // the accumulator, otherwise it is added once the product is scaled.
+      auto out_block = VectorBlock<T, RowTile, ColTile>{};
+      if (add_output && !scale_product) {
         out_block = load_block<RowTile, ColTile>(const_out_ptr, params_.n,
                                                  valid_row, valid_col);
-        scalar_multiply(out_block, params_.beta);
+        scalar_multiply(out_block, static_cast<T>(params_.beta));
       }
       Index acc_idx = 0;
 
@@ -118,6 +130,16 @@ struct MatmulKernel {
         }
       }
 
+      if (scale_product) {
+        scalar_multiply(out_block, static_cast<T>(params_.alpha));
+        if (add_output) {
+          add_scaled_output(out_block, const_out_ptr, valid_row, valid_col);
+        }
+      }
+      if (epilogue_.enabled()) {
+        apply_epilogue(out_block, col, valid_col);
+      }
+
       (!CheckBounds || (internal_row_block && internal_col_block))
           ? store_block<RowTile, ColTile>(out_block, out_ptr, out_ld)
           : store_block<RowTile, ColTile>(out_block, out_ptr, out_ld, valid_row,
@@ -126,9 +148,45 @@ struct MatmulKernel {
   }
 
  private:
+  /** Add beta times the existing output values to the output block. */
+  template <typename Pointer>
+  void SNN_ALWAYS_INLINE add_scaled_output(
+      VectorBlock<T, RowTile, ColTile>& out_block, Pointer const_out_ptr,
+      std::array<bool, RowTile> const& valid_row,
+      std::array<bool, ColTile> const& valid_col) const {
+    using VectorType = typename VectorBlock<T, RowTile, ColTile>::VectorType;
+    auto prev_block = load_block<RowTile, ColTile>(const_out_ptr, params_.n,
+                                                   valid_row, valid_col);
+    VectorType const beta{static_cast<T>(params_.beta)};
+    for (int i = 0; i < RowTile; ++i) {
+      out_block.data(i) =
+          helpers::math::mad(beta, prev_block.data(i), out_block.data(i));
+    }
+  }
+
+  /**
+   * Apply the epilogue to each value in the output block. Columns past the
+   * end of the matrix are never stored, so they reuse the first column's
+   * bias rather than reading out of bounds.
+   */
+  void SNN_ALWAYS_INLINE
+  apply_epilogue(VectorBlock<T, RowTile, ColTile>& out_block, Index col,
+                 std::array<bool, ColTile> const& valid_col) const {
+    namespace vec_elem = helpers::vector_element;
+    for (int i = 0; i < RowTile; ++i) {
+      for (int j = 0; j < ColTile; ++j) {
+        Index const out_col = valid_col[j] ? col + j : col;
+        vec_elem::set(
+            out_block.data(i), j,
+            epilogue_.apply(vec_elem::get(out_block.data(i), j), out_col));
+      }
+    }
+  }
+
   ReadMem<T const, IsUSM> lhs_;
   ReadMem<T const, IsUSM> rhs_;
   ReadWriteMem<T, IsUSM> output_;
+  internal::FusedEpilogue<T, IsUSM> epilogue_;
   MatmulParams params_;
 };
 
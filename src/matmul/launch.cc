@@ -18,18 +18,49 @@
 
 #include "sycldnn/mem_object.h"
 
+#include "sycldnn/internal/matmul/epilogue.h"
+#include "sycldnn/internal/matmul/gemv.h"
+
+#include "src/matmul/queue_gemv.h"
 #include "src/matmul/queue_kernel.h"
+#include "src/matmul/queue_local_kernel.h"
+#include "src/matmul/queue_split_k.h"
+
+#include <string>
+
+#include <CL/sycl.hpp>
 
 namespace sycldnn {
 namespace matmul {
 namespace internal {
 namespace {
 
+// Configuration of a matmul kernel launch. The tile sizes must be one of the
+// tiles instantiated in src/matmul/CMakeLists.txt.
+struct MatmulConfig {
+  // Number of rows of the output computed by each work item.
+  int row_tile;
+  // Number of elements of the shared dimension loaded at a time.
+  int acc_tile;
+  // Number of columns of the output computed by each work item.
+  int col_tile;
+  // Number of work items in the row dimension of a work-group.
+  int wg_rows;
+  // Number of work items in the column dimension of a work-group.
+  int wg_cols;
+  // Whether to use the kernel which stages the inputs in local memory. The
+  // local memory kernel uses fixed tile and work-group sizes, so the other
+  // fields are only used if the device cannot run it.
+  bool local_mem = false;
+};
+
 // Launch the kernel specified by the template parameters.
 template <typename T, bool TransposeLHS, bool TransposeRHS, int RowTile,
           int AccTile, int ColTile, template <typename> class MemObj>
 SNNStatus launch_with_tiles(MemObj<T const>& lhs, MemObj<T const>& rhs,
-                            MemObj<T>& output, MatmulParams const& params,
+                            MemObj<T>& output,
+                            EpilogueMem<T, MemObj>& epilogue,
+                            MatmulParams const& params,
                             cl::sycl::queue& queue, size_t wg_rows,
                             size_t wg_cols, size_t wg_batch,
                             const std::vector<cl::sycl::event>& events) {
@@ -39,8 +70,102 @@ SNNStatus launch_with_tiles(MemObj<T const>& lhs, MemObj<T const>& rhs,
                                    AccTile, ColTile, false, MemObj>
                     : queue_kernel<T, int, TransposeLHS, TransposeRHS, RowTile,
                                    AccTile, ColTile, true, MemObj>;
-  return kernel(lhs, rhs, output, params, queue, wg_rows, wg_cols, wg_batch,
-                events);
+  return kernel(lhs, rhs, output, epilogue, params, queue, wg_rows, wg_cols,
+                wg_batch, events);
+}
+
+// Launch the kernel with the tile sizes and work-group shape given in config.
+// The tile sizes must match those instantiated in src/matmul/CMakeLists.txt.
+template <typename T, bool TransposeLHS, bool TransposeRHS,
+          template <typename> class MemObj>
+SNNStatus launch_with_config(MemObj<T const>& lhs, MemObj<T const>& rhs,
+                             MemObj<T>& output,
+                             EpilogueMem<T, MemObj>& epilogue,
+                             MatmulParams const& params,
+                             cl::sycl::queue& queue,
+                             MatmulConfig const& config,
+                             const std::vector<cl::sycl::event>& events) {
+  if (config.local_mem) {
+    auto status =
+        queue_local_kernel<T, int, TransposeLHS, TransposeRHS, 4, 8, 4,
+                           MemObj>(lhs, rhs, output, epilogue, params, queue,
+                                   events);
+    // Fall back to the register tiled kernels if the device does not have
+    // enough local memory or does not support large enough work-groups.
+    if (status.status != StatusCode::InvalidAlgorithm) {
+      return status;
+    }
+  }
+  size_t const wg_rows = config.wg_rows;
+  size_t const wg_cols = config.wg_cols;
+  if (config.row_tile == 1 && config.acc_tile == 8 && config.col_tile == 4) {
+    return launch_with_tiles<T, TransposeLHS, TransposeRHS, 1, 8, 4, MemObj>(
+        lhs, rhs, output, epilogue, params, queue, wg_rows, wg_cols, 1,
+        events);
+  }
+  if (config.row_tile == 4 && config.acc_tile == 8 && config.col_tile == 4) {
+    return launch_with_tiles<T, TransposeLHS, TransposeRHS, 4, 8, 4, MemObj>(
+        lhs, rhs, output, epilogue, params, queue, wg_rows, wg_cols, 1,
+        events);
+  }
+  if (config.row_tile == 8 && config.acc_tile == 4 && config.col_tile == 8) {
+    return launch_with_tiles<T, TransposeLHS, TransposeRHS, 8, 4, 8, MemObj>(
+        lhs, rhs, output, epilogue, params, queue, wg_rows, wg_cols, 1,
+        events);
+  }
+  return launch_with_tiles<T, TransposeLHS, TransposeRHS, 4, 4, 4, MemObj>(
+      lhs, rhs, output, epilogue, params, queue, wg_rows, wg_cols, 1, events);
+}
+
+// Launch the matrix-vector kernel for a matmul where either m or n is one.
+// The matrix operand is the RHS for a row vector output and the LHS for a
+// column vector output.
+template <typename T, bool TransposeLHS, bool TransposeRHS,
+          template <typename> class MemObj>
+SNNStatus launch_gemv(MemObj<T const>& lhs, MemObj<T const>& rhs,
+                      MemObj<T>& output, EpilogueMem<T, MemObj>& epilogue,
+                      MatmulParams const& params, cl::sycl::queue& queue,
+                      const std::vector<cl::sycl::event>& events) {
+  bool const row_vector = params.m == 1;
+  MemObj<T const>& matrix = row_vector ? rhs : lhs;
+  MemObj<T const>& vector = row_vector ? lhs : rhs;
+  auto kernel = is_gemv_contiguous_acc<TransposeLHS, TransposeRHS>(params)
+                    ? queue_gemv<T, int, true, MemObj>
+                    : queue_gemv<T, int, false, MemObj>;
+  return kernel(matrix, vector, output, epilogue, params, queue, events);
+}
+
+// Whether the device has dedicated local memory, so that staging the inputs
+// in local memory is likely to be faster than reading them through the cache.
+bool has_local_memory(cl::sycl::device const& device) {
+  return !device.is_cpu() &&
+         device.get_info<cl::sycl::info::device::local_mem_type>() ==
+             cl::sycl::info::local_mem_type::local;
+}
+
+// Choose the tile sizes and work-group shape for a matmul.
+MatmulConfig default_config(MatmulParams const& params,
+                            cl::sycl::device const& device) {
+  bool const is_cpu = device.is_cpu();
+  // Matrix-vector like products, such as fully connected layers with a small
+  // batch, do not have enough rows to fill larger row tiles.
+  if (params.m < 4) {
+    return {1, 8, 4, 1, 64};
+  }
+  // Each work-group of the local memory kernel computes a 32x32 block of the
+  // output, so the matrices need to be large enough to fill these blocks and
+  // to amortise the cost of the barriers. This covers the 1x1 convolutions in
+  // bottleneck blocks, computed as matmuls over every pixel.
+  if (params.m >= 64 && params.n >= 64 && params.k >= 32 &&
+      has_local_memory(device)) {
+    return {4, 8, 4, 8, 8, true};
+  }
+  // Large products, such as 1x1 convolutions over many pixels, benefit from
+  // larger tiles which reuse each loaded value more times.
+  if (params.m >= 1024 && params.n >= 64 && params.k >= 8) {
+    return is_cpu ? MatmulConfig{8, 4, 8, 8, 4} : MatmulConfig{4, 8, 4, 8, 8};
+  }
+  return {4, 4, 4, 8, 4};
 }
 
 }  // namespace
@@ -49,25 +174,75 @@ SNNStatus launch_with_tiles(MemObj<T const>& lhs, MemObj<T const>& rhs,
 template <typename T, bool TransposeLHS, bool TransposeRHS,
           template <typename> class MemObj>
 SNNStatus launch(MemObj<T const>& lhs, MemObj<T const>& rhs, MemObj<T>& output,
-                 MatmulParams const& params, cl::sycl::queue& queue,
+                 EpilogueMem<T, MemObj>& epilogue, MatmulParams const& params,
+                 cl::sycl::queue& queue,
                  const std::vector<cl::sycl::event>& events) {
-  return launch_with_tiles<T, TransposeLHS, TransposeRHS, 4, 4, 4, MemObj>(
-      lhs, rhs, output, params, queue, 8, 4, 1, events);
+  if (is_gemv(params)) {
+    auto status = launch_gemv<T, TransposeLHS, TransposeRHS>(
+        lhs, rhs, output, epilogue, params, queue, events);
+    // Fall back to the register tiled kernels if the device does not support
+    // the work-group size used by the GEMV kernels.
+    if (status.status != StatusCode::InvalidAlgorithm) {
+      return status;
+    }
+  }
+  auto const config = default_config(params, queue.get_device());
+  return launch_with_config<T, TransposeLHS, TransposeRHS>(
+      lhs, rhs, output, epilogue, params, queue, config, events);
+}
+
+// Launch the split-K kernels, computing the partial products for each
+// partition of the shared dimension and then summing them into the output.
+// The tile sizes must match those instantiated in src/matmul/CMakeLists.txt.
+template <typename T, bool TransposeLHS, bool TransposeRHS,
+          template <typename> class MemObj>
+SNNStatus launch_split_k(MemObj<T const>& lhs, MemObj<T const>& rhs,
+                         MemObj<T>& output, MemObj<T>& workspace,
+                         EpilogueMem<T, MemObj>& epilogue,
+                         MatmulParams const& params, int n_splits,
+                         cl::sycl::queue& queue,
+                         const std::vector<cl::sycl::event>& events) {
+  auto partial_kernel =
+      params.m < 4 ? queue_split_k_kernel<T, int, TransposeLHS, TransposeRHS,
+                                          1, 8, 4, MemObj>
+                   : queue_split_k_kernel<T, int, TransposeLHS, TransposeRHS,
+                                          4, 8, 4, MemObj>;
+  auto status = partial_kernel(lhs, rhs, workspace, params, n_splits, queue,
+                               events);
+  if (status.status != StatusCode::OK) {
+    return status;
+  }
+  auto const_workspace = workspace.as_const();
+  return queue_split_k_reduce<T, int>(const_workspace, output, epilogue,
+                                      params, n_splits, queue,
+                                      {status.event});
 }
 
-#define INSTANTIATE_LAUNCHER(DTYPE, TLHS, TRHS, MEMOBJ)            \
-  template SNN_EXPORT SNNStatus launch<DTYPE, TLHS, TRHS, MEMOBJ>( \
-      MEMOBJ<DTYPE const> & input, MEMOBJ<DTYPE const> & filter,   \
-      MEMOBJ<DTYPE> & output, MatmulParams const& params,          \
-      cl::sycl::queue& queue, const std::vector<cl::sycl::event>& events);
+#define INSTANTIATE_LAUNCHER(DTYPE, TLHS, TRHS, MEMOBJ)                     \
+  template SNN_EXPORT SNNStatus launch<DTYPE, TLHS, TRHS, MEMOBJ>(          \
+      MEMOBJ<DTYPE const> & input, MEMOBJ<DTYPE const> & filter,            \
+      MEMOBJ<DTYPE> & output, EpilogueMem<DTYPE, MEMOBJ> & epilogue,        \
+      MatmulParams const& params, cl::sycl::queue& queue,                   \
+      const std::vector<cl::sycl::event>& events);
+
+#define INSTANTIATE_SPLIT_K_LAUNCHER(DTYPE, TLHS, TRHS, MEMOBJ)            \
+  template SNN_EXPORT SNNStatus launch_split_k<DTYPE, TLHS, TRHS, MEMOBJ>( \
+      MEMOBJ<DTYPE const> & input, MEMOBJ<DTYPE const> & filter,           \
+      MEMOBJ<DTYPE> & output, MEMOBJ<DTYPE> & workspace,                   \
+      EpilogueMem<DTYPE, MEMOBJ> & epilogue, MatmulParams const& params,   \
+      int n_splits, cl::sycl::queue& queue,                                \
+      const std::vector<cl::sycl::event>& events);
 
 #ifdef SNN_ENABLE_USM
+#define INSTANTIATE_FOR_MEMOBJ(DTYPE, TLHS, TRHS)                  \
+  INSTANTIATE_LAUNCHER(DTYPE, TLHS, TRHS, BufferMemObject)         \
+  INSTANTIATE_LAUNCHER(DTYPE, TLHS, TRHS, USMMemObject)            \
+  INSTANTIATE_SPLIT_K_LAUNCHER(DTYPE, TLHS, TRHS, BufferMemObject) \
+  INSTANTIATE_SPLIT_K_LAUNCHER(DTYPE, TLHS, TRHS, USMMemObject)
+#else
 #define INSTANTIATE_FOR_MEMOBJ(DTYPE, TLHS, TRHS)          \
   INSTANTIATE_LAUNCHER(DTYPE, TLHS, TRHS, BufferMemObject) \
-  INSTANTIATE_LAUNCHER(DTYPE, TLHS, TRHS, USMMemObject)
-#else
-#define INSTANTIATE_FOR_MEMOBJ(DTYPE, TLHS, TRHS) \
-  INSTANTIATE_LAUNCHER(DTYPE, TLHS, TRHS, BufferMemObject)
+  INSTANTIATE_SPLIT_K_LAUNCHER(DTYPE, TLHS, TRHS, BufferMemObject)
 #endif  // SNN_ENABLE_USM
 
 #define INSTANTIATE_FOR_TYPE(DTYPE)          \
@@ -88,6 +263,7 @@ INSTANTIATE_FOR_TYPE(cl::sycl::half);
 
 #undef INSTANTIATE_FOR_TYPE
 #undef INSTANTIATE_FOR_MEMOBJ
+#undef INSTANTIATE_SPLIT_K_LAUNCHER
 #undef INSTANTIATE_LAUNCHER
 
 }  // namespace internal
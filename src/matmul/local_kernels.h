@@ -0,0 +1,263 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_MATMUL_LOCAL_KERNELS_H_
+#define SYCLDNN_SRC_MATMUL_LOCAL_KERNELS_H_
+
+#include "sycldnn/accessor_types.h"
+#include "sycldnn/matmul/params.h"
+
+#include "sycldnn/helpers/macros.h"
+
+#include "src/helpers/math.h"
+#include "src/helpers/register_tile.h"
+#include "src/helpers/vector_io.h"
+#include "src/matmul/fused_epilogue.h"
+
+#include <CL/sycl.hpp>
+
+namespace sycldnn {
+namespace matmul {
+
+/**
+ * Shape of the work-groups used by the local memory matmul kernel.
+ *
+ * Each work-group computes a block of Rows x Cols register tiles of the
+ * output, staging panels of the LHS and RHS matrices in local memory.
+ */
+struct LocalMatmulWorkGroup {
+  /** Number of register tiles in the row direction of a work-group. */
+  static constexpr int Rows = 8;
+  /** Number of register tiles in the column direction of a work-group. */
+  static constexpr int Cols = 8;
+  /** Total number of work items in a work-group. */
+  static constexpr int Size = Rows * Cols;
+};
+
+/**
+ * Sizes of the local memory panels used by the local memory matmul kernel.
+ *
+ * The LHS panel holds BlockRows rows of AccTile elements of the shared
+ * dimension, and the RHS panel holds AccTile rows of BlockCols columns. Both
+ * are stored with the shared dimension outermost. Two of each panel are
+ * required for double buffering.
+ */
+template <int RowTile, int AccTile, int ColTile>
+struct LocalMatmulSizes {
+  /** Number of output rows computed by a work-group. */
+  static constexpr int BlockRows = RowTile * LocalMatmulWorkGroup::Rows;
+  /** Number of output columns computed by a work-group. */
+  static constexpr int BlockCols = ColTile * LocalMatmulWorkGroup::Cols;
+  /** Number of elements in a single LHS panel. */
+  static constexpr int LHSPanel = BlockRows * AccTile;
+  /** Number of elements in a single RHS panel. */
+  static constexpr int RHSPanel = AccTile * BlockCols;
+};
+
+/**
+ * Matrix multiply kernel which stages the LHS and RHS in local memory.
+ *
+ * Each work-group loops over the shared dimension AccTile elements at a time.
+ * The work items cooperatively load the LHS and RHS panels for the next step
+ * into one half of the double buffered local memory, while computing their
+ * RowTile x ColTile register tiles from the panels loaded in the previous
+ * step, so only a single barrier is needed per step.
+ *
+ * The kernel is launched over a 3D range of [batch, row groups * Rows, column
+ * groups * Cols], with work-groups of [1, Rows, Cols].
+ */
+template <typename T, typename Index, bool TransposeLHS, bool TransposeRHS,
+          int RowTile, int AccTile, int ColTile, bool IsUSM>
+struct LocalMatmulKernel {
+  using Sizes = LocalMatmulSizes<RowTile, AccTile, ColTile>;
+  using Load = helpers::io::Load<T>;
+  using Store = helpers::io::Store<T>;
+
+  LocalMatmulKernel(ReadMem<T const, IsUSM> const& lhs,
+                    ReadMem<T const, IsUSM> const& rhs,
+                    ReadWriteMem<T, IsUSM> const& output,
+                    internal::FusedEpilogue<T, IsUSM> const& epilogue,
+                    LocalAccessor<T> local_lhs, LocalAccessor<T> local_rhs,
+                    MatmulParams const& params)
+      : lhs_{lhs},
+        rhs_{rhs},
+        output_{output},
+        epilogue_{epilogue},
+        local_lhs_{std::move(local_lhs)},
+        local_rhs_{std::move(local_rhs)},
+        params_{params} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::nd_item<3> item) const {
+    Index const batch = item.get_group(0);
+    Index const block_row = item.get_group(1) * Sizes::BlockRows;
+    Index const block_col = item.get_group(2) * Sizes::BlockCols;
+    Index const local_row = item.get_local_id(1);
+    Index const local_col = item.get_local_id(2);
+    Index const local_idx = local_row * LocalMatmulWorkGroup::Cols + local_col;
+
+    Index const lhs_offset = batch * get_lhs_batch_stride(params_);
+    Index const rhs_offset = batch * get_rhs_batch_stride(params_);
+
+    helpers::RegisterTile2D<T, RowTile, ColTile> out_tile{};
+
+    Index const n_steps = (params_.k + AccTile - 1) / AccTile;
+    load_panels(local_idx, 0, lhs_offset, rhs_offset, block_row, block_col, 0);
+    item.barrier(cl::sycl::access::fence_space::local_space);
+
+    for (Index step = 0; step < n_steps; ++step) {
+      int const buffer = step % 2;
+      // The other buffer was last read in the previous step, which all work
+      // items have finished as they have passed the barrier since then.
+      if (step + 1 < n_steps) {
+        load_panels(local_idx, 1 - buffer, lhs_offset, rhs_offset, block_row,
+                    block_col, (step + 1) * AccTile);
+      }
+      accumulate(out_tile, buffer, local_row * RowTile, local_col * ColTile);
+      item.barrier(cl::sycl::access::fence_space::local_space);
+    }
+
+    write_out(out_tile, batch, block_row + local_row * RowTile,
+              block_col + local_col * ColTile);
+  }
+
+ private:
+  /**
+   * Cooperatively load the LHS and RHS panels for the AccTile elements of the
+   * shared dimension starting at acc into the given local memory buffer. The
+   * global memory accesses are ordered so that consecutive work items read
+   * consecutive addresses, and values past the edges are zero filled.
+   */
+  void SNN_ALWAYS_INLINE load_panels(Index local_idx, int buffer,
+                                     Index lhs_offset, Index rhs_offset,
+                                     Index block_row, Index block_col,
+                                     Index acc) const {
+    auto lhs_data = lhs_.get_pointer();
+    Index const lhs_buffer = buffer * Sizes::LHSPanel;
+    for (Index idx = local_idx; idx < Sizes::LHSPanel;
+         idx += LocalMatmulWorkGroup::Size) {
+      Index const row = TransposeLHS ? idx % Sizes::BlockRows : idx / AccTile;
+      Index const acc_idx =
+          TransposeLHS ? idx / Sizes::BlockRows : idx % AccTile;
+      Index const global_row = block_row + row;
+      Index const global_acc = acc + acc_idx;
+      T value{0};
+      if (global_row < params_.m && global_acc < params_.k) {
+        Index const offset = TransposeLHS
+                                 ? global_acc * params_.m + global_row
+                                 : global_row * params_.k + global_acc;
+        value = Load()(lhs_data, lhs_offset + offset);
+      }
+      local_lhs_[lhs_buffer + acc_idx * Sizes::BlockRows + row] = value;
+    }
+
+    auto rhs_data = rhs_.get_pointer();
+    Index const rhs_buffer = buffer * Sizes::RHSPanel;
+    for (Index idx = local_idx; idx < Sizes::RHSPanel;
+         idx += LocalMatmulWorkGroup::Size) {
+      Index const col = TransposeRHS ? idx / AccTile : idx % Sizes::BlockCols;
+      Index const acc_idx =
+          TransposeRHS ? idx % AccTile : idx / Sizes::BlockCols;
+      Index const global_col = block_col + col;
+      Index const global_acc = acc + acc_idx;
+      T value{0};
+      if (global_col < params_.n && global_acc < params_.k) {
+        Index const offset = TransposeRHS
+                                 ? global_col * params_.k + global_acc
+                                 : global_acc * params_.n + global_col;
+        value = Load()(rhs_data, rhs_offset + offset);
+      }
+      local_rhs_[rhs_buffer + acc_idx * Sizes::BlockCols + col] = value;
+    }
+  }
+
+  /**
+   * Accumulate the contribution of the panels in the given local memory
+   * buffer to this work item's register tile.
+   */
+  void SNN_ALWAYS_INLINE
+  accumulate(helpers::RegisterTile2D<T, RowTile, ColTile>& out_tile,
+             int buffer, Index first_row, Index first_col) const {
+    Index const lhs_buffer = buffer * Sizes::LHSPanel + first_row;
+    Index const rhs_buffer = buffer * Sizes::RHSPanel + first_col;
+    SNN_PRAGMA_UNROLL
+    for (int acc_idx = 0; acc_idx < AccTile; ++acc_idx) {
+      helpers::RegisterTile1D<T, RowTile> lhs_tile;
+      SNN_PRAGMA_UNROLL
+      for (int i = 0; i < RowTile; ++i) {
+        lhs_tile.data(i) =
+            local_lhs_[lhs_buffer + acc_idx * Sizes::BlockRows + i];
+      }
+      helpers::RegisterTile1D<T, ColTile> rhs_tile;
+      SNN_PRAGMA_UNROLL
+      for (int j = 0; j < ColTile; ++j) {
+        rhs_tile.data(j) =
+            local_rhs_[rhs_buffer + acc_idx * Sizes::BlockCols + j];
+      }
+      SNN_PRAGMA_UNROLL
+      for (int i = 0; i < RowTile; ++i) {
+        SNN_PRAGMA_UNROLL
+        for (int j = 0; j < ColTile; ++j) {
+          out_tile.data(i, j) = helpers::math::mad(
+              lhs_tile.data(i), rhs_tile.data(j), out_tile.data(i, j));
+        }
+      }
+    }
+  }
+
+  /**
+   * Write the register tile to the output, scaling and adding the existing
+   * output values if beta is non-zero, and skipping out of bounds values.
+   */
+  void SNN_ALWAYS_INLINE
+  write_out(helpers::RegisterTile2D<T, RowTile, ColTile> const& out_tile,
+            Index batch, Index row, Index col) const {
+    auto output_data = output_.get_pointer();
+    Index const out_offset = batch * get_output_batch_stride(params_);
+    SNN_PRAGMA_UNROLL
+    for (int i = 0; i < RowTile; ++i) {
+      SNN_PRAGMA_UNROLL
+      for (int j = 0; j < ColTile; ++j) {
+        if (row + i < params_.m && col + j < params_.n) {
+          Index const offset = out_offset + (row + i) * params_.n + col + j;
+          T value = out_tile.data(i, j);
+          if (params_.alpha != 1.f) {
+            value *= static_cast<T>(params_.alpha);
+          }
+          if (params_.beta != 0.f) {
+            value = helpers::math::mad(static_cast<T>(params_.beta),
+                                       Load()(output_data, offset), value);
+          }
+          if (epilogue_.enabled()) {
+            value = epilogue_.apply(value, col + j);
+          }
+          Store()(output_data, offset, value);
+        }
+      }
+    }
+  }
+
+  ReadMem<T const, IsUSM> lhs_;
+  ReadMem<T const, IsUSM> rhs_;
+  ReadWriteMem<T, IsUSM> output_;
+  internal::FusedEpilogue<T, IsUSM> epilogue_;
+  LocalAccessor<T> local_lhs_;
+  LocalAccessor<T> local_rhs_;
+  MatmulParams params_;
+};
+
+}  // namespace matmul
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_SRC_MATMUL_LOCAL_KERNELS_H_
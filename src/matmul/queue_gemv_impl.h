@@ -0,0 +1,87 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_MATMUL_QUEUE_GEMV_IMPL_H_
+#define SYCLDNN_SRC_MATMUL_QUEUE_GEMV_IMPL_H_
+
+#include "sycldnn/accessor_types.h"
+#include "sycldnn/mem_object.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/helpers/ratio.h"
+
+#include "sycldnn/matmul/params.h"
+
+#include "src/matmul/gemv_kernels.h"
+#include "src/matmul/queue_gemv.h"
+
+namespace sycldnn {
+namespace matmul {
+namespace internal {
+
+template <typename T, typename Index, bool ContiguousAcc,
+          template <typename> class MemObj>
+SNNStatus queue_gemv(MemObj<T const>& matrix_mem, MemObj<T const>& vector_mem,
+                     MemObj<T>& output_mem,
+                     EpilogueMem<T, MemObj>& epilogue_mem,
+                     MatmulParams const& params, cl::sycl::queue& queue,
+                     const std::vector<cl::sycl::event>& events) {
+  constexpr bool is_usm = is_usm_obj_v<MemObj<T>, T>;
+  constexpr size_t workgroup_size = gemv_workgroup_size;
+
+  cl::sycl::device device = queue.get_device();
+  size_t const max_workgroup_size =
+      device.get_info<cl::sycl::info::device::max_work_group_size>();
+  if (workgroup_size > max_workgroup_size) {
+    return StatusCode::InvalidAlgorithm;
+  }
+
+  size_t const rows = params.m == 1 ? params.n : params.m;
+  size_t const n_row_threads =
+      ContiguousAcc
+          ? rows * workgroup_size
+          : helpers::round_up_to_nearest_multiple(rows, workgroup_size);
+  size_t const n_batch_threads = static_cast<size_t>(params.batches);
+
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    cgh.depends_on(events);
+    auto matrix = matrix_mem.read_mem(cgh);
+    auto vector = vector_mem.read_mem(cgh);
+    auto output = output_mem.read_write_mem(cgh);
+    auto epilogue = get_fused_epilogue(epilogue_mem, cgh);
+
+    cl::sycl::nd_range<2> range{
+        cl::sycl::range<2>{n_batch_threads, n_row_threads},
+        cl::sycl::range<2>{1, workgroup_size},
+    };
+    if constexpr (ContiguousAcc) {
+      using Functor = GemvReductionKernel<T, Index, is_usm>;
+      LocalAccessor<T> workspace{cl::sycl::range<1>{workgroup_size}, cgh};
+      Functor functor{matrix, vector, output, epilogue, workspace, params};
+      cgh.parallel_for(range, functor);
+    } else {
+      using Functor = GemvKernel<T, Index, is_usm>;
+      Functor functor{matrix, vector, output, epilogue, params};
+      cgh.parallel_for(range, functor);
+    }
+  });
+  return {event, StatusCode::OK};
+}
+
+}  // namespace internal
+}  // namespace matmul
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_SRC_MATMUL_QUEUE_GEMV_IMPL_H_
@@ -0,0 +1,48 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_MATMUL_QUEUE_GROUPED_KERNEL_H_
+#define SYCLDNN_SRC_MATMUL_QUEUE_GROUPED_KERNEL_H_
+
+#include "sycldnn/matmul/grouped_params.h"
+
+#include "sycldnn/mem_object.h"
+#include "sycldnn/status.h"
+
+namespace sycldnn {
+namespace matmul {
+namespace internal {
+
+/**
+ * Add a grouped matrix multiply kernel to the provided SYCL queue, computing
+ * every problem in the group in a single launch.
+ *
+ * Returns StatusCode::InvalidAlgorithm if the device does not support the
+ * work-group size required by the kernel.
+ */
+template <typename T, typename Index, bool TransposeLHS, bool TransposeRHS,
+          template <typename> class MemObj>
+SNNStatus queue_grouped_kernel(MemObj<T const>& lhs, MemObj<T const>& rhs,
+                               MemObj<T>& output,
+                               MemObj<GroupedMatmulProblem const>& problems,
+                               GroupedMatmulParams const& params,
+                               cl::sycl::queue& queue,
+                               const std::vector<cl::sycl::event>& events);
+
+}  // namespace internal
+}  // namespace matmul
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_SRC_MATMUL_QUEUE_GROUPED_KERNEL_H_
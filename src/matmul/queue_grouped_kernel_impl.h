@@ -0,0 +1,85 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_MATMUL_QUEUE_GROUPED_KERNEL_IMPL_H_
+#define SYCLDNN_SRC_MATMUL_QUEUE_GROUPED_KERNEL_IMPL_H_
+
+#include "sycldnn/mem_object.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/matmul/grouped_params.h"
+
+#include "src/matmul/grouped_kernels.h"
+#include "src/matmul/queue_grouped_kernel.h"
+
+namespace sycldnn {
+namespace matmul {
+namespace internal {
+
+/**
+ * Number of work-groups launched for each compute unit by the grouped matmul
+ * kernel. The shapes of the problems are only known on the device, so the
+ * number of work-groups is chosen to occupy the device rather than to match
+ * the number of output blocks.
+ */
+static constexpr size_t grouped_workgroups_per_compute_unit = 4;
+
+template <typename T, typename Index, bool TransposeLHS, bool TransposeRHS,
+          template <typename> class MemObj>
+SNNStatus queue_grouped_kernel(MemObj<T const>& lhs_mem,
+                               MemObj<T const>& rhs_mem, MemObj<T>& output_mem,
+                               MemObj<GroupedMatmulProblem const>& problem_mem,
+                               GroupedMatmulParams const& params,
+                               cl::sycl::queue& queue,
+                               const std::vector<cl::sycl::event>& events) {
+  using Functor = GroupedMatmulKernel<T, Index, TransposeLHS, TransposeRHS,
+                                      is_usm_obj_v<MemObj<T>, T>>;
+  using Tiles = GroupedMatmulTiles;
+  constexpr size_t workgroup_size = Tiles::Rows * Tiles::Cols;
+
+  cl::sycl::device device = queue.get_device();
+  size_t const max_workgroup_size =
+      device.get_info<cl::sycl::info::device::max_work_group_size>();
+  if (workgroup_size > max_workgroup_size) {
+    return StatusCode::InvalidAlgorithm;
+  }
+  size_t const compute_units =
+      device.get_info<cl::sycl::info::device::max_compute_units>();
+  size_t const n_groups = compute_units * grouped_workgroups_per_compute_unit;
+
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    cgh.depends_on(events);
+    auto lhs = lhs_mem.read_mem(cgh);
+    auto rhs = rhs_mem.read_mem(cgh);
+    auto output = output_mem.read_write_mem(cgh);
+    auto problems = problem_mem.read_mem(cgh);
+
+    Functor functor{lhs, rhs, output, problems, params};
+
+    cgh.parallel_for(
+        cl::sycl::nd_range<2>{
+            cl::sycl::range<2>{n_groups * Tiles::Rows, Tiles::Cols},
+            cl::sycl::range<2>{Tiles::Rows, Tiles::Cols},
+        },
+        functor);
+  });
+  return {event, StatusCode::OK};
+}
+
+}  // namespace internal
+}  // namespace matmul
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_SRC_MATMUL_QUEUE_GROUPED_KERNEL_IMPL_H_
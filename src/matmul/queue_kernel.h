@@ -18,6 +18,8 @@
 
 #include "sycldnn/matmul/params.h"
 
+#include "sycldnn/internal/matmul/epilogue.h"
+
 #include "sycldnn/mem_object.h"
 #include "sycldnn/status.h"
 
@@ -25,14 +27,17 @@ namespace sycldnn {
 namespace matmul {
 namespace internal {
 
-/** Add a matrix multiply kernel to the provided SYCL queue. */
+/**
+ * Add a matrix multiply kernel to the provided SYCL queue, applying the
+ * epilogue to the output values before they are stored.
+ */
 template <typename T, typename Index, bool TransposeLHS, bool TransposeRHS,
           int RowTile, int AccTile, int ColTile, bool CheckBounds,
           template <typename> class MemObj>
 SNNStatus queue_kernel(MemObj<T const>& lhs, MemObj<T const>& rhs,
-                       MemObj<T>& output, MatmulParams const& params,
-                       cl::sycl::queue& queue, size_t wg_row, size_t wg_col,
-                       size_t wg_batch,
+                       MemObj<T>& output, EpilogueMem<T, MemObj>& epilogue,
+                       MatmulParams const& params, cl::sycl::queue& queue,
+                       size_t wg_row, size_t wg_col, size_t wg_batch,
                        const std::vector<cl::sycl::event>& events);
 
 }  // namespace internal
@@ -33,9 +33,10 @@ template <typename T, typename Index, bool TransposeLHS, bool TransposeRHS,
           int RowTile, int AccTile, int ColTile, bool CheckBounds,
           template <typename> class MemObj>
 SNNStatus queue_kernel(MemObj<T const>& lhs_mem, MemObj<T const>& rhs_mem,
-                       MemObj<T>& output_mem, MatmulParams const& params,
-                       cl::sycl::queue& queue, size_t wg_row, size_t wg_col,
-                       size_t wg_batch,
+                       MemObj<T>& output_mem,
+                       EpilogueMem<T, MemObj>& epilogue_mem,
+                       MatmulParams const& params, cl::sycl::queue& queue,
+                       size_t wg_row, size_t wg_col, size_t wg_batch,
                        const std::vector<cl::sycl::event>& events) {
   constexpr bool is_usm = is_usm_obj_v<MemObj<T>, T>;
   Index const output_size_row = helpers::round_ratio_up(params.m, RowTile);
@@ -52,11 +53,12 @@ SNNStatus queue_kernel(MemObj<T const>& lhs_mem, MemObj<T const>& rhs_mem,
     auto lhs = lhs_mem.read_mem(cgh);
     auto rhs = rhs_mem.read_mem(cgh);
     auto output = output_mem.read_write_mem(cgh);
+    auto epilogue = get_fused_epilogue(epilogue_mem, cgh);
 
     using Functor = MatmulKernel<T, Index, TransposeLHS, TransposeRHS, RowTile,
                                  AccTile, ColTile, CheckBounds, is_usm>;
 
-    Functor functor{lhs, rhs, output, params};
+    Functor functor{lhs, rhs, output, epilogue, params};
 
     cgh.parallel_for(
         cl::sycl::nd_range<3>{
@@ -0,0 +1,52 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_MATMUL_QUEUE_LOCAL_KERNEL_H_
+#define SYCLDNN_SRC_MATMUL_QUEUE_LOCAL_KERNEL_H_
+
+#include "sycldnn/matmul/params.h"
+
+#include "sycldnn/internal/matmul/epilogue.h"
+
+#include "sycldnn/mem_object.h"
+#include "sycldnn/status.h"
+
+namespace sycldnn {
+namespace matmul {
+namespace internal {
+
+/**
+ * Add a matrix multiply kernel which stages the inputs in local memory to the
+ * provided SYCL queue, applying the epilogue to the output values before
+ * they are stored.
+ *
+ * Returns StatusCode::InvalidAlgorithm if the device does not support the
+ * work-group size or local memory required by the kernel.
+ */
+template <typename T, typename Index, bool TransposeLHS, bool TransposeRHS,
+          int RowTile, int AccTile, int ColTile,
+          template <typename> class MemObj>
+SNNStatus queue_local_kernel(MemObj<T const>& lhs, MemObj<T const>& rhs,
+                             MemObj<T>& output,
+                             EpilogueMem<T, MemObj>& epilogue,
+                             MatmulParams const& params,
+                             cl::sycl::queue& queue,
+                             const std::vector<cl::sycl::event>& events);
+
+}  // namespace internal
+}  // namespace matmul
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_SRC_MATMUL_QUEUE_LOCAL_KERNEL_H_
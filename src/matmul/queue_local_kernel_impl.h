@@ -0,0 +1,97 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_MATMUL_QUEUE_LOCAL_KERNEL_IMPL_H_
+#define SYCLDNN_SRC_MATMUL_QUEUE_LOCAL_KERNEL_IMPL_H_
+
+#include "sycldnn/accessor_types.h"
+#include "sycldnn/mem_object.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/helpers/ratio.h"
+
+#include "sycldnn/matmul/params.h"
+
+#include "src/matmul/local_kernels.h"
+#include "src/matmul/queue_local_kernel.h"
+
+namespace sycldnn {
+namespace matmul {
+namespace internal {
+
+template <typename T, typename Index, bool TransposeLHS, bool TransposeRHS,
+          int RowTile, int AccTile, int ColTile,
+          template <typename> class MemObj>
+SNNStatus queue_local_kernel(MemObj<T const>& lhs_mem,
+                             MemObj<T const>& rhs_mem, MemObj<T>& output_mem,
+                             EpilogueMem<T, MemObj>& epilogue_mem,
+                             MatmulParams const& params,
+                             cl::sycl::queue& queue,
+                             const std::vector<cl::sycl::event>& events) {
+  using Functor = LocalMatmulKernel<T, Index, TransposeLHS, TransposeRHS,
+                                    RowTile, AccTile, ColTile,
+                                    is_usm_obj_v<MemObj<T>, T>>;
+  using Sizes = LocalMatmulSizes<RowTile, AccTile, ColTile>;
+  using WorkGroup = LocalMatmulWorkGroup;
+  constexpr size_t workgroup_size = WorkGroup::Size;
+
+  cl::sycl::device device = queue.get_device();
+  size_t const max_workgroup_size =
+      device.get_info<cl::sycl::info::device::max_work_group_size>();
+  size_t const local_mem_size =
+      device.get_info<cl::sycl::info::device::local_mem_size>();
+  // Both panels are double buffered.
+  size_t const required_local_mem =
+      2 * (Sizes::LHSPanel + Sizes::RHSPanel) * sizeof(T);
+  if (workgroup_size > max_workgroup_size ||
+      required_local_mem > local_mem_size) {
+    return StatusCode::InvalidAlgorithm;
+  }
+
+  size_t const n_row_threads =
+      helpers::round_ratio_up(params.m, Sizes::BlockRows) * WorkGroup::Rows;
+  size_t const n_col_threads =
+      helpers::round_ratio_up(params.n, Sizes::BlockCols) * WorkGroup::Cols;
+  size_t const n_batch_threads = static_cast<size_t>(params.batches);
+
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    cgh.depends_on(events);
+    auto lhs = lhs_mem.read_mem(cgh);
+    auto rhs = rhs_mem.read_mem(cgh);
+    auto output = output_mem.read_write_mem(cgh);
+    auto epilogue = get_fused_epilogue(epilogue_mem, cgh);
+
+    LocalAccessor<T> local_lhs{
+        cl::sycl::range<1>{static_cast<size_t>(2 * Sizes::LHSPanel)}, cgh};
+    LocalAccessor<T> local_rhs{
+        cl::sycl::range<1>{static_cast<size_t>(2 * Sizes::RHSPanel)}, cgh};
+
+    Functor functor{lhs, rhs, output, epilogue, local_lhs, local_rhs, params};
+
+    cgh.parallel_for(
+        cl::sycl::nd_range<3>{
+            cl::sycl::range<3>{n_batch_threads, n_row_threads, n_col_threads},
+            cl::sycl::range<3>{1, WorkGroup::Rows, WorkGroup::Cols},
+        },
+        functor);
+  });
+  return {event, StatusCode::OK};
+}
+
+}  // namespace internal
+}  // namespace matmul
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_SRC_MATMUL_QUEUE_LOCAL_KERNEL_IMPL_H_
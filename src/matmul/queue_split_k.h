@@ -0,0 +1,60 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_MATMUL_QUEUE_SPLIT_K_H_
+#define SYCLDNN_SRC_MATMUL_QUEUE_SPLIT_K_H_
+
+#include "sycldnn/matmul/params.h"
+
+#include "sycldnn/internal/matmul/epilogue.h"
+
+#include "sycldnn/mem_object.h"
+#include "sycldnn/status.h"
+
+namespace sycldnn {
+namespace matmul {
+namespace internal {
+
+/**
+ * Add a kernel to the provided SYCL queue to compute the partial matrix
+ * products over n_splits partitions of the shared dimension into the
+ * workspace.
+ */
+template <typename T, typename Index, bool TransposeLHS, bool TransposeRHS,
+          int RowTile, int AccTile, int ColTile,
+          template <typename> class MemObj>
+SNNStatus queue_split_k_kernel(MemObj<T const>& lhs, MemObj<T const>& rhs,
+                               MemObj<T>& workspace,
+                               MatmulParams const& params, int n_splits,
+                               cl::sycl::queue& queue,
+                               const std::vector<cl::sycl::event>& events);
+
+/**
+ * Add a kernel to the provided SYCL queue to sum the n_splits partial matrix
+ * products in the workspace into the output, applying the epilogue to the
+ * summed values.
+ */
+template <typename T, typename Index, template <typename> class MemObj>
+SNNStatus queue_split_k_reduce(MemObj<T const>& workspace, MemObj<T>& output,
+                               EpilogueMem<T, MemObj>& epilogue,
+                               MatmulParams const& params, int n_splits,
+                               cl::sycl::queue& queue,
+                               const std::vector<cl::sycl::event>& events);
+
+}  // namespace internal
+}  // namespace matmul
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_SRC_MATMUL_QUEUE_SPLIT_K_H_
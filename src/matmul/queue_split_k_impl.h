@@ -0,0 +1,104 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_MATMUL_QUEUE_SPLIT_K_IMPL_H_
+#define SYCLDNN_SRC_MATMUL_QUEUE_SPLIT_K_IMPL_H_
+
+#include "sycldnn/mem_object.h"
+#include "sycldnn/status.h"
+
+#include "sycldnn/helpers/ratio.h"
+
+#include "sycldnn/matmul/params.h"
+
+#include "src/matmul/queue_split_k.h"
+#include "src/matmul/split_k_kernels.h"
+
+namespace sycldnn {
+namespace matmul {
+namespace internal {
+
+template <typename T, typename Index, bool TransposeLHS, bool TransposeRHS,
+          int RowTile, int AccTile, int ColTile,
+          template <typename> class MemObj>
+SNNStatus queue_split_k_kernel(MemObj<T const>& lhs_mem,
+                               MemObj<T const>& rhs_mem,
+                               MemObj<T>& workspace_mem,
+                               MatmulParams const& params, int n_splits,
+                               cl::sycl::queue& queue,
+                               const std::vector<cl::sycl::event>& events) {
+  using Functor =
+      SplitKMatmulKernel<T, Index, TransposeLHS, TransposeRHS, RowTile,
+                         AccTile, ColTile, is_usm_obj_v<MemObj<T>, T>>;
+  // Each partition covers a whole number of accumulator tiles.
+  Index const split_size = helpers::round_up_to_nearest_multiple(
+      helpers::round_ratio_up(params.k, n_splits), AccTile);
+  size_t const wg_rows = RowTile == 1 ? 1 : 8;
+  size_t const wg_cols = RowTile == 1 ? 64 : 8;
+  size_t const n_matrix_threads =
+      static_cast<size_t>(n_splits) * static_cast<size_t>(params.batches);
+  size_t const n_row_threads = helpers::round_up_to_nearest_multiple(
+      helpers::round_ratio_up(params.m, RowTile), wg_rows);
+  size_t const n_col_threads = helpers::round_up_to_nearest_multiple(
+      helpers::round_ratio_up(params.n, ColTile), wg_cols);
+
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    cgh.depends_on(events);
+    auto lhs = lhs_mem.read_mem(cgh);
+    auto rhs = rhs_mem.read_mem(cgh);
+    auto workspace = workspace_mem.write_mem(cgh);
+
+    Functor functor{lhs, rhs, workspace, params, split_size};
+
+    cgh.parallel_for(
+        cl::sycl::nd_range<3>{
+            cl::sycl::range<3>{n_matrix_threads, n_row_threads, n_col_threads},
+            cl::sycl::range<3>{1, wg_rows, wg_cols},
+        },
+        functor);
+  });
+  return {event, StatusCode::OK};
+}
+
+template <typename T, typename Index, template <typename> class MemObj>
+SNNStatus queue_split_k_reduce(MemObj<T const>& workspace_mem,
+                               MemObj<T>& output_mem,
+                               EpilogueMem<T, MemObj>& epilogue_mem,
+                               MatmulParams const& params, int n_splits,
+                               cl::sycl::queue& queue,
+                               const std::vector<cl::sycl::event>& events) {
+  using Functor = SplitKReduceKernel<T, Index, is_usm_obj_v<MemObj<T>, T>>;
+  Index const output_size = params.batches * params.m * params.n;
+  size_t const n_threads =
+      helpers::round_up_to_nearest_multiple(output_size, 64);
+
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    cgh.depends_on(events);
+    auto workspace = workspace_mem.read_mem(cgh);
+    auto output = output_mem.read_write_mem(cgh);
+    auto epilogue = get_fused_epilogue(epilogue_mem, cgh);
+
+    Functor functor{workspace, output, epilogue, params, n_splits};
+
+    cgh.parallel_for(cl::sycl::range<1>{n_threads}, functor);
+  });
+  return {event, StatusCode::OK};
+}
+
+}  // namespace internal
+}  // namespace matmul
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_SRC_MATMUL_QUEUE_SPLIT_K_IMPL_H_
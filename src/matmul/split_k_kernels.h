@@ -0,0 +1,205 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_SRC_MATMUL_SPLIT_K_KERNELS_H_
+#define SYCLDNN_SRC_MATMUL_SPLIT_K_KERNELS_H_
+
+#include "sycldnn/accessor_types.h"
+#include "sycldnn/matmul/params.h"
+
+#include "sycldnn/helpers/macros.h"
+
+#include "src/helpers/math.h"
+#include "src/helpers/register_tile.h"
+#include "src/helpers/vector_io.h"
+#include "src/matmul/fused_epilogue.h"
+
+#include <CL/sycl.hpp>
+
+namespace sycldnn {
+namespace matmul {
+
+/**
+ * Matrix multiply kernel which computes the partial products over one
+ * partition of the shared dimension.
+ *
+ * The kernel is launched over a 3D range of [partitions * batch,
+ * rows / RowTile, cols / ColTile]. Each work item computes a RowTile x ColTile
+ * tile of the product of the LHS and RHS over the split_size elements of the
+ * shared dimension in its partition, and writes it to the workspace. The
+ * partial products for partition p of batch b are stored as the
+ * (p * batches + b)th matrix in the workspace.
+ */
+template <typename T, typename Index, bool TransposeLHS, bool TransposeRHS,
+          int RowTile, int AccTile, int ColTile, bool IsUSM>
+struct SplitKMatmulKernel {
+  using Load = helpers::io::Load<T>;
+  using Store = helpers::io::Store<T>;
+
+  SplitKMatmulKernel(ReadMem<T const, IsUSM> const& lhs,
+                     ReadMem<T const, IsUSM> const& rhs,
+                     WriteMem<T, IsUSM> const& workspace,
+                     MatmulParams const& params, Index split_size)
+      : lhs_{lhs},
+        rhs_{rhs},
+        workspace_{workspace},
+        params_{params},
+        split_size_{split_size} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::nd_item<3> item) const {
+    Index const matrix = item.get_global_id(0);
+    Index const row = item.get_global_id(1) * RowTile;
+    Index const col = item.get_global_id(2) * ColTile;
+    if (row >= params_.m || col >= params_.n) {
+      return;
+    }
+    Index const split = matrix / params_.batches;
+    Index const batch = matrix % params_.batches;
+    Index const acc_begin = split * split_size_;
+    Index const acc_end =
+        cl::sycl::min(acc_begin + split_size_, Index{params_.k});
+
+    auto lhs_data = lhs_.get_pointer();
+    auto rhs_data = rhs_.get_pointer();
+    Index const lhs_offset = batch * get_lhs_batch_stride(params_);
+    Index const rhs_offset = batch * get_rhs_batch_stride(params_);
+
+    helpers::RegisterTile2D<T, RowTile, ColTile> out_tile{};
+    for (Index acc = acc_begin; acc < acc_end; acc += AccTile) {
+      SNN_PRAGMA_UNROLL
+      for (int acc_idx = 0; acc_idx < AccTile; ++acc_idx) {
+        Index const k_idx = acc + acc_idx;
+        if (k_idx < acc_end) {
+          helpers::RegisterTile1D<T, RowTile> lhs_tile{};
+          SNN_PRAGMA_UNROLL
+          for (int i = 0; i < RowTile; ++i) {
+            if (row + i < params_.m) {
+              Index const offset = TransposeLHS
+                                       ? k_idx * params_.m + row + i
+                                       : (row + i) * params_.k + k_idx;
+              lhs_tile.data(i) = Load()(lhs_data, lhs_offset + offset);
+            }
+          }
+          helpers::RegisterTile1D<T, ColTile> rhs_tile{};
+          SNN_PRAGMA_UNROLL
+          for (int j = 0; j < ColTile; ++j) {
+            if (col + j < params_.n) {
+              Index const offset = TransposeRHS
+                                       ? (col + j) * params_.k + k_idx
+                                       : k_idx * params_.n + col + j;
+              rhs_tile.data(j) = Load()(rhs_data, rhs_offset + offset);
+            }
+          }
+          SNN_PRAGMA_UNROLL
+          for (int i = 0; i < RowTile; ++i) {
+            SNN_PRAGMA_UNROLL
+            for (int j = 0; j < ColTile; ++j) {
+              out_tile.data(i, j) = helpers::math::mad(
+                  lhs_tile.data(i), rhs_tile.data(j), out_tile.data(i, j));
+            }
+          }
+        }
+      }
+    }
+
+    auto workspace_data = workspace_.get_pointer();
+    Index const out_offset = matrix * params_.m * params_.n;
+    SNN_PRAGMA_UNROLL
+    for (int i = 0; i < RowTile; ++i) {
+      SNN_PRAGMA_UNROLL
+      for (int j = 0; j < ColTile; ++j) {
+        if (row + i < params_.m && col + j < params_.n) {
+          Store()(workspace_data, out_offset + (row + i) * params_.n + col + j,
+                  out_tile.data(i, j));
+        }
+      }
+    }
+  }
+
+ private:
+  ReadMem<T const, IsUSM> lhs_;
+  ReadMem<T const, IsUSM> rhs_;
+  WriteMem<T, IsUSM> workspace_;
+  MatmulParams params_;
+  Index split_size_;
+};
+
+/**
+ * Kernel to sum the partial products computed by SplitKMatmulKernel into the
+ * output. The sum is scaled by alpha, the existing output values are scaled
+ * and added if beta is non-zero, and then the epilogue is applied.
+ *
+ * The kernel is launched over a 1D range of the output size, where each work
+ * item computes a single output value.
+ */
+template <typename T, typename Index, bool IsUSM>
+struct SplitKReduceKernel {
+  using Load = helpers::io::Load<T>;
+  using Store = helpers::io::Store<T>;
+
+  SplitKReduceKernel(ReadMem<T const, IsUSM> const& workspace,
+                     ReadWriteMem<T, IsUSM> const& output,
+                     internal::FusedEpilogue<T, IsUSM> const& epilogue,
+                     MatmulParams const& params, Index n_splits)
+      : workspace_{workspace},
+        output_{output},
+        epilogue_{epilogue},
+        params_{params},
+        output_size_{params.batches * params.m * params.n},
+        n_splits_{n_splits} {}
+
+  void SNN_ALWAYS_INLINE operator()(cl::sycl::item<1> item) const {
+    Index const idx = item.get_id(0);
+    if (idx < output_size_) {
+      auto workspace_data = workspace_.get_pointer();
+      auto output_data = output_.get_pointer();
+
+      T value = Load()(workspace_data, idx);
+      for (Index split = 1; split < n_splits_; ++split) {
+        value += Load()(workspace_data, split * output_size_ + idx);
+      }
+      // The workspace is packed, while the output may have a larger stride
+      // between batches.
+      Index const matrix_size = params_.m * params_.n;
+      Index const out_idx = (idx / matrix_size) *
+                                get_output_batch_stride(params_) +
+                            idx % matrix_size;
+      if (params_.alpha != 1.f) {
+        value *= static_cast<T>(params_.alpha);
+      }
+      if (params_.beta != 0.f) {
+        value = helpers::math::mad(static_cast<T>(params_.beta),
+                                   Load()(output_data, out_idx), value);
+      }
+      if (epilogue_.enabled()) {
+        value = epilogue_.apply(value, idx % params_.n);
+      }
+      Store()(output_data, out_idx, value);
+    }
+  }
+
+ private:
+  ReadMem<T const, IsUSM> workspace_;
+  ReadWriteMem<T, IsUSM> output_;
+  internal::FusedEpilogue<T, IsUSM> epilogue_;
+  MatmulParams params_;
+  Index output_size_;
+  Index n_splits_;
+};
+
+}  // namespace matmul
+}  // namespace sycldnn
+
+#endif  // SYCLDNN_SRC_MATMUL_SPLIT_K_KERNELS_H_
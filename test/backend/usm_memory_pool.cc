@@ -0,0 +1,107 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "sycldnn/backend/snn_usm_backend.h"
+#include "sycldnn/backend/usm_memory_pool.h"
+
+#include "test/backend/backend_test_fixture.h"
+
+#include <future>
+
+#include <CL/sycl.hpp>
+
+using USMMemoryPoolTest =
+    BackendTestFixture<sycldnn::backend::SNNUSMBackend>;
+
+TEST_F(USMMemoryPoolTest, ReusesReleasedBlock) {
+  auto& backend = this->provider_.get_backend();
+  float* ptr = backend.allocate<float>(100);
+  ASSERT_NE(nullptr, ptr);
+  backend.deallocate(ptr);
+
+  // A smaller allocation in the same bin reuses the cached block.
+  float* reused = backend.allocate<float>(90);
+  EXPECT_EQ(ptr, reused);
+
+  auto stats = backend.get_memory_pool_stats();
+  EXPECT_EQ(1u, stats.device_allocations);
+  EXPECT_EQ(1u, stats.reused_allocations);
+  EXPECT_EQ(0u, stats.bytes_retained);
+  backend.deallocate(reused);
+}
+TEST_F(USMMemoryPoolTest, WaitsForEventsBeforeReuse) {
+  auto& backend = this->provider_.get_backend();
+  auto& queue = backend.get_queue();
+  float* ptr = backend.allocate<float>(256);
+  ASSERT_NE(nullptr, ptr);
+
+  // Hold the block with a host task which does not complete until the
+  // promise is fulfilled.
+  std::promise<void> release;
+  auto released = release.get_future().share();
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    cgh.host_task([=]() { released.wait(); });
+  });
+  backend.deallocate(ptr, {event});
+
+  float* other = backend.allocate<float>(256);
+  EXPECT_NE(ptr, other);
+
+  release.set_value();
+  event.wait_and_throw();
+  float* reused = backend.allocate<float>(256);
+  EXPECT_EQ(ptr, reused);
+
+  backend.deallocate(other);
+  backend.deallocate(reused);
+}
+TEST_F(USMMemoryPoolTest, TrimFreesRetainedBlocks) {
+  auto& backend = this->provider_.get_backend();
+  float* small = backend.allocate<float>(16);
+  float* large = backend.allocate<float>(1 << 16);
+  backend.deallocate(small);
+  backend.deallocate(large);
+  EXPECT_LT(0u, backend.get_memory_pool_stats().bytes_retained);
+
+  size_t const retained = backend.get_memory_pool_stats().bytes_retained;
+  EXPECT_EQ(retained, backend.trim_memory_pool());
+
+  auto stats = backend.get_memory_pool_stats();
+  EXPECT_EQ(0u, stats.bytes_retained);
+  EXPECT_EQ(0u, stats.bytes_in_use);
+  EXPECT_EQ(2u, stats.device_frees);
+}
+TEST_F(USMMemoryPoolTest, RetainedBytesAreCapped) {
+  size_t const max_retained_bytes = 4096;
+  sycldnn::backend::SNNUSMBackend backend{
+      this->provider_.get_backend().get_queue(), max_retained_bytes};
+  float* first = backend.allocate<float>(1024);
+  float* second = backend.allocate<float>(1024);
+  float* third = backend.allocate<float>(1024);
+  backend.deallocate(first);
+  backend.deallocate(second);
+  backend.deallocate(third);
+
+  auto stats = backend.get_memory_pool_stats();
+  // Each release over the cap frees an older cached block.
+  EXPECT_EQ(max_retained_bytes, stats.bytes_retained);
+  EXPECT_EQ(2u, stats.device_frees);
+  EXPECT_EQ(3 * max_retained_bytes, stats.peak_bytes);
+
+  backend.set_memory_pool_limit(0);
+  EXPECT_EQ(0u, backend.get_memory_pool_stats().bytes_retained);
+}
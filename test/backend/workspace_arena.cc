@@ -0,0 +1,145 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "sycldnn/backend/snn_usm_backend.h"
+#include "sycldnn/backend/workspace_arena.h"
+
+#include "test/backend/backend_test_fixture.h"
+
+#include <future>
+
+#include <CL/sycl.hpp>
+
+using WorkspaceArenaTest = BackendTestFixture<sycldnn::backend::SNNUSMBackend>;
+using sycldnn::backend::WorkspaceArena;
+
+TEST_F(WorkspaceArenaTest, ReusesBlockOnceIdle) {
+  auto& arena = this->provider_.get_backend().get_workspace_arena();
+  auto first = arena.borrow(1000, "op");
+  ASSERT_NE(nullptr, first.ptr);
+  EXPECT_FALSE(first.pooled);
+  arena.give_back(first, {});
+
+  auto second = arena.borrow(1000, "op");
+  EXPECT_EQ(first.ptr, second.ptr);
+  arena.give_back(second, {});
+
+  auto stats = arena.stats();
+  EXPECT_EQ(1u, stats.grows);
+  EXPECT_EQ(2u, stats.arena_borrows);
+  EXPECT_EQ(0u, stats.overflow_borrows);
+  EXPECT_EQ(WorkspaceArena::aligned_size(1000), stats.high_water_bytes);
+}
+TEST_F(WorkspaceArenaTest, ConcurrentBorrowsAreDisjoint) {
+  auto& backend = this->provider_.get_backend();
+  backend.reserve_workspace(4096);
+  auto& arena = backend.get_workspace_arena();
+  auto first = arena.borrow(100, "op");
+  auto second = arena.borrow(100, "op");
+  EXPECT_FALSE(first.pooled);
+  EXPECT_FALSE(second.pooled);
+  EXPECT_EQ(static_cast<char*>(first.ptr) + WorkspaceArena::alignment,
+            static_cast<char*>(second.ptr));
+  arena.give_back(second, {});
+  arena.give_back(first, {});
+}
+TEST_F(WorkspaceArenaTest, GrowsToHighWaterMark) {
+  auto& arena = this->provider_.get_backend().get_workspace_arena();
+  auto first = arena.borrow(1024, "op");
+  // The block only holds the first request, so the second uses the pool.
+  auto second = arena.borrow(2048, "op");
+  EXPECT_FALSE(first.pooled);
+  EXPECT_TRUE(second.pooled);
+  arena.give_back(second, {});
+  arena.give_back(first, {});
+  EXPECT_EQ(3072u, arena.stats().high_water_bytes);
+
+  // Once idle the block grows to hold both requests.
+  first = arena.borrow(1024, "op");
+  second = arena.borrow(2048, "op");
+  EXPECT_FALSE(first.pooled);
+  EXPECT_FALSE(second.pooled);
+  arena.give_back(second, {});
+  arena.give_back(first, {});
+
+  auto stats = arena.stats();
+  EXPECT_EQ(3072u, stats.capacity);
+  EXPECT_EQ(2u, stats.grows);
+  EXPECT_EQ(1u, stats.overflow_borrows);
+}
+TEST_F(WorkspaceArenaTest, LaterBorrowsDependOnReturnedEvents) {
+  auto& backend = this->provider_.get_backend();
+  auto& queue = backend.get_queue();
+  auto& arena = backend.get_workspace_arena();
+  auto first = arena.borrow(512, "op");
+  EXPECT_TRUE(first.dependencies.empty());
+
+  // Hold the region with a host task which does not complete until the
+  // promise is fulfilled.
+  std::promise<void> release;
+  auto released = release.get_future().share();
+  auto event = queue.submit([&](cl::sycl::handler& cgh) {
+    cgh.host_task([=]() { released.wait(); });
+  });
+  arena.give_back(first, {event});
+
+  // The region is handed out again without blocking, along with the event of
+  // the kernel still using it.
+  auto second = arena.borrow(512, "op");
+  EXPECT_EQ(first.ptr, second.ptr);
+  EXPECT_EQ(1u, second.dependencies.size());
+  arena.give_back(second, {});
+
+  release.set_value();
+  event.wait_and_throw();
+  auto third = arena.borrow(512, "op");
+  EXPECT_TRUE(third.dependencies.empty());
+  arena.give_back(third, {});
+}
+TEST_F(WorkspaceArenaTest, RecordsPeakPerOperator) {
+  auto& backend = this->provider_.get_backend();
+  auto& arena = backend.get_workspace_arena();
+  arena.give_back(arena.borrow(100, "first"), {});
+  arena.give_back(arena.borrow(3000, "second"), {});
+  arena.give_back(arena.borrow(700, "first"), {});
+
+  EXPECT_EQ(WorkspaceArena::aligned_size(700), arena.op_peak_bytes("first"));
+  EXPECT_EQ(WorkspaceArena::aligned_size(3000), arena.op_peak_bytes("second"));
+  EXPECT_EQ(0u, arena.op_peak_bytes("third"));
+  EXPECT_EQ(2u, backend.get_workspace_stats().op_peak_bytes.size());
+}
+TEST_F(WorkspaceArenaTest, TrimReleasesIdleBlock) {
+  auto& backend = this->provider_.get_backend();
+  auto& arena = backend.get_workspace_arena();
+  arena.give_back(arena.borrow(4096, "op"), {});
+  ASSERT_EQ(4096u, arena.stats().capacity);
+
+  // The block is kept while scratch memory is borrowed.
+  auto lease = arena.borrow(100, "op");
+  EXPECT_EQ(0u, arena.release());
+  arena.give_back(lease, {});
+
+  backend.trim_memory_pool();
+  auto stats = arena.stats();
+  EXPECT_EQ(0u, stats.capacity);
+  EXPECT_EQ(0u, stats.high_water_bytes);
+  EXPECT_EQ(0u, backend.get_memory_pool_stats().bytes_retained);
+
+  // Later requests grow a block of only the size they need.
+  arena.give_back(arena.borrow(100, "op"), {});
+  EXPECT_EQ(WorkspaceArena::aligned_size(100), arena.stats().capacity);
+}
@@ -0,0 +1,110 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "sycldnn/binaryop/launch.h"
+#include "sycldnn/binaryop/operators.h"
+#include "sycldnn/helpers/scope_exit.h"
+
+#include "test/backend/backend_test_fixture.h"
+#include "test/helpers/float_comparison.h"
+#include "test/types/cartesian_product.h"
+#include "test/types/kernel_data_types.h"
+#include "test/types/test_backend_types.h"
+#include "test/types/to_gtest_types.h"
+
+#include <string>
+#include <vector>
+
+template <typename Pair>
+struct BinaryOpScalarFixture
+    : public BackendTestFixture<typename Pair::SecondType> {
+  using DataType = typename Pair::FirstType;
+  using Backend = typename Pair::SecondType;
+
+ protected:
+  /**
+   * Run a scalar binary op on the values 1, 2, ..., size and check the output
+   * against the same op computed on the host.
+   */
+  template <typename Op, typename HostOp>
+  void run(int size, DataType rhs, HostOp host_op, bool in_place = false) {
+    std::vector<DataType> lhs_data(size);
+    std::vector<DataType> exp(size);
+    for (int i = 0; i < size; ++i) {
+      lhs_data[i] = static_cast<DataType>(i + 1);
+      exp[i] = host_op(lhs_data[i], rhs);
+    }
+    std::vector<DataType> out_data(size, DataType{0});
+
+    auto& provider = this->provider_;
+    auto& backend = provider.get_backend();
+    {
+      auto lhs_gpu = provider.get_initialised_device_memory(size, lhs_data);
+      auto out_gpu = provider.get_initialised_device_memory(size, out_data);
+      SNN_ON_SCOPE_EXIT {
+        provider.deallocate_ptr(lhs_gpu);
+        provider.deallocate_ptr(out_gpu);
+      };
+
+      auto status = sycldnn::binaryop::launch_scalar<DataType, Op>(
+          lhs_gpu, rhs, in_place ? lhs_gpu : out_gpu, size, backend);
+      ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+      status.event.wait_and_throw();
+
+      provider.copy_device_data_to_host(size, in_place ? lhs_gpu : out_gpu,
+                                        out_data);
+    }
+
+    for (int i = 0; i < size; ++i) {
+      SCOPED_TRACE("Element: " + std::to_string(i));
+      SNN_ALMOST_EQUAL(exp[i], out_data[i], 10u);
+    }
+  }
+};
+
+using DataTypeList = sycldnn::types::KernelDataTypes;
+using Backends = sycldnn::types::AllBackendTypes;
+using TypeBackendPairs =
+    sycldnn::types::CartesianProduct<DataTypeList, Backends>::type;
+using GTestTypePairs = sycldnn::types::ToGTestTypes<TypeBackendPairs>::type;
+TYPED_TEST_SUITE(BinaryOpScalarFixture, GTestTypePairs);
+
+TYPED_TEST(BinaryOpScalarFixture, AddSingleElement) {
+  using DataType = typename TestFixture::DataType;
+  this->template run<sycldnn::binaryop::Add>(
+      1, 0.5, [](DataType a, DataType b) { return a + b; });
+}
+TYPED_TEST(BinaryOpScalarFixture, SubOddSize) {
+  using DataType = typename TestFixture::DataType;
+  this->template run<sycldnn::binaryop::Sub>(
+      7, 3, [](DataType a, DataType b) { return a - b; });
+}
+TYPED_TEST(BinaryOpScalarFixture, MulVector2) {
+  using DataType = typename TestFixture::DataType;
+  this->template run<sycldnn::binaryop::Mul>(
+      6, 0.25, [](DataType a, DataType b) { return a * b; });
+}
+TYPED_TEST(BinaryOpScalarFixture, DivVector4) {
+  using DataType = typename TestFixture::DataType;
+  this->template run<sycldnn::binaryop::Div>(
+      12, 4, [](DataType a, DataType b) { return a / b; });
+}
+TYPED_TEST(BinaryOpScalarFixture, MulInPlace) {
+  using DataType = typename TestFixture::DataType;
+  this->template run<sycldnn::binaryop::Mul>(
+      16, 2, [](DataType a, DataType b) { return a * b; }, /*in_place=*/true);
+}
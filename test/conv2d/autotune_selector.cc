@@ -0,0 +1,193 @@
+/*
+ * Copyright Codeplay Software Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use these files except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "sycldnn/conv2d/launch.h"
+#include "sycldnn/conv2d/selector/autotune_selector.h"
+#include "sycldnn/conv2d/sizes.h"
+#include "sycldnn/conv2d/workspace_size.h"
+
+#include "src/backend/snn_backend_provider.h"
+#include "src/backend/snn_usm_backend_provider.h"
+#include "sycldnn/backend/snn_backend.h"
+#include "sycldnn/backend/snn_usm_backend.h"
+#include "test/backend/backend_test_fixture.h"
+
+#include "test/types/test_backend_types.h"
+#include "test/types/to_gtest_types.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+template <typename Backend>
+struct AutotuneSelectorFixture : public BackendTestFixture<Backend> {
+ protected:
+  using Selector = sycldnn::conv2d::AutotuneSelector<Backend, float>;
+
+  sycldnn::conv2d::Conv2DParams get_3x3_params() {
+    sycldnn::conv2d::Conv2DParams params;
+    params.channels = 8;
+    params.features = 8;
+    params.batch = 2;
+    params.in_rows = 16;
+    params.in_cols = 16;
+    params.window_rows = 3;
+    params.window_cols = 3;
+    params.stride_rows = 1;
+    params.stride_cols = 1;
+    params.out_rows = 16;
+    params.out_cols = 16;
+    params.pad_rows = 1;
+    params.pad_cols = 1;
+    params.dilation_rows = 1;
+    params.dilation_cols = 1;
+    return params;
+  }
+
+  template <typename ConvType>
+  void check_conv_launch_successful(sycldnn::conv2d::Conv2DParams const& params,
+                                    Selector& selector) {
+    using HostData = std::vector<float>;
+
+    auto& provider = this->provider_;
+    auto sizes = sycldnn::conv2d::get_sizes<ConvType>(params);
+    auto workspace_size =
+        sycldnn::conv2d::query_workspace_size<ConvType>(params, selector);
+    HostData input(sizes.input_size);
+    HostData filter(sizes.filter_size);
+    HostData output(sizes.output_size);
+
+    auto input_gpu =
+        provider.get_initialised_device_memory(sizes.input_size, input);
+    auto filter_gpu =
+        provider.get_initialised_device_memory(sizes.filter_size, filter);
+    auto output_gpu =
+        provider.get_initialised_device_memory(sizes.output_size, output);
+    auto workspace_gpu = provider.get_backend().template allocate<float>(
+        std::max<size_t>(workspace_size.recommended_size, 1));
+
+    auto status = sycldnn::conv2d::launch<float, ConvType>(
+        input_gpu, filter_gpu, output_gpu, params, selector,
+        provider.get_backend(), workspace_gpu, workspace_size.recommended_size);
+    ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+    status.event.wait_and_throw();
+  }
+};
+
+template <typename Backend>
+using AutotuneSelectorTest = AutotuneSelectorFixture<Backend>;
+
+TYPED_TEST_SUITE(AutotuneSelectorTest,
+                 sycldnn::types::GTestDefaultBackendTypes);
+
+TYPED_TEST(AutotuneSelectorTest, ForwardSelectionIsCached) {
+  using ConvType = sycldnn::conv2d::conv_type::Forward;
+  typename TestFixture::Selector selector{this->provider_.get_backend()};
+  auto params = this->get_3x3_params();
+
+  auto algo = selector.template select<ConvType>(params);
+  EXPECT_NE(sycldnn::conv2d::Algorithm::NotSupported, algo);
+  EXPECT_EQ(1u, selector.n_benchmarked());
+
+  EXPECT_EQ(algo, selector.template select<ConvType>(params));
+  EXPECT_EQ(1u, selector.n_benchmarked());
+
+  this->template check_conv_launch_successful<ConvType>(params, selector);
+  EXPECT_EQ(1u, selector.n_benchmarked());
+}
+
+TYPED_TEST(AutotuneSelectorTest, ConvTypesAreTunedSeparately) {
+  using sycldnn::conv2d::conv_type::FilterBackprop;
+  using sycldnn::conv2d::conv_type::Forward;
+  using sycldnn::conv2d::conv_type::InputBackprop;
+  typename TestFixture::Selector selector{this->provider_.get_backend()};
+  auto params = this->get_3x3_params();
+
+  this->template check_conv_launch_successful<Forward>(params, selector);
+  this->template check_conv_launch_successful<InputBackprop>(params, selector);
+  this->template check_conv_launch_successful<FilterBackprop>(params,
+                                                               selector);
+  EXPECT_EQ(3u, selector.n_benchmarked());
+}
+
+TYPED_TEST(AutotuneSelectorTest, SelectionsArePersisted) {
+  using ConvType = sycldnn::conv2d::conv_type::Forward;
+  std::string cache_file = std::string{"autotune_cache_"} +
+                           TypeParam::name() + ".txt";
+  std::remove(cache_file.c_str());
+  auto params = this->get_3x3_params();
+
+  sycldnn::conv2d::Algorithm tuned_algo;
+  {
+    typename TestFixture::Selector selector{this->provider_.get_backend(),
+                                            cache_file};
+    tuned_algo = selector.template select<ConvType>(params);
+    EXPECT_EQ(1u, selector.n_benchmarked());
+  }
+  {
+    typename TestFixture::Selector selector{this->provider_.get_backend(),
+                                            cache_file};
+    EXPECT_EQ(tuned_algo, selector.template select<ConvType>(params));
+    EXPECT_EQ(0u, selector.n_benchmarked());
+  }
+  std::remove(cache_file.c_str());
+}
+
+TYPED_TEST(AutotuneSelectorTest, InvalidCacheEntriesAreIgnored) {
+  using sycldnn::conv2d::conv_type::FilterBackprop;
+  using sycldnn::conv2d::conv_type::Forward;
+  using sycldnn::conv2d::conv_type::InputBackprop;
+  namespace internal = sycldnn::conv2d::internal;
+  std::string cache_file = std::string{"autotune_invalid_cache_"} +
+                           TypeParam::name() + ".txt";
+  auto params = this->get_3x3_params();
+  auto device = this->provider_.get_backend().get_queue().get_device();
+  auto device_name = device.template get_info<cl::sycl::info::device::name>();
+  auto driver =
+      device.template get_info<cl::sycl::info::device::driver_version>();
+  auto const params_key = internal::params_to_key(params);
+  {
+    std::ofstream file{cache_file};
+    // Algorithm id past the last enumerator.
+    file << device_name << '|' << driver << '|'
+         << internal::conv_type_name<Forward>() << '|' << params_key << ' '
+         << 1000 << '\n';
+    // Tuned on a driver version which has this driver version as a prefix.
+    file << device_name << '|' << driver << "1|"
+         << internal::conv_type_name<InputBackprop>() << '|' << params_key
+         << ' '
+         << static_cast<int>(sycldnn::conv2d::Algorithm::Direct) << '\n';
+    // Algorithm which is not a number.
+    file << device_name << '|' << driver << '|'
+         << internal::conv_type_name<FilterBackprop>() << '|' << params_key
+         << " direct\n";
+  }
+  typename TestFixture::Selector selector{this->provider_.get_backend(),
+                                          cache_file};
+  EXPECT_NE(sycldnn::conv2d::Algorithm::NotSupported,
+            selector.template select<Forward>(params));
+  EXPECT_NE(sycldnn::conv2d::Algorithm::NotSupported,
+            selector.template select<InputBackprop>(params));
+  EXPECT_NE(sycldnn::conv2d::Algorithm::NotSupported,
+            selector.template select<FilterBackprop>(params));
+  EXPECT_EQ(3u, selector.n_benchmarked());
+  std::remove(cache_file.c_str());
+}
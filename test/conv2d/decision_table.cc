@@ -0,0 +1,111 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "src/conv2d/selector/decision_table.h"
+#include "src/helpers/size_bucket.h"
+
+#include "sycldnn/conv2d/algorithm.h"
+#include "sycldnn/conv2d/params.h"
+
+#include <stddef.h>
+
+using sycldnn::conv2d::Algorithm;
+using sycldnn::conv2d::internal::any_bucket;
+using sycldnn::conv2d::internal::DecisionEntry;
+using sycldnn::conv2d::internal::DecisionTable;
+using sycldnn::conv2d::internal::select_from_table;
+using sycldnn::helpers::size_bucket;
+
+namespace {
+
+sycldnn::conv2d::Conv2DParams get_params(int window, int stride,
+                                         int channels, int features,
+                                         int out_size) {
+  sycldnn::conv2d::Conv2DParams params;
+  params.channels = channels;
+  params.features = features;
+  params.batch = 1;
+  params.window_rows = window;
+  params.window_cols = window;
+  params.stride_rows = stride;
+  params.stride_cols = stride;
+  params.out_rows = out_size;
+  params.out_cols = out_size;
+  params.in_rows = out_size * stride;
+  params.in_cols = out_size * stride;
+  return params;
+}
+
+constexpr DecisionEntry test_entries[] = {
+    {1, 1, 6, 8, 11, Algorithm::Matmul},
+    {1, 1, 9, 6, 5, Algorithm::Direct},
+    {3, 1, any_bucket, any_bucket, any_bucket, Algorithm::Winograd},
+};
+constexpr DecisionTable test_table{test_entries, 3};
+
+}  // namespace
+
+TEST(DecisionTableTest, SizeBuckets) {
+  EXPECT_EQ(0, size_bucket(0));
+  EXPECT_EQ(0, size_bucket(1));
+  EXPECT_EQ(1, size_bucket(2));
+  EXPECT_EQ(1, size_bucket(3));
+  EXPECT_EQ(6, size_bucket(64));
+  EXPECT_EQ(6, size_bucket(127));
+  EXPECT_EQ(7, size_bucket(128));
+  EXPECT_EQ(33, size_bucket(size_t{1} << 33));
+}
+
+TEST(DecisionTableTest, EmptyTable) {
+  DecisionTable table{nullptr, 0};
+  EXPECT_EQ(Algorithm::NotSupported,
+            select_from_table(table, get_params(3, 1, 64, 64, 56)));
+}
+
+TEST(DecisionTableTest, MissingWindow) {
+  EXPECT_EQ(Algorithm::NotSupported,
+            select_from_table(test_table, get_params(5, 1, 64, 64, 56)));
+  EXPECT_EQ(Algorithm::NotSupported,
+            select_from_table(test_table, get_params(3, 2, 64, 64, 56)));
+}
+
+TEST(DecisionTableTest, NonSquareWindow) {
+  auto params = get_params(3, 1, 64, 64, 56);
+  params.window_cols = 1;
+  EXPECT_EQ(Algorithm::NotSupported, select_from_table(test_table, params));
+}
+
+TEST(DecisionTableTest, AnyBucketMatchesAllSizes) {
+  EXPECT_EQ(Algorithm::Winograd,
+            select_from_table(test_table, get_params(3, 1, 3, 32, 224)));
+  EXPECT_EQ(Algorithm::Winograd,
+            select_from_table(test_table, get_params(3, 1, 512, 512, 7)));
+}
+
+TEST(DecisionTableTest, ExactBuckets) {
+  EXPECT_EQ(Algorithm::Matmul,
+            select_from_table(test_table, get_params(1, 1, 64, 256, 56)));
+  EXPECT_EQ(Algorithm::Direct,
+            select_from_table(test_table, get_params(1, 1, 512, 64, 7)));
+}
+
+TEST(DecisionTableTest, ClosestBuckets) {
+  EXPECT_EQ(Algorithm::Matmul,
+            select_from_table(test_table, get_params(1, 1, 128, 256, 28)));
+  EXPECT_EQ(Algorithm::Direct,
+            select_from_table(test_table, get_params(1, 1, 1024, 32, 14)));
+}
@@ -96,3 +96,98 @@ TYPED_TEST(DefaultSelectorTest, GetValidSelectionFor5x5s2) {
   params.dilation_cols = 1;
   this->check_conv_launch_successful(params);
 }
+
+TYPED_TEST(DefaultSelectorTest, GetValidSelectionForDilated3x3s1) {
+  sycldnn::conv2d::Conv2DParams params;
+  params.channels = 16;
+  params.features = 16;
+  params.batch = 2;
+  params.in_rows = 32;
+  params.in_cols = 32;
+  params.window_rows = 3;
+  params.window_cols = 3;
+  params.stride_rows = 1;
+  params.stride_cols = 1;
+  params.out_rows = 32;
+  params.out_cols = 32;
+  params.pad_rows = 2;
+  params.pad_cols = 2;
+  params.dilation_rows = 2;
+  params.dilation_cols = 2;
+  this->check_conv_launch_successful(params);
+}
+
+TYPED_TEST(DefaultSelectorTest, GetValidSelectionForDeep3x3s1) {
+  sycldnn::conv2d::Conv2DParams params;
+  params.channels = 64;
+  params.features = 64;
+  params.batch = 2;
+  params.in_rows = 48;
+  params.in_cols = 48;
+  params.window_rows = 3;
+  params.window_cols = 3;
+  params.stride_rows = 1;
+  params.stride_cols = 1;
+  params.out_rows = 48;
+  params.out_cols = 48;
+  params.pad_rows = 1;
+  params.pad_cols = 1;
+  params.dilation_rows = 1;
+  params.dilation_cols = 1;
+  this->check_conv_launch_successful(params);
+}
+
+TYPED_TEST(DefaultSelectorTest, GetValidSelectionForDeep5x5s1) {
+  sycldnn::conv2d::Conv2DParams params;
+  params.channels = 32;
+  params.features = 32;
+  params.batch = 2;
+  params.in_rows = 32;
+  params.in_cols = 32;
+  params.window_rows = 5;
+  params.window_cols = 5;
+  params.stride_rows = 1;
+  params.stride_cols = 1;
+  params.out_rows = 32;
+  params.out_cols = 32;
+  params.pad_rows = 2;
+  params.pad_cols = 2;
+  params.dilation_rows = 1;
+  params.dilation_cols = 1;
+  this->check_conv_launch_successful(params);
+}
+
+TYPED_TEST(DefaultSelectorTest, GroupedNCHWIsNotSupported) {
+  sycldnn::conv2d::Conv2DParams params;
+  params.channels = 8;
+  params.features = 8;
+  params.batch = 2;
+  params.in_rows = 16;
+  params.in_cols = 16;
+  params.window_rows = 3;
+  params.window_cols = 3;
+  params.stride_rows = 1;
+  params.stride_cols = 1;
+  params.out_rows = 16;
+  params.out_cols = 16;
+  params.pad_rows = 1;
+  params.pad_cols = 1;
+  params.dilation_rows = 1;
+  params.dilation_cols = 1;
+  params.groups = 2;
+  params.input_format = sycldnn::DataFormat::NCHW;
+  params.filter_format = sycldnn::FilterFormat::FCHW;
+
+  using sycldnn::conv2d::conv_type::FilterBackprop;
+  using sycldnn::conv2d::conv_type::Forward;
+  using sycldnn::conv2d::conv_type::InputBackprop;
+  auto device = this->provider_.get_backend().get_queue().get_device();
+  auto selector = sycldnn::conv2d::get_default_selector(device);
+  ASSERT_TRUE(nullptr != selector);
+  EXPECT_EQ(sycldnn::conv2d::Algorithm::NotSupported,
+            selector->template select<Forward>(params));
+  EXPECT_EQ(sycldnn::conv2d::Algorithm::NotSupported,
+            selector->template select<InputBackprop>(params));
+  EXPECT_EQ(sycldnn::conv2d::Algorithm::NotSupported,
+            selector->template select<FilterBackprop>(params));
+}
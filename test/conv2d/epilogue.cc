@@ -0,0 +1,325 @@
+/*
+ * Copyright Codeplay Software Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use these files except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "sycldnn/conv2d/epilogue.h"
+#include "sycldnn/conv2d/launch.h"
+#include "sycldnn/conv2d/selector/direct_selector.h"
+#include "sycldnn/conv2d/selector/im2col_selector.h"
+#include "sycldnn/conv2d/selector/implicit_gemm_selector.h"
+#include "sycldnn/conv2d/selector/matmul_selector.h"
+#include "sycldnn/conv2d/selector/tiled_selector.h"
+#include "sycldnn/conv2d/selector/winograd_selector.h"
+#include "sycldnn/conv2d/sizes.h"
+#include "sycldnn/conv2d/workspace_size.h"
+
+#include "src/backend/snn_backend_provider.h"
+#include "src/backend/snn_usm_backend_provider.h"
+#include "sycldnn/backend/snn_backend.h"
+#include "sycldnn/backend/snn_usm_backend.h"
+#include "test/backend/backend_test_fixture.h"
+
+#include "test/types/test_backend_types.h"
+#include "test/types/to_gtest_types.h"
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+namespace {
+
+using HostData = std::vector<float>;
+
+/** Naive reference forward convolution for NHWC tensors and HWCF filters. */
+HostData reference_conv(sycldnn::conv2d::Conv2DParams const& p,
+                        HostData const& input, HostData const& filter,
+                        size_t output_size) {
+  HostData output(output_size, 0.f);
+  for (int b = 0; b < p.batch; ++b) {
+    for (int o_r = 0; o_r < p.out_rows; ++o_r) {
+      for (int o_c = 0; o_c < p.out_cols; ++o_c) {
+        for (int k_r = 0; k_r < p.window_rows; ++k_r) {
+          int const i_r = o_r * p.stride_rows - p.pad_rows + k_r;
+          if (i_r < 0 || i_r >= p.in_rows) {
+            continue;
+          }
+          for (int k_c = 0; k_c < p.window_cols; ++k_c) {
+            int const i_c = o_c * p.stride_cols - p.pad_cols + k_c;
+            if (i_c < 0 || i_c >= p.in_cols) {
+              continue;
+            }
+            for (int c = 0; c < p.channels; ++c) {
+              for (int f = 0; f < p.features; ++f) {
+                int const x_idx =
+                    ((b * p.in_rows + i_r) * p.in_cols + i_c) * p.channels + c;
+                int const w_idx =
+                    ((k_r * p.window_cols + k_c) * p.channels + c) *
+                        p.features +
+                    f;
+                int const y_idx =
+                    ((b * p.out_rows + o_r) * p.out_cols + o_c) * p.features +
+                    f;
+                output[y_idx] += input[x_idx] * filter[w_idx];
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+  return output;
+}
+
+/** Host side epilogue, matching the formula documented in EpilogueParams. */
+HostData reference_epilogue(HostData const& conv, HostData const& bias,
+                            HostData const& scale, HostData const& shift,
+                            HostData const& residual,
+                            sycldnn::conv2d::Activation activation,
+                            int features) {
+  HostData output(conv.size());
+  for (size_t i = 0; i < conv.size(); ++i) {
+    size_t const f = i % features;
+    float val = (conv[i] + bias[f]) * scale[f] + shift[f] + residual[i];
+    switch (activation) {
+      case sycldnn::conv2d::Activation::Relu:
+        val = std::max(val, 0.f);
+        break;
+      case sycldnn::conv2d::Activation::Tanh:
+        val = std::tanh(val);
+        break;
+      case sycldnn::conv2d::Activation::None:
+        break;
+    }
+    output[i] = val;
+  }
+  return output;
+}
+
+/**
+ * Launch a convolution with an epilogue. The USM launcher takes the events to
+ * wait on before the epilogue, while the buffer launcher does not.
+ */
+template <typename ConvType, typename Backend>
+sycldnn::SNNStatus launch_with_epilogue(
+    typename Backend::template pointer_type<float const> input,
+    typename Backend::template pointer_type<float const> filter,
+    typename Backend::template pointer_type<float> output,
+    sycldnn::conv2d::Conv2DParams const& params,
+    sycldnn::conv2d::Selector& selector, Backend& backend,
+    typename Backend::template pointer_type<float> workspace,
+    size_t workspace_size,
+    sycldnn::conv2d::Epilogue<float, Backend> const& epilogue) {
+  if constexpr (sycldnn::backend::is_usm_backend_v<Backend>) {
+    return sycldnn::conv2d::launch<float, ConvType>(
+        input, filter, output, params, selector, backend, workspace,
+        workspace_size, {}, epilogue);
+  } else {
+    return sycldnn::conv2d::launch<float, ConvType>(
+        input, filter, output, params, selector, backend, workspace,
+        workspace_size, epilogue);
+  }
+}
+
+}  // namespace
+
+template <typename Backend>
+struct ConvEpilogueFixture : public BackendTestFixture<Backend> {
+ protected:
+  sycldnn::conv2d::Conv2DParams get_params(int window) {
+    sycldnn::conv2d::Conv2DParams params;
+    params.channels = 4;
+    params.features = 8;
+    params.batch = 2;
+    params.in_rows = 11;
+    params.in_cols = 10;
+    params.window_rows = window;
+    params.window_cols = window;
+    params.stride_rows = 1;
+    params.stride_cols = 1;
+    params.pad_rows = window / 2;
+    params.pad_cols = window / 2;
+    params.out_rows = params.in_rows;
+    params.out_cols = params.in_cols;
+    return params;
+  }
+
+  HostData iota_data(size_t size, int max_val) {
+    HostData data(size);
+    for (size_t i = 0; i < size; ++i) {
+      data[i] = static_cast<float>(static_cast<int>(i % max_val) - max_val / 2);
+    }
+    return data;
+  }
+
+  void check_matches_reference(sycldnn::conv2d::Conv2DParams const& params,
+                               sycldnn::conv2d::Selector& selector,
+                               sycldnn::conv2d::Activation activation) {
+    using Forward = sycldnn::conv2d::conv_type::Forward;
+    auto& provider = this->provider_;
+    auto& backend = provider.get_backend();
+    auto sizes = sycldnn::conv2d::get_sizes<Forward>(params);
+    size_t const n_features = params.features;
+
+    HostData input = iota_data(sizes.input_size, 7);
+    HostData filter = iota_data(sizes.filter_size, 5);
+    HostData bias = iota_data(n_features, 3);
+    HostData scale(n_features);
+    for (size_t i = 0; i < n_features; ++i) {
+      scale[i] = 0.5f + 0.25f * static_cast<float>(i % 4);
+    }
+    HostData shift = iota_data(n_features, 4);
+    HostData residual = iota_data(sizes.output_size, 9);
+    HostData output(sizes.output_size, 0.f);
+    HostData expected = reference_epilogue(
+        reference_conv(params, input, filter, sizes.output_size), bias, scale,
+        shift, residual, activation, params.features);
+
+    auto workspace_size =
+        sycldnn::conv2d::query_workspace_size<Forward>(params, selector);
+    size_t const workspace_alloc =
+        std::max<size_t>(workspace_size.recommended_size, 1);
+
+    auto input_gpu =
+        provider.get_initialised_device_memory(sizes.input_size, input);
+    auto filter_gpu =
+        provider.get_initialised_device_memory(sizes.filter_size, filter);
+    auto output_gpu =
+        provider.get_initialised_device_memory(sizes.output_size, output);
+    auto workspace_gpu = provider.get_initialised_device_memory(
+        workspace_alloc, HostData(workspace_alloc));
+    auto bias_gpu = provider.get_initialised_device_memory(n_features, bias);
+    auto scale_gpu = provider.get_initialised_device_memory(n_features, scale);
+    auto shift_gpu = provider.get_initialised_device_memory(n_features, shift);
+    auto residual_gpu =
+        provider.get_initialised_device_memory(sizes.output_size, residual);
+
+    sycldnn::conv2d::Epilogue<float, Backend> epilogue;
+    epilogue.bias = bias_gpu;
+    epilogue.scale = scale_gpu;
+    epilogue.shift = shift_gpu;
+    epilogue.residual = residual_gpu;
+    epilogue.activation = activation;
+
+    auto status = launch_with_epilogue<Forward>(
+        input_gpu, filter_gpu, output_gpu, params, selector, backend,
+        workspace_gpu, workspace_size.recommended_size, epilogue);
+    ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+    status.event.wait_and_throw();
+
+    provider.copy_device_data_to_host(sizes.output_size, output_gpu, output);
+    for (size_t i = 0; i < sizes.output_size; ++i) {
+      SCOPED_TRACE("Element: " + std::to_string(i));
+      EXPECT_FLOAT_EQ(expected[i], output[i]);
+    }
+
+    provider.deallocate_ptr(input_gpu);
+    provider.deallocate_ptr(filter_gpu);
+    provider.deallocate_ptr(output_gpu);
+    provider.deallocate_ptr(workspace_gpu);
+    provider.deallocate_ptr(bias_gpu);
+    provider.deallocate_ptr(scale_gpu);
+    provider.deallocate_ptr(shift_gpu);
+    provider.deallocate_ptr(residual_gpu);
+  }
+};
+
+template <typename Backend>
+using ConvEpilogueTest = ConvEpilogueFixture<Backend>;
+
+TYPED_TEST_SUITE(ConvEpilogueTest, sycldnn::types::GTestDefaultBackendTypes);
+
+using sycldnn::conv2d::Activation;
+
+TYPED_TEST(ConvEpilogueTest, Direct) {
+  sycldnn::conv2d::DirectSelector selector{};
+  this->check_matches_reference(this->get_params(3), selector,
+                                Activation::Relu);
+  this->check_matches_reference(this->get_params(3), selector,
+                                Activation::None);
+}
+
+TYPED_TEST(ConvEpilogueTest, Tiled) {
+  sycldnn::conv2d::TiledSelector selector{};
+  this->check_matches_reference(this->get_params(3), selector,
+                                Activation::Relu);
+  this->check_matches_reference(this->get_params(1), selector,
+                                Activation::None);
+}
+
+TYPED_TEST(ConvEpilogueTest, TiledLocal) {
+  sycldnn::conv2d::TiledLocalSelector selector{};
+  this->check_matches_reference(this->get_params(3), selector,
+                                Activation::Relu);
+}
+
+TYPED_TEST(ConvEpilogueTest, ImplicitGemm) {
+  sycldnn::conv2d::ImplicitGemmSelector selector{};
+  this->check_matches_reference(this->get_params(3), selector,
+                                Activation::Relu);
+  this->check_matches_reference(this->get_params(1), selector,
+                                Activation::None);
+}
+
+TYPED_TEST(ConvEpilogueTest, Winograd) {
+  sycldnn::conv2d::WinogradSelector selector{};
+  this->check_matches_reference(this->get_params(3), selector,
+                                Activation::Relu);
+  this->check_matches_reference(this->get_params(3), selector,
+                                Activation::None);
+}
+
+TYPED_TEST(ConvEpilogueTest, Im2col) {
+  sycldnn::conv2d::Im2colSelector selector{};
+  this->check_matches_reference(this->get_params(3), selector,
+                                Activation::Relu);
+}
+
+TYPED_TEST(ConvEpilogueTest, Matmul) {
+  sycldnn::conv2d::MatmulSelector selector{};
+  this->check_matches_reference(this->get_params(1), selector,
+                                Activation::Relu);
+}
+
+TYPED_TEST(ConvEpilogueTest, RejectsBackprop) {
+  using InputBackprop = sycldnn::conv2d::conv_type::InputBackprop;
+  auto& provider = this->provider_;
+  auto& backend = provider.get_backend();
+  auto params = this->get_params(3);
+  auto sizes = sycldnn::conv2d::get_sizes<InputBackprop>(params);
+
+  auto input_gpu = provider.get_initialised_device_memory(
+      sizes.input_size, HostData(sizes.input_size));
+  auto filter_gpu = provider.get_initialised_device_memory(
+      sizes.filter_size, HostData(sizes.filter_size));
+  auto output_gpu = provider.get_initialised_device_memory(
+      sizes.output_size, HostData(sizes.output_size));
+
+  sycldnn::conv2d::Epilogue<float, TypeParam> epilogue;
+  epilogue.activation = Activation::Relu;
+
+  sycldnn::conv2d::DirectSelector selector{};
+  auto status = launch_with_epilogue<InputBackprop>(
+      input_gpu, filter_gpu, output_gpu, params, selector, backend, output_gpu,
+      0, epilogue);
+  EXPECT_EQ(sycldnn::StatusCode::InvalidParameter, status.status);
+
+  provider.deallocate_ptr(input_gpu);
+  provider.deallocate_ptr(filter_gpu);
+  provider.deallocate_ptr(output_gpu);
+}
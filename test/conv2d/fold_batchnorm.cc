@@ -0,0 +1,282 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "sycldnn/conv2d/fold_batchnorm.h"
+#include "sycldnn/conv2d/params.h"
+#include "sycldnn/conv2d/sizes.h"
+#include "sycldnn/depthwise_conv2d/fold_batchnorm.h"
+#include "sycldnn/depthwise_conv2d/params.h"
+
+#include "src/backend/snn_backend_provider.h"
+#include "src/backend/snn_usm_backend_provider.h"
+#include "sycldnn/backend/snn_backend.h"
+#include "sycldnn/backend/snn_usm_backend.h"
+#include "test/backend/backend_test_fixture.h"
+
+#include "test/types/test_backend_types.h"
+#include "test/types/to_gtest_types.h"
+
+#include <algorithm>
+#include <cmath>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+namespace {
+
+using HostData = std::vector<float>;
+
+/** Folded filter and bias computed on the host. */
+struct Folded {
+  HostData filter;
+  HostData bias;
+};
+
+/**
+ * Reference batchnorm folding, where the feature of filter element i is
+ * (i / inner_size) % features.
+ */
+Folded reference_fold(HostData const& filter, HostData const& bias,
+                      HostData const& gamma, HostData const& beta,
+                      HostData const& mean, HostData const& variance,
+                      size_t features, size_t inner_size, float epsilon) {
+  HostData scale(features);
+  for (size_t f = 0; f < features; ++f) {
+    scale[f] = gamma[f] / std::sqrt(variance[f] + epsilon);
+  }
+  Folded folded{HostData(filter.size()), HostData(features)};
+  for (size_t i = 0; i < filter.size(); ++i) {
+    folded.filter[i] = filter[i] * scale[(i / inner_size) % features];
+  }
+  for (size_t f = 0; f < features; ++f) {
+    float const b = bias.empty() ? 0.f : bias[f];
+    folded.bias[f] = (b - mean[f]) * scale[f] + beta[f];
+  }
+  return folded;
+}
+
+HostData iota_data(size_t size, int max_val, float offset = 0.f) {
+  HostData data(size);
+  for (size_t i = 0; i < size; ++i) {
+    data[i] = static_cast<float>(static_cast<int>(i % max_val) - max_val / 2) +
+              offset;
+  }
+  return data;
+}
+
+void expect_all_near(HostData const& expected, HostData const& actual) {
+  ASSERT_EQ(expected.size(), actual.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    SCOPED_TRACE("Element: " + std::to_string(i));
+    float const tol = 1e-5f * std::max(1.f, std::abs(expected[i]));
+    EXPECT_NEAR(expected[i], actual[i], tol);
+  }
+}
+
+sycldnn::conv2d::Conv2DParams get_conv_params(
+    sycldnn::FilterFormat filter_format) {
+  sycldnn::conv2d::Conv2DParams params;
+  params.channels = 5;
+  params.features = 6;
+  params.batch = 1;
+  params.in_rows = 8;
+  params.in_cols = 8;
+  params.window_rows = 3;
+  params.window_cols = 3;
+  params.stride_rows = 1;
+  params.stride_cols = 1;
+  params.out_rows = 8;
+  params.out_cols = 8;
+  params.pad_rows = 1;
+  params.pad_cols = 1;
+  params.dilation_rows = 1;
+  params.dilation_cols = 1;
+  params.filter_format = filter_format;
+  return params;
+}
+
+sycldnn::depthwise_conv2d::DepthwiseConv2DParams get_depthwise_params() {
+  sycldnn::depthwise_conv2d::DepthwiseConv2DParams params;
+  params.channels = 5;
+  params.channel_multiplier = 2;
+  params.batch = 1;
+  params.in_rows = 8;
+  params.in_cols = 8;
+  params.window_rows = 3;
+  params.window_cols = 3;
+  params.stride_rows = 1;
+  params.stride_cols = 1;
+  params.out_rows = 8;
+  params.out_cols = 8;
+  params.pad_rows = 1;
+  params.pad_cols = 1;
+  return params;
+}
+
+}  // namespace
+
+template <typename Backend>
+struct FoldBatchNormFixture : public BackendTestFixture<Backend> {
+ protected:
+  /**
+   * Fold a batchnorm with the given number of features into a filter with
+   * the given size and layout, and check the results against the host
+   * reference. The fold function is passed the device pointers and returns
+   * the launch status.
+   */
+  template <typename FoldFunc>
+  void check_fold(size_t filter_size, size_t features, size_t inner_size,
+                  bool has_bias, float epsilon, FoldFunc&& fold) {
+    auto& provider = this->provider_;
+
+    HostData filter = iota_data(filter_size, 9);
+    HostData bias = has_bias ? iota_data(features, 5) : HostData{};
+    HostData gamma = iota_data(features, 7, 0.5f);
+    HostData beta = iota_data(features, 3);
+    HostData mean = iota_data(features, 4, 0.25f);
+    HostData variance = iota_data(features, 6, 4.f);
+    Folded expected = reference_fold(filter, bias, gamma, beta, mean,
+                                     variance, features, inner_size, epsilon);
+
+    HostData folded_filter(filter_size, 0.f);
+    HostData folded_bias(features, 0.f);
+
+    auto filter_gpu =
+        provider.get_initialised_device_memory(filter_size, filter);
+    auto bias_gpu = provider.get_initialised_device_memory(
+        features, has_bias ? bias : HostData(features));
+    auto gamma_gpu = provider.get_initialised_device_memory(features, gamma);
+    auto beta_gpu = provider.get_initialised_device_memory(features, beta);
+    auto mean_gpu = provider.get_initialised_device_memory(features, mean);
+    auto variance_gpu =
+        provider.get_initialised_device_memory(features, variance);
+    auto folded_filter_gpu =
+        provider.get_initialised_device_memory(filter_size, folded_filter);
+    auto folded_bias_gpu =
+        provider.get_initialised_device_memory(features, folded_bias);
+
+    using ConstPointer =
+        typename Backend::template pointer_type<float const>;
+    std::optional<ConstPointer> maybe_bias;
+    if (has_bias) {
+      maybe_bias = bias_gpu;
+    }
+    auto status = fold(filter_gpu, maybe_bias, gamma_gpu, beta_gpu, mean_gpu,
+                       variance_gpu, folded_filter_gpu, folded_bias_gpu);
+    ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+    status.event.wait_and_throw();
+
+    provider.copy_device_data_to_host(filter_size, folded_filter_gpu,
+                                      folded_filter);
+    provider.copy_device_data_to_host(features, folded_bias_gpu, folded_bias);
+    {
+      SCOPED_TRACE("Folded filter");
+      expect_all_near(expected.filter, folded_filter);
+    }
+    {
+      SCOPED_TRACE("Folded bias");
+      expect_all_near(expected.bias, folded_bias);
+    }
+
+    provider.deallocate_ptr(filter_gpu);
+    provider.deallocate_ptr(bias_gpu);
+    provider.deallocate_ptr(gamma_gpu);
+    provider.deallocate_ptr(beta_gpu);
+    provider.deallocate_ptr(mean_gpu);
+    provider.deallocate_ptr(variance_gpu);
+    provider.deallocate_ptr(folded_filter_gpu);
+    provider.deallocate_ptr(folded_bias_gpu);
+  }
+
+  /** Check folding into a standard convolution with the given params. */
+  void check_conv_fold(sycldnn::conv2d::Conv2DParams const& params,
+                       size_t inner_size, bool has_bias) {
+    float const epsilon = 1e-3f;
+    auto& backend = this->provider_.get_backend();
+    auto sizes =
+        sycldnn::conv2d::get_sizes<sycldnn::conv2d::conv_type::Forward>(
+            params);
+    this->check_fold(
+        sizes.filter_size, params.features, inner_size, has_bias, epsilon,
+        [&](auto filter, auto bias, auto gamma, auto beta, auto mean,
+            auto variance, auto folded_filter, auto folded_bias) {
+          return sycldnn::conv2d::fold_batchnorm<float>(
+              filter, bias, gamma, beta, mean, variance, folded_filter,
+              folded_bias, params, epsilon, backend);
+        });
+  }
+};
+
+template <typename Backend>
+using FoldBatchNormTest = FoldBatchNormFixture<Backend>;
+
+TYPED_TEST_SUITE(FoldBatchNormTest, sycldnn::types::GTestDefaultBackendTypes);
+
+TYPED_TEST(FoldBatchNormTest, HWCFWithBias) {
+  auto params = get_conv_params(sycldnn::FilterFormat::HWCF);
+  this->check_conv_fold(params, 1, true);
+}
+
+TYPED_TEST(FoldBatchNormTest, HWCFWithoutBias) {
+  auto params = get_conv_params(sycldnn::FilterFormat::HWCF);
+  this->check_conv_fold(params, 1, false);
+}
+
+TYPED_TEST(FoldBatchNormTest, GroupedHWCF) {
+  auto params = get_conv_params(sycldnn::FilterFormat::HWCF);
+  params.channels = 4;
+  params.groups = 2;
+  this->check_conv_fold(params, 1, true);
+}
+
+TYPED_TEST(FoldBatchNormTest, FHWCWithBias) {
+  auto params = get_conv_params(sycldnn::FilterFormat::FHWC);
+  size_t const inner_size =
+      params.window_rows * params.window_cols * params.channels;
+  this->check_conv_fold(params, inner_size, true);
+}
+
+TYPED_TEST(FoldBatchNormTest, Depthwise) {
+  using Backend = TypeParam;
+  float const epsilon = 1e-5f;
+  auto params = get_depthwise_params();
+  auto& backend = this->provider_.get_backend();
+  size_t const features = params.channels * params.channel_multiplier;
+  size_t const filter_size =
+      params.window_rows * params.window_cols * features;
+  this->check_fold(
+      filter_size, features, 1, true, epsilon,
+      [&](auto filter, auto bias, auto gamma, auto beta, auto mean,
+          auto variance, auto folded_filter, auto folded_bias) {
+        return sycldnn::depthwise_conv2d::fold_batchnorm<float, Backend>(
+            filter, bias, gamma, beta, mean, variance, folded_filter,
+            folded_bias, params, epsilon, backend);
+      });
+}
+
+TYPED_TEST(FoldBatchNormTest, RejectsNegativeEpsilon) {
+  using Backend = TypeParam;
+  auto params = get_conv_params(sycldnn::FilterFormat::HWCF);
+  auto& backend = this->provider_.get_backend();
+  typename Backend::template pointer_type<float> null_ptr{};
+  auto status = sycldnn::conv2d::fold_batchnorm<float>(
+      null_ptr, std::nullopt, null_ptr, null_ptr, null_ptr, null_ptr,
+      null_ptr, null_ptr, params, -1.f, backend);
+  EXPECT_EQ(sycldnn::StatusCode::InvalidParameter, status.status);
+}
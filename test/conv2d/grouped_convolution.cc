@@ -0,0 +1,266 @@
+/*
+ * Copyright Codeplay Software Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use these files except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "sycldnn/conv2d/launch.h"
+#include "sycldnn/conv2d/selector/constant_selector.h"
+#include "sycldnn/conv2d/selector/default_selector.h"
+#include "sycldnn/conv2d/selector/direct_selector.h"
+#include "sycldnn/conv2d/selector/im2col_selector.h"
+#include "sycldnn/conv2d/selector/tiled_selector.h"
+#include "sycldnn/conv2d/sizes.h"
+#include "sycldnn/conv2d/workspace_size.h"
+
+#include "sycldnn/backend/backend_helpers.h"
+
+#include "src/backend/snn_backend_provider.h"
+#include "src/backend/snn_usm_backend_provider.h"
+#include "sycldnn/backend/snn_backend.h"
+#include "sycldnn/backend/snn_usm_backend.h"
+#include "test/backend/backend_test_fixture.h"
+#include "test/conv2d/reference_conv.h"
+
+#include "test/types/test_backend_types.h"
+#include "test/types/to_gtest_types.h"
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+namespace {
+
+using HostData = std::vector<float>;
+
+using sycldnn::conv2d::conv_type::FilterBackprop;
+using sycldnn::conv2d::conv_type::Forward;
+using sycldnn::conv2d::conv_type::InputBackprop;
+
+}  // namespace
+
+template <typename Backend>
+struct GroupedConvolutionFixture : public BackendTestFixture<Backend> {
+ protected:
+  /** Get parameters for an NHWC group convolution with a square window. */
+  sycldnn::conv2d::Conv2DParams get_params(int channels, int features,
+                                           int groups, int window, int stride,
+                                           sycldnn::BatchFormat group_format) {
+    sycldnn::conv2d::Conv2DParams params;
+    params.channels = channels;
+    params.features = features;
+    params.groups = groups;
+    params.group_format = group_format;
+    params.batch = 2;
+    params.in_rows = 7;
+    params.in_cols = 6;
+    params.window_rows = window;
+    params.window_cols = window;
+    params.stride_rows = stride;
+    params.stride_cols = stride;
+    params.pad_rows = window / 2;
+    params.pad_cols = window / 2;
+    params.out_rows =
+        (params.in_rows + 2 * params.pad_rows - window) / stride + 1;
+    params.out_cols =
+        (params.in_cols + 2 * params.pad_cols - window) / stride + 1;
+    params.input_format = sycldnn::DataFormat::NHWC;
+    params.filter_format = sycldnn::FilterFormat::HWCF;
+    return params;
+  }
+
+  HostData iota_data(size_t size, int max_val) {
+    HostData data(size);
+    for (size_t i = 0; i < size; ++i) {
+      data[i] = static_cast<float>(static_cast<int>(i % max_val) - max_val / 2);
+    }
+    return data;
+  }
+
+  /**
+   * Run a group convolution with the given selector, and check that the result
+   * matches the reference. Returns without checking if the selected algorithm
+   * needs an interleaved batched matmul which the backend does not provide.
+   */
+  template <typename ConvType>
+  void check_matches_reference(sycldnn::conv2d::Conv2DParams const& params,
+                               sycldnn::conv2d::Selector& selector) {
+    if (params.group_format == sycldnn::BatchFormat::INTERLEAVED &&
+        selector.select<ConvType>(params) ==
+            sycldnn::conv2d::Algorithm::Im2col &&
+        !sycldnn::backend::supports_interleaved_matmul<Backend>::value) {
+      return;
+    }
+    auto& provider = this->provider_;
+    auto& backend = provider.get_backend();
+    auto sizes = sycldnn::conv2d::get_sizes<ConvType>(params);
+
+    HostData input = iota_data(sizes.input_size, 7);
+    HostData filter = iota_data(sizes.filter_size, 5);
+    HostData output(sizes.output_size, 0.f);
+    HostData expected = reference_conv<ConvType>(params, input, filter,
+                                                 sizes.output_size);
+
+    auto workspace_size =
+        sycldnn::conv2d::query_workspace_size<ConvType>(params, selector);
+    size_t const workspace_alloc =
+        std::max<size_t>(workspace_size.recommended_size, 1);
+
+    auto input_gpu =
+        provider.get_initialised_device_memory(sizes.input_size, input);
+    auto filter_gpu =
+        provider.get_initialised_device_memory(sizes.filter_size, filter);
+    auto output_gpu =
+        provider.get_initialised_device_memory(sizes.output_size, output);
+    auto workspace_gpu = provider.get_initialised_device_memory(
+        workspace_alloc, HostData(workspace_alloc));
+
+    auto status = sycldnn::conv2d::launch<float, ConvType>(
+        input_gpu, filter_gpu, output_gpu, params, selector, backend,
+        workspace_gpu, workspace_size.recommended_size);
+    ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+    status.event.wait_and_throw();
+
+    provider.copy_device_data_to_host(sizes.output_size, output_gpu, output);
+    for (size_t i = 0; i < sizes.output_size; ++i) {
+      SCOPED_TRACE("Element: " + std::to_string(i));
+      float const abs_tolerance = 1e-5f * std::max(1.f, std::abs(expected[i]));
+      EXPECT_NEAR(expected[i], output[i], abs_tolerance);
+    }
+
+    provider.deallocate_ptr(input_gpu);
+    provider.deallocate_ptr(filter_gpu);
+    provider.deallocate_ptr(output_gpu);
+    provider.deallocate_ptr(workspace_gpu);
+  }
+
+  /**
+   * Check the given pass against the reference for strided and interleaved
+   * groups, depthwise convolutions and a range of windows and strides.
+   */
+  template <typename ConvType>
+  void check_all_shapes(sycldnn::conv2d::Selector& selector) {
+    for (auto format :
+         {sycldnn::BatchFormat::STRIDED, sycldnn::BatchFormat::INTERLEAVED}) {
+      SCOPED_TRACE(format == sycldnn::BatchFormat::STRIDED ? "Strided"
+                                                           : "Interleaved");
+      this->check_matches_reference<ConvType>(
+          this->get_params(6, 4, 2, 3, 1, format), selector);
+      this->check_matches_reference<ConvType>(
+          this->get_params(8, 8, 2, 3, 2, format), selector);
+      this->check_matches_reference<ConvType>(
+          this->get_params(12, 6, 3, 1, 1, format), selector);
+      this->check_matches_reference<ConvType>(
+          this->get_params(4, 4, 4, 3, 1, format), selector);
+      this->check_matches_reference<ConvType>(
+          this->get_params(6, 6, 3, 5, 2, format), selector);
+    }
+  }
+};
+
+template <typename Backend>
+using GroupedConvolutionTest = GroupedConvolutionFixture<Backend>;
+
+TYPED_TEST_SUITE(GroupedConvolutionTest,
+                 sycldnn::types::GTestDefaultBackendTypes);
+
+TYPED_TEST(GroupedConvolutionTest, DirectForward) {
+  sycldnn::conv2d::DirectSelector selector{};
+  this->template check_all_shapes<Forward>(selector);
+}
+
+TYPED_TEST(GroupedConvolutionTest, DirectInputBackprop) {
+  sycldnn::conv2d::DirectSelector selector{};
+  this->template check_all_shapes<InputBackprop>(selector);
+}
+
+TYPED_TEST(GroupedConvolutionTest, DirectFilterBackprop) {
+  sycldnn::conv2d::DirectSelector selector{};
+  this->template check_all_shapes<FilterBackprop>(selector);
+}
+
+TYPED_TEST(GroupedConvolutionTest, TiledForward) {
+  sycldnn::conv2d::TiledSelector selector{};
+  for (auto format :
+       {sycldnn::BatchFormat::STRIDED, sycldnn::BatchFormat::INTERLEAVED}) {
+    this->template check_matches_reference<Forward>(
+        this->get_params(6, 4, 2, 3, 1, format), selector);
+    this->template check_matches_reference<Forward>(
+        this->get_params(8, 8, 2, 3, 2, format), selector);
+    this->template check_matches_reference<Forward>(
+        this->get_params(12, 6, 3, 1, 1, format), selector);
+    this->template check_matches_reference<Forward>(
+        this->get_params(4, 4, 4, 3, 1, format), selector);
+  }
+}
+
+TYPED_TEST(GroupedConvolutionTest, TiledInputBackprop) {
+  sycldnn::conv2d::ConstantSelector<sycldnn::conv2d::Algorithm::Tiled>
+      selector{};
+  for (auto format :
+       {sycldnn::BatchFormat::STRIDED, sycldnn::BatchFormat::INTERLEAVED}) {
+    this->template check_matches_reference<InputBackprop>(
+        this->get_params(6, 4, 2, 3, 1, format), selector);
+    this->template check_matches_reference<InputBackprop>(
+        this->get_params(8, 8, 2, 3, 2, format), selector);
+    this->template check_matches_reference<InputBackprop>(
+        this->get_params(12, 6, 3, 1, 1, format), selector);
+    this->template check_matches_reference<InputBackprop>(
+        this->get_params(4, 4, 4, 3, 1, format), selector);
+  }
+}
+
+TYPED_TEST(GroupedConvolutionTest, TiledFilterBackprop) {
+  sycldnn::conv2d::TiledSelector selector{};
+  this->template check_all_shapes<FilterBackprop>(selector);
+}
+
+TYPED_TEST(GroupedConvolutionTest, Im2colInputBackprop) {
+  sycldnn::conv2d::Im2colSelector selector{};
+  this->template check_all_shapes<InputBackprop>(selector);
+}
+
+TYPED_TEST(GroupedConvolutionTest, Im2colFilterBackpropIsRejected) {
+  sycldnn::conv2d::Im2colSelector selector{};
+  auto params = this->get_params(6, 4, 2, 3, 1, sycldnn::BatchFormat::STRIDED);
+  auto& provider = this->provider_;
+  auto& backend = provider.get_backend();
+  auto sizes = sycldnn::conv2d::get_sizes<FilterBackprop>(params);
+  auto input_gpu = provider.get_initialised_device_memory(
+      sizes.input_size, HostData(sizes.input_size));
+  auto filter_gpu = provider.get_initialised_device_memory(
+      sizes.filter_size, HostData(sizes.filter_size));
+  auto output_gpu = provider.get_initialised_device_memory(
+      sizes.output_size, HostData(sizes.output_size));
+
+  auto status = sycldnn::conv2d::launch<float, FilterBackprop>(
+      input_gpu, filter_gpu, output_gpu, params, selector, backend,
+      output_gpu, 0);
+  EXPECT_EQ(sycldnn::StatusCode::InvalidAlgorithm, status.status);
+
+  provider.deallocate_ptr(input_gpu);
+  provider.deallocate_ptr(filter_gpu);
+  provider.deallocate_ptr(output_gpu);
+}
+
+TYPED_TEST(GroupedConvolutionTest, DefaultSelector) {
+  auto selector = sycldnn::conv2d::get_default_selector(
+      this->provider_.get_backend().get_queue().get_device());
+  this->template check_all_shapes<Forward>(*selector);
+  this->template check_all_shapes<InputBackprop>(*selector);
+  this->template check_all_shapes<FilterBackprop>(*selector);
+}
@@ -0,0 +1,154 @@
+/*
+ * Copyright Codeplay Software Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use these files except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "sycldnn/conv2d/launch.h"
+#include "sycldnn/conv2d/selector/implicit_gemm_selector.h"
+#include "sycldnn/conv2d/sizes.h"
+#include "sycldnn/conv2d/workspace_size.h"
+
+#include "src/backend/snn_backend_provider.h"
+#include "src/backend/snn_usm_backend_provider.h"
+#include "sycldnn/backend/snn_backend.h"
+#include "sycldnn/backend/snn_usm_backend.h"
+#include "test/backend/backend_test_fixture.h"
+#include "test/conv2d/reference_conv.h"
+
+#include "test/types/test_backend_types.h"
+#include "test/types/to_gtest_types.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+namespace {
+
+using HostData = std::vector<float>;
+
+}  // namespace
+
+template <typename Backend>
+struct ImplicitGemmFixture : public BackendTestFixture<Backend> {
+ protected:
+  sycldnn::conv2d::Conv2DParams get_params(int window, int stride, int pad,
+                                           int dilation) {
+    sycldnn::conv2d::Conv2DParams params;
+    params.channels = 7;
+    params.features = 9;
+    params.batch = 3;
+    params.in_rows = 11;
+    params.in_cols = 10;
+    params.window_rows = window;
+    params.window_cols = window;
+    params.stride_rows = stride;
+    params.stride_cols = stride;
+    params.pad_rows = pad;
+    params.pad_cols = pad;
+    params.dilation_rows = dilation;
+    params.dilation_cols = dilation;
+    int const extent = (window - 1) * dilation + 1;
+    params.out_rows =
+        (params.in_rows + 2 * params.pad_rows - extent) / stride + 1;
+    params.out_cols =
+        (params.in_cols + 2 * params.pad_cols - extent) / stride + 1;
+    return params;
+  }
+
+  HostData iota_data(size_t size, int max_val) {
+    HostData data(size);
+    for (size_t i = 0; i < size; ++i) {
+      data[i] = static_cast<float>(static_cast<int>(i % max_val) - max_val / 2);
+    }
+    return data;
+  }
+
+  template <typename ConvType>
+  void check_matches_reference(sycldnn::conv2d::Conv2DParams const& params) {
+    auto& provider = this->provider_;
+    auto& backend = provider.get_backend();
+    auto sizes = sycldnn::conv2d::get_sizes<ConvType>(params);
+    sycldnn::conv2d::ImplicitGemmSelector selector{};
+
+    auto workspace_size =
+        sycldnn::conv2d::query_workspace_size<ConvType>(params, selector);
+    ASSERT_EQ(0u, workspace_size.required_size);
+    ASSERT_EQ(0u, workspace_size.recommended_size);
+
+    HostData input = iota_data(sizes.input_size, 7);
+    HostData filter = iota_data(sizes.filter_size, 5);
+    HostData output(sizes.output_size, 0.f);
+    HostData expected = reference_conv<ConvType>(params, input, filter,
+                                                 sizes.output_size);
+
+    auto input_gpu =
+        provider.get_initialised_device_memory(sizes.input_size, input);
+    auto filter_gpu =
+        provider.get_initialised_device_memory(sizes.filter_size, filter);
+    auto output_gpu =
+        provider.get_initialised_device_memory(sizes.output_size, output);
+    auto workspace_gpu =
+        provider.get_initialised_device_memory(1, HostData(1));
+
+    auto status = sycldnn::conv2d::launch<float, ConvType>(
+        input_gpu, filter_gpu, output_gpu, params, selector, backend,
+        workspace_gpu, 0);
+    ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+    status.event.wait_and_throw();
+
+    provider.copy_device_data_to_host(sizes.output_size, output_gpu, output);
+    for (size_t i = 0; i < sizes.output_size; ++i) {
+      SCOPED_TRACE("Element: " + std::to_string(i));
+      EXPECT_FLOAT_EQ(expected[i], output[i]);
+    }
+
+    provider.deallocate_ptr(input_gpu);
+    provider.deallocate_ptr(filter_gpu);
+    provider.deallocate_ptr(output_gpu);
+    provider.deallocate_ptr(workspace_gpu);
+  }
+
+  template <typename ConvType>
+  void check_all_params() {
+    // Window, stride, padding and dilation.
+    this->template check_matches_reference<ConvType>(get_params(1, 1, 0, 1));
+    this->template check_matches_reference<ConvType>(get_params(3, 1, 1, 1));
+    this->template check_matches_reference<ConvType>(get_params(3, 2, 0, 1));
+    this->template check_matches_reference<ConvType>(get_params(5, 2, 2, 1));
+    this->template check_matches_reference<ConvType>(get_params(4, 3, 1, 1));
+    this->template check_matches_reference<ConvType>(get_params(3, 1, 2, 2));
+    this->template check_matches_reference<ConvType>(get_params(3, 2, 3, 3));
+  }
+};
+
+template <typename Backend>
+using ImplicitGemmTest = ImplicitGemmFixture<Backend>;
+
+TYPED_TEST_SUITE(ImplicitGemmTest, sycldnn::types::GTestDefaultBackendTypes);
+
+TYPED_TEST(ImplicitGemmTest, Forward) {
+  this->template check_all_params<sycldnn::conv2d::conv_type::Forward>();
+}
+
+TYPED_TEST(ImplicitGemmTest, InputBackprop) {
+  this->template check_all_params<sycldnn::conv2d::conv_type::InputBackprop>();
+}
+
+TYPED_TEST(ImplicitGemmTest, FilterBackprop) {
+  this->template check_all_params<
+      sycldnn::conv2d::conv_type::FilterBackprop>();
+}
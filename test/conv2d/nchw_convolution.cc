@@ -0,0 +1,205 @@
+/*
+ * Copyright Codeplay Software Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use these files except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "sycldnn/conv2d/launch.h"
+#include "sycldnn/conv2d/selector/constant_selector.h"
+#include "sycldnn/conv2d/selector/default_selector.h"
+#include "sycldnn/conv2d/selector/im2col_selector.h"
+#include "sycldnn/conv2d/selector/matmul_selector.h"
+#include "sycldnn/conv2d/selector/tiled_selector.h"
+#include "sycldnn/conv2d/selector/winograd_selector.h"
+#include "sycldnn/conv2d/sizes.h"
+#include "sycldnn/conv2d/workspace_size.h"
+
+#include "src/backend/snn_backend_provider.h"
+#include "src/backend/snn_usm_backend_provider.h"
+#include "sycldnn/backend/snn_backend.h"
+#include "sycldnn/backend/snn_usm_backend.h"
+#include "test/backend/backend_test_fixture.h"
+#include "test/conv2d/reference_conv.h"
+
+#include "test/types/test_backend_types.h"
+#include "test/types/to_gtest_types.h"
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+namespace {
+
+using HostData = std::vector<float>;
+
+}  // namespace
+
+template <typename Backend>
+struct NCHWConvolutionFixture : public BackendTestFixture<Backend> {
+ protected:
+  /** Get parameters for an NCHW convolution with a square window. */
+  sycldnn::conv2d::Conv2DParams get_params(int window, int stride,
+                                           int dilation) {
+    sycldnn::conv2d::Conv2DParams params;
+    params.channels = 3;
+    params.features = 5;
+    params.batch = 2;
+    params.in_rows = 9;
+    params.in_cols = 8;
+    params.window_rows = window;
+    params.window_cols = window;
+    params.stride_rows = stride;
+    params.stride_cols = stride;
+    params.pad_rows = dilation * (window / 2);
+    params.pad_cols = dilation * (window / 2);
+    params.dilation_rows = dilation;
+    params.dilation_cols = dilation;
+    int const extent = dilation * (window - 1) + 1;
+    params.out_rows =
+        (params.in_rows + 2 * params.pad_rows - extent) / stride + 1;
+    params.out_cols =
+        (params.in_cols + 2 * params.pad_cols - extent) / stride + 1;
+    params.input_format = sycldnn::DataFormat::NCHW;
+    params.filter_format = sycldnn::FilterFormat::FCHW;
+    return params;
+  }
+
+  HostData iota_data(size_t size, int max_val) {
+    HostData data(size);
+    for (size_t i = 0; i < size; ++i) {
+      data[i] = static_cast<float>(static_cast<int>(i % max_val) - max_val / 2);
+    }
+    return data;
+  }
+
+  /**
+   * Run a forward convolution with the given selector, and check that the
+   * result matches the reference to within the given relative tolerance.
+   */
+  void check_matches_reference(sycldnn::conv2d::Conv2DParams const& params,
+                               sycldnn::conv2d::Selector& selector,
+                               float tolerance) {
+    using sycldnn::conv2d::conv_type::Forward;
+    auto& provider = this->provider_;
+    auto& backend = provider.get_backend();
+    auto sizes = sycldnn::conv2d::get_sizes<Forward>(params);
+
+    HostData input = iota_data(sizes.input_size, 7);
+    HostData filter = iota_data(sizes.filter_size, 5);
+    HostData output(sizes.output_size, 0.f);
+    HostData expected =
+        reference_conv<Forward>(params, input, filter, sizes.output_size);
+
+    auto workspace_size =
+        sycldnn::conv2d::query_workspace_size<Forward>(params, selector);
+    size_t const workspace_alloc =
+        std::max<size_t>(workspace_size.recommended_size, 1);
+
+    auto input_gpu =
+        provider.get_initialised_device_memory(sizes.input_size, input);
+    auto filter_gpu =
+        provider.get_initialised_device_memory(sizes.filter_size, filter);
+    auto output_gpu =
+        provider.get_initialised_device_memory(sizes.output_size, output);
+    auto workspace_gpu = provider.get_initialised_device_memory(
+        workspace_alloc, HostData(workspace_alloc));
+
+    auto status = sycldnn::conv2d::launch<float, Forward>(
+        input_gpu, filter_gpu, output_gpu, params, selector, backend,
+        workspace_gpu, workspace_size.recommended_size);
+    ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+    status.event.wait_and_throw();
+
+    provider.copy_device_data_to_host(sizes.output_size, output_gpu, output);
+    for (size_t i = 0; i < sizes.output_size; ++i) {
+      SCOPED_TRACE("Element: " + std::to_string(i));
+      float const abs_tolerance =
+          tolerance * std::max(1.f, std::abs(expected[i]));
+      EXPECT_NEAR(expected[i], output[i], abs_tolerance);
+    }
+
+    provider.deallocate_ptr(input_gpu);
+    provider.deallocate_ptr(filter_gpu);
+    provider.deallocate_ptr(output_gpu);
+    provider.deallocate_ptr(workspace_gpu);
+  }
+};
+
+template <typename Backend>
+using NCHWConvolutionTest = NCHWConvolutionFixture<Backend>;
+
+TYPED_TEST_SUITE(NCHWConvolutionTest,
+                 sycldnn::types::GTestDefaultBackendTypes);
+
+using sycldnn::conv2d::conv_type::FilterBackprop;
+using sycldnn::conv2d::conv_type::InputBackprop;
+
+TYPED_TEST(NCHWConvolutionTest, Tiled) {
+  sycldnn::conv2d::TiledSelector selector{};
+  this->check_matches_reference(this->get_params(3, 1, 1), selector, 0.f);
+  this->check_matches_reference(this->get_params(3, 2, 1), selector, 0.f);
+  this->check_matches_reference(this->get_params(3, 1, 2), selector, 0.f);
+  this->check_matches_reference(this->get_params(1, 1, 1), selector, 0.f);
+}
+
+TYPED_TEST(NCHWConvolutionTest, Im2col) {
+  sycldnn::conv2d::Im2colSelector selector{};
+  this->check_matches_reference(this->get_params(3, 1, 1), selector, 0.f);
+  this->check_matches_reference(this->get_params(3, 2, 1), selector, 0.f);
+  this->check_matches_reference(this->get_params(3, 1, 2), selector, 0.f);
+  this->check_matches_reference(this->get_params(5, 2, 1), selector, 0.f);
+}
+
+TYPED_TEST(NCHWConvolutionTest, Winograd) {
+  sycldnn::conv2d::WinogradSelector selector{};
+  this->check_matches_reference(this->get_params(3, 1, 1), selector, 1e-4f);
+}
+
+TYPED_TEST(NCHWConvolutionTest, WinogradLarge) {
+  sycldnn::conv2d::ConstantSelector<sycldnn::conv2d::Algorithm::WinogradLarge>
+      selector{};
+  this->check_matches_reference(this->get_params(3, 1, 1), selector, 1e-4f);
+}
+
+TYPED_TEST(NCHWConvolutionTest, Winograd5x5) {
+  sycldnn::conv2d::ConstantSelector<sycldnn::conv2d::Algorithm::Winograd5x5>
+      selector{};
+  this->check_matches_reference(this->get_params(5, 1, 1), selector, 1e-4f);
+}
+
+TYPED_TEST(NCHWConvolutionTest, Matmul) {
+  sycldnn::conv2d::MatmulSelector selector{};
+  this->check_matches_reference(this->get_params(1, 1, 1), selector, 0.f);
+}
+
+TYPED_TEST(NCHWConvolutionTest, DefaultSelector) {
+  auto selector = sycldnn::conv2d::get_default_selector(
+      this->provider_.get_backend().get_queue().get_device());
+  this->check_matches_reference(this->get_params(3, 1, 1), *selector, 1e-4f);
+  this->check_matches_reference(this->get_params(1, 1, 1), *selector, 1e-4f);
+  this->check_matches_reference(this->get_params(3, 2, 1), *selector, 1e-4f);
+}
+
+TYPED_TEST(NCHWConvolutionTest, DefaultSelectorUsesDirectForBackprop) {
+  auto selector = sycldnn::conv2d::get_default_selector(
+      this->provider_.get_backend().get_queue().get_device());
+  auto params = this->get_params(3, 1, 1);
+  EXPECT_EQ(sycldnn::conv2d::Algorithm::Direct,
+            selector->template select<InputBackprop>(params));
+  EXPECT_EQ(sycldnn::conv2d::Algorithm::Direct,
+            selector->template select<FilterBackprop>(params));
+}
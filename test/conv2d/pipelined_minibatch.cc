@@ -0,0 +1,189 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "sycldnn/conv2d/launch.h"
+#include "sycldnn/conv2d/selector/im2col_selector.h"
+#include "sycldnn/conv2d/selector/winograd_selector.h"
+#include "sycldnn/conv2d/sizes.h"
+#include "sycldnn/conv2d/workspace_size.h"
+
+#include "src/backend/snn_backend_provider.h"
+#include "src/backend/snn_usm_backend_provider.h"
+#include "sycldnn/backend/snn_backend.h"
+#include "sycldnn/backend/snn_usm_backend.h"
+#include "test/backend/backend_test_fixture.h"
+#include "test/conv2d/reference_conv.h"
+
+#include "test/types/test_backend_types.h"
+#include "test/types/to_gtest_types.h"
+
+#include <string>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+namespace {
+
+using HostData = std::vector<float>;
+
+}  // namespace
+
+template <typename Backend>
+struct PipelinedMinibatchFixture : public BackendTestFixture<Backend> {
+ protected:
+  /**
+   * Get parameters for a 3x3 convolution with enough images that a workspace
+   * of the overlap size splits the batch into several double buffered
+   * minibatches.
+   */
+  sycldnn::conv2d::Conv2DParams get_params() {
+    sycldnn::conv2d::Conv2DParams params;
+    params.channels = 3;
+    params.features = 4;
+    params.batch = 5;
+    params.in_rows = 9;
+    params.in_cols = 8;
+    params.window_rows = 3;
+    params.window_cols = 3;
+    params.stride_rows = 1;
+    params.stride_cols = 1;
+    params.out_rows = 9;
+    params.out_cols = 8;
+    params.pad_rows = 1;
+    params.pad_cols = 1;
+    params.dilation_rows = 1;
+    params.dilation_cols = 1;
+    return params;
+  }
+
+  HostData iota_data(size_t size, int max_val) {
+    HostData data(size);
+    for (size_t i = 0; i < size; ++i) {
+      data[i] = static_cast<float>(static_cast<int>(i % max_val) - max_val / 2);
+    }
+    return data;
+  }
+
+  /**
+   * Run the convolution with a workspace of the given size, and check that
+   * the result matches the reference.
+   */
+  template <typename ConvType>
+  void check_matches_reference(sycldnn::conv2d::Selector& selector,
+                               size_t workspace_size) {
+    auto params = get_params();
+    auto& provider = this->provider_;
+    auto& backend = provider.get_backend();
+    auto sizes = sycldnn::conv2d::get_sizes<ConvType>(params);
+
+    HostData input = iota_data(sizes.input_size, 7);
+    HostData filter = iota_data(sizes.filter_size, 5);
+    HostData output(sizes.output_size, 0.f);
+    HostData expected = reference_conv<ConvType>(params, input, filter,
+                                                 sizes.output_size);
+
+    auto input_gpu =
+        provider.get_initialised_device_memory(sizes.input_size, input);
+    auto filter_gpu =
+        provider.get_initialised_device_memory(sizes.filter_size, filter);
+    auto output_gpu =
+        provider.get_initialised_device_memory(sizes.output_size, output);
+    auto workspace_gpu = provider.get_initialised_device_memory(
+        workspace_size, HostData(workspace_size));
+
+    auto status = sycldnn::conv2d::launch<float, ConvType>(
+        input_gpu, filter_gpu, output_gpu, params, selector, backend,
+        workspace_gpu, workspace_size);
+    ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+    status.event.wait_and_throw();
+
+    provider.copy_device_data_to_host(sizes.output_size, output_gpu, output);
+    for (size_t i = 0; i < sizes.output_size; ++i) {
+      SCOPED_TRACE("Element: " + std::to_string(i));
+      EXPECT_FLOAT_EQ(expected[i], output[i]);
+    }
+
+    provider.deallocate_ptr(input_gpu);
+    provider.deallocate_ptr(filter_gpu);
+    provider.deallocate_ptr(output_gpu);
+    provider.deallocate_ptr(workspace_gpu);
+  }
+
+  /**
+   * Check the convolution with workspaces which give double buffered
+   * minibatches of one and two images, as well as the single buffered
+   * minimum workspace.
+   */
+  template <typename ConvType>
+  void check_workspace_sizes(sycldnn::conv2d::Selector& selector) {
+    auto workspace_size =
+        sycldnn::conv2d::query_workspace_size<ConvType>(get_params(), selector);
+    ASSERT_LT(workspace_size.overlap_size, workspace_size.recommended_size);
+    size_t const size_per_image =
+        workspace_size.overlap_size - workspace_size.required_size;
+    {
+      SCOPED_TRACE("Required size");
+      check_matches_reference<ConvType>(selector,
+                                        workspace_size.required_size);
+    }
+    {
+      SCOPED_TRACE("Overlap size");
+      check_matches_reference<ConvType>(selector,
+                                        workspace_size.overlap_size);
+    }
+    {
+      SCOPED_TRACE("Two images per minibatch");
+      check_matches_reference<ConvType>(
+          selector, workspace_size.overlap_size + 2 * size_per_image);
+    }
+  }
+};
+
+template <typename Backend>
+using PipelinedMinibatchTest = PipelinedMinibatchFixture<Backend>;
+
+TYPED_TEST_SUITE(PipelinedMinibatchTest,
+                 sycldnn::types::GTestDefaultBackendTypes);
+
+using sycldnn::conv2d::conv_type::FilterBackprop;
+using sycldnn::conv2d::conv_type::Forward;
+using sycldnn::conv2d::conv_type::InputBackprop;
+
+TYPED_TEST(PipelinedMinibatchTest, WinogradForward) {
+  sycldnn::conv2d::WinogradSelector selector{};
+  this->template check_workspace_sizes<Forward>(selector);
+}
+
+TYPED_TEST(PipelinedMinibatchTest, WinogradInputBackprop) {
+  sycldnn::conv2d::WinogradSelector selector{};
+  this->template check_workspace_sizes<InputBackprop>(selector);
+}
+
+TYPED_TEST(PipelinedMinibatchTest, Im2colForward) {
+  sycldnn::conv2d::Im2colSelector selector{};
+  this->template check_workspace_sizes<Forward>(selector);
+}
+
+TYPED_TEST(PipelinedMinibatchTest, Im2colInputBackprop) {
+  sycldnn::conv2d::Im2colSelector selector{};
+  this->template check_workspace_sizes<InputBackprop>(selector);
+}
+
+TYPED_TEST(PipelinedMinibatchTest, Im2colFilterBackprop) {
+  sycldnn::conv2d::Im2colSelector selector{};
+  this->template check_workspace_sizes<FilterBackprop>(selector);
+}
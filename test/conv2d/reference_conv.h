@@ -0,0 +1,113 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef SYCLDNN_TEST_CONV2D_REFERENCE_CONV_H_
+#define SYCLDNN_TEST_CONV2D_REFERENCE_CONV_H_
+
+#include "sycldnn/batch_format.h"
+#include "sycldnn/data_format.h"
+#include "sycldnn/filter_format.h"
+
+#include "sycldnn/conv2d/conv_type.h"
+#include "sycldnn/conv2d/params.h"
+
+#include <stddef.h>
+#include <type_traits>
+#include <vector>
+
+/**
+ * Naive reference 2D convolution, supporting strides, padding, dilation and
+ * groups.
+ *
+ * The tensors are either NHWC with HWCF filters or NCHW with FCHW filters,
+ * as given by the params. A group filter holds channels / groups channels,
+ * and the channels and features in each group are laid out according to
+ * params.group_format.
+ *
+ * All three passes iterate over the same index space, and only differ in
+ * which tensor is accumulated into:
+ *   Forward:        lhs is the input,        rhs the filter, result y.
+ *   InputBackprop:  lhs is the output grad,  rhs the filter, result dx.
+ *   FilterBackprop: lhs is the input,        rhs the output grad, result dw.
+ */
+template <typename ConvType, typename T>
+std::vector<T> reference_conv(sycldnn::conv2d::Conv2DParams const& p,
+                              std::vector<T> const& lhs,
+                              std::vector<T> const& rhs, size_t result_size) {
+  using sycldnn::conv2d::conv_type::Forward;
+  using sycldnn::conv2d::conv_type::InputBackprop;
+  std::vector<T> result(result_size, T{0});
+  bool const nchw = p.input_format == sycldnn::DataFormat::NCHW;
+  bool const fchw = p.filter_format == sycldnn::FilterFormat::FCHW;
+  bool const interleaved = p.group_format == sycldnn::BatchFormat::INTERLEAVED;
+  int const group_channels = p.channels / p.groups;
+  int const group_features = p.features / p.groups;
+  for (int b = 0; b < p.batch; ++b) {
+    for (int o_r = 0; o_r < p.out_rows; ++o_r) {
+      for (int o_c = 0; o_c < p.out_cols; ++o_c) {
+        for (int f = 0; f < p.features; ++f) {
+          int const g = interleaved ? f % p.groups : f / group_features;
+          int const y_idx =
+              nchw ? ((b * p.features + f) * p.out_rows + o_r) * p.out_cols +
+                         o_c
+                   : ((b * p.out_rows + o_r) * p.out_cols + o_c) * p.features +
+                         f;
+          for (int k_r = 0; k_r < p.window_rows; ++k_r) {
+            int const i_r =
+                o_r * p.stride_rows - p.pad_rows + k_r * p.dilation_rows;
+            if (i_r < 0 || i_r >= p.in_rows) {
+              continue;
+            }
+            for (int k_c = 0; k_c < p.window_cols; ++k_c) {
+              int const i_c =
+                  o_c * p.stride_cols - p.pad_cols + k_c * p.dilation_cols;
+              if (i_c < 0 || i_c >= p.in_cols) {
+                continue;
+              }
+              for (int cg = 0; cg < group_channels; ++cg) {
+                int const c = interleaved ? cg * p.groups + g
+                                          : g * group_channels + cg;
+                int const x_idx =
+                    nchw ? ((b * p.channels + c) * p.in_rows + i_r) *
+                                   p.in_cols +
+                               i_c
+                         : ((b * p.in_rows + i_r) * p.in_cols + i_c) *
+                                   p.channels +
+                               c;
+                int const w_idx =
+                    fchw ? ((f * group_channels + cg) * p.window_rows + k_r) *
+                                   p.window_cols +
+                               k_c
+                         : ((k_r * p.window_cols + k_c) * group_channels +
+                            cg) * p.features +
+                               f;
+                if (std::is_same<ConvType, Forward>::value) {
+                  result[y_idx] += lhs[x_idx] * rhs[w_idx];
+                } else if (std::is_same<ConvType, InputBackprop>::value) {
+                  result[x_idx] += lhs[y_idx] * rhs[w_idx];
+                } else {
+                  result[w_idx] += lhs[x_idx] * rhs[y_idx];
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+  return result;
+}
+
+#endif  // SYCLDNN_TEST_CONV2D_REFERENCE_CONV_H_
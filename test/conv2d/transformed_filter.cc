@@ -0,0 +1,241 @@
+/*
+ * Copyright Codeplay Software Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use these files except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "sycldnn/conv2d/launch.h"
+#include "sycldnn/conv2d/selector/direct_selector.h"
+#include "sycldnn/conv2d/selector/im2col_selector.h"
+#include "sycldnn/conv2d/selector/winograd_selector.h"
+#include "sycldnn/conv2d/sizes.h"
+#include "sycldnn/conv2d/transform_filter.h"
+#include "sycldnn/conv2d/workspace_size.h"
+
+#include "src/backend/snn_backend_provider.h"
+#include "src/backend/snn_usm_backend_provider.h"
+#include "sycldnn/backend/snn_backend.h"
+#include "sycldnn/backend/snn_usm_backend.h"
+#include "test/backend/backend_test_fixture.h"
+
+#include "test/types/test_backend_types.h"
+#include "test/types/to_gtest_types.h"
+
+#include <string>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+template <typename Backend>
+struct TransformedFilterFixture : public BackendTestFixture<Backend> {
+ protected:
+  using HostData = std::vector<float>;
+
+  sycldnn::conv2d::Conv2DParams get_3x3_params() {
+    sycldnn::conv2d::Conv2DParams params;
+    params.channels = 4;
+    params.features = 6;
+    params.batch = 3;
+    params.in_rows = 9;
+    params.in_cols = 9;
+    params.window_rows = 3;
+    params.window_cols = 3;
+    params.stride_rows = 1;
+    params.stride_cols = 1;
+    params.out_rows = 9;
+    params.out_cols = 9;
+    params.pad_rows = 1;
+    params.pad_cols = 1;
+    params.dilation_rows = 1;
+    params.dilation_cols = 1;
+    return params;
+  }
+
+  sycldnn::conv2d::Conv2DParams get_grouped_params(
+      int groups, sycldnn::FilterFormat filter_format) {
+    auto params = get_3x3_params();
+    params.channels = 2 * groups;
+    params.features = 3 * groups;
+    params.groups = groups;
+    params.filter_format = filter_format;
+    return params;
+  }
+
+  HostData iota_data(size_t size, int max_val) {
+    HostData data(size);
+    for (size_t i = 0; i < size; ++i) {
+      data[i] = static_cast<float>(static_cast<int>(i % max_val) - max_val / 2);
+    }
+    return data;
+  }
+
+  /**
+   * Compute the convolution twice: once with the standard launch and once with
+   * a filter transformed ahead of time, then check both results match.
+   */
+  template <typename ConvType>
+  void check_matches_launch(sycldnn::conv2d::Conv2DParams const& params,
+                            sycldnn::conv2d::Selector& selector) {
+    auto& provider = this->provider_;
+    auto& backend = provider.get_backend();
+    auto sizes = sycldnn::conv2d::get_sizes<ConvType>(params);
+
+    HostData input = iota_data(sizes.input_size, 7);
+    HostData filter = iota_data(sizes.filter_size, 5);
+    HostData output(sizes.output_size, 0.f);
+
+    auto workspace_size =
+        sycldnn::conv2d::query_workspace_size<ConvType>(params, selector);
+    auto transformed_workspace_size =
+        sycldnn::conv2d::query_transformed_filter_workspace_size<ConvType>(
+            params, selector);
+    auto transformed_size =
+        sycldnn::conv2d::query_transformed_filter_size<ConvType>(params,
+                                                                 selector);
+    ASSERT_LT(0u, transformed_size);
+    ASSERT_GE(workspace_size.recommended_size,
+              transformed_workspace_size.recommended_size);
+
+    auto input_gpu =
+        provider.get_initialised_device_memory(sizes.input_size, input);
+    auto filter_gpu =
+        provider.get_initialised_device_memory(sizes.filter_size, filter);
+    auto expected_gpu =
+        provider.get_initialised_device_memory(sizes.output_size, output);
+    auto output_gpu =
+        provider.get_initialised_device_memory(sizes.output_size, output);
+    auto transformed_gpu = provider.get_initialised_device_memory(
+        transformed_size, HostData(transformed_size));
+    auto workspace_gpu = provider.get_initialised_device_memory(
+        workspace_size.recommended_size,
+        HostData(workspace_size.recommended_size));
+
+    auto status = sycldnn::conv2d::launch<float, ConvType>(
+        input_gpu, filter_gpu, expected_gpu, params, selector, backend,
+        workspace_gpu, workspace_size.recommended_size);
+    ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+    status.event.wait_and_throw();
+
+    status = sycldnn::conv2d::transform_filter<float, ConvType>(
+        filter_gpu, transformed_gpu, params, selector, backend);
+    ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+    status.event.wait_and_throw();
+
+    // Run twice to check that the transformed filter is not consumed.
+    for (int i = 0; i < 2; ++i) {
+      status = sycldnn::conv2d::launch_transformed<float, ConvType>(
+          input_gpu, transformed_gpu, output_gpu, params, selector, backend,
+          workspace_gpu, transformed_workspace_size.recommended_size);
+      ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+      status.event.wait_and_throw();
+    }
+
+    HostData expected(sizes.output_size);
+    provider.copy_device_data_to_host(sizes.output_size, expected_gpu,
+                                      expected);
+    provider.copy_device_data_to_host(sizes.output_size, output_gpu, output);
+    for (size_t i = 0; i < sizes.output_size; ++i) {
+      SCOPED_TRACE("Element: " + std::to_string(i));
+      EXPECT_FLOAT_EQ(expected[i], output[i]);
+    }
+
+    provider.deallocate_ptr(input_gpu);
+    provider.deallocate_ptr(filter_gpu);
+    provider.deallocate_ptr(expected_gpu);
+    provider.deallocate_ptr(output_gpu);
+    provider.deallocate_ptr(transformed_gpu);
+    provider.deallocate_ptr(workspace_gpu);
+  }
+};
+
+template <typename Backend>
+using TransformedFilterTest = TransformedFilterFixture<Backend>;
+
+TYPED_TEST_SUITE(TransformedFilterTest,
+                 sycldnn::types::GTestDefaultBackendTypes);
+
+TYPED_TEST(TransformedFilterTest, WinogradForward) {
+  sycldnn::conv2d::WinogradSelector selector{};
+  this->template check_matches_launch<sycldnn::conv2d::conv_type::Forward>(
+      this->get_3x3_params(), selector);
+}
+
+TYPED_TEST(TransformedFilterTest, WinogradInputBackprop) {
+  sycldnn::conv2d::WinogradSelector selector{};
+  this->template check_matches_launch<
+      sycldnn::conv2d::conv_type::InputBackprop>(this->get_3x3_params(),
+                                                  selector);
+}
+
+TYPED_TEST(TransformedFilterTest, WinogradLargeForward) {
+  sycldnn::conv2d::WinogradLargeSelector selector{};
+  this->template check_matches_launch<sycldnn::conv2d::conv_type::Forward>(
+      this->get_3x3_params(), selector);
+}
+
+TYPED_TEST(TransformedFilterTest, Winograd6x6Forward) {
+  sycldnn::conv2d::Winograd6x6Selector selector{};
+  this->template check_matches_launch<sycldnn::conv2d::conv_type::Forward>(
+      this->get_3x3_params(), selector);
+}
+
+TYPED_TEST(TransformedFilterTest, Im2colForward) {
+  sycldnn::conv2d::Im2colSelector selector{};
+  this->template check_matches_launch<sycldnn::conv2d::conv_type::Forward>(
+      this->get_3x3_params(), selector);
+}
+
+TYPED_TEST(TransformedFilterTest, Im2colForwardFHWC) {
+  sycldnn::conv2d::Im2colSelector selector{};
+  auto params = this->get_3x3_params();
+  params.filter_format = sycldnn::FilterFormat::FHWC;
+  this->template check_matches_launch<sycldnn::conv2d::conv_type::Forward>(
+      params, selector);
+}
+
+TYPED_TEST(TransformedFilterTest, Im2colInputBackprop) {
+  sycldnn::conv2d::Im2colSelector selector{};
+  this->template check_matches_launch<
+      sycldnn::conv2d::conv_type::InputBackprop>(this->get_3x3_params(),
+                                                  selector);
+}
+
+TYPED_TEST(TransformedFilterTest, Im2colGroupedHWCF) {
+  sycldnn::conv2d::Im2colSelector selector{};
+  this->template check_matches_launch<sycldnn::conv2d::conv_type::Forward>(
+      this->get_grouped_params(2, sycldnn::FilterFormat::HWCF), selector);
+}
+
+TYPED_TEST(TransformedFilterTest, Im2colGroupedFHWC) {
+  sycldnn::conv2d::Im2colSelector selector{};
+  this->template check_matches_launch<sycldnn::conv2d::conv_type::Forward>(
+      this->get_grouped_params(2, sycldnn::FilterFormat::FHWC), selector);
+}
+
+TYPED_TEST(TransformedFilterTest, Im2colDepthwise) {
+  sycldnn::conv2d::Im2colSelector selector{};
+  auto params = this->get_3x3_params();
+  params.groups = params.channels;
+  params.features = params.channels;
+  this->template check_matches_launch<sycldnn::conv2d::conv_type::Forward>(
+      params, selector);
+}
+
+TYPED_TEST(TransformedFilterTest, DirectIsNotSupported) {
+  using ConvType = sycldnn::conv2d::conv_type::Forward;
+  sycldnn::conv2d::DirectSelector selector{};
+  auto params = this->get_3x3_params();
+  EXPECT_EQ(0u, sycldnn::conv2d::query_transformed_filter_size<ConvType>(
+                    params, selector));
+}
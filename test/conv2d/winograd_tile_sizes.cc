@@ -0,0 +1,199 @@
+/*
+ * Copyright Codeplay Software Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use these files except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "sycldnn/conv2d/launch.h"
+#include "sycldnn/conv2d/selector/direct_selector.h"
+#include "sycldnn/conv2d/selector/winograd_selector.h"
+#include "sycldnn/conv2d/sizes.h"
+#include "sycldnn/conv2d/workspace_size.h"
+
+#include "src/backend/snn_backend_provider.h"
+#include "src/backend/snn_usm_backend_provider.h"
+#include "sycldnn/backend/snn_backend.h"
+#include "sycldnn/backend/snn_usm_backend.h"
+#include "test/backend/backend_test_fixture.h"
+
+#include "test/types/test_backend_types.h"
+#include "test/types/to_gtest_types.h"
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include <CL/sycl.hpp>
+
+template <typename Backend>
+struct WinogradTileSizesFixture : public BackendTestFixture<Backend> {
+ protected:
+  using HostData = std::vector<float>;
+
+  /** Get parameters for a SAME padded stride 1 convolution. The spatial sizes
+   * are chosen so that the output is not a multiple of any of the tile sizes,
+   * to exercise the partial tiles at the edges. */
+  sycldnn::conv2d::Conv2DParams get_params(int window) {
+    sycldnn::conv2d::Conv2DParams params;
+    params.channels = 5;
+    params.features = 6;
+    params.batch = 2;
+    params.in_rows = 15;
+    params.in_cols = 13;
+    params.window_rows = window;
+    params.window_cols = window;
+    params.stride_rows = 1;
+    params.stride_cols = 1;
+    params.out_rows = 15;
+    params.out_cols = 13;
+    params.pad_rows = window / 2;
+    params.pad_cols = window / 2;
+    params.dilation_rows = 1;
+    params.dilation_cols = 1;
+    return params;
+  }
+
+  HostData iota_data(size_t size, int max_val) {
+    HostData data(size);
+    for (size_t i = 0; i < size; ++i) {
+      data[i] = static_cast<float>(static_cast<int>(i % max_val) - max_val / 2);
+    }
+    return data;
+  }
+
+  template <typename ConvType>
+  HostData run_conv(sycldnn::conv2d::Conv2DParams const& params,
+                    sycldnn::conv2d::Selector& selector, HostData const& input,
+                    HostData const& filter) {
+    auto& provider = this->provider_;
+    auto& backend = provider.get_backend();
+    auto sizes = sycldnn::conv2d::get_sizes<ConvType>(params);
+    HostData output(sizes.output_size, 0.f);
+
+    auto workspace_size =
+        sycldnn::conv2d::query_workspace_size<ConvType>(params, selector);
+    size_t const workspace_alloc =
+        std::max<size_t>(workspace_size.recommended_size, 1);
+
+    auto input_gpu =
+        provider.get_initialised_device_memory(sizes.input_size, input);
+    auto filter_gpu =
+        provider.get_initialised_device_memory(sizes.filter_size, filter);
+    auto output_gpu =
+        provider.get_initialised_device_memory(sizes.output_size, output);
+    auto workspace_gpu = provider.get_initialised_device_memory(
+        workspace_alloc, HostData(workspace_alloc));
+
+    auto status = sycldnn::conv2d::launch<float, ConvType>(
+        input_gpu, filter_gpu, output_gpu, params, selector, backend,
+        workspace_gpu, workspace_size.recommended_size);
+    EXPECT_EQ(sycldnn::StatusCode::OK, status.status);
+    if (status.status == sycldnn::StatusCode::OK) {
+      status.event.wait_and_throw();
+      provider.copy_device_data_to_host(sizes.output_size, output_gpu, output);
+    }
+
+    provider.deallocate_ptr(input_gpu);
+    provider.deallocate_ptr(filter_gpu);
+    provider.deallocate_ptr(output_gpu);
+    provider.deallocate_ptr(workspace_gpu);
+    return output;
+  }
+
+  /**
+   * Compute the convolution with the given Winograd selector and check that
+   * it matches the direct convolution. The larger Winograd tiles are not
+   * exact, so the results are compared with a relative tolerance.
+   */
+  template <typename ConvType>
+  void check_matches_direct(sycldnn::conv2d::Conv2DParams const& params,
+                            sycldnn::conv2d::Selector& selector) {
+    ASSERT_NE(sycldnn::conv2d::Algorithm::NotSupported,
+              selector.select<ConvType>(params));
+    auto sizes = sycldnn::conv2d::get_sizes<ConvType>(params);
+    HostData input = iota_data(sizes.input_size, 7);
+    HostData filter = iota_data(sizes.filter_size, 5);
+
+    sycldnn::conv2d::DirectSelector direct{};
+    HostData expected = run_conv<ConvType>(params, direct, input, filter);
+    HostData output = run_conv<ConvType>(params, selector, input, filter);
+    for (size_t i = 0; i < sizes.output_size; ++i) {
+      SCOPED_TRACE("Element: " + std::to_string(i));
+      EXPECT_NEAR(expected[i], output[i],
+                  1e-3f * std::max(1.f, std::abs(expected[i])));
+    }
+  }
+};
+
+template <typename Backend>
+using WinogradTileSizesTest = WinogradTileSizesFixture<Backend>;
+
+TYPED_TEST_SUITE(WinogradTileSizesTest,
+                 sycldnn::types::GTestDefaultBackendTypes);
+
+using sycldnn::conv2d::conv_type::FilterBackprop;
+using sycldnn::conv2d::conv_type::Forward;
+using sycldnn::conv2d::conv_type::InputBackprop;
+
+TYPED_TEST(WinogradTileSizesTest, Winograd6x6Forward) {
+  sycldnn::conv2d::Winograd6x6Selector selector{};
+  this->template check_matches_direct<Forward>(this->get_params(3), selector);
+}
+
+TYPED_TEST(WinogradTileSizesTest, Winograd6x6InputBackprop) {
+  sycldnn::conv2d::Winograd6x6Selector selector{};
+  this->template check_matches_direct<InputBackprop>(this->get_params(3),
+                                                     selector);
+}
+
+TYPED_TEST(WinogradTileSizesTest, Winograd5x5Forward) {
+  sycldnn::conv2d::Winograd5x5Selector selector{};
+  this->template check_matches_direct<Forward>(this->get_params(5), selector);
+}
+
+TYPED_TEST(WinogradTileSizesTest, Winograd5x5InputBackprop) {
+  sycldnn::conv2d::Winograd5x5Selector selector{};
+  this->template check_matches_direct<InputBackprop>(this->get_params(5),
+                                                     selector);
+}
+
+TYPED_TEST(WinogradTileSizesTest, Winograd5x5LargeForward) {
+  sycldnn::conv2d::Winograd5x5LargeSelector selector{};
+  this->template check_matches_direct<Forward>(this->get_params(5), selector);
+}
+
+TYPED_TEST(WinogradTileSizesTest, Winograd5x5LargeInputBackprop) {
+  sycldnn::conv2d::Winograd5x5LargeSelector selector{};
+  this->template check_matches_direct<InputBackprop>(this->get_params(5),
+                                                     selector);
+}
+
+TYPED_TEST(WinogradTileSizesTest, FilterBackpropNotSupported) {
+  sycldnn::conv2d::Winograd6x6Selector selector_6x6{};
+  sycldnn::conv2d::Winograd5x5LargeSelector selector_5x5{};
+  EXPECT_EQ(sycldnn::conv2d::Algorithm::NotSupported,
+            selector_6x6.select<FilterBackprop>(this->get_params(3)));
+  EXPECT_EQ(sycldnn::conv2d::Algorithm::NotSupported,
+            selector_5x5.select<FilterBackprop>(this->get_params(5)));
+}
+
+TYPED_TEST(WinogradTileSizesTest, MismatchedWindowNotSupported) {
+  sycldnn::conv2d::Winograd6x6Selector selector_6x6{};
+  sycldnn::conv2d::Winograd5x5Selector selector_5x5{};
+  EXPECT_EQ(sycldnn::conv2d::Algorithm::NotSupported,
+            selector_6x6.select<Forward>(this->get_params(5)));
+  EXPECT_EQ(sycldnn::conv2d::Algorithm::NotSupported,
+            selector_5x5.select<Forward>(this->get_params(3)));
+}
@@ -89,6 +89,27 @@ TEST(Conv2DWorskpaceSize, TiledNoWorkspace) {
   EXPECT_EQ(0u, filbk_workspace.recommended_size);
 }
 
+TEST(Conv2DWorskpaceSize, TiledSmallFilterBackpropWorkspace) {
+  // A first layer filter has too few vectors to occupy a device, so the tiled
+  // filter backprop recommends a workspace to split its reduction, but can
+  // still run without one.
+  sycldnn::conv2d::TiledSelector selector{};
+  auto params = get_params(3, 1, 224, 3, 16, 1, sycldnn::PaddingMode::SAME);
+
+  auto forward_workspace = sycldnn::conv2d::query_workspace_size<
+      sycldnn::conv2d::conv_type::Forward>(params, selector);
+  EXPECT_EQ(0u, forward_workspace.required_size);
+  EXPECT_EQ(0u, forward_workspace.recommended_size);
+
+  auto constexpr filter_size = 3u * 3u * 3u * 16u;
+  auto filbk_workspace = sycldnn::conv2d::query_workspace_size<
+      sycldnn::conv2d::conv_type::FilterBackprop>(params, selector);
+  EXPECT_EQ(0u, filbk_workspace.required_size);
+  EXPECT_LE(2 * filter_size, filbk_workspace.recommended_size);
+  EXPECT_EQ(0u, filbk_workspace.recommended_size % filter_size);
+  EXPECT_EQ(filbk_workspace.recommended_size, filbk_workspace.overlap_size);
+}
+
 TEST(Conv2DWorskpaceSize, Im2colVGGLayer1Workspace) {
   // We allow the queried workspace to be larger than the absolute minimum
   // required, so that internally we can add extra size requirements for
@@ -165,3 +186,93 @@ TEST(Conv2DWorskpaceSize, WinogradVGGLayer1Workspace) {
       A * B * (32u * (filbk_in_tiles + filbk_out_tiles) + filbk_fil_tiles),
       filbk_workspace.recommended_size);
 }
+
+TEST(Conv2DWorskpaceSize, WinogradTransformedFilterWorkspace) {
+  sycldnn::conv2d::WinogradSelector selector{};
+  auto params = get_params(3, 1, 224, 64, 64, 32, sycldnn::PaddingMode::SAME);
+
+  auto constexpr A = 2u + 3u - 1;
+  auto constexpr B = 2u + 3u - 1;
+  auto constexpr fil_transform_size = A * B * 64u * 64u;
+
+  auto forward_workspace = sycldnn::conv2d::query_workspace_size<
+      sycldnn::conv2d::conv_type::Forward>(params, selector);
+  auto forward_transformed_workspace =
+      sycldnn::conv2d::query_transformed_filter_workspace_size<
+          sycldnn::conv2d::conv_type::Forward>(params, selector);
+  EXPECT_EQ(forward_workspace.required_size - fil_transform_size,
+            forward_transformed_workspace.required_size);
+  EXPECT_EQ(forward_workspace.recommended_size - fil_transform_size,
+            forward_transformed_workspace.recommended_size);
+  EXPECT_EQ(fil_transform_size,
+            sycldnn::conv2d::query_transformed_filter_size<
+                sycldnn::conv2d::conv_type::Forward>(params, selector));
+
+  auto inbk_workspace = sycldnn::conv2d::query_workspace_size<
+      sycldnn::conv2d::conv_type::InputBackprop>(params, selector);
+  auto inbk_transformed_workspace =
+      sycldnn::conv2d::query_transformed_filter_workspace_size<
+          sycldnn::conv2d::conv_type::InputBackprop>(params, selector);
+  EXPECT_EQ(inbk_workspace.required_size - fil_transform_size,
+            inbk_transformed_workspace.required_size);
+  EXPECT_EQ(fil_transform_size,
+            sycldnn::conv2d::query_transformed_filter_size<
+                sycldnn::conv2d::conv_type::InputBackprop>(params, selector));
+
+  EXPECT_EQ(0u, sycldnn::conv2d::query_transformed_filter_size<
+                    sycldnn::conv2d::conv_type::FilterBackprop>(params,
+                                                                selector));
+}
+
+TEST(Conv2DWorskpaceSize, Im2colPackedFilterWorkspace) {
+  sycldnn::conv2d::Im2colSelector selector{};
+  auto params = get_params(3, 1, 56, 64, 64, 8, sycldnn::PaddingMode::SAME);
+  params.groups = 4;
+
+  auto constexpr fil_transform_size = 3u * 3u * 64u * 64u / 4u;
+  auto workspace = sycldnn::conv2d::query_workspace_size<
+      sycldnn::conv2d::conv_type::Forward>(params, selector);
+  auto packed_workspace =
+      sycldnn::conv2d::query_transformed_filter_workspace_size<
+          sycldnn::conv2d::conv_type::Forward>(params, selector);
+  EXPECT_EQ(workspace.required_size - fil_transform_size,
+            packed_workspace.required_size);
+  EXPECT_EQ(workspace.recommended_size - fil_transform_size,
+            packed_workspace.recommended_size);
+  EXPECT_EQ(fil_transform_size,
+            sycldnn::conv2d::query_transformed_filter_size<
+                sycldnn::conv2d::conv_type::Forward>(params, selector));
+}
+
+TEST(Conv2DWorskpaceSize, OverlapWorkspace) {
+  auto params = get_params(3, 1, 56, 64, 64, 8, sycldnn::PaddingMode::SAME);
+
+  sycldnn::conv2d::WinogradSelector winograd_selector{};
+  auto winograd_workspace = sycldnn::conv2d::query_workspace_size<
+      sycldnn::conv2d::conv_type::Forward>(params, winograd_selector);
+  auto constexpr A = 2u + 3u - 1;
+  auto constexpr B = 2u + 3u - 1;
+  auto constexpr fil_transform_size = A * B * 64u * 64u;
+  size_t const winograd_per_image =
+      winograd_workspace.required_size - fil_transform_size;
+  EXPECT_EQ(2 * winograd_per_image + fil_transform_size,
+            winograd_workspace.overlap_size);
+  EXPECT_LT(winograd_workspace.overlap_size,
+            winograd_workspace.recommended_size);
+
+  // The Winograd filter backprop does not overlap minibatches.
+  auto filbk_workspace = sycldnn::conv2d::query_workspace_size<
+      sycldnn::conv2d::conv_type::FilterBackprop>(params, winograd_selector);
+  EXPECT_EQ(filbk_workspace.recommended_size, filbk_workspace.overlap_size);
+
+  sycldnn::conv2d::Im2colSelector im2col_selector{};
+  auto im2col_workspace = sycldnn::conv2d::query_workspace_size<
+      sycldnn::conv2d::conv_type::Forward>(params, im2col_selector);
+  EXPECT_EQ(2 * im2col_workspace.required_size, im2col_workspace.overlap_size);
+
+  // With a single image there is nothing to overlap.
+  params.batch = 1;
+  auto single_workspace = sycldnn::conv2d::query_workspace_size<
+      sycldnn::conv2d::conv_type::Forward>(params, im2col_selector);
+  EXPECT_EQ(single_workspace.recommended_size, single_workspace.overlap_size);
+}
@@ -17,12 +17,14 @@
 #define SYCLDNN_TEST_MATMUL_FIXTURE_H_
 
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <vector>
 
 #include "sycldnn/backend/snn_backend.h"
 #include "sycldnn/helpers/scope_exit.h"
 #include "sycldnn/matmul/launch.h"
 #include "sycldnn/matmul/params.h"
+#include "sycldnn/matmul/workspace_size.h"
 #include "test/backend/backend_test_fixture.h"
 #include "test/gen/iota_initialised_data.h"
 #include "test/helpers/float_comparison.h"
@@ -35,7 +37,7 @@ struct MatmulFixture : public BackendTestFixture<typename Pair::SecondType> {
  protected:
   void run(std::vector<DataType> const& exp, int batches, int m, int k, int n,
            DataType beta, int lhs_offset, int rhs_offset, int out_offset,
-           DataType max_val) {
+           DataType max_val, bool use_workspace = false) {
     size_t lhs_size = batches * m * k + lhs_offset;
     size_t rhs_size = batches * k * n + rhs_offset;
     size_t out_size = batches * m * n + out_offset;
@@ -58,10 +60,15 @@ struct MatmulFixture : public BackendTestFixture<typename Pair::SecondType> {
         provider.deallocate_ptr(out_gpu);
       };
 
-      auto status =
-          sycldnn::matmul::launch<DataType, TransposeLhs, TransposeRhs>(
-              lhs_gpu + lhs_offset, rhs_gpu + rhs_offset, out_gpu + out_offset,
-              sycldnn::matmul::MatmulParams{batches, m, k, n, beta}, backend);
+      auto params = sycldnn::matmul::MatmulParams{batches, m, k, n, beta};
+      auto status = use_workspace
+                        ? launch_with_workspace(lhs_gpu + lhs_offset,
+                                                rhs_gpu + rhs_offset,
+                                                out_gpu + out_offset, params)
+                        : sycldnn::matmul::launch<DataType, TransposeLhs,
+                                                  TransposeRhs>(
+                              lhs_gpu + lhs_offset, rhs_gpu + rhs_offset,
+                              out_gpu + out_offset, params, backend);
 
       ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
       status.event.wait_and_throw();
@@ -74,6 +81,25 @@ struct MatmulFixture : public BackendTestFixture<typename Pair::SecondType> {
       SNN_ALMOST_EQUAL(exp[i], out_data[i], 10u);
     }
   }
+
+ private:
+  /** Launch the matmul using a workspace of the queried size. */
+  template <typename Pointer>
+  sycldnn::SNNStatus launch_with_workspace(
+      Pointer lhs, Pointer rhs, Pointer output,
+      sycldnn::matmul::MatmulParams const& params) {
+    auto& provider = this->provider_;
+    size_t workspace_size = sycldnn::matmul::query_workspace_size(params);
+    std::vector<DataType> workspace_data(std::max(workspace_size, size_t{1}));
+    auto workspace = provider.get_initialised_device_memory(
+        workspace_data.size(), workspace_data);
+    auto status = sycldnn::matmul::launch<DataType, TransposeLhs, TransposeRhs>(
+        lhs, rhs, output, params, provider.get_backend(), workspace,
+        workspace_size);
+    status.event.wait_and_throw();
+    provider.deallocate_ptr(workspace);
+    return status;
+  }
 };
 
 #endif  // SYCLDNN_TEST_MATMUL_FIXTURE_H_
@@ -0,0 +1,163 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "sycldnn/matmul/launch.h"
+#include "sycldnn/matmul/params.h"
+
+#include "sycldnn/backend/snn_backend.h"
+#include "sycldnn/backend/snn_usm_backend.h"
+#include "test/backend/backend_test_fixture.h"
+
+#include "test/types/test_backend_types.h"
+#include "test/types/to_gtest_types.h"
+
+#include <string>
+#include <vector>
+
+/**
+ * Tests for batched matrix multiplies with independent batch strides for each
+ * tensor, including broadcasting a single lhs or rhs matrix to every batch
+ * and leaving gaps between the output matrices.
+ */
+
+namespace {
+
+using HostData = std::vector<float>;
+using sycldnn::matmul::get_batch_extent;
+using sycldnn::matmul::get_lhs_batch_stride;
+using sycldnn::matmul::get_output_batch_stride;
+using sycldnn::matmul::get_rhs_batch_stride;
+using sycldnn::matmul::packed_batch_stride;
+
+/** Host side reference for lhs * rhs + beta * output with batch strides. */
+HostData reference_matmul(sycldnn::matmul::MatmulParams const& p,
+                          HostData const& lhs, HostData const& rhs,
+                          HostData const& output) {
+  int const lhs_stride = get_lhs_batch_stride(p);
+  int const rhs_stride = get_rhs_batch_stride(p);
+  int const out_stride = get_output_batch_stride(p);
+  HostData result = output;
+  for (int b = 0; b < p.batches; ++b) {
+    for (int row = 0; row < p.m; ++row) {
+      for (int col = 0; col < p.n; ++col) {
+        float sum = 0.f;
+        for (int acc = 0; acc < p.k; ++acc) {
+          sum += lhs[b * lhs_stride + row * p.k + acc] *
+                 rhs[b * rhs_stride + acc * p.n + col];
+        }
+        size_t const idx = b * out_stride + row * p.n + col;
+        result[idx] = sum + p.beta * output[idx];
+      }
+    }
+  }
+  return result;
+}
+
+}  // namespace
+
+template <typename Backend>
+struct MatmulBatchStrideFixture : public BackendTestFixture<Backend> {
+ protected:
+  /** Small integer values, so that the matmul sums are computed exactly. */
+  HostData iota_data(size_t size, int max_val) {
+    HostData data(size);
+    for (size_t i = 0; i < size; ++i) {
+      data[i] = static_cast<float>(static_cast<int>(i % max_val) - max_val / 2);
+    }
+    return data;
+  }
+
+  void check_matches_reference(int batches, int m, int k, int n,
+                               int lhs_stride, int rhs_stride, int out_stride,
+                               float beta) {
+    auto& provider = this->provider_;
+    auto& backend = provider.get_backend();
+
+    sycldnn::matmul::MatmulParams params{batches, m, k, n, beta};
+    params.lhs_batch_stride = lhs_stride;
+    params.rhs_batch_stride = rhs_stride;
+    params.output_batch_stride = out_stride;
+    size_t const lhs_size =
+        get_batch_extent(batches, get_lhs_batch_stride(params), m * k);
+    size_t const rhs_size =
+        get_batch_extent(batches, get_rhs_batch_stride(params), k * n);
+    size_t const out_size =
+        get_batch_extent(batches, get_output_batch_stride(params), m * n);
+
+    HostData lhs = iota_data(lhs_size, 5);
+    HostData rhs = iota_data(rhs_size, 3);
+    HostData output = iota_data(out_size, 7);
+    HostData expected = reference_matmul(params, lhs, rhs, output);
+
+    auto lhs_gpu = provider.get_initialised_device_memory(lhs_size, lhs);
+    auto rhs_gpu = provider.get_initialised_device_memory(rhs_size, rhs);
+    auto out_gpu = provider.get_initialised_device_memory(out_size, output);
+
+    auto status = sycldnn::matmul::launch<float, false, false>(
+        lhs_gpu, rhs_gpu, out_gpu, params, backend);
+    ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+    status.event.wait_and_throw();
+
+    // Values in any gaps between the output matrices must be unchanged.
+    provider.copy_device_data_to_host(out_size, out_gpu, output);
+    for (size_t i = 0; i < out_size; ++i) {
+      SCOPED_TRACE("Element: " + std::to_string(i));
+      EXPECT_EQ(expected[i], output[i]);
+    }
+
+    provider.deallocate_ptr(lhs_gpu);
+    provider.deallocate_ptr(rhs_gpu);
+    provider.deallocate_ptr(out_gpu);
+  }
+};
+
+using BackendTypeList = sycldnn::types::DefaultBackendTypes;
+using GTestTypeList = sycldnn::types::ToGTestTypes<BackendTypeList>::type;
+TYPED_TEST_SUITE(MatmulBatchStrideFixture, GTestTypeList);
+
+TYPED_TEST(MatmulBatchStrideFixture, BroadcastLhs) {
+  this->check_matches_reference(3, 3, 19, 33, 0, packed_batch_stride,
+                                packed_batch_stride, 0.f);
+}
+TYPED_TEST(MatmulBatchStrideFixture, BroadcastRhs) {
+  this->check_matches_reference(3, 3, 19, 33, packed_batch_stride, 0,
+                                packed_batch_stride, 1.f);
+}
+TYPED_TEST(MatmulBatchStrideFixture, PaddedOutput) {
+  this->check_matches_reference(3, 4, 8, 12, packed_batch_stride,
+                                packed_batch_stride, 4 * 12 + 5, 1.f);
+}
+TYPED_TEST(MatmulBatchStrideFixture, PaddedInputs) {
+  this->check_matches_reference(2, 4, 8, 12, 4 * 8 + 3, 8 * 12 + 7,
+                                packed_batch_stride, 0.f);
+}
+TYPED_TEST(MatmulBatchStrideFixture, LocalBlocksBroadcastRhs) {
+  this->check_matches_reference(2, 70, 40, 65, packed_batch_stride, 0,
+                                70 * 65 + 1, 1.f);
+}
+TYPED_TEST(MatmulBatchStrideFixture, SplitKBroadcastLhs) {
+  this->check_matches_reference(3, 5, 1030, 9, 0, packed_batch_stride,
+                                5 * 9 + 2, 1.f);
+}
+TYPED_TEST(MatmulBatchStrideFixture, GemvRowVectorBroadcastRhs) {
+  this->check_matches_reference(3, 1, 40, 33, packed_batch_stride, 0,
+                                packed_batch_stride, 1.f);
+}
+TYPED_TEST(MatmulBatchStrideFixture, GemvColumnVectorBroadcastLhs) {
+  this->check_matches_reference(3, 30, 40, 1, 0, packed_batch_stride,
+                                30 + 3, 0.f);
+}
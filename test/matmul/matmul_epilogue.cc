@@ -0,0 +1,211 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "sycldnn/matmul/epilogue.h"
+#include "sycldnn/matmul/launch.h"
+#include "sycldnn/matmul/params.h"
+#include "sycldnn/matmul/workspace_size.h"
+
+#include "sycldnn/backend/snn_backend.h"
+#include "sycldnn/backend/snn_usm_backend.h"
+#include "test/backend/backend_test_fixture.h"
+
+#include "test/types/test_backend_types.h"
+#include "test/types/to_gtest_types.h"
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+/**
+ * Tests for matrix multiplies which scale the product by alpha and apply a
+ * bias and activation epilogue, with shapes chosen to exercise the tiled,
+ * local memory, split-K and matrix-vector kernels.
+ */
+
+namespace {
+
+using HostData = std::vector<float>;
+using sycldnn::matmul::Activation;
+
+/** Host side reference for epilogue(alpha * lhs * rhs + beta * output). */
+HostData reference_matmul(sycldnn::matmul::MatmulParams const& p,
+                          HostData const& lhs, HostData const& rhs,
+                          HostData const& output, HostData const& bias,
+                          Activation activation) {
+  HostData result(output.size());
+  for (int b = 0; b < p.batches; ++b) {
+    for (int row = 0; row < p.m; ++row) {
+      for (int col = 0; col < p.n; ++col) {
+        float sum = 0.f;
+        for (int acc = 0; acc < p.k; ++acc) {
+          sum += lhs[(b * p.m + row) * p.k + acc] *
+                 rhs[(b * p.k + acc) * p.n + col];
+        }
+        size_t const idx = (b * p.m + row) * p.n + col;
+        float val = p.alpha * sum + p.beta * output[idx] + bias[col];
+        switch (activation) {
+          case Activation::Relu:
+            val = std::max(val, 0.f);
+            break;
+          case Activation::Tanh:
+            val = std::tanh(val);
+            break;
+          case Activation::None:
+            break;
+        }
+        result[idx] = val;
+      }
+    }
+  }
+  return result;
+}
+
+/**
+ * Launch a matmul with an epilogue. The USM launcher takes the events to wait
+ * on before the epilogue, while the buffer launcher does not. The workspace
+ * allows the split-K kernels to be used.
+ */
+template <typename Backend>
+sycldnn::SNNStatus launch_with_epilogue(
+    typename Backend::template pointer_type<float const> lhs,
+    typename Backend::template pointer_type<float const> rhs,
+    typename Backend::template pointer_type<float> output,
+    sycldnn::matmul::MatmulParams const& params, Backend& backend,
+    typename Backend::template pointer_type<float> workspace,
+    size_t workspace_size,
+    sycldnn::matmul::Epilogue<float, Backend> const& epilogue) {
+  if constexpr (sycldnn::backend::is_usm_backend_v<Backend>) {
+    return sycldnn::matmul::launch<float, false, false>(
+        lhs, rhs, output, params, backend, workspace, workspace_size, {},
+        epilogue);
+  } else {
+    return sycldnn::matmul::launch<float, false, false>(
+        lhs, rhs, output, params, backend, workspace, workspace_size,
+        epilogue);
+  }
+}
+
+}  // namespace
+
+template <typename Backend>
+struct MatmulEpilogueFixture : public BackendTestFixture<Backend> {
+ protected:
+  /** Small integer values, so that the matmul sums are computed exactly. */
+  HostData iota_data(size_t size, int max_val) {
+    HostData data(size);
+    for (size_t i = 0; i < size; ++i) {
+      data[i] = static_cast<float>(static_cast<int>(i % max_val) - max_val / 2);
+    }
+    return data;
+  }
+
+  void check_matches_reference(int batches, int m, int k, int n, float alpha,
+                               float beta, bool use_bias,
+                               Activation activation) {
+    auto& provider = this->provider_;
+    auto& backend = provider.get_backend();
+
+    sycldnn::matmul::MatmulParams params{batches, m, k, n, beta};
+    params.alpha = alpha;
+    size_t const lhs_size = batches * m * k;
+    size_t const rhs_size = batches * k * n;
+    size_t const out_size = batches * m * n;
+
+    HostData lhs = iota_data(lhs_size, 5);
+    HostData rhs = iota_data(rhs_size, 3);
+    HostData output = iota_data(out_size, 7);
+    HostData bias = use_bias ? iota_data(n, 9) : HostData(n, 0.f);
+    HostData expected =
+        reference_matmul(params, lhs, rhs, output, bias, activation);
+
+    auto lhs_gpu = provider.get_initialised_device_memory(lhs_size, lhs);
+    auto rhs_gpu = provider.get_initialised_device_memory(rhs_size, rhs);
+    auto out_gpu = provider.get_initialised_device_memory(out_size, output);
+    auto bias_gpu = provider.get_initialised_device_memory(n, bias);
+    size_t const workspace_size = sycldnn::matmul::query_workspace_size(params);
+    HostData workspace(std::max(workspace_size, size_t{1}));
+    auto workspace_gpu =
+        provider.get_initialised_device_memory(workspace.size(), workspace);
+
+    sycldnn::matmul::Epilogue<float, Backend> epilogue;
+    if (use_bias) {
+      epilogue.bias = bias_gpu;
+    }
+    epilogue.activation = activation;
+
+    auto status =
+        launch_with_epilogue(lhs_gpu, rhs_gpu, out_gpu, params, backend,
+                             workspace_gpu, workspace_size, epilogue);
+    ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+    status.event.wait_and_throw();
+
+    provider.copy_device_data_to_host(out_size, out_gpu, output);
+    for (size_t i = 0; i < out_size; ++i) {
+      SCOPED_TRACE("Element: " + std::to_string(i));
+      EXPECT_NEAR(expected[i], output[i], 1e-5f);
+    }
+
+    provider.deallocate_ptr(lhs_gpu);
+    provider.deallocate_ptr(rhs_gpu);
+    provider.deallocate_ptr(out_gpu);
+    provider.deallocate_ptr(bias_gpu);
+    provider.deallocate_ptr(workspace_gpu);
+  }
+};
+
+using BackendTypeList = sycldnn::types::DefaultBackendTypes;
+using GTestTypeList = sycldnn::types::ToGTestTypes<BackendTypeList>::type;
+TYPED_TEST_SUITE(MatmulEpilogueFixture, GTestTypeList);
+
+TYPED_TEST(MatmulEpilogueFixture, Alpha) {
+  this->check_matches_reference(2, 3, 19, 33, 0.5f, 0.f, false,
+                                Activation::None);
+}
+TYPED_TEST(MatmulEpilogueFixture, AlphaBeta) {
+  this->check_matches_reference(2, 3, 19, 33, 2.f, 1.f, false,
+                                Activation::None);
+}
+TYPED_TEST(MatmulEpilogueFixture, Bias) {
+  this->check_matches_reference(2, 3, 19, 33, 1.f, 0.f, true,
+                                Activation::None);
+}
+TYPED_TEST(MatmulEpilogueFixture, BiasRelu) {
+  this->check_matches_reference(2, 3, 19, 33, 1.f, 1.f, true,
+                                Activation::Relu);
+}
+TYPED_TEST(MatmulEpilogueFixture, BiasTanh) {
+  this->check_matches_reference(1, 4, 8, 12, 0.25f, 0.f, true,
+                                Activation::Tanh);
+}
+TYPED_TEST(MatmulEpilogueFixture, LocalBlocksBiasRelu) {
+  this->check_matches_reference(2, 70, 40, 65, 0.5f, 1.f, true,
+                                Activation::Relu);
+}
+TYPED_TEST(MatmulEpilogueFixture, GemvRowVectorBiasRelu) {
+  this->check_matches_reference(1, 1, 40, 33, 0.5f, 1.f, true,
+                                Activation::Relu);
+}
+TYPED_TEST(MatmulEpilogueFixture, GemvColumnVectorBiasRelu) {
+  this->check_matches_reference(2, 30, 40, 1, 0.5f, 1.f, true,
+                                Activation::Relu);
+}
+TYPED_TEST(MatmulEpilogueFixture, SplitKBiasRelu) {
+  this->check_matches_reference(2, 5, 1030, 9, 0.5f, 1.f, true,
+                                Activation::Relu);
+}
@@ -0,0 +1,196 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "sycldnn/matmul/grouped_launch.h"
+#include "sycldnn/matmul/grouped_params.h"
+
+#include "sycldnn/backend/snn_backend.h"
+#include "sycldnn/backend/snn_usm_backend.h"
+#include "test/backend/backend_test_fixture.h"
+
+#include "test/types/test_backend_types.h"
+#include "test/types/to_gtest_types.h"
+
+#include <array>
+#include <string>
+#include <vector>
+
+/**
+ * Tests for grouped matrix multiplies, where every problem in the group has a
+ * different shape and is computed in a single launch.
+ */
+
+namespace {
+
+using HostData = std::vector<float>;
+using sycldnn::matmul::GroupedMatmulParams;
+using sycldnn::matmul::GroupedMatmulProblem;
+
+/** Host side reference for a single problem of a grouped matmul. */
+template <bool TransposeLHS, bool TransposeRHS>
+void reference_matmul(GroupedMatmulProblem const& p,
+                      GroupedMatmulParams const& params, HostData const& lhs,
+                      HostData const& rhs, HostData& output) {
+  for (int row = 0; row < p.m; ++row) {
+    for (int col = 0; col < p.n; ++col) {
+      float sum = 0.f;
+      for (int acc = 0; acc < p.k; ++acc) {
+        int const lhs_idx = TransposeLHS ? acc * p.m + row : row * p.k + acc;
+        int const rhs_idx = TransposeRHS ? col * p.k + acc : acc * p.n + col;
+        sum += lhs[p.lhs_offset + lhs_idx] * rhs[p.rhs_offset + rhs_idx];
+      }
+      float& out = output[p.output_offset + row * p.n + col];
+      out = params.alpha * sum + params.beta * out;
+    }
+  }
+}
+
+/**
+ * Launch a grouped matmul. The USM launcher takes the events to wait on,
+ * while the buffer launcher does not.
+ */
+template <bool TransposeLHS, bool TransposeRHS, typename Backend>
+sycldnn::SNNStatus launch_grouped(
+    typename Backend::template pointer_type<float const> lhs,
+    typename Backend::template pointer_type<float const> rhs,
+    typename Backend::template pointer_type<float> output,
+    typename Backend::template pointer_type<GroupedMatmulProblem const>
+        problems,
+    GroupedMatmulParams const& params, Backend& backend) {
+  if constexpr (sycldnn::backend::is_usm_backend_v<Backend>) {
+    return sycldnn::matmul::launch_grouped<float, TransposeLHS, TransposeRHS>(
+        lhs, rhs, output, problems, params, backend, {});
+  } else {
+    return sycldnn::matmul::launch_grouped<float, TransposeLHS, TransposeRHS>(
+        lhs, rhs, output, problems, params, backend);
+  }
+}
+
+}  // namespace
+
+template <typename Backend>
+struct MatmulGroupedFixture : public BackendTestFixture<Backend> {
+ protected:
+  /** Small integer values, so that the matmul sums are computed exactly. */
+  HostData iota_data(size_t size, int max_val) {
+    HostData data(size);
+    for (size_t i = 0; i < size; ++i) {
+      data[i] = static_cast<float>(static_cast<int>(i % max_val) - max_val / 2);
+    }
+    return data;
+  }
+
+  /**
+   * Run a grouped matmul over problems of the given shapes, packed one after
+   * another in each tensor, and compare against a reference computed on the
+   * host.
+   */
+  template <bool TransposeLHS, bool TransposeRHS>
+  void check_matches_reference(std::vector<std::array<int, 3>> const& shapes,
+                               float alpha = 1.f, float beta = 0.f) {
+    auto& provider = this->provider_;
+    auto& backend = provider.get_backend();
+
+    std::vector<GroupedMatmulProblem> problems;
+    int lhs_size = 0;
+    int rhs_size = 0;
+    int out_size = 0;
+    for (auto const& shape : shapes) {
+      int const m = shape[0];
+      int const k = shape[1];
+      int const n = shape[2];
+      problems.push_back({m, k, n, lhs_size, rhs_size, out_size});
+      lhs_size += m * k;
+      rhs_size += k * n;
+      out_size += m * n;
+    }
+    GroupedMatmulParams params{static_cast<int>(problems.size()),
+                               static_cast<size_t>(lhs_size),
+                               static_cast<size_t>(rhs_size),
+                               static_cast<size_t>(out_size)};
+    params.alpha = alpha;
+    params.beta = beta;
+
+    HostData lhs = iota_data(lhs_size, 5);
+    HostData rhs = iota_data(rhs_size, 3);
+    HostData output = iota_data(out_size, 7);
+    HostData expected = output;
+    for (auto const& problem : problems) {
+      reference_matmul<TransposeLHS, TransposeRHS>(problem, params, lhs, rhs,
+                                                   expected);
+    }
+
+    auto lhs_gpu = provider.get_initialised_device_memory(lhs_size, lhs);
+    auto rhs_gpu = provider.get_initialised_device_memory(rhs_size, rhs);
+    auto out_gpu = provider.get_initialised_device_memory(out_size, output);
+    auto problems_gpu =
+        provider.get_initialised_device_memory(problems.size(), problems);
+
+    auto status = launch_grouped<TransposeLHS, TransposeRHS>(
+        lhs_gpu, rhs_gpu, out_gpu, problems_gpu, params, backend);
+    ASSERT_EQ(sycldnn::StatusCode::OK, status.status);
+    status.event.wait_and_throw();
+
+    provider.copy_device_data_to_host(out_size, out_gpu, output);
+    for (int i = 0; i < out_size; ++i) {
+      SCOPED_TRACE("Element: " + std::to_string(i));
+      EXPECT_FLOAT_EQ(expected[i], output[i]);
+    }
+
+    provider.deallocate_ptr(lhs_gpu);
+    provider.deallocate_ptr(rhs_gpu);
+    provider.deallocate_ptr(out_gpu);
+    provider.deallocate_ptr(problems_gpu);
+  }
+};
+
+using BackendTypeList = sycldnn::types::DefaultBackendTypes;
+using GTestTypeList = sycldnn::types::ToGTestTypes<BackendTypeList>::type;
+TYPED_TEST_SUITE(MatmulGroupedFixture, GTestTypeList);
+
+// Shapes with uneven splits, as in a grouped convolution, and problems which
+// cover several output blocks.
+std::vector<std::array<int, 3>> const mixed_shapes = {
+    {1, 1, 1}, {5, 7, 3}, {33, 16, 40}, {70, 12, 65}, {4, 1, 9}, {2, 64, 2}};
+
+TYPED_TEST(MatmulGroupedFixture, SingleProblem) {
+  this->template check_matches_reference<false, false>({{40, 20, 35}});
+}
+TYPED_TEST(MatmulGroupedFixture, MixedFalseFalse) {
+  this->template check_matches_reference<false, false>(mixed_shapes);
+}
+TYPED_TEST(MatmulGroupedFixture, MixedFalseTrue) {
+  this->template check_matches_reference<false, true>(mixed_shapes);
+}
+TYPED_TEST(MatmulGroupedFixture, MixedTrueFalse) {
+  this->template check_matches_reference<true, false>(mixed_shapes);
+}
+TYPED_TEST(MatmulGroupedFixture, MixedTrueTrue) {
+  this->template check_matches_reference<true, true>(mixed_shapes);
+}
+TYPED_TEST(MatmulGroupedFixture, AlphaBeta) {
+  this->template check_matches_reference<false, false>(mixed_shapes, 0.5f,
+                                                       2.f);
+}
+// Ragged sequence lengths, as in attention over a batch of sequences.
+TYPED_TEST(MatmulGroupedFixture, ManyProblems) {
+  std::vector<std::array<int, 3>> shapes;
+  for (int i = 1; i <= 40; ++i) {
+    shapes.push_back({i, 8, i});
+  }
+  this->template check_matches_reference<false, true>(shapes);
+}
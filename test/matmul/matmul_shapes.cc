@@ -0,0 +1,148 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "test/gen/iota_initialised_data.h"
+#include "test/matmul/fixture.h"
+#include "test/types/cartesian_product.h"
+#include "test/types/kernel_data_types.h"
+#include "test/types/test_backend_types.h"
+#include "test/types/to_gtest_types.h"
+
+/**
+ * Tests for matrix multiplies with shapes chosen to exercise each of the
+ * kernel configurations that the matmul launcher chooses between, including
+ * the matrix-vector kernels used when m or n is one.
+ */
+
+using DataTypeList = sycldnn::types::KernelDataTypes;
+using BackendTypeList = sycldnn::types::DefaultBackendTypes;
+using TypePairList =
+    sycldnn::types::CartesianProduct<DataTypeList, BackendTypeList>::type;
+using GTestTypeList = sycldnn::types::ToGTestTypes<TypePairList>::type;
+
+template <typename Pair, bool TransposeLhs, bool TransposeRhs>
+struct MatmulShapeFixture
+    : public MatmulFixture<Pair, TransposeLhs, TransposeRhs> {
+  using DataType = typename Pair::FirstType;
+
+ protected:
+  /** Compare the matmul against a reference computed on the host. */
+  void test_shape(int batches, int m, int k, int n, DataType max_val = 4,
+                  bool use_workspace = false) {
+    auto lhs = iota_initialised_data(batches * m * k, max_val);
+    auto rhs = iota_initialised_data(batches * k * n, max_val);
+    std::vector<DataType> exp(batches * m * n);
+    for (int b = 0; b < batches; ++b) {
+      for (int row = 0; row < m; ++row) {
+        for (int col = 0; col < n; ++col) {
+          DataType sum = 0;
+          for (int acc = 0; acc < k; ++acc) {
+            auto lhs_idx = TransposeLhs ? acc * m + row : row * k + acc;
+            auto rhs_idx = TransposeRhs ? col * k + acc : acc * n + col;
+            sum += lhs[b * m * k + lhs_idx] * rhs[b * k * n + rhs_idx];
+          }
+          exp[(b * m + row) * n + col] = sum;
+        }
+      }
+    }
+    this->run(exp, batches, m, k, n, static_cast<DataType>(0), 0, 0, 0,
+              max_val, use_workspace);
+  }
+};
+
+template <typename Pair>
+using MatmulShapesFalseFalse = MatmulShapeFixture<Pair, false, false>;
+TYPED_TEST_SUITE(MatmulShapesFalseFalse, GTestTypeList);
+
+template <typename Pair>
+using MatmulShapesTrueTrue = MatmulShapeFixture<Pair, true, true>;
+TYPED_TEST_SUITE(MatmulShapesTrueTrue, GTestTypeList);
+
+TYPED_TEST(MatmulShapesFalseFalse, SingleRow) {
+  this->test_shape(1, 1, 64, 100);
+}
+TYPED_TEST(MatmulShapesFalseFalse, FewRows) { this->test_shape(2, 3, 19, 33); }
+TYPED_TEST(MatmulShapesFalseFalse, ManyRows) {
+  this->test_shape(1, 1030, 16, 68);
+}
+TYPED_TEST(MatmulShapesFalseFalse, SmallBatched) {
+  this->test_shape(16, 12, 8, 20);
+}
+TYPED_TEST(MatmulShapesFalseFalse, LocalBlocks) {
+  this->test_shape(1, 128, 64, 96);
+}
+TYPED_TEST(MatmulShapesFalseFalse, LocalPartialBlocks) {
+  this->test_shape(2, 70, 40, 65);
+}
+// The large shared dimensions use values of one so that every partial sum is
+// exactly representable, whatever order they are computed in.
+TYPED_TEST(MatmulShapesFalseFalse, SplitK) {
+  this->test_shape(1, 1, 1024, 24, 1);
+}
+TYPED_TEST(MatmulShapesFalseFalse, SplitKBatched) {
+  this->test_shape(2, 5, 1030, 9, 1);
+}
+TYPED_TEST(MatmulShapesFalseFalse, SplitKWorkspace) {
+  this->test_shape(2, 5, 1030, 9, 1, true);
+}
+TYPED_TEST(MatmulShapesFalseFalse, GemvRowVector) {
+  this->test_shape(1, 1, 96, 70);
+}
+TYPED_TEST(MatmulShapesFalseFalse, GemvColumnVector) {
+  this->test_shape(3, 45, 80, 1);
+}
+TYPED_TEST(MatmulShapesFalseFalse, GemvDot) { this->test_shape(2, 1, 100, 1); }
+TYPED_TEST(MatmulShapesFalseFalse, GemvLargeK) {
+  this->test_shape(1, 1, 1500, 130, 1);
+}
+
+TYPED_TEST(MatmulShapesTrueTrue, SingleRow) { this->test_shape(1, 1, 64, 100); }
+TYPED_TEST(MatmulShapesTrueTrue, FewRows) { this->test_shape(2, 3, 19, 33); }
+TYPED_TEST(MatmulShapesTrueTrue, ManyRows) {
+  this->test_shape(1, 1030, 16, 68);
+}
+TYPED_TEST(MatmulShapesTrueTrue, SmallBatched) {
+  this->test_shape(16, 12, 8, 20);
+}
+TYPED_TEST(MatmulShapesTrueTrue, LocalBlocks) {
+  this->test_shape(1, 128, 64, 96);
+}
+TYPED_TEST(MatmulShapesTrueTrue, LocalPartialBlocks) {
+  this->test_shape(2, 70, 40, 65);
+}
+// The large shared dimensions use values of one so that every partial sum is
+// exactly representable, whatever order they are computed in.
+TYPED_TEST(MatmulShapesTrueTrue, SplitK) {
+  this->test_shape(1, 1, 1024, 24, 1);
+}
+TYPED_TEST(MatmulShapesTrueTrue, SplitKBatched) {
+  this->test_shape(2, 5, 1030, 9, 1);
+}
+TYPED_TEST(MatmulShapesTrueTrue, SplitKWorkspace) {
+  this->test_shape(2, 5, 1030, 9, 1, true);
+}
+TYPED_TEST(MatmulShapesTrueTrue, GemvRowVector) {
+  this->test_shape(1, 1, 96, 70);
+}
+TYPED_TEST(MatmulShapesTrueTrue, GemvColumnVector) {
+  this->test_shape(3, 45, 80, 1);
+}
+TYPED_TEST(MatmulShapesTrueTrue, GemvDot) { this->test_shape(2, 1, 100, 1); }
+TYPED_TEST(MatmulShapesTrueTrue, GemvLargeK) {
+  this->test_shape(1, 1, 1500, 130, 1);
+}
@@ -0,0 +1,180 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "tools/memory_planner.h"
+
+#include <stddef.h>
+#include <vector>
+
+namespace {
+
+// Checks that each layer's slab can hold its output, and that planning never
+// uses more memory than giving every layer output its own allocation.
+void check_slabs(sycldnn::MemoryPlanner const& planner,
+                 std::vector<size_t> const& sizes) {
+  ASSERT_TRUE(planner.is_planned());
+  ASSERT_EQ(sizes.size(), planner.get_num_layers());
+  auto const& slab_sizes = planner.get_slab_sizes();
+  for (size_t layer = 0; layer < sizes.size(); ++layer) {
+    ASSERT_LT(planner.get_slab(layer), slab_sizes.size());
+    EXPECT_LE(sizes[layer], slab_sizes[planner.get_slab(layer)]);
+  }
+  EXPECT_LE(planner.get_planned_size(), planner.get_unplanned_size());
+}
+
+}  // namespace
+
+TEST(MemoryPlanner, LinearChainReusesSlabs) {
+  std::vector<size_t> const sizes = {10, 20, 10, 5};
+  sycldnn::MemoryPlanner planner;
+  planner.add_layer(sizes[0], {}, false);
+  planner.add_layer(sizes[1], {0}, false);
+  planner.add_layer(sizes[2], {1}, false);
+  planner.add_layer(sizes[3], {2}, false);
+  planner.plan();
+  check_slabs(planner, sizes);
+
+  // Each layer only needs its input and output, so two slabs alternate.
+  EXPECT_EQ(2u, planner.get_slab_sizes().size());
+  EXPECT_NE(planner.get_slab(0), planner.get_slab(1));
+  EXPECT_EQ(planner.get_slab(0), planner.get_slab(2));
+  EXPECT_EQ(planner.get_slab(1), planner.get_slab(3));
+  EXPECT_EQ(30u, planner.get_planned_size());
+  EXPECT_EQ(45u, planner.get_unplanned_size());
+  for (size_t layer = 0; layer < sizes.size(); ++layer) {
+    EXPECT_FALSE(planner.runs_in_place(layer));
+  }
+}
+
+TEST(MemoryPlanner, InPlaceLayersChain) {
+  // A convolution followed by a bias-add and an activation, which both write
+  // over their input.
+  std::vector<size_t> const sizes = {10, 10, 10, 10};
+  sycldnn::MemoryPlanner planner;
+  planner.add_layer(sizes[0], {}, false);
+  planner.add_layer(sizes[1], {0}, true);
+  planner.add_layer(sizes[2], {1}, true);
+  planner.add_layer(sizes[3], {2}, false);
+  planner.plan();
+  check_slabs(planner, sizes);
+
+  EXPECT_FALSE(planner.runs_in_place(0));
+  EXPECT_TRUE(planner.runs_in_place(1));
+  EXPECT_TRUE(planner.runs_in_place(2));
+  EXPECT_FALSE(planner.runs_in_place(3));
+  EXPECT_EQ(planner.get_slab(0), planner.get_slab(1));
+  EXPECT_EQ(planner.get_slab(0), planner.get_slab(2));
+  EXPECT_NE(planner.get_slab(2), planner.get_slab(3));
+  EXPECT_EQ(20u, planner.get_planned_size());
+}
+
+TEST(MemoryPlanner, ResidualAddAliasesDyingInput) {
+  // A residual block whose reference output is also read by a projection
+  // after the addition, so only the block output can be overwritten.
+  std::vector<size_t> const sizes = {10, 10, 10, 10, 10};
+  size_t const ref = 0;
+  sycldnn::MemoryPlanner planner;
+  planner.add_layer(sizes[0], {}, false);
+  planner.add_layer(sizes[1], {ref}, false);
+  size_t const prev = planner.add_layer(sizes[2], {1}, false);
+  size_t const add = planner.add_layer(sizes[3], {ref, prev}, true);
+  planner.add_layer(sizes[4], {ref, add}, false);
+  planner.plan();
+  check_slabs(planner, sizes);
+
+  EXPECT_TRUE(planner.runs_in_place(add));
+  EXPECT_EQ(planner.get_slab(prev), planner.get_slab(add));
+  EXPECT_NE(planner.get_slab(ref), planner.get_slab(add));
+}
+
+TEST(MemoryPlanner, ResidualAddAliasesReference) {
+  // The usual ResNet residual addition, where the reference output is not
+  // read after the addition but the block output is.
+  std::vector<size_t> const sizes = {10, 10, 10, 10, 10};
+  size_t const ref = 0;
+  sycldnn::MemoryPlanner planner;
+  planner.add_layer(sizes[0], {}, false);
+  planner.add_layer(sizes[1], {ref}, false);
+  size_t const prev = planner.add_layer(sizes[2], {1}, false);
+  size_t const add = planner.add_layer(sizes[3], {ref, prev}, true);
+  planner.add_layer(sizes[4], {prev, add}, false);
+  planner.plan();
+  check_slabs(planner, sizes);
+
+  EXPECT_TRUE(planner.runs_in_place(add));
+  EXPECT_EQ(planner.get_slab(ref), planner.get_slab(add));
+  EXPECT_NE(planner.get_slab(prev), planner.get_slab(add));
+}
+
+TEST(MemoryPlanner, InputReadLaterIsNotAliased) {
+  // The activation's input has the same size as its output, but is read by
+  // the next layer as well, so must not be overwritten.
+  std::vector<size_t> const sizes = {10, 10, 10};
+  sycldnn::MemoryPlanner planner;
+  planner.add_layer(sizes[0], {}, false);
+  size_t const act = planner.add_layer(sizes[1], {0}, true);
+  planner.add_layer(sizes[2], {0, act}, false);
+  planner.plan();
+  check_slabs(planner, sizes);
+
+  EXPECT_FALSE(planner.runs_in_place(act));
+  EXPECT_NE(planner.get_slab(0), planner.get_slab(act));
+  EXPECT_NE(planner.get_slab(0), planner.get_slab(2));
+  EXPECT_NE(planner.get_slab(act), planner.get_slab(2));
+}
+
+TEST(MemoryPlanner, DifferentSizedInputIsNotAliased) {
+  std::vector<size_t> const sizes = {20, 10};
+  sycldnn::MemoryPlanner planner;
+  planner.add_layer(sizes[0], {}, false);
+  planner.add_layer(sizes[1], {0}, true);
+  planner.plan();
+  check_slabs(planner, sizes);
+
+  EXPECT_FALSE(planner.runs_in_place(1));
+  EXPECT_NE(planner.get_slab(0), planner.get_slab(1));
+}
+
+TEST(MemoryPlanner, FinalOutputIsKeptLive) {
+  // The outputs of layers 1 and 3 are never read. The slab of layer 1 is
+  // reused as soon as it has been written, but the final output is kept so
+  // that it can be copied back, so no other output is written over it.
+  std::vector<size_t> const sizes = {10, 10, 10, 10};
+  sycldnn::MemoryPlanner planner;
+  planner.add_layer(sizes[0], {}, false);
+  planner.add_layer(sizes[1], {0}, false);
+  planner.add_layer(sizes[2], {0}, false);
+  size_t const last = planner.add_layer(sizes[3], {2}, false);
+  planner.plan();
+  check_slabs(planner, sizes);
+
+  EXPECT_EQ(planner.get_slab(1), planner.get_slab(2));
+  EXPECT_EQ(planner.get_slab(0), planner.get_slab(last));
+  EXPECT_NE(planner.get_slab(2), planner.get_slab(last));
+  EXPECT_EQ(2u, planner.get_slab_sizes().size());
+}
+
+TEST(MemoryPlanner, AddingLayerRequiresReplanning) {
+  sycldnn::MemoryPlanner planner;
+  planner.add_layer(10, {}, false);
+  planner.plan();
+  EXPECT_TRUE(planner.is_planned());
+  planner.add_layer(10, {0}, false);
+  EXPECT_FALSE(planner.is_planned());
+  planner.plan();
+  check_slabs(planner, {10, 10});
+}
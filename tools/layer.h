@@ -32,9 +32,12 @@
 
 #include "sycldnn/batchnorm/launch.h"
 
+#include "sycldnn/matmul/epilogue.h"
 #include "sycldnn/matmul/launch.h"
 #include "sycldnn/matmul/params.h"
 
+#include "sycldnn/backend/backend_helpers.h"
+
 #include "sycldnn/softmax/launch.h"
 #include "sycldnn/softmax/sizes.h"
 
@@ -43,6 +46,8 @@
 
 #include <CL/sycl.hpp>
 
+#include <vector>
+
 namespace sycldnn {
 
 // Base class of all layer types to present unified interface and construction
@@ -57,6 +62,14 @@ struct Layer {
   virtual DeviceMem get_output() = 0;
   virtual size_t get_output_size() const = 0;
   virtual sycldnn::SNNStatus run() = 0;
+
+  // Rebinds the activations read by the layer, in the order the producing
+  // layers were given to Network::add_layer.
+  virtual void set_inputs(std::vector<DeviceMem> const& inputs) = 0;
+  virtual void set_output(DeviceMem output) = 0;
+
+  // Whether the layer's output may be written over an input of the same size.
+  virtual bool can_run_in_place() const { return false; }
 };
 
 template <typename DType, typename Backend>
@@ -88,6 +101,10 @@ struct ConvolutionLayer : Layer<DType, Backend> {
         selector_{selector} {}
 
   DeviceMem get_output() override { return output_; }
+  void set_inputs(std::vector<DeviceMem> const& inputs) override {
+    input_ = inputs.at(0);
+  }
+  void set_output(DeviceMem output) override { output_ = output; }
   size_t get_output_size() const override { return sizes_.output_size; }
 
   sycldnn::SNNStatus run() override {
@@ -114,6 +131,15 @@ struct BiasAddLayer : Layer<DType, Backend> {
         output_{output} {}
 
   DeviceMem get_output() override { return output_; }
+  void set_inputs(std::vector<DeviceMem> const& inputs) override {
+    input_ = inputs.at(0);
+    // A residual connection reads a second activation in place of the bias.
+    if (inputs.size() > 1) {
+      biases_ = inputs[1];
+    }
+  }
+  void set_output(DeviceMem output) override { output_ = output; }
+  bool can_run_in_place() const override { return true; }
   size_t get_output_size() const override {
     return helpers::get_total_size(params_.lhs_dims);
   }
@@ -153,6 +179,10 @@ struct BatchNormTrainingLayer : Layer<DType, Backend> {
         output_{output} {}
 
   DeviceMem get_output() override { return output_; }
+  void set_inputs(std::vector<DeviceMem> const& inputs) override {
+    input_ = inputs.at(0);
+  }
+  void set_output(DeviceMem output) override { output_ = output; }
   size_t get_output_size() const override {
     return params_.batch * params_.rows * params_.cols * params_.channels;
   }
@@ -190,6 +220,10 @@ struct BatchNormFrozenLayer : Layer<DType, Backend> {
         output_{output} {}
 
   DeviceMem get_output() override { return output_; }
+  void set_inputs(std::vector<DeviceMem> const& inputs) override {
+    input_ = inputs.at(0);
+  }
+  void set_output(DeviceMem output) override { output_ = output; }
   size_t get_output_size() const override {
     return params_.batch * params_.rows * params_.cols * params_.channels;
   }
@@ -218,6 +252,11 @@ struct ActivationLayer : Layer<DType, Backend> {
         output_{output} {}
 
   DeviceMem get_output() override { return output_; }
+  void set_inputs(std::vector<DeviceMem> const& inputs) override {
+    input_ = inputs.at(0);
+  }
+  void set_output(DeviceMem output) override { output_ = output; }
+  bool can_run_in_place() const override { return true; }
   size_t get_output_size() const override { return params_.size; }
 
   sycldnn::SNNStatus run() override {
@@ -245,6 +284,10 @@ struct PoolingLayer : Layer<DType, Backend> {
         output_{output} {}
 
   DeviceMem get_output() override { return output_; }
+  void set_inputs(std::vector<DeviceMem> const& inputs) override {
+    input_ = inputs.at(0);
+  }
+  void set_output(DeviceMem output) override { output_ = output; }
   size_t get_output_size() const override { return sizes_.output_size; }
 
   sycldnn::SNNStatus run() override {
@@ -254,30 +297,55 @@ struct PoolingLayer : Layer<DType, Backend> {
   }
 };
 
+// Fully connected layer. The epilogue can add a bias and apply an activation
+// in the matmul's output stage, rather than in separate layers, if the backend
+// supports it.
 template <typename DType, typename Backend>
 struct FCLayer : Layer<DType, Backend> {
   using DeviceMem = typename Backend::template pointer_type<DType>;
+  using Epilogue = sycldnn::matmul::Epilogue<DType, Backend>;
   sycldnn::matmul::MatmulParams params_;
   DeviceMem input_;
   DeviceMem weights_;
   DeviceMem output_;
+  Epilogue epilogue_;
 
   FCLayer(sycldnn::matmul::MatmulParams const& p, DeviceMem const input,
-          DeviceMem const weights, DeviceMem output, Backend& b)
+          DeviceMem const weights, DeviceMem output, Backend& b,
+          Epilogue const& epilogue = {})
       : Layer<DType, Backend>(b),
         params_(p),
         input_{input},
         weights_{weights},
-        output_{output} {}
+        output_{output},
+        epilogue_{epilogue} {}
 
   DeviceMem get_output() override { return output_; }
+  void set_inputs(std::vector<DeviceMem> const& inputs) override {
+    input_ = inputs.at(0);
+  }
+  void set_output(DeviceMem output) override { output_ = output; }
   size_t get_output_size() const override { return params_.n; }
   sycldnn::SNNStatus run() override {
     using ConstPointer = typename Backend::template pointer_type<DType const>;
-    return {this->backend_.template matmul<false, false>(
-                ConstPointer{input_}, ConstPointer{weights_}, output_,
-                params_.beta, params_.m, params_.k, params_.n),
-            sycldnn::StatusCode::OK};
+    if constexpr (backend::supports_matmul_epilogue<Backend>::value) {
+      return {this->backend_.template matmul<false, false>(
+                  ConstPointer{input_}, ConstPointer{weights_}, output_,
+                  static_cast<DType>(params_.alpha),
+                  static_cast<DType>(params_.beta), params_.m, params_.k,
+                  params_.n, epilogue_),
+              sycldnn::StatusCode::OK};
+    } else {
+      SNN_VALIDATE_PARAM(params_.alpha == 1.f,
+                         "The backend does not support scaling the product.");
+      SNN_VALIDATE_PARAM(
+          sycldnn::matmul::is_identity(epilogue_.get_params()),
+          "The backend does not support a fully connected epilogue.");
+      return {this->backend_.template matmul<false, false>(
+                  ConstPointer{input_}, ConstPointer{weights_}, output_,
+                  params_.beta, params_.m, params_.k, params_.n),
+              sycldnn::StatusCode::OK};
+    }
   }
 };
 
@@ -301,6 +369,10 @@ struct SoftmaxLayer : Layer<DType, Backend> {
         output_{output} {}
 
   DeviceMem get_output() override { return output_; }
+  void set_inputs(std::vector<DeviceMem> const& inputs) override {
+    input_ = inputs.at(0);
+  }
+  void set_output(DeviceMem output) override { output_ = output; }
   size_t get_output_size() const override { return sizes_.output_size; }
 
   sycldnn::SNNStatus run() override {
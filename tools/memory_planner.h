@@ -0,0 +1,192 @@
+/*
+ * Copyright Codeplay Software Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+namespace sycldnn {
+
+// Plans the storage of the outputs of a sequence of layers. Each layer output
+// is live from the layer which produces it to the last layer which reads it,
+// and outputs with disjoint live intervals are assigned to the same slab of
+// memory. Layers which can run in place write their output over an input
+// which is not read again, so the two share storage.
+class MemoryPlanner {
+  struct Value {
+    size_t start;
+    size_t end;
+    size_t size;
+  };
+
+  struct Slab {
+    size_t size;
+    size_t free_after;
+  };
+
+  static constexpr size_t live_to_end = std::numeric_limits<size_t>::max();
+
+  // Number of elements in each layer's output
+  std::vector<size_t> sizes_;
+  // Layers whose outputs are read by each layer
+  std::vector<std::vector<size_t>> inputs_;
+  // Last layer to read each layer's output
+  std::vector<size_t> last_use_;
+  // Whether each layer may write its output over one of its inputs
+  std::vector<bool> in_place_;
+  // Layer which owns the storage each layer writes its output to
+  std::vector<size_t> storage_;
+  // Slab each layer's output is assigned to
+  std::vector<size_t> slab_of_;
+  std::vector<size_t> slab_sizes_;
+  bool planned_;
+
+ public:
+  MemoryPlanner()
+      : sizes_{},
+        inputs_{},
+        last_use_{},
+        in_place_{},
+        storage_{},
+        slab_of_{},
+        slab_sizes_{},
+        planned_{false} {}
+
+  // Records a layer producing size elements from the outputs of the earlier
+  // layers given in inputs, and returns the index of the layer.
+  size_t add_layer(size_t size, std::vector<size_t> const& inputs,
+                   bool in_place) {
+    size_t const index = sizes_.size();
+    for (auto input : inputs) {
+      assert(input < index && "Layers can only read earlier layers' outputs");
+      last_use_[input] = std::max(last_use_[input], index);
+    }
+    sizes_.push_back(size);
+    inputs_.push_back(inputs);
+    last_use_.push_back(index);
+    in_place_.push_back(in_place);
+    planned_ = false;
+    return index;
+  }
+
+  // Assigns every layer output to a slab. The output of the final layer is
+  // kept live after the network has run, so that it can be read back.
+  void plan() {
+    size_t const n_layers = sizes_.size();
+    storage_.resize(n_layers);
+    std::vector<Value> values;
+    std::vector<size_t> value_of(n_layers);
+    for (size_t layer = 0; layer < n_layers; ++layer) {
+      size_t const end =
+          layer + 1 == n_layers ? live_to_end : last_use_[layer];
+      storage_[layer] = layer;
+      if (in_place_[layer]) {
+        for (auto input : inputs_[layer]) {
+          auto& value = values[value_of[input]];
+          if (value.end == layer && value.size == sizes_[layer]) {
+            storage_[layer] = storage_[input];
+            value_of[layer] = value_of[input];
+            value.end = end;
+            break;
+          }
+        }
+      }
+      if (storage_[layer] == layer) {
+        value_of[layer] = values.size();
+        values.push_back({layer, end, sizes_[layer]});
+      }
+    }
+
+    // Values are created in order of their start, so colouring them in order
+    // frees each slab as soon as the value using it is dead.
+    std::vector<Slab> slabs;
+    std::vector<size_t> slab_of_value(values.size());
+    for (size_t i = 0; i < values.size(); ++i) {
+      auto const& value = values[i];
+      size_t best = slabs.size();
+      for (size_t slab = 0; slab < slabs.size(); ++slab) {
+        if (slabs[slab].free_after >= value.start) {
+          continue;
+        }
+        if (best == slabs.size()) {
+          best = slab;
+          continue;
+        }
+        bool const fits = slabs[slab].size >= value.size;
+        bool const best_fits = slabs[best].size >= value.size;
+        // Prefer the smallest slab which fits, otherwise the largest slab so
+        // that it grows as little as possible.
+        if ((fits && (!best_fits || slabs[slab].size < slabs[best].size)) ||
+            (!fits && !best_fits && slabs[slab].size > slabs[best].size)) {
+          best = slab;
+        }
+      }
+      if (best == slabs.size()) {
+        slabs.push_back({value.size, value.end});
+      } else {
+        slabs[best].size = std::max(slabs[best].size, value.size);
+        slabs[best].free_after = value.end;
+      }
+      slab_of_value[i] = best;
+    }
+
+    slab_of_.resize(n_layers);
+    for (size_t layer = 0; layer < n_layers; ++layer) {
+      slab_of_[layer] = slab_of_value[value_of[layer]];
+    }
+    slab_sizes_.clear();
+    for (auto const& slab : slabs) {
+      slab_sizes_.push_back(slab.size);
+    }
+    planned_ = true;
+  }
+
+  bool is_planned() const { return planned_; }
+
+  size_t get_num_layers() const { return sizes_.size(); }
+
+  std::vector<size_t> const& get_inputs(size_t layer) const {
+    return inputs_[layer];
+  }
+
+  // Whether the layer writes its output over the output of an earlier layer.
+  bool runs_in_place(size_t layer) const { return storage_[layer] != layer; }
+
+  size_t get_slab(size_t layer) const { return slab_of_[layer]; }
+
+  std::vector<size_t> const& get_slab_sizes() const { return slab_sizes_; }
+
+  // Total number of elements in the planned slabs.
+  size_t get_planned_size() const {
+    size_t total = 0;
+    for (auto size : slab_sizes_) {
+      total += size;
+    }
+    return total;
+  }
+
+  // Total number of elements if every layer output had its own allocation.
+  size_t get_unplanned_size() const {
+    size_t total = 0;
+    for (auto size : sizes_) {
+      total += size;
+    }
+    return total;
+  }
+};
+}  // namespace sycldnn
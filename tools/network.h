@@ -15,9 +15,12 @@
  */
 
 #include "tools/layer.h"
+#include "tools/memory_planner.h"
 
 #include <CL/sycl.hpp>
 
+#include <vector>
+
 namespace sycldnn {
 template <typename DType, typename Backend>
 class Network {
@@ -25,16 +28,66 @@ class Network {
   std::vector<std::unique_ptr<Layer<DType, Backend>>> network_;
   std::vector<DType>& output_;
   Backend& backend_;
+  MemoryPlanner planner_;
+  std::vector<DeviceMem> slabs_;
 
  public:
   Network(Backend& backend, std::vector<DType>& output)
-      : network_{}, output_{output}, backend_{backend} {}
+      : network_{}, output_{output}, backend_{backend}, planner_{}, slabs_{} {}
+
+  ~Network() { release_slabs(); }
+
+  // Layers are their own types, number of parameters differs between each.
+  // The layer reads the output of the previously added layer, or the input it
+  // was constructed with if it is the first layer.
+  void add_layer(Layer<DType, Backend>* layer) {
+    std::vector<size_t> inputs;
+    if (!network_.empty()) {
+      inputs.push_back(network_.size() - 1);
+    }
+    add_layer(layer, inputs);
+  }
+
+  // Adds a layer which reads the outputs of the given earlier layers, such as
+  // a residual connection. With no inputs the layer reads the input it was
+  // constructed with.
+  void add_layer(Layer<DType, Backend>* layer,
+                 std::vector<size_t> const& inputs) {
+    network_.emplace_back(layer);
+    planner_.add_layer(layer->get_output_size(), inputs,
+                       layer->can_run_in_place());
+  }
 
-  // Layers are their own types, number of parameters differs between each
-  void add_layer(Layer<DType, Backend>* layer) { network_.emplace_back(layer); }
+  // Allocates the memory for the layer outputs, reusing memory once the
+  // outputs stored in it are no longer read, and binds it to the layers. This
+  // is done before the network is first run, so it only needs to be called
+  // directly to query the planned memory. Only the output of the final layer
+  // is kept after the network has run. Planning again frees the memory of the
+  // previous plan.
+  void plan_memory() {
+    planner_.plan();
+    release_slabs();
+    for (auto size : planner_.get_slab_sizes()) {
+      slabs_.push_back(backend_.template allocate<DType>(size));
+    }
+    for (size_t i = 0; i < network_.size(); ++i) {
+      network_[i]->set_output(slabs_[planner_.get_slab(i)]);
+      auto const& inputs = planner_.get_inputs(i);
+      if (!inputs.empty()) {
+        std::vector<DeviceMem> input_mem;
+        for (auto input : inputs) {
+          input_mem.push_back(network_[input]->get_output());
+        }
+        network_[i]->set_inputs(input_mem);
+      }
+    }
+  }
 
   // Runs each layer, checks for exceptions after every layer
   sycldnn::SNNStatus test() {
+    if (!planner_.is_planned()) {
+      plan_memory();
+    }
     sycldnn::SNNStatus status;
     for (auto& layer : network_) {
       status = layer->run();
@@ -44,6 +97,9 @@ class Network {
   }
 
   sycldnn::SNNStatus run() {
+    if (!planner_.is_planned()) {
+      plan_memory();
+    }
     sycldnn::SNNStatus status;
     for (auto& layer : network_) {
       status = layer->run();
@@ -61,19 +117,56 @@ class Network {
 
   size_t get_output_size() const { return network_.back()->get_output_size(); }
 
+  // Number of bytes allocated for the layer outputs once memory is planned.
+  size_t get_planned_memory() const {
+    return planner_.get_planned_size() * sizeof(DType);
+  }
+
+  // Number of bytes needed if every layer output had its own allocation.
+  size_t get_unplanned_memory() const {
+    return planner_.get_unplanned_size() * sizeof(DType);
+  }
+
+  // Number of layers which write their output over one of their inputs.
+  size_t get_num_in_place_layers() const {
+    size_t count = 0;
+    if (!planner_.is_planned()) {
+      return count;
+    }
+    for (size_t i = 0; i < network_.size(); ++i) {
+      count += planner_.runs_in_place(i) ? 1 : 0;
+    }
+    return count;
+  }
+
   sycldnn::SNNStatus dump_network_output() {
     DeviceMem out = this->get_output();
     auto count = this->get_output_size();
     output_.resize(count);
 
+    // The output may only use the start of a larger slab of memory.
     auto buf_out = out.get_buffer();
     auto event = backend_.get_queue().submit([&](cl::sycl::handler& cgh) {
-      auto acc_out =
-          buf_out.template get_access<cl::sycl::access::mode::read>(cgh);
+      auto acc_out = buf_out.template get_access<cl::sycl::access::mode::read>(
+          cgh, cl::sycl::range<1>{count}, cl::sycl::id<1>{out.get_offset()});
 
       cgh.copy(acc_out, output_.data());
     });
     return {event, sycldnn::StatusCode::OK};
   }
+
+ private:
+  // Frees the memory of any previous plan, once the layers which may still be
+  // using it have finished running.
+  void release_slabs() {
+    if (slabs_.empty()) {
+      return;
+    }
+    backend_.get_queue().wait_and_throw();
+    for (auto slab : slabs_) {
+      backend_.template deallocate<DType>(slab);
+    }
+    slabs_.clear();
+  }
 };
 }  // namespace sycldnn